@@ -0,0 +1,142 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/tests/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Arena.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Binary.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Biquad.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Bits.dir/DependInfo.cmake"
+  "tests/CMakeFiles/BlockFloat.dir/DependInfo.cmake"
+  "tests/CMakeFiles/CIC.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Ceil.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Classic.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Complex.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Constexpr.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Conversion.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Cordic.dir/DependInfo.cmake"
+  "tests/CMakeFiles/DoubleConversion.dir/DependInfo.cmake"
+  "tests/CMakeFiles/DynFixed.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Explore.dir/DependInfo.cmake"
+  "tests/CMakeFiles/FFT.dir/DependInfo.cmake"
+  "tests/CMakeFiles/FIR.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Fix.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Floor.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Llr.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Lut.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Matrix.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NCO.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NN.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NearEven.dir/DependInfo.cmake"
+  "tests/CMakeFiles/NearOdd.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Newton.dir/DependInfo.cmake"
+  "tests/CMakeFiles/OverflowDetector.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Polar.dir/DependInfo.cmake"
+  "tests/CMakeFiles/QR.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Statistics.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Sticky.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StringConversion.dir/DependInfo.cmake"
+  "tests/CMakeFiles/StringMath.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Tables.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Tracked.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Undefined.dir/DependInfo.cmake"
+  "tests/CMakeFiles/Viterbi.dir/DependInfo.cmake"
+  "tests/CMakeFiles/construction8.dir/DependInfo.cmake"
+  "tests/CMakeFiles/construction_d1.dir/DependInfo.cmake"
+  "tests/CMakeFiles/construction_eq.dir/DependInfo.cmake"
+  "tests/CMakeFiles/construction.dir/DependInfo.cmake"
+  "tests/CMakeFiles/fixed_t7.dir/DependInfo.cmake"
+  "tests/CMakeFiles/fixed_t.dir/DependInfo.cmake"
+  "tests/CMakeFiles/issue_26.dir/DependInfo.cmake"
+  "tests/CMakeFiles/min_max.dir/DependInfo.cmake"
+  "tests/CMakeFiles/min_max_val.dir/DependInfo.cmake"
+  "tests/CMakeFiles/negation.dir/DependInfo.cmake"
+  "tests/CMakeFiles/parsing.dir/DependInfo.cmake"
+  "tests/CMakeFiles/to_type.dir/DependInfo.cmake"
+  "tests/CMakeFiles/u_construction.dir/DependInfo.cmake"
+  "tests/CMakeFiles/ufixed_t.dir/DependInfo.cmake"
+  "tests/CMakeFiles/w_eq_f.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "Arena"
+  "Arena.pdb"
+  "CMakeFiles/Arena.dir/Arena_test.cpp.o"
+  "CMakeFiles/Arena.dir/Arena_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Arena.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
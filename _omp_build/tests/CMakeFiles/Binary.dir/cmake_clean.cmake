@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "Binary"
+  "Binary.pdb"
+  "CMakeFiles/Binary.dir/Binary_test.cpp.o"
+  "CMakeFiles/Binary.dir/Binary_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Binary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
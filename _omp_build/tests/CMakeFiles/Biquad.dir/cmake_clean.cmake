@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "Biquad"
+  "Biquad.pdb"
+  "CMakeFiles/Biquad.dir/Biquad_test.cpp.o"
+  "CMakeFiles/Biquad.dir/Biquad_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Biquad.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "Bits"
+  "Bits.pdb"
+  "CMakeFiles/Bits.dir/Bits_test.cpp.o"
+  "CMakeFiles/Bits.dir/Bits_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Bits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BlockFloat"
+  "BlockFloat.pdb"
+  "CMakeFiles/BlockFloat.dir/BlockFloat_test.cpp.o"
+  "CMakeFiles/BlockFloat.dir/BlockFloat_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BlockFloat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CIC"
+  "CIC.pdb"
+  "CMakeFiles/CIC.dir/CIC_test.cpp.o"
+  "CMakeFiles/CIC.dir/CIC_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CIC.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Ceil.dir/Ceil_test.cpp.o"
+  "CMakeFiles/Ceil.dir/Ceil_test.cpp.o.d"
+  "Ceil"
+  "Ceil.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Ceil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
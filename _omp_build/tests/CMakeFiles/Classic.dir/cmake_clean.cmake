@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Classic.dir/Classic_test.cpp.o"
+  "CMakeFiles/Classic.dir/Classic_test.cpp.o.d"
+  "Classic"
+  "Classic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Classic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Complex.dir/Complex_test.cpp.o"
+  "CMakeFiles/Complex.dir/Complex_test.cpp.o.d"
+  "Complex"
+  "Complex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Complex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
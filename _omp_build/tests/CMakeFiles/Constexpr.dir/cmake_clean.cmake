@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Constexpr.dir/Constexpr_test.cpp.o"
+  "CMakeFiles/Constexpr.dir/Constexpr_test.cpp.o.d"
+  "Constexpr"
+  "Constexpr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Constexpr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Conversion.dir/Conversion_test.cpp.o"
+  "CMakeFiles/Conversion.dir/Conversion_test.cpp.o.d"
+  "Conversion"
+  "Conversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Conversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
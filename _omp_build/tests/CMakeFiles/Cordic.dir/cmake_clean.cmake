@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Cordic.dir/Cordic_test.cpp.o"
+  "CMakeFiles/Cordic.dir/Cordic_test.cpp.o.d"
+  "Cordic"
+  "Cordic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Cordic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
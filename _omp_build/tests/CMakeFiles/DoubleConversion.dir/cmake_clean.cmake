@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DoubleConversion.dir/DoubleConversion_test.cpp.o"
+  "CMakeFiles/DoubleConversion.dir/DoubleConversion_test.cpp.o.d"
+  "DoubleConversion"
+  "DoubleConversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DoubleConversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
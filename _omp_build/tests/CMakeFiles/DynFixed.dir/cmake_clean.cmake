@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DynFixed.dir/DynFixed_test.cpp.o"
+  "CMakeFiles/DynFixed.dir/DynFixed_test.cpp.o.d"
+  "DynFixed"
+  "DynFixed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DynFixed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Explore.dir/Explore_test.cpp.o"
+  "CMakeFiles/Explore.dir/Explore_test.cpp.o.d"
+  "Explore"
+  "Explore.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Explore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
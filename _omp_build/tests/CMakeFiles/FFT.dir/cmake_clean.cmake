@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FFT.dir/FFT_test.cpp.o"
+  "CMakeFiles/FFT.dir/FFT_test.cpp.o.d"
+  "FFT"
+  "FFT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FFT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
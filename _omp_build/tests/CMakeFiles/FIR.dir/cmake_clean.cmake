@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FIR.dir/FIR_test.cpp.o"
+  "CMakeFiles/FIR.dir/FIR_test.cpp.o.d"
+  "FIR"
+  "FIR.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FIR.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Fix.dir/Fix_test.cpp.o"
+  "CMakeFiles/Fix.dir/Fix_test.cpp.o.d"
+  "Fix"
+  "Fix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Fix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
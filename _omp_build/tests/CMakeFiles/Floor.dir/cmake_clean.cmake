@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Floor.dir/Floor_test.cpp.o"
+  "CMakeFiles/Floor.dir/Floor_test.cpp.o.d"
+  "Floor"
+  "Floor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Floor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
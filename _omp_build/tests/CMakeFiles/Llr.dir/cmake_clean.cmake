@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Llr.dir/Llr_test.cpp.o"
+  "CMakeFiles/Llr.dir/Llr_test.cpp.o.d"
+  "Llr"
+  "Llr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Llr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
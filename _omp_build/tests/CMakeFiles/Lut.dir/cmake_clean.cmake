@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Lut.dir/Lut_test.cpp.o"
+  "CMakeFiles/Lut.dir/Lut_test.cpp.o.d"
+  "Lut"
+  "Lut.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Lut.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Matrix.dir/Matrix_test.cpp.o"
+  "CMakeFiles/Matrix.dir/Matrix_test.cpp.o.d"
+  "Matrix"
+  "Matrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NCO.dir/NCO_test.cpp.o"
+  "CMakeFiles/NCO.dir/NCO_test.cpp.o.d"
+  "NCO"
+  "NCO.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NCO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
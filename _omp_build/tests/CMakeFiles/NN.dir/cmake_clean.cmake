@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NN.dir/NN_test.cpp.o"
+  "CMakeFiles/NN.dir/NN_test.cpp.o.d"
+  "NN"
+  "NN.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NN.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
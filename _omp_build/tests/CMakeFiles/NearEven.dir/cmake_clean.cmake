@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NearEven.dir/NearEven_test.cpp.o"
+  "CMakeFiles/NearEven.dir/NearEven_test.cpp.o.d"
+  "NearEven"
+  "NearEven.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NearEven.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NearOdd.dir/NearOdd_test.cpp.o"
+  "CMakeFiles/NearOdd.dir/NearOdd_test.cpp.o.d"
+  "NearOdd"
+  "NearOdd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NearOdd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Newton.dir/Newton_test.cpp.o"
+  "CMakeFiles/Newton.dir/Newton_test.cpp.o.d"
+  "Newton"
+  "Newton.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Newton.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OverflowDetector.dir/OverflowDetector_test.cpp.o"
+  "CMakeFiles/OverflowDetector.dir/OverflowDetector_test.cpp.o.d"
+  "OverflowDetector"
+  "OverflowDetector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OverflowDetector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
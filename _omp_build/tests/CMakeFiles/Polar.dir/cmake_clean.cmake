@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Polar.dir/Polar_test.cpp.o"
+  "CMakeFiles/Polar.dir/Polar_test.cpp.o.d"
+  "Polar"
+  "Polar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Polar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/QR.dir/QR_test.cpp.o"
+  "CMakeFiles/QR.dir/QR_test.cpp.o.d"
+  "QR"
+  "QR.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/QR.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Statistics.dir/Statistics_test.cpp.o"
+  "CMakeFiles/Statistics.dir/Statistics_test.cpp.o.d"
+  "Statistics"
+  "Statistics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Statistics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
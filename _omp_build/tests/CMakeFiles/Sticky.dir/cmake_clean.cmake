@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Sticky.dir/Sticky_test.cpp.o"
+  "CMakeFiles/Sticky.dir/Sticky_test.cpp.o.d"
+  "Sticky"
+  "Sticky.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Sticky.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StringConversion.dir/StringConversion_test.cpp.o"
+  "CMakeFiles/StringConversion.dir/StringConversion_test.cpp.o.d"
+  "StringConversion"
+  "StringConversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StringConversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
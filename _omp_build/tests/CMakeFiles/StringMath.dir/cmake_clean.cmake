@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StringMath.dir/StringMath_test.cpp.o"
+  "CMakeFiles/StringMath.dir/StringMath_test.cpp.o.d"
+  "StringMath"
+  "StringMath.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StringMath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
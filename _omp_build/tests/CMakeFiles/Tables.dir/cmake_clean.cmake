@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tables.dir/Tables_test.cpp.o"
+  "CMakeFiles/Tables.dir/Tables_test.cpp.o.d"
+  "Tables"
+  "Tables.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
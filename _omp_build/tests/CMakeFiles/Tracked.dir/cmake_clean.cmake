@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tracked.dir/Tracked_test.cpp.o"
+  "CMakeFiles/Tracked.dir/Tracked_test.cpp.o.d"
+  "Tracked"
+  "Tracked.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tracked.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Undefined.dir/Undefined_test.cpp.o"
+  "CMakeFiles/Undefined.dir/Undefined_test.cpp.o.d"
+  "Undefined"
+  "Undefined.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Undefined.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
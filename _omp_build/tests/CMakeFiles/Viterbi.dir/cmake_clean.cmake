@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Viterbi.dir/Viterbi_test.cpp.o"
+  "CMakeFiles/Viterbi.dir/Viterbi_test.cpp.o.d"
+  "Viterbi"
+  "Viterbi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Viterbi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/construction8.dir/construction8_test.cpp.o"
+  "CMakeFiles/construction8.dir/construction8_test.cpp.o.d"
+  "construction8"
+  "construction8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/construction8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
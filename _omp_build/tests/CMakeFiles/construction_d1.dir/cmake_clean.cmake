@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/construction_d1.dir/construction_d1_test.cpp.o"
+  "CMakeFiles/construction_d1.dir/construction_d1_test.cpp.o.d"
+  "construction_d1"
+  "construction_d1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/construction_d1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
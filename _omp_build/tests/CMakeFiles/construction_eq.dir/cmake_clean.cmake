@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/construction_eq.dir/construction_eq_test.cpp.o"
+  "CMakeFiles/construction_eq.dir/construction_eq_test.cpp.o.d"
+  "construction_eq"
+  "construction_eq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/construction_eq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
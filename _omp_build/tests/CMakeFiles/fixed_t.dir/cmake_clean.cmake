@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fixed_t.dir/fixed_t_test.cpp.o"
+  "CMakeFiles/fixed_t.dir/fixed_t_test.cpp.o.d"
+  "fixed_t"
+  "fixed_t.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fixed_t.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fixed_t7.dir/fixed_t7_test.cpp.o"
+  "CMakeFiles/fixed_t7.dir/fixed_t7_test.cpp.o.d"
+  "fixed_t7"
+  "fixed_t7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fixed_t7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
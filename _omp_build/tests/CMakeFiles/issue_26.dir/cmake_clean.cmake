@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/issue_26.dir/issue_26_test.cpp.o"
+  "CMakeFiles/issue_26.dir/issue_26_test.cpp.o.d"
+  "issue_26"
+  "issue_26.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/issue_26.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
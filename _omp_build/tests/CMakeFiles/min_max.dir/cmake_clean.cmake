@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/min_max.dir/min_max_test.cpp.o"
+  "CMakeFiles/min_max.dir/min_max_test.cpp.o.d"
+  "min_max"
+  "min_max.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/min_max.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
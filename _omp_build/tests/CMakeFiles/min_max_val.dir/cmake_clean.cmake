@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/min_max_val.dir/min_max_val_test.cpp.o"
+  "CMakeFiles/min_max_val.dir/min_max_val_test.cpp.o.d"
+  "min_max_val"
+  "min_max_val.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/min_max_val.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/negation.dir/negation_test.cpp.o"
+  "CMakeFiles/negation.dir/negation_test.cpp.o.d"
+  "negation"
+  "negation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/negation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/to_type.dir/to_type_test.cpp.o"
+  "CMakeFiles/to_type.dir/to_type_test.cpp.o.d"
+  "to_type"
+  "to_type.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/to_type.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/u_construction.dir/u_construction_test.cpp.o"
+  "CMakeFiles/u_construction.dir/u_construction_test.cpp.o.d"
+  "u_construction"
+  "u_construction.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/u_construction.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ufixed_t.dir/ufixed_t_test.cpp.o"
+  "CMakeFiles/ufixed_t.dir/ufixed_t_test.cpp.o.d"
+  "ufixed_t"
+  "ufixed_t.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ufixed_t.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/w_eq_f.dir/w_eq_f_test.cpp.o"
+  "CMakeFiles/w_eq_f.dir/w_eq_f_test.cpp.o.d"
+  "w_eq_f"
+  "w_eq_f.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/w_eq_f.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,112 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_omp_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(Arena "/root/repo/_omp_build/tests/Arena")
+set_tests_properties(Arena PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Binary "/root/repo/_omp_build/tests/Binary")
+set_tests_properties(Binary PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Biquad "/root/repo/_omp_build/tests/Biquad")
+set_tests_properties(Biquad PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Bits "/root/repo/_omp_build/tests/Bits")
+set_tests_properties(Bits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(BlockFloat "/root/repo/_omp_build/tests/BlockFloat")
+set_tests_properties(BlockFloat PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(CIC "/root/repo/_omp_build/tests/CIC")
+set_tests_properties(CIC PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Ceil "/root/repo/_omp_build/tests/Ceil")
+set_tests_properties(Ceil PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Classic "/root/repo/_omp_build/tests/Classic")
+set_tests_properties(Classic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Complex "/root/repo/_omp_build/tests/Complex")
+set_tests_properties(Complex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Constexpr "/root/repo/_omp_build/tests/Constexpr")
+set_tests_properties(Constexpr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Conversion "/root/repo/_omp_build/tests/Conversion")
+set_tests_properties(Conversion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Cordic "/root/repo/_omp_build/tests/Cordic")
+set_tests_properties(Cordic PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DoubleConversion "/root/repo/_omp_build/tests/DoubleConversion")
+set_tests_properties(DoubleConversion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(DynFixed "/root/repo/_omp_build/tests/DynFixed")
+set_tests_properties(DynFixed PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Explore "/root/repo/_omp_build/tests/Explore")
+set_tests_properties(Explore PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FFT "/root/repo/_omp_build/tests/FFT")
+set_tests_properties(FFT PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(FIR "/root/repo/_omp_build/tests/FIR")
+set_tests_properties(FIR PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Fix "/root/repo/_omp_build/tests/Fix")
+set_tests_properties(Fix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Floor "/root/repo/_omp_build/tests/Floor")
+set_tests_properties(Floor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Llr "/root/repo/_omp_build/tests/Llr")
+set_tests_properties(Llr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Lut "/root/repo/_omp_build/tests/Lut")
+set_tests_properties(Lut PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Matrix "/root/repo/_omp_build/tests/Matrix")
+set_tests_properties(Matrix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(NCO "/root/repo/_omp_build/tests/NCO")
+set_tests_properties(NCO PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(NN "/root/repo/_omp_build/tests/NN")
+set_tests_properties(NN PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(NearEven "/root/repo/_omp_build/tests/NearEven")
+set_tests_properties(NearEven PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(NearOdd "/root/repo/_omp_build/tests/NearOdd")
+set_tests_properties(NearOdd PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Newton "/root/repo/_omp_build/tests/Newton")
+set_tests_properties(Newton PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(OverflowDetector "/root/repo/_omp_build/tests/OverflowDetector")
+set_tests_properties(OverflowDetector PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Polar "/root/repo/_omp_build/tests/Polar")
+set_tests_properties(Polar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(QR "/root/repo/_omp_build/tests/QR")
+set_tests_properties(QR PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Statistics "/root/repo/_omp_build/tests/Statistics")
+set_tests_properties(Statistics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Sticky "/root/repo/_omp_build/tests/Sticky")
+set_tests_properties(Sticky PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StringConversion "/root/repo/_omp_build/tests/StringConversion")
+set_tests_properties(StringConversion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(StringMath "/root/repo/_omp_build/tests/StringMath")
+set_tests_properties(StringMath PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Tables "/root/repo/_omp_build/tests/Tables")
+set_tests_properties(Tables PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Tracked "/root/repo/_omp_build/tests/Tracked")
+set_tests_properties(Tracked PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Undefined "/root/repo/_omp_build/tests/Undefined")
+set_tests_properties(Undefined PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(Viterbi "/root/repo/_omp_build/tests/Viterbi")
+set_tests_properties(Viterbi PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(construction8 "/root/repo/_omp_build/tests/construction8")
+set_tests_properties(construction8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(construction_d1 "/root/repo/_omp_build/tests/construction_d1")
+set_tests_properties(construction_d1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(construction_eq "/root/repo/_omp_build/tests/construction_eq")
+set_tests_properties(construction_eq PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(construction "/root/repo/_omp_build/tests/construction")
+set_tests_properties(construction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(fixed_t7 "/root/repo/_omp_build/tests/fixed_t7")
+set_tests_properties(fixed_t7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(fixed_t "/root/repo/_omp_build/tests/fixed_t")
+set_tests_properties(fixed_t PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(issue_26 "/root/repo/_omp_build/tests/issue_26")
+set_tests_properties(issue_26 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(min_max "/root/repo/_omp_build/tests/min_max")
+set_tests_properties(min_max PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(min_max_val "/root/repo/_omp_build/tests/min_max_val")
+set_tests_properties(min_max_val PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(negation "/root/repo/_omp_build/tests/negation")
+set_tests_properties(negation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(parsing "/root/repo/_omp_build/tests/parsing")
+set_tests_properties(parsing PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(to_type "/root/repo/_omp_build/tests/to_type")
+set_tests_properties(to_type PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(u_construction "/root/repo/_omp_build/tests/u_construction")
+set_tests_properties(u_construction PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(ufixed_t "/root/repo/_omp_build/tests/ufixed_t")
+set_tests_properties(ufixed_t PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(w_eq_f "/root/repo/_omp_build/tests/w_eq_f")
+set_tests_properties(w_eq_f PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;22;add_test;/root/repo/tests/CMakeLists.txt;0;")
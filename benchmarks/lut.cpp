@@ -0,0 +1,158 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+/*
+ *Accuracy and speed of the table-driven functions of Fi::lut, compared
+ *with converting to double, calling the standard library and converting
+ *back. Errors are in units in the last place of the output type.
+ */
+
+#include "fi/Lut.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+typedef Fi::Fixed<16, 8, Fi::UNSIGNED, Fi::Saturate, Fi::Classic> In;
+typedef Fi::Fixed<16, 8, Fi::SIGNED, Fi::Saturate, Fi::Classic> SignedIn;
+typedef Fi::Fixed<24, 16, Fi::SIGNED, Fi::Saturate, Fi::Classic> Out;
+
+const int REPEAT = 20;
+
+struct Reciprocal {
+	typedef In input;
+	static const char* name() { return "reciprocal"; }
+	static double exact(double x) { return 1.0/x; }
+	template<std::size_t TB, Fi::lut::Interpolation I>
+	static Out lut(const In& x) { return Fi::lut::reciprocal<In, Out, TB, I>(x); }
+};
+
+struct Rsqrt {
+	typedef In input;
+	static const char* name() { return "rsqrt"; }
+	static double exact(double x) { return 1.0/std::sqrt(x); }
+	template<std::size_t TB, Fi::lut::Interpolation I>
+	static Out lut(const In& x) { return Fi::lut::rsqrt<In, Out, TB, I>(x); }
+};
+
+struct Log2 {
+	typedef In input;
+	static const char* name() { return "log2"; }
+	static double exact(double x) { return std::log(x)/std::log(2.0); }
+	template<std::size_t TB, Fi::lut::Interpolation I>
+	static Out lut(const In& x) { return Fi::lut::log2<In, Out, TB, I>(x); }
+};
+
+struct Exp2 {
+	typedef SignedIn input;
+	static const char* name() { return "exp2"; }
+	static double exact(double x) { return std::pow(2.0, x); }
+	template<std::size_t TB, Fi::lut::Interpolation I>
+	static Out lut(const SignedIn& x) {
+		return Fi::lut::exp2<SignedIn, Out, TB, I>(x);
+	}
+};
+
+template<typename Fn>
+std::vector<typename Fn::input> inputs() {
+	typedef typename Fn::input T;
+	std::vector<T> x;
+	const double lsb = 1.0/(1 << Out::FRACTION_LENGTH);
+	for (int r = 1; r < (1 << 16); ++r) {
+		const T v = T::fromBinary(r);
+		const double e = Fn::exact(v.toDouble());
+		if (e >= lsb && e < 127.0) {
+			x.push_back(v);
+		}
+	}
+	return x;
+}
+
+double nanoseconds(std::clock_t start, std::size_t n) {
+	return 1e9*(std::clock() - start)/CLOCKS_PER_SEC/n/REPEAT;
+}
+
+template<typename Fn, std::size_t TB, Fi::lut::Interpolation I>
+void run(const char* interpolation) {
+
+	typedef typename Fn::input T;
+	const std::vector<T> x = inputs<Fn>();
+	const double lsb = 1.0/(1 << Out::FRACTION_LENGTH);
+
+	double maxUlp = 0.0;
+	double sumUlp = 0.0;
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		const double e = std::fabs(Fn::template lut<TB, I>(x[i]).toDouble() -
+		                           Fn::exact(x[i].toDouble()))/lsb;
+		maxUlp = std::max(maxUlp, e);
+		sumUlp += e;
+	}
+
+	Fn::template lut<TB, I>(x[0]);
+	Out sink;
+	std::clock_t start = std::clock();
+	for (int r = 0; r < REPEAT; ++r) {
+		for (std::size_t i = 0; i < x.size(); ++i) {
+			sink += Fn::template lut<TB, I>(x[i]);
+		}
+	}
+	const double lutNs = nanoseconds(start, x.size());
+
+	start = std::clock();
+	for (int r = 0; r < REPEAT; ++r) {
+		for (std::size_t i = 0; i < x.size(); ++i) {
+			sink += Out(Fn::exact(x[i].toDouble()));
+		}
+	}
+	const double stdNs = nanoseconds(start, x.size());
+
+	std::printf("%-10s %-9s %2u bits  max %6.2f ulp  mean %5.2f ulp  "
+	            "%7.1f ns/op  std:: %7.1f ns/op  (%g)\n",
+	            Fn::name(), interpolation, static_cast<unsigned>(TB),
+	            maxUlp, sumUlp/x.size(), lutNs, stdNs, sink.toDouble());
+
+}
+
+template<typename Fn>
+void runAll() {
+	run<Fn, 8, Fi::lut::NEAREST>("nearest");
+	run<Fn, 6, Fi::lut::LINEAR>("linear");
+	run<Fn, 8, Fi::lut::LINEAR>("linear");
+	run<Fn, 4, Fi::lut::QUADRATIC>("quadratic");
+	run<Fn, 6, Fi::lut::QUADRATIC>("quadratic");
+}
+
+int main() {
+
+	runAll<Reciprocal>();
+	runAll<Rsqrt>();
+	runAll<Log2>();
+	runAll<Exp2>();
+
+	return 0;
+
+}
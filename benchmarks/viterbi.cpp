@@ -0,0 +1,136 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+/*
+ *Speed of Viterbi decoding of the K = 7, rate 1/2 code (generators 171
+ *and 133 octal) with modular path metrics: Fi::Viterbi with 16-bit
+ *metrics (vector add-compare-select where available) and 20-bit metrics
+ *(scalar), compared with add-compare-select written with the operators
+ *of Fi::Fixed. Bit errors are counted on a noisy channel.
+ */
+
+#include "fi/Viterbi.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+typedef Fi::Fixed<6, 2, Fi::SIGNED, Fi::Saturate, Fi::Classic> Symbol;
+typedef Fi::Fixed<12, 2, Fi::SIGNED, Fi::Wrap> Narrow;
+typedef Fi::Fixed<20, 2, Fi::SIGNED, Fi::Wrap> Wide;
+typedef Fi::Trellis<7, 0171, 0133> K7;
+
+const std::size_t BITS = 200000;
+
+double megabits(std::clock_t start) {
+	return BITS/(1e6*(std::clock() - start)/CLOCKS_PER_SEC);
+}
+
+std::size_t errors(const std::vector<uint8_t>& a,
+                   const std::vector<uint8_t>& b) {
+	std::size_t e = 0;
+	for (std::size_t i = 0; i < a.size(); ++i) {
+		e += (a[i] != b[i]);
+	}
+	return e;
+}
+
+template<typename PathT>
+void run(const char* name, const std::vector<Symbol>& y,
+         const std::vector<uint8_t>& u) {
+
+	Fi::Viterbi<K7, Symbol, PathT> decoder;
+	std::vector<uint8_t> bits(u.size());
+
+	const std::clock_t start = std::clock();
+	decoder.update(&y[0], u.size());
+	decoder.traceback(0, &bits[0]);
+	const double speed = megabits(start);
+
+	std::printf("%-24s %8.2f Mbit/s  %6lu errors\n", name, speed,
+	            static_cast<unsigned long>(errors(bits, u)));
+
+}
+
+/**
+ *Add-compare-select with the operators, keeping only the metrics.
+ */
+void runOperators(const std::vector<Symbol>& y, std::size_t n) {
+
+	const std::size_t S = K7::STATES;
+	std::vector<Narrow> metrics(S), next(S);
+	std::vector<uint8_t> decisions(n*S);
+
+	const std::clock_t start = std::clock();
+	for (std::size_t i = 0; i < n; ++i) {
+		const Narrow y0 = Narrow::fromBinary(y[2*i].toBinary(true));
+		const Narrow y1 = Narrow::fromBinary(y[2*i + 1].toBinary(true));
+		for (std::size_t t = 0; t < S; ++t) {
+			Narrow m[2];
+			for (std::size_t h = 0; h < 2; ++h) {
+				const std::size_t p = (t >> 1) + h*S/2;
+				const unsigned c = K7::output(p, t & 1);
+				m[h] = metrics[p];
+				m[h] += (c & 1) ? y0 : -y0;
+				m[h] += (c & 2) ? y1 : -y1;
+			}
+			const bool d = Fi::modularLess(m[1], m[0]);
+			next[t] = d ? m[1] : m[0];
+			decisions[i*S + t] = d;
+		}
+		metrics.swap(next);
+	}
+	const double speed = megabits(start);
+
+	std::printf("%-24s %8.2f Mbit/s  (metric %g)\n", "Fixed operators", speed,
+	            metrics[0].toDouble());
+
+}
+
+int main() {
+
+	std::vector<uint8_t> u(BITS, 0);
+	for (std::size_t i = 0; i + 6 < BITS; ++i) {
+		u[i] = static_cast<uint8_t>(std::rand() % 2);
+	}
+
+	std::vector<uint8_t> c(2*BITS);
+	K7::encode(&u[0], BITS, &c[0]);
+
+	//BPSK at amplitude 2 with uniform noise of amplitude 3.
+	std::vector<Symbol> y(c.size());
+	for (std::size_t i = 0; i < c.size(); ++i) {
+		const double noise = 3.0*(2.0*std::rand()/(RAND_MAX + 1.0) - 1.0);
+		y[i] = Symbol((c[i] ? -2.0 : 2.0) + noise);
+	}
+
+	run<Narrow>("Viterbi, 12-bit metrics", y, u);
+	run<Wide>("Viterbi, 20-bit metrics", y, u);
+	runOperators(y, BITS);
+
+	return 0;
+
+}
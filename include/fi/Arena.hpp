@@ -0,0 +1,244 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_ARENA_HPP
+#define FI_ARENA_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief A bump allocator for short-lived buffers.
+
+	 *Memory is handed out by advancing a pointer through a list of large
+	 *blocks. Individual allocations are never freed; instead, the whole
+	 *arena is rewound with Arena::reset(), typically once per simulated
+	 *frame. Blocks are kept across resets, so once the arena has grown to
+	 *the size needed by one frame, subsequent frames do not touch the heap.
+
+	 *Use Fi::ArenaAllocator to back standard containers, or the buffer
+	 *overload of Fixed::toString() to format numbers without allocating:
+	 *\code
+	 #include "fi/Arena.hpp"
+
+	 typedef Fi::Fixed<16, 8, Fi::SIGNED> fi;
+
+	 int main(int argc, char* argv[]) {
+	 Fi::Arena arena;
+
+	 for (int frame = 0; frame < 1000; ++frame) {
+	 {
+	 Fi::ArenaVector<fi>::type buf((Fi::ArenaAllocator<fi>(arena)));
+	 buf.resize(1024);
+	 //...
+	 }
+	 //buf is destroyed before its memory is reclaimed
+	 arena.reset();
+	 }
+
+	 return 0;
+	 }
+	 \endcode
+
+	 *\warning An arena is not thread-safe. Use one arena per thread.
+	 */
+	class Arena {
+
+	public:
+
+		///Default size of each block in bytes.
+		static const std::size_t DEFAULT_BLOCK_SIZE = 64*1024;
+
+		///Default alignment of allocations in bytes.
+		static const std::size_t DEFAULT_ALIGNMENT = 16;
+
+		/**
+		 *\brief Creates an empty arena.
+		 *\param blockSize Minimum size of each block requested from the heap.
+		 */
+		explicit Arena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+		/**
+		 *\brief Releases all blocks.
+		 */
+		~Arena();
+
+		/**
+		 *\brief Allocates memory from the arena.
+		 *\param size Number of bytes.
+		 *\param alignment Alignment in bytes. Must be a power of two.
+		 *\return Pointer to uninitialized memory.
+		 *\throw std::bad_alloc if a new block cannot be obtained, including
+		 *when its size does not fit in std::size_t.
+		 */
+		void* allocate(std::size_t size,
+		               std::size_t alignment = DEFAULT_ALIGNMENT);
+
+		/**
+		 *\brief Allocates uninitialized storage for \c n objects of type T.
+		 *\throw std::bad_alloc if a new block cannot be obtained or
+		 *\c n*sizeof(T) does not fit in std::size_t.
+		 */
+		template<typename T>
+		T* allocateArray(std::size_t n);
+
+		/**
+		 *\brief Rewinds the arena, invalidating all allocations.
+
+		 *All blocks are kept for reuse.
+		 */
+		void reset();
+
+		/**
+		 *\brief Returns all blocks to the heap, invalidating all allocations.
+		 */
+		void release();
+
+		///Number of bytes allocated since the last reset, including padding.
+		std::size_t used() const;
+
+		///Total number of bytes held in blocks.
+		std::size_t capacity() const;
+
+		///Number of blocks obtained from the heap.
+		std::size_t blockCount() const;
+
+	private:
+
+		struct Block {
+			Block* next;
+			std::size_t size;
+		};
+
+		//Non-copyable
+		Arena(const Arena&);
+		Arena& operator=(const Arena&);
+
+		static char* begin(Block* b);
+		static char* end(Block* b);
+
+		///\internal Allocates from the current block, or returns 0.
+		void* bump(std::size_t size, std::size_t alignment);
+
+		void* allocateSlow(std::size_t size, std::size_t alignment);
+
+		std::size_t _blockSize;
+
+		Block* _first;
+		Block* _current;
+
+		char* _ptr;
+		char* _end;
+
+		std::size_t _usedBefore;
+
+	};
+
+
+	/**\brief An STL-compatible allocator that obtains memory from a Fi::Arena.
+
+	 *Deallocation is a no-op; memory is reclaimed when the arena is reset.
+	 *Containers using this allocator must not outlive the next reset of
+	 *the arena.
+
+	 *\tparam T Allocated type.
+	 */
+	template<typename T>
+	class ArenaAllocator {
+
+	public:
+
+		typedef T value_type;
+		typedef T* pointer;
+		typedef const T* const_pointer;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+		template<typename U>
+		struct rebind {
+			typedef ArenaAllocator<U> other;
+		};
+
+		/**
+		 *\brief Creates an allocator drawing from \c arena.
+		 */
+		explicit ArenaAllocator(Arena& arena);
+
+		template<typename U>
+		ArenaAllocator(const ArenaAllocator<U>& that);
+
+		pointer address(reference x) const;
+		const_pointer address(const_reference x) const;
+
+		pointer allocate(size_type n, const void* hint = 0);
+		void deallocate(pointer p, size_type n);
+
+		size_type max_size() const;
+
+		void construct(pointer p, const T& val);
+		void destroy(pointer p);
+
+		///The arena memory is drawn from.
+		Arena& arena() const;
+
+	private:
+
+		Arena* _arena;
+
+	};
+
+	template<typename T, typename U>
+	bool operator==(const ArenaAllocator<T>& x, const ArenaAllocator<U>& y);
+
+	template<typename T, typename U>
+	bool operator!=(const ArenaAllocator<T>& x, const ArenaAllocator<U>& y);
+
+
+	/**\brief A \c std::vector backed by a Fi::Arena.
+	 *\tparam T Element type.
+	 */
+	template<typename T>
+	struct ArenaVector {
+		typedef std::vector<T, ArenaAllocator<T> > type;
+	};
+
+
+	/**
+	 *\relates Fi::Arena
+	 *\brief String representation of a number, stored in an arena.
+
+	 *\return A null-terminated string valid until the arena is reset.
+	 */
+	template<std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	const char* toString(const Fi::Fixed<W, F, S, OF, R>& x, Arena& arena);
+
+}
+
+#include "private/Arena_priv.hpp"
+
+#endif
@@ -0,0 +1,279 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_BIQUAD_HPP
+#define FI_BIQUAD_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief Structure of a second-order IIR section.
+
+	 *With coefficients \c b0, \c b1, \c b2, \c a1 and \c a2, every
+	 *structure computes
+	 *<tt>y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]</tt>
+	 *in exact arithmetic; they differ in the nodes that are quantized.
+	 *Each node is a sum of terms, listed in the order they are added.
+	 */
+	enum BiquadStructure {
+		/**One node, the output:
+		 *<tt>y = b0 x + b1 x1 + b2 x2 - a1 y1 - a2 y2</tt>,
+		 *where \c x1 and \c x2 are past inputs and \c y1 and \c y2 past
+		 *outputs.
+		 */
+		DIRECT_FORM_I,
+		/**The state <tt>w = x - a1 w1 - a2 w2</tt> and the output
+		 *<tt>y = b0 w + b1 w1 + b2 w2</tt>, where \c w1 and \c w2 are past
+		 *states.
+		 */
+		DIRECT_FORM_II,
+		/**The output <tt>y = b0 x + s1</tt> and the states
+		 *<tt>s1 = b1 x - a1 y + s2</tt> and <tt>s2 = b2 x - a2 y</tt>,
+		 *where \c s1 and \c s2 are the states of the previous sample.
+		 */
+		TRANSPOSED_DIRECT_FORM_II
+	};
+
+	/**\brief Coefficients of a second-order section, normalized so that
+	 *\c a0 is 1.
+	 */
+	template<typename CoefT>
+	struct BiquadCoefficients {
+
+		/**
+		 *\brief Creates a section with all coefficients equal to zero.
+		 */
+		BiquadCoefficients();
+
+		/**
+		 *\brief Creates a section from its coefficients.
+		 */
+		BiquadCoefficients(const CoefT& b0, const CoefT& b1, const CoefT& b2,
+		                   const CoefT& a1, const CoefT& a2);
+
+		CoefT b0;
+		CoefT b1;
+		CoefT b2;
+		CoefT a1;
+		CoefT a2;
+
+	};
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT>
+	struct BiquadTypes;
+
+	/**\brief Multichannel second-order IIR section with a format for
+	 *each internal node.
+
+	 *Every node of the structure \c S is computed the way hardware
+	 *would: each product of a coefficient and a signal is computed
+	 *exactly and converted to \c AccT, the terms are added using the
+	 *operators of \c AccT, and the sum is quantized once to the format of
+	 *the node using its rounding mode and overflow handler: \c StateT for
+	 *the states of the direct form II structures and \c OutT for the
+	 *output, which is also the format of the past outputs in direct form
+	 *I. Terms without a coefficient are converted to \c AccT directly.
+
+	 *Samples of all channels are interleaved, and each channel has its
+	 *own state, which is kept between calls to process().
+
+	 *When \c AccT keeps every bit of every term and no input can overflow
+	 *it, see overflowFree(), nodes are computed using integer arithmetic;
+	 *with vector instructions, four channels are then computed at once
+	 *if all formats are signed and the rounding modes of the nodes have
+	 *vector implementations. The results are the same as those of the
+	 *operators.
+
+	 *\code
+	 #include "fi/Biquad.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> sample;
+	 typedef Fi::Fixed<16, 14, Fi::SIGNED, Fi::Saturate, Fi::Classic> coef;
+	 typedef Fi::Fixed<32, 29, Fi::SIGNED, Fi::Saturate, Fi::Classic> acc;
+	 typedef Fi::Fixed<18, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> state;
+
+	 Fi::BiquadCoefficients<coef> c(coef(0.0675), coef(0.135), coef(0.0675),
+	                                coef(-1.143), coef(0.413));
+	 Fi::Biquad<sample, coef, acc, state, sample,
+	            Fi::TRANSPOSED_DIRECT_FORM_II> lowpass(c, 8);
+
+	 std::vector<sample> in = ..., out;
+	 lowpass.process(in, out);
+	 \endcode
+
+	 *\tparam InT Fi::Fixed type of the input.
+	 *\tparam CoefT Fi::Fixed type of the coefficients.
+	 *\tparam AccT Fi::Fixed type of the adders.
+	 *\tparam StateT Fi::Fixed type of the states of the direct form II
+	 *structures.
+	 *\tparam OutT Fi::Fixed type of the output.
+	 *\tparam S Structure of the section.
+	 */
+	template<typename InT, typename CoefT, typename AccT,
+	         typename StateT = AccT, typename OutT = InT,
+	         BiquadStructure S = DIRECT_FORM_I>
+	class Biquad {
+
+	public:
+
+		/**
+		 *\brief Creates a section with the state of every channel set to
+		 *zero.
+		 *\throw std::invalid_argument if \c channels is zero.
+		 */
+		explicit Biquad(const BiquadCoefficients<CoefT>& coefficients,
+		                std::size_t channels = 1);
+
+		///Coefficients.
+		const BiquadCoefficients<CoefT>& coefficients() const;
+
+		///Number of channels.
+		std::size_t channels() const;
+
+		/**
+		 *\brief \c true if the adders can neither round nor overflow for
+		 *any input.
+		 */
+		bool overflowFree() const;
+
+		/**
+		 *\brief Filter \c frames samples of every channel.
+
+		 *\c in and \c out hold <tt>frames*channels()</tt> interleaved
+		 *samples and may be the same array.
+		 */
+		void process(const InT* in, OutT* out, std::size_t frames);
+
+		/**
+		 *\brief Filter interleaved samples, replacing the contents of
+		 *\c out with the outputs.
+		 *\throw std::invalid_argument if the size of \c in is not a
+		 *multiple of channels().
+		 */
+		template<typename InAlloc, typename OutAlloc>
+		void process(const std::vector<InT, InAlloc>& in,
+		             std::vector<OutT, OutAlloc>& out);
+
+		/**
+		 *\brief Set the state of every channel to zero.
+		 */
+		void reset();
+
+	private:
+
+		typedef BiquadTypes<InT, CoefT, AccT, StateT, OutT> Types;
+
+		BiquadCoefficients<CoefT> _coefficients;
+		std::size_t _channels;
+		int64_t _k[5];
+		bool _overflowFree;
+
+		std::vector<int64_t> _state;
+
+	};
+
+	/**\brief Cascade of second-order sections sharing their formats.
+
+	 *The first section converts from \c InT to \c OutT; the signal
+	 *between sections, and the input of the other sections, is in
+	 *\c OutT. Blocks are filtered by one section at a time.
+
+	 *\tparam InT Fi::Fixed type of the input.
+	 *\tparam CoefT Fi::Fixed type of the coefficients.
+	 *\tparam AccT Fi::Fixed type of the adders.
+	 *\tparam StateT Fi::Fixed type of the states of the direct form II
+	 *structures.
+	 *\tparam OutT Fi::Fixed type of the output of each section.
+	 *\tparam S Structure of the sections.
+	 */
+	template<typename InT, typename CoefT, typename AccT,
+	         typename StateT = AccT, typename OutT = InT,
+	         BiquadStructure S = DIRECT_FORM_I>
+	class BiquadCascade {
+
+	public:
+
+		///Type of the first section.
+		typedef Biquad<InT, CoefT, AccT, StateT, OutT, S> FirstSection;
+		///Type of the other sections.
+		typedef Biquad<OutT, CoefT, AccT, StateT, OutT, S> Section;
+
+		/**
+		 *\brief Creates a cascade with the state of every channel set to
+		 *zero.
+		 *\throw std::invalid_argument if there are no sections or
+		 *\c channels is zero.
+		 */
+		explicit BiquadCascade(
+			const std::vector< BiquadCoefficients<CoefT> >& sections,
+			std::size_t channels = 1);
+
+		///Number of sections.
+		std::size_t size() const;
+
+		///Number of channels.
+		std::size_t channels() const;
+
+		/**
+		 *\brief Filter \c frames samples of every channel.
+		 *\sa Biquad::process()
+		 */
+		void process(const InT* in, OutT* out, std::size_t frames);
+
+		/**
+		 *\brief Filter interleaved samples, replacing the contents of
+		 *\c out with the outputs.
+		 *\throw std::invalid_argument if the size of \c in is not a
+		 *multiple of channels().
+		 */
+		template<typename InAlloc, typename OutAlloc>
+		void process(const std::vector<InT, InAlloc>& in,
+		             std::vector<OutT, OutAlloc>& out);
+
+		/**
+		 *\brief Set the state of every section and channel to zero.
+		 */
+		void reset();
+
+	private:
+
+		static const BiquadCoefficients<CoefT>& front(
+			const std::vector< BiquadCoefficients<CoefT> >& sections);
+
+		FirstSection _first;
+		std::vector<Section> _rest;
+
+	};
+
+}
+
+#include "private/Biquad_priv.hpp"
+
+#endif
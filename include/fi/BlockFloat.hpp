@@ -0,0 +1,180 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_BLOCKFLOAT_HPP
+#define FI_BLOCKFLOAT_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+
+namespace Fi {
+
+	/**\brief A block of fixed-point mantissas sharing one exponent.
+
+	 *Element \c i has the value <tt>mantissa(i)*2^exponent()</tt>. The
+	 *exponent is a signed integer of \c ExpBits bits.
+
+	 *Results of arithmetic and conversions are normalized: the exponent is
+	 *the smallest for which every element fits \c MantT, found by counting
+	 *the leading sign bits of the exact results, so that the largest
+	 *mantissa uses the whole word. Each element is then rounded once from
+	 *its exact value using the rounding mode of \c MantT. If rounding
+	 *carries out of the word, the exponent is increased by one. An
+	 *exponent that would be larger than \c MAX_EXPONENT is limited, and the
+	 *overflow handler of \c MantT is applied to the mantissas; one that
+	 *would be smaller than \c MIN_EXPONENT is limited, leaving the
+	 *mantissas not fully normalized. A block of zeros has the exponent
+	 *\c MIN_EXPONENT.
+
+	 *In a sum, the elements are aligned to the smaller exponent. When the
+	 *exponents of the normalized operands differ by more than
+	 *<tt>61 - W</tt> bits, the bits of the smaller operand beyond that
+	 *distance only affect rounding, which remains exact.
+
+	 *normalize() counts sign bits and shifts mantissas using vector
+	 *instructions when \c MantT has at most 16 bits.
+
+	 *\code
+	 #include "fi/BlockFloat.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/NearEven.hpp"
+
+	 typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::NearEven> mant;
+	 typedef Fi::BlockFloat<mant, 64, 6> block;
+
+	 double x[64] = ...;
+	 block a = block::fromDouble(x);
+	 block p = a*a + a;
+	 p.toDouble(x);
+	 \endcode
+
+	 *\tparam MantT Signed Fi::Fixed type of the mantissas.
+	 *\tparam BlockSize Number of elements.
+	 *\tparam ExpBits Width of the exponent, between 2 and 16 bits.
+	 */
+	template<typename MantT, std::size_t BlockSize, std::size_t ExpBits>
+	class BlockFloat {
+
+	public:
+
+		typedef MantT mantissa_type;
+
+		///Number of elements.
+		static const std::size_t SIZE = BlockSize;
+
+		///Smallest exponent.
+		static const int MIN_EXPONENT = -(1 << (ExpBits - 1));
+
+		///Largest exponent.
+		static const int MAX_EXPONENT = (1 << (ExpBits - 1)) - 1;
+
+		/**
+		 *\brief Creates a block of zeros.
+		 */
+		BlockFloat();
+
+		/**
+		 *\brief Creates a block from its mantissas and exponent, without
+		 *normalizing it.
+		 *\throw std::invalid_argument if \c exponent is out of range.
+		 */
+		BlockFloat(const MantT* mantissas, int exponent);
+
+		/**
+		 *\brief Block holding the values of an array of \c SIZE
+		 *fixed-point numbers of any format.
+		 */
+		template<typename FixedT>
+		static const BlockFloat fromFixed(const FixedT* x);
+
+		/**
+		 *\brief Block holding the values of an array of \c SIZE finite
+		 *numbers.
+		 */
+		static const BlockFloat fromDouble(const double* x);
+
+		/**
+		 *\brief Convert each element to \c FixedT using its rounding mode
+		 *and overflow handler.
+		 */
+		template<typename FixedT>
+		void toFixed(FixedT* out) const;
+
+		///Values of the elements.
+		void toDouble(double* out) const;
+
+		///Value of element \c i.
+		double value(std::size_t i) const;
+
+		///Mantissa of element \c i.
+		const MantT& mantissa(std::size_t i) const;
+
+		///Shared exponent.
+		int exponent() const;
+
+		/**
+		 *\brief Number of bits by which every mantissa can be shifted to
+		 *the left without overflow: the smallest number of redundant
+		 *leading sign bits, or <tt>W - 1</tt> for a block of zeros.
+		 */
+		int headroom() const;
+
+		/**
+		 *\brief Shift the mantissas to the left by the headroom, exactly,
+		 *decreasing the exponent, without going below \c MIN_EXPONENT. A
+		 *block of zeros gets the exponent \c MIN_EXPONENT.
+		 */
+		void normalize();
+
+	private:
+
+		MantT _mantissas[BlockSize];
+		int _exponent;
+
+	};
+
+	/**\relates Fi::BlockFloat
+	 *\brief Element-wise sum.
+	 */
+	template<typename MantT, std::size_t N, std::size_t E>
+	const BlockFloat<MantT, N, E> operator+(const BlockFloat<MantT, N, E>& x,
+	                                        const BlockFloat<MantT, N, E>& y);
+
+	/**\relates Fi::BlockFloat
+	 *\brief Element-wise difference.
+	 */
+	template<typename MantT, std::size_t N, std::size_t E>
+	const BlockFloat<MantT, N, E> operator-(const BlockFloat<MantT, N, E>& x,
+	                                        const BlockFloat<MantT, N, E>& y);
+
+	/**\relates Fi::BlockFloat
+	 *\brief Element-wise product.
+	 */
+	template<typename MantT, std::size_t N, std::size_t E>
+	const BlockFloat<MantT, N, E> operator*(const BlockFloat<MantT, N, E>& x,
+	                                        const BlockFloat<MantT, N, E>& y);
+
+}
+
+#include "private/BlockFloat_priv.hpp"
+
+#endif
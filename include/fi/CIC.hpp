@@ -0,0 +1,272 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef FI_CIC_HPP
+#define FI_CIC_HPP
+
+#include "Fixed.hpp"
+#include "overflow/Wrap.hpp"
+#include "rounding/Floor.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief Whether a CIC filter decimates or interpolates.
+	 */
+	enum CICType {
+		///Integrators at the input rate, combs at the output rate.
+		CIC_DECIMATOR,
+		///Combs at the input rate, integrators at the output rate.
+		CIC_INTERPOLATOR
+	};
+
+	/**\internal
+	 *\brief Smallest \c G such that <tt>Q*2^G >= P</tt>.
+	 */
+	template<uint64_t P, uint64_t Q, std::size_t G = 0, bool DONE = (Q >= P)>
+	struct CeilLog2Ratio {
+		static const std::size_t value =
+			CeilLog2Ratio<P, 2*Q, G + 1>::value;
+	};
+
+	template<uint64_t P, uint64_t Q, std::size_t G>
+	struct CeilLog2Ratio<P, Q, G, true> {
+		static const std::size_t value = G;
+	};
+
+	/**\internal
+	 *\brief <tt>B^E</tt>.
+	 */
+	template<uint64_t B, std::size_t E>
+	struct Power {
+		static const uint64_t value = B*Power<B, E - 1>::value;
+	};
+
+	template<uint64_t B>
+	struct Power<B, 0> {
+		static const uint64_t value = 1;
+	};
+
+	/**\internal
+	 *\brief Bit growth and full-precision formats of a CIC filter.
+	 */
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T>
+	struct CICFormat {
+
+		typedef char StageCheck[(N > 0) ? 1 : -1];
+		typedef char RateCheck[(R > 0 && M > 0) ? 1 : -1];
+
+		///Largest gain is <tt>(R*M)^N</tt>, divided by \c R when interpolating.
+		static const std::size_t GROWTH =
+			CeilLog2Ratio<Power<R*M, N>::value,
+			              (T == CIC_INTERPOLATOR) ? R : 1>::value;
+
+		///Bits of the input as a signed number.
+		static const std::size_t INPUT_LENGTH =
+			InT::WORD_LENGTH + ((InT::SIGNEDNESS == SIGNED) ? 0 : 1);
+
+		static const std::size_t WORD_LENGTH = INPUT_LENGTH + GROWTH;
+		static const std::size_t FRACTION_LENGTH =
+			InT::FRACTION_LENGTH + GROWTH;
+
+		typedef char LengthCheck[(WORD_LENGTH <= 62) ? 1 : -1];
+
+		static const std::size_t OUTPUT_LENGTH =
+			(WORD_LENGTH < 32) ? WORD_LENGTH : 32;
+
+		typedef char IntegerCheck[
+			(WORD_LENGTH - FRACTION_LENGTH <= OUTPUT_LENGTH) ? 1 : -1];
+
+		///Most significant bits of the full-precision output.
+		typedef Fixed<OUTPUT_LENGTH,
+		              FRACTION_LENGTH - (WORD_LENGTH - OUTPUT_LENGTH),
+		              SIGNED, Wrap, Floor> type;
+
+	};
+
+	/**\brief Multichannel cascaded integrator-comb decimator or
+	 *interpolator.
+
+	 *A CIC filter of \c Stages stages, rate change \c Rate and
+	 *differential delay \c Delay has the response
+	 *<tt>((1 - z^-(Rate*Delay))/(1 - z^-1))^Stages</tt> at the high rate,
+	 *computed as \c Stages integrators at the high rate and \c Stages
+	 *combs at the low rate without multiplications. The decimator keeps
+	 *the outputs at inputs <tt>0, Rate, 2*Rate, ...</tt>; the
+	 *interpolator produces \c Rate outputs per input.
+
+	 *The output is the response divided by <tt>2^GROWTH</tt>, where
+	 *\c GROWTH is the number of bits by which the largest gain
+	 *<tt>(Rate*Delay)^Stages</tt> (divided by \c Rate when interpolating)
+	 *grows the signal, so its DC gain is in <tt>(1/2, 1]</tt>. In full
+	 *precision it has \c WORD_LENGTH bits, \c FRACTION_LENGTH of them
+	 *fractional. It is converted to \c OutT using its rounding mode and
+	 *overflow handler; by default \c OutT keeps the 32 most significant
+	 *bits of the full-precision output, truncating the others.
+
+	 *The registers are native integers and wrap around, as in hardware:
+	 *integrators overflow, but as long as the output fits in its format
+	 *the combs cancel the overflows and the result is exact. The
+	 *register widths are those of Hogenauer: the stages of an
+	 *interpolator are only as wide as their largest gain requires, and
+	 *when \c OutT discards least significant bits of a decimator's
+	 *output, each stage discards as many as it can while keeping the
+	 *variance of the added error below that of the output
+	 *quantization. See registerWidth() and pruned().
+
+	 *Several channels are filtered at once from interleaved samples. The
+	 *filter keeps its state between calls to process(), so a signal can
+	 *be filtered in blocks of any size.
+
+	 *\code
+	 #include "fi/CIC.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<12, 11, Fi::SIGNED, Fi::Saturate, Fi::Classic> sample;
+	 typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> narrow;
+
+	 Fi::CIC<sample, 4, 16, 1, Fi::CIC_DECIMATOR, narrow> cic(2);
+
+	 std::vector<sample> in = ..., out; //I and Q interleaved
+	 cic.process(in, out);
+	 \endcode
+
+	 *\tparam InT Fi::Fixed type of the input.
+	 *\tparam Stages Number of integrators and of combs.
+	 *\tparam Rate Rate change factor.
+	 *\tparam Delay Differential delay of the combs.
+	 *\tparam Type Decimator or interpolator.
+	 *\tparam OutT Fi::Fixed type of the output. The difference between
+	 *\c FRACTION_LENGTH and its fractional length must be less than 31.
+	 */
+	template<typename InT, std::size_t Stages, std::size_t Rate,
+	         std::size_t Delay = 1, CICType Type = CIC_DECIMATOR,
+	         typename OutT = typename CICFormat<InT, Stages, Rate, Delay,
+	                                            Type>::type>
+	class CIC {
+
+	public:
+
+		///Number of integrators and of combs.
+		static const std::size_t STAGES = Stages;
+
+		///Rate change factor.
+		static const std::size_t RATE = Rate;
+
+		///Differential delay of the combs.
+		static const std::size_t DELAY = Delay;
+
+		///Bit growth of the full-precision output.
+		static const std::size_t GROWTH =
+			CICFormat<InT, Stages, Rate, Delay, Type>::GROWTH;
+
+		///Word length of the full-precision output.
+		static const std::size_t WORD_LENGTH =
+			CICFormat<InT, Stages, Rate, Delay, Type>::WORD_LENGTH;
+
+		///Fraction length of the full-precision output.
+		static const std::size_t FRACTION_LENGTH =
+			CICFormat<InT, Stages, Rate, Delay, Type>::FRACTION_LENGTH;
+
+		/**
+		 *\brief Creates a filter with its state set to zero.
+		 *\throw std::invalid_argument if \c channels is zero.
+		 */
+		explicit CIC(std::size_t channels = 1);
+
+		///Number of interleaved channels.
+		std::size_t channels() const;
+
+		/**
+		 *\brief Width in bits of the registers of a stage, in the order
+		 *in which the signal goes through them.
+		 *\throw std::invalid_argument if \c stage is not less than
+		 *<tt>2*STAGES</tt>.
+		 */
+		static std::size_t registerWidth(std::size_t stage);
+
+		/**
+		 *\brief Number of least significant bits of the full-precision
+		 *output that a stage discards.
+		 *\throw std::invalid_argument if \c stage is not less than
+		 *<tt>2*STAGES</tt>.
+		 */
+		static std::size_t pruned(std::size_t stage);
+
+		/**
+		 *\brief Largest number of output frames produced from \c n input
+		 *frames.
+		 */
+		std::size_t maxOutputs(std::size_t n) const;
+
+		/**
+		 *\brief Filter a block of frames.
+		 *\param in <tt>n*channels()</tt> interleaved inputs.
+		 *\param n Number of input frames.
+		 *\param out Outputs, with room for at least
+		 *<tt>maxOutputs(n)*channels()</tt> values.
+		 *\return Number of output frames.
+		 */
+		std::size_t process(const InT* in, std::size_t n, OutT* out);
+
+		/**
+		 *\brief Filter a block of interleaved inputs, replacing the
+		 *contents of \c out with the outputs.
+		 *\throw std::invalid_argument if the size of \c in is not a
+		 *multiple of channels().
+		 */
+		template<typename InAlloc, typename OutAlloc>
+		void process(const std::vector<InT, InAlloc>& in,
+		             std::vector<OutT, OutAlloc>& out);
+
+		/**
+		 *\brief Set the state to zero, as after construction.
+		 */
+		void reset();
+
+	private:
+
+		void integrate(const int64_t* x);
+		const int64_t* comb(const int64_t* x);
+		void output(const int64_t* x, OutT* out) const;
+
+		std::size_t _channels;
+
+		std::vector<int64_t> _integrators;
+		std::vector<int64_t> _combs;
+		std::vector<int64_t> _work;
+		std::size_t _slot;
+		std::size_t _time;
+
+	};
+
+}
+
+#include "private/CIC_priv.hpp"
+
+#endif
@@ -0,0 +1,319 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_COMPLEX_HPP
+#define FI_COMPLEX_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief Complex multiplier with four real multipliers and two adders:
+	 *<tt>(ar*br - ai*bi) + j(ar*bi + ai*br)</tt>.
+
+	 *The word lengths of the operands must add up to at most 62 bits.
+	 */
+	struct FourMultipliers { };
+
+	/**\brief Complex multiplier with three real multipliers and five
+	 *adders (Gauss).
+
+	 *<tt>k1 = br*(ar + ai)</tt>, <tt>k2 = ar*(bi - br)</tt> and
+	 *<tt>k3 = ai*(br + bi)</tt>, and the result is
+	 *<tt>(k1 - k3) + j(k1 + k2)</tt>.
+
+	 *The sum of each pre-adder is quantized to \c PreT with its rounding
+	 *mode and overflow handler, as in hardware where the pre-adders have
+	 *their own word length. The products and post-adders are exact. When
+	 *\c PreT is \c void, the pre-adders are one bit wider than their
+	 *operands, and the result is the same as that of Fi::FourMultipliers.
+
+	 *The three products, aligned to the same number of fractional bits,
+	 *must fit 62 bits.
+
+	 *\tparam PreT Fi::Fixed type of the pre-adders, or \c void.
+	 */
+	template<typename PreT = void>
+	struct ThreeMultipliers { };
+
+	/**\brief Complex number with fixed-point real and imaginary parts.
+
+	 *Addition and subtraction are performed component-wise using the
+	 *operators of \c T. Products are computed at full precision and then
+	 *quantized once per component using the rounding mode and overflow
+	 *handler of the product type, instead of once per partial product as
+	 *when composing Fi::Fixed operators.
+
+	 *\code
+	 #include "fi/Complex.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> sample;
+	 typedef Fi::Fixed<16, 12, Fi::SIGNED, Fi::Saturate, Fi::Classic> product;
+
+	 Fi::Complex<sample> a(sample(0.5), sample(-0.25));
+	 Fi::Complex<sample> b(sample(0.75), sample(0.125));
+
+	 typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> pre;
+	 typedef Fi::ThreeMultipliers<pre> gauss;
+
+	 Fi::Complex<product> p = Fi::multiply<product, gauss>(a, b);
+	 \endcode
+
+	 *\tparam T A Fi::Fixed type.
+	 */
+	template<typename T>
+	class Complex {
+
+	public:
+
+		///Type of the real and imaginary parts.
+		typedef T value_type;
+
+		/**
+		 *\brief Creates a complex number equal to zero.
+		 */
+		Complex();
+
+		/**
+		 *\brief Creates a complex number from its parts.
+		 *\param re Real part.
+		 *\param im Imaginary part.
+		 */
+		Complex(const T& re, const T& im = T());
+
+		///Real part.
+		const T& real() const;
+		///Imaginary part.
+		const T& imag() const;
+
+		///Set the real part.
+		void real(const T& re);
+		///Set the imaginary part.
+		void imag(const T& im);
+
+		/**
+		 *\brief Component-wise addition.
+		 */
+		Complex& operator+=(const Complex& x);
+
+		/**
+		 *\brief Component-wise subtraction.
+		 */
+		Complex& operator-=(const Complex& x);
+
+		/**
+		 *\brief Multiply and store using four multipliers.
+
+		 *Each component is quantized once to \c T.
+		 */
+		Complex& operator*=(const Complex& x);
+
+	private:
+
+		T _re;
+		T _im;
+
+	};
+
+
+	/**\relates Fi::Complex
+	 *\brief Equality operator.
+	 */
+	template<typename T>
+	bool operator==(const Complex<T>& x, const Complex<T>& y);
+
+	/**\relates Fi::Complex
+	 *\brief Inequality operator.
+	 */
+	template<typename T>
+	bool operator!=(const Complex<T>& x, const Complex<T>& y);
+
+	/**\relates Fi::Complex
+	 *\brief Addition operator.
+	 */
+	template<typename T>
+	const Complex<T> operator+(const Complex<T>& x, const Complex<T>& y);
+
+	/**\relates Fi::Complex
+	 *\brief Subtraction operator.
+	 */
+	template<typename T>
+	const Complex<T> operator-(const Complex<T>& x, const Complex<T>& y);
+
+	/**\relates Fi::Complex
+	 *\brief Negation operator.
+	 */
+	template<typename T>
+	const Complex<T> operator-(const Complex<T>& x);
+
+	/**\relates Fi::Complex
+	 *\brief Multiplication operator using four multipliers.
+	 */
+	template<typename T>
+	const Complex<T> operator*(const Complex<T>& x, const Complex<T>& y);
+
+	/**\relates Fi::Complex
+	 *\brief Complex conjugate.
+	 */
+	template<typename T>
+	const Complex<T> conj(const Complex<T>& x);
+
+	/**\relates Fi::Complex
+	 *\brief Multiply two complex numbers using four multipliers.
+
+	 *The operands may have different formats. Each component of the
+	 *exact product is quantized once to \c ProdT.
+
+	 *\tparam ProdT Fi::Fixed type of the product.
+	 */
+	template<typename ProdT, typename T1, typename T2>
+	const Complex<ProdT> multiply(const Complex<T1>& x, const Complex<T2>& y);
+
+	/**\relates Fi::Complex
+	 *\brief Multiply two complex numbers using the selected multiplier
+	 *structure.
+
+	 *\tparam ProdT Fi::Fixed type of the product.
+	 *\tparam M Multiplier structure, Fi::FourMultipliers or
+	 *Fi::ThreeMultipliers.
+	 */
+	template<typename ProdT, typename M, typename T1, typename T2>
+	const Complex<ProdT> multiply(const Complex<T1>& x, const Complex<T2>& y);
+
+	/**\relates Fi::Complex
+	 *\brief Writes a complex number as <tt>(re,im)</tt>.
+	 */
+	template<typename T>
+	std::ostream& operator<<(std::ostream& os, const Complex<T>& x);
+
+
+	/**\brief A vector of complex numbers with interleaved storage.
+
+	 *Real and imaginary parts are stored alternately in one contiguous
+	 *array of \c T, the layout used by most hardware and file formats.
+	 *Element-wise operations on whole vectors use vector instructions
+	 *when available and give the same results as the scalar operators.
+
+	 *\tparam T A Fi::Fixed type.
+	 *\tparam Alloc Allocator for \c T, e.g. Fi::ArenaAllocator.
+	 */
+	template<typename T, typename Alloc = std::allocator<T> >
+	class ComplexVector {
+
+	public:
+
+		typedef Complex<T> value_type;
+		typedef Alloc allocator_type;
+
+		/**
+		 *\brief Creates an empty vector.
+		 */
+		explicit ComplexVector(const Alloc& alloc = Alloc());
+
+		/**
+		 *\brief Creates a vector of \c n zeros.
+		 */
+		explicit ComplexVector(std::size_t n, const Alloc& alloc = Alloc());
+
+		///Number of complex elements.
+		std::size_t size() const;
+
+		///Change the number of complex elements. New elements are zero.
+		void resize(std::size_t n);
+
+		///Element \c i.
+		const Complex<T> operator[](std::size_t i) const;
+
+		///Set element \c i.
+		void set(std::size_t i, const Complex<T>& x);
+
+		///Interleaved parts, <tt>2*size()</tt> values.
+		T* data();
+		///Interleaved parts, <tt>2*size()</tt> values.
+		const T* data() const;
+
+	private:
+
+		std::vector<T, Alloc> _data;
+
+	};
+
+	/**\relates Fi::ComplexVector
+	 *\brief Element-wise sum, <tt>out[i] = x[i] + y[i]</tt>.
+	 *\note \c out is resized to the size of \c x.
+	 *\throw std::invalid_argument if \c x and \c y have different sizes.
+	 */
+	template<typename T, typename A1, typename A2, typename A3>
+	void add(const ComplexVector<T, A1>& x, const ComplexVector<T, A2>& y,
+	         ComplexVector<T, A3>& out);
+
+	/**\relates Fi::ComplexVector
+	 *\brief Element-wise difference, <tt>out[i] = x[i] - y[i]</tt>.
+	 *\note \c out is resized to the size of \c x.
+	 *\throw std::invalid_argument if \c x and \c y have different sizes.
+	 */
+	template<typename T, typename A1, typename A2, typename A3>
+	void subtract(const ComplexVector<T, A1>& x, const ComplexVector<T, A2>& y,
+	              ComplexVector<T, A3>& out);
+
+	/**\relates Fi::ComplexVector
+	 *\brief Element-wise conjugate, <tt>out[i] = conj(x[i])</tt>.
+	 *\note \c out is resized to the size of \c x.
+	 */
+	template<typename T, typename A1, typename A2>
+	void conjugate(const ComplexVector<T, A1>& x, ComplexVector<T, A2>& out);
+
+	/**\relates Fi::ComplexVector
+	 *\brief Element-wise product using four multipliers,
+	 *<tt>out[i] = multiply<ProdT>(x[i], y[i])</tt>.
+	 *\note \c out is resized to the size of \c x.
+	 *\throw std::invalid_argument if \c x and \c y have different sizes.
+	 */
+	template<typename ProdT, typename T1, typename T2,
+	         typename A1, typename A2, typename A3>
+	void multiply(const ComplexVector<T1, A1>& x,
+	              const ComplexVector<T2, A2>& y,
+	              ComplexVector<ProdT, A3>& out);
+
+	/**\relates Fi::ComplexVector
+	 *\brief Element-wise product using the selected multiplier structure,
+	 *<tt>out[i] = multiply<ProdT, M>(x[i], y[i])</tt>.
+	 *\note \c out is resized to the size of \c x.
+	 *\throw std::invalid_argument if \c x and \c y have different sizes.
+	 */
+	template<typename ProdT, typename M, typename T1, typename T2,
+	         typename A1, typename A2, typename A3>
+	void multiply(const ComplexVector<T1, A1>& x,
+	              const ComplexVector<T2, A2>& y,
+	              ComplexVector<ProdT, A3>& out);
+
+}
+
+#include "private/Complex_priv.hpp"
+
+#endif
@@ -0,0 +1,173 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_CORDIC_HPP
+#define FI_CORDIC_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+
+namespace Fi {
+
+	/**\brief Elementary functions computed with the CORDIC algorithm.
+
+	 *Angles are in radians. Circular iteration \c i, for \c i from 0 to
+	 *<tt>Iterations - 1</tt>, rotates <tt>(x, y)</tt> by
+	 *<tt>d*atan(2^-i)</tt>, where \c d is 1 or -1:
+
+	 *<tt>x' = x - d*(y >> i)</tt>, <tt>y' = y + d*(x >> i)</tt>,
+	 *<tt>z' = z - d*atan(2^-i)</tt>
+
+	 *The datapath holds raw values with the fractional length of
+	 *\c FixedT for \c x and \c y, and of \c AngleT for \c z, and has
+	 *enough integer bits that it cannot overflow. Shifts truncate, as in
+	 *hardware, and the overflow handler of the destination type is
+	 *applied to each result. The rounding modes of the types are not
+	 *used.
+
+	 *The angles <tt>atan(2^-i)</tt>, \c pi, and the gain compensation
+	 *constant <tt>1/A = prod(cos(atan(2^-i)))</tt> are computed at
+	 *compile time using integer arithmetic and rounded to the nearest
+	 *value of \c AngleT and \c FixedT, so the results depend only on the
+	 *formats and the number of iterations.
+
+	 *The batch functions compute independent CORDICs four at a time
+	 *using vector instructions when \c FixedT has at most 29 bits and
+	 *\c AngleT at most 28 fractional bits, with the same results as the
+	 *scalar functions.
+
+	 *\code
+	 #include "fi/Cordic.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+
+	 typedef Fi::Fixed<16, 14, Fi::SIGNED, Fi::Saturate> sample;
+	 typedef Fi::Fixed<16, 13, Fi::SIGNED, Fi::Saturate> angle;
+	 typedef Fi::Cordic<sample, 14, angle> cordic;
+
+	 sample s, c;
+	 cordic::sincos(angle(0.5), s, c);
+	 angle a = cordic::atan2(s, c);
+	 \endcode
+
+	 *\tparam FixedT Signed Fi::Fixed type of the data, with at most 31
+	 *fractional bits.
+	 *\tparam Iterations Number of iterations, between 1 and 48.
+	 *\tparam AngleT Signed Fi::Fixed type of angles.
+	 */
+	template<typename FixedT, std::size_t Iterations, typename AngleT = FixedT>
+	class Cordic {
+
+	public:
+
+		///Number of iterations.
+		static const std::size_t ITERATIONS = Iterations;
+
+		/**
+		 *\brief The angle <tt>atan(2^-i)</tt> used by iteration \c i.
+		 */
+		static const AngleT angle(std::size_t i);
+
+		/**
+		 *\brief The gain compensation constant \c 1/A in \c FixedT, by
+		 *which sincos() scales its starting vector.
+		 */
+		static const FixedT compensation();
+
+		/**
+		 *\brief Rotation mode: rotate <tt>(x, y)</tt> by \c z, driving
+		 *\c z towards zero.
+
+		 *The rotated vector is multiplied by the gain \c A, about 1.647.
+		 *\c z must be within <tt>[-1.74, 1.74]</tt>.
+		 */
+		static void rotation(FixedT& x, FixedT& y, AngleT& z);
+
+		/**
+		 *\brief Vectoring mode: rotate <tt>(x, y)</tt> onto the \c x axis,
+		 *adding the angle of the vector to \c z.
+
+		 *\c x becomes \c A times the magnitude of the vector. \c x must not
+		 *be negative.
+		 */
+		static void vectoring(FixedT& x, FixedT& y, AngleT& z);
+
+		/**
+		 *\brief Sine and cosine of an angle in <tt>[-pi, pi]</tt>.
+
+		 *Rotation mode starting from <tt>(1/A, 0)</tt>, after a rotation
+		 *by \c pi when the angle is outside <tt>[-pi/2, pi/2]</tt>.
+		 */
+		static void sincos(const AngleT& a, FixedT& s, FixedT& c);
+
+		///Sine of an angle in <tt>[-pi, pi]</tt>. \sa sincos()
+		static const FixedT sin(const AngleT& a);
+
+		///Cosine of an angle in <tt>[-pi, pi]</tt>. \sa sincos()
+		static const FixedT cos(const AngleT& a);
+
+		/**
+		 *\brief Angle of the vector <tt>(x, y)</tt>, in <tt>[-pi, pi]</tt>.
+
+		 *Vectoring mode, after a rotation by \c pi when \c x is negative.
+		 *The angle of <tt>(0, 0)</tt> is 0, as for \c std::atan2.
+		 */
+		static const AngleT atan2(const FixedT& y, const FixedT& x);
+
+		/**
+		 *\brief Magnitude of the vector <tt>(x, y)</tt>.
+
+		 *Vectoring mode, with the result multiplied by \c 1/A.
+		 */
+		static const FixedT magnitude(const FixedT& x, const FixedT& y);
+
+		/**
+		 *\brief Square root.
+
+		 *The input is normalized by an even power of two to
+		 *<tt>[1/4, 1)</tt> and scaled by <tt>1/A_h^2</tt>, then hyperbolic
+		 *vectoring of <tt>(m + 1/4, m - 1/4)</tt> is run for shifts 1 to
+		 *\c Iterations, with shifts 4, 13 and 40 repeated. The datapath
+		 *has enough fractional bits that normalization is exact.
+		 *\throw std::domain_error if \c v is negative.
+		 */
+		static const FixedT sqrt(const FixedT& v);
+
+		///Element-wise sincos(). \sa sincos()
+		static void sincos(const AngleT* a, FixedT* s, FixedT* c,
+		                   std::size_t n);
+
+		///Element-wise atan2(). \sa atan2()
+		static void atan2(const FixedT* y, const FixedT* x, AngleT* out,
+		                  std::size_t n);
+
+		///Element-wise magnitude(). \sa magnitude()
+		static void magnitude(const FixedT* x, const FixedT* y, FixedT* out,
+		                      std::size_t n);
+
+	};
+
+}
+
+#include "private/Cordic_priv.hpp"
+
+#endif
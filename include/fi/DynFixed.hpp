@@ -0,0 +1,527 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_DYN_FIXED_HPP
+#define FI_DYN_FIXED_HPP
+
+#include "Fixed.hpp"
+#include "overflow/Saturate.hpp"
+#include "overflow/Sticky.hpp"
+#include "overflow/Throw.hpp"
+#include "overflow/Undefined.hpp"
+#include "overflow/Wrap.hpp"
+#include "rounding/Ceil.hpp"
+#include "rounding/Classic.hpp"
+#include "rounding/Fix.hpp"
+#include "rounding/Floor.hpp"
+#include "rounding/NearEven.hpp"
+#include "rounding/NearOdd.hpp"
+
+#include <cstddef>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <utility>
+
+namespace Fi {
+
+	/**\brief Overflow handler of a Fi::DynFixed number.
+	 */
+	enum OverflowMode {
+		///Fi::Saturate
+		SATURATE_OVERFLOW,
+		///Fi::Wrap
+		WRAP_OVERFLOW,
+		///Fi::Throw
+		THROW_OVERFLOW,
+		///Fi::Undefined
+		UNDEFINED_OVERFLOW,
+		///Fi::StickySaturate
+		STICKY_SATURATE_OVERFLOW,
+		///Fi::StickyWrap
+		STICKY_WRAP_OVERFLOW
+	};
+
+	/**\brief Rounding mode of a Fi::DynFixed number.
+	 */
+	enum RoundingMode {
+		///Fi::Ceil
+		CEIL_ROUNDING,
+		///Fi::Classic
+		CLASSIC_ROUNDING,
+		///Fi::Fix
+		FIX_ROUNDING,
+		///Fi::Floor
+		FLOOR_ROUNDING,
+		///Fi::NearEven
+		NEAR_EVEN_ROUNDING,
+		///Fi::NearOdd
+		NEAR_ODD_ROUNDING
+	};
+
+	/**\brief Format and policies of a Fi::DynFixed number.
+
+	 *Everything that Fi::Fixed derives from its template arguments is
+	 *computed once when the format is created: the masks, the limits and
+	 *the functions implementing the overflow handler and rounding mode.
+	 *Numbers refer to their format, which must outlive them.
+	 *
+	 *\code
+	 for (std::size_t f = 0; f <= 12; ++f) {
+	 	Fi::DynFormat format(12, f, Fi::SIGNED,
+	 	                     Fi::SATURATE_OVERFLOW, Fi::CLASSIC_ROUNDING);
+	 	Fi::DynFixed x(format, 3.14159);
+	 	std::cout << x << std::endl;
+	 }
+	 \endcode
+	 */
+	class DynFormat {
+
+	public:
+
+		///Largest supported word length.
+		static const std::size_t MAX_WORD_LENGTH = 32;
+
+		/**
+		 *\brief Creates a format.
+		 *\param wordLength Total word length in bits, including the sign
+		 *bit.
+		 *\param fractionLength Number of fractional bits.
+		 *\param signedness Signedness of the type.
+		 *\param overflow Overflow handler.
+		 *\param rounding Rounding mode.
+		 *\throw std::invalid_argument if \c wordLength is zero or greater
+		 *than \c MAX_WORD_LENGTH, or if \c fractionLength is greater than
+		 *\c wordLength.
+		 */
+		DynFormat(std::size_t wordLength, std::size_t fractionLength,
+		          Signedness signedness, OverflowMode overflow,
+		          RoundingMode rounding);
+
+		/**
+		 *\brief The format of a Fi::Fixed type.
+
+		 *The format is created on first use and lives until the program
+		 *exits.
+		 */
+		template<typename FixedT>
+		static const DynFormat& of();
+
+		///Total word length in bits, including the sign bit.
+		std::size_t wordLength() const;
+		///Number of fractional bits.
+		std::size_t fractionLength() const;
+		///Signedness of the type.
+		Signedness signedness() const;
+		///Overflow handler.
+		OverflowMode overflow() const;
+		///Rounding mode.
+		RoundingMode rounding() const;
+
+		///A mask to obtain the entire number discarding any padding bits.
+		int64_t tMask() const;
+		///A mask to obtain the sign bit and its extension.
+		int64_t sMask() const;
+		///A mask to obtain the fractional bits only.
+		int64_t fMask() const;
+		///Binary representation of the largest value.
+		int64_t maxVal() const;
+		///Binary representation of the smallest value.
+		int64_t minVal() const;
+
+		///Whether both formats have the same lengths and policies.
+		bool operator==(const DynFormat& that) const;
+
+		///Whether the formats differ.
+		bool operator!=(const DynFormat& that) const;
+
+		/** \name Operations used by Fi::DynFixed */
+		//@{
+
+		/**\internal
+		 *\brief Reduce an intermediate result to the internal type of
+		 *the equivalent Fi::Fixed, which is twice as wide as the number.
+		 */
+		int64_t internal(uint64_t n) const;
+
+		/**\internal
+		 *\brief Detect and handle overflow of an intermediate result.
+		 */
+		int64_t fromFixedPoint(int64_t n) const;
+
+		/**\internal
+		 *\brief Round away the lower \c F bits of an intermediate result.
+		 */
+		std::pair<int64_t, int> round(int64_t n) const;
+
+		/**\internal
+		 *\brief Round and overflow-check a floating-point number.
+		 */
+		int64_t fromDouble(double f) const;
+
+		/**\internal
+		 *\brief Parse, round and overflow-check a string.
+		 */
+		int64_t fromString(const std::string& number) const;
+
+		/**\internal
+		 *\brief Binary representation with the sign extended.
+		 */
+		int64_t fromBinary(int64_t value) const;
+
+		///\internal \brief Integer part of a binary representation.
+		std::string integerString(int64_t val) const;
+
+		///\internal \brief Fractional part of a binary representation.
+		std::string fractionalString(int64_t val) const;
+
+		///\internal \brief Decimal form of a binary representation.
+		std::string toString(int64_t val) const;
+
+		//@}
+
+	private:
+
+		typedef int64_t (*Handler)(const DynFormat& format, int64_t n);
+
+		typedef std::pair<int64_t, int>
+		(*Rounder)(const DynFormat& format, int64_t n);
+
+		typedef std::pair<int64_t, int>
+		(*DoubleRounder)(const DynFormat& format, double f, int64_t n);
+
+		typedef std::pair<int64_t, int>
+		(*StringRounder)(const DynFormat& format, const std::string& str,
+		                 int64_t n);
+
+		template<RoundingMode R>
+		void setRounding();
+
+		template<OverflowMode OF>
+		void setOverflow();
+
+		int64_t overflowFromString(const std::string& str, int64_t n,
+		                           int roundingDirection) const;
+
+		std::size_t _w;
+		std::size_t _f;
+		Signedness _s;
+		OverflowMode _overflow;
+		RoundingMode _rounding;
+
+		std::size_t _internalBits;
+
+		int64_t _tMask;
+		int64_t _sMask;
+		int64_t _fMask;
+		int64_t _maxVal;
+		int64_t _minVal;
+
+		double _minDouble;
+		double _maxDouble;
+
+		Handler _positiveOverflow;
+		Handler _negativeOverflow;
+		Rounder _round;
+		DoubleRounder _roundDouble;
+		StringRounder _roundString;
+
+	};
+
+	/**
+	 *\brief A fixed-point number whose format and policies are chosen at
+	 *run time.
+
+	 *Every operation gives the same result as the same operation on the
+	 *Fi::Fixed type of the same format, so a single binary can sweep word
+	 *lengths, fraction lengths and policies. Conversions to and from
+	 *Fi::Fixed are lossless.
+
+	 *Operations on numbers of different formats throw.
+
+	 *A number refers to its format without copying it. Since C++11,
+	 *creating a number from a temporary format does not compile.
+
+	 *\code
+	 Fi::DynFormat format(8, 4, Fi::SIGNED, Fi::WRAP_OVERFLOW,
+	                      Fi::CLASSIC_ROUNDING);
+	 Fi::DynFixed a(format, "3.14");
+	 Fi::DynFixed b(format, "13.14");
+	 std::cout << a*b << std::endl;
+
+	 typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Wrap, Fi::Classic> fixed;
+	 fixed c = (a*b).toFixed<fixed>();
+	 \endcode
+	 */
+	class DynFixed {
+
+	public:
+
+		/**
+		 *\brief Creates a new number initialized to zero.
+		 */
+		explicit DynFixed(const DynFormat& format);
+
+		/**
+		 *\brief Creates a new number from a floating-point number.
+		 */
+		DynFixed(const DynFormat& format, double f);
+
+		/**
+		 *\brief Creates a new number from a string.
+		 *\throw std::invalid_argument if \c number is not a valid number.
+		 */
+		DynFixed(const DynFormat& format, const std::string& number);
+
+		/**
+		 *\brief Converts a Fi::Fixed number without loss, using
+		 *DynFormat::of().
+		 */
+		template<std::size_t W, std::size_t F, Signedness S,
+		         template <typename> class OF,
+		         template <typename> class R>
+		DynFixed(const Fixed<W, F, S, OF, R>& x);
+
+		/**
+		 *\brief Creates a number from its binary representation.
+		 */
+		static DynFixed fromBinary(const DynFormat& format, int64_t value);
+
+		/**
+		 *\brief Convert to another format as Fi::Fixed::fromFixed() would.
+		 */
+		DynFixed convert(const DynFormat& format) const;
+
+		/**
+		 *\brief Convert to a Fi::Fixed type without loss.
+		 *\throw std::invalid_argument if the word length, fraction length
+		 *or signedness of \c FixedT differ from those of the number.
+		 */
+		template<typename FixedT>
+		FixedT toFixed() const;
+
+		///Format of the number.
+		const DynFormat& format() const;
+
+		/**
+		 *\brief Increment operator.
+		 *\throw std::invalid_argument if the formats differ.
+		 */
+		DynFixed& operator+=(const DynFixed& x);
+
+		/**
+		 *\brief Decrement operator.
+		 *\throw std::invalid_argument if the formats differ.
+		 */
+		DynFixed& operator-=(const DynFixed& x);
+
+		/**
+		 *\brief Multiply and store operator.
+		 *\throw std::invalid_argument if the formats differ.
+		 */
+		DynFixed& operator*=(const DynFixed& x);
+
+		/**
+		 *\brief Divide and store operator.
+		 *\throw std::invalid_argument if the formats differ.
+		 */
+		DynFixed& operator/=(const DynFixed& x);
+
+		///Binary inversion operator.
+		const DynFixed operator~() const;
+
+		/**
+		 *\brief Binary OR and store.
+		 *\throw std::invalid_argument if the formats differ.
+		 */
+		DynFixed& operator|=(const DynFixed& x);
+
+		/**
+		 *\brief Binary AND and store.
+		 *\throw std::invalid_argument if the formats differ.
+		 */
+		DynFixed& operator&=(const DynFixed& x);
+
+		/**
+		 *\brief Binary XOR and store.
+		 *\throw std::invalid_argument if the formats differ.
+		 */
+		DynFixed& operator^=(const DynFixed& x);
+
+		///Binary right-shift and store.
+		DynFixed& operator>>=(std::size_t pos);
+
+		///Binary left-shift and store.
+		DynFixed& operator<<=(std::size_t pos);
+
+		///Convert to \c float.
+		float toFloat() const;
+
+		///Convert to \c double.
+		double toDouble() const;
+
+		///Integer part of number.
+		std::string integer() const;
+
+		///Fractional part of number.
+		std::string fraction() const;
+
+		///String representation of number.
+		std::string toString() const;
+
+		///Returns a string containing the binary representation of number.
+		std::string toBinaryString() const;
+
+		/**
+		 *\brief Returns the raw binary representation of the number.
+		 *\param extendSign Extend the sign bit and maintain sign.
+		 */
+		int64_t toBinary(bool extendSign=false) const;
+
+		///Maximum value of a format.
+		static DynFixed MaxVal(const DynFormat& format);
+
+		///Minimum value of a format.
+		static DynFixed MinVal(const DynFormat& format);
+
+#if __cplusplus >= 201103L
+		/** \name Temporary formats
+		 *A number keeps a pointer to its format, which would dangle once a
+		 *temporary format is destroyed.
+		 */
+		//@{
+		explicit DynFixed(const DynFormat&& format) = delete;
+		DynFixed(const DynFormat&& format, double f) = delete;
+		DynFixed(const DynFormat&& format, const std::string& number) = delete;
+		static DynFixed fromBinary(const DynFormat&& format,
+		                           int64_t value) = delete;
+		DynFixed convert(const DynFormat&& format) const = delete;
+		static DynFixed MaxVal(const DynFormat&& format) = delete;
+		static DynFixed MinVal(const DynFormat&& format) = delete;
+		//@}
+#endif
+
+	private:
+
+		const DynFormat* _format;
+		int64_t _val;
+
+	};
+
+	/** \name Comparison operators */
+	//@{
+	/**\brief Equality check operator.
+	 *\throw std::invalid_argument if the formats differ.
+	 *\relates Fi::DynFixed
+	 */
+	bool operator==(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Inequality check operator.
+	 *\relates Fi::DynFixed
+	 */
+	bool operator!=(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Less than operator.
+	 *\throw std::invalid_argument if the formats differ.
+	 *\relates Fi::DynFixed
+	 */
+	bool operator<(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Less than or equals operator.
+	 *\relates Fi::DynFixed
+	 */
+	bool operator<=(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Greater than operator.
+	 *\relates Fi::DynFixed
+	 */
+	bool operator>(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Greater than or equals operator.
+	 *\relates Fi::DynFixed
+	 */
+	bool operator>=(const DynFixed& x, const DynFixed& y);
+	//@}
+
+	/** \name Arithmetic operators */
+	//@{
+	/**\brief Addition operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator+(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Subtraction operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator-(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Negation operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator-(const DynFixed& a);
+
+	/**\brief Multiplication operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator*(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Division operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator/(const DynFixed& x, const DynFixed& y);
+	//@}
+
+	/** \name Bitwise operators */
+	//@{
+	/**\brief Binary OR operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator|(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Binary AND operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator&(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Binary XOR operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator^(const DynFixed& x, const DynFixed& y);
+
+	/**\brief Binary left-shift operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator<<(const DynFixed& x, std::size_t pos);
+
+	/**\brief Binary right-shift operator.
+	 *\relates Fi::DynFixed
+	 */
+	const DynFixed operator>>(const DynFixed& x, std::size_t pos);
+	//@}
+
+	///\relates Fi::DynFixed
+	std::ostream& operator<<(std::ostream& os, const DynFixed& x);
+
+}
+
+#include "private/DynFixed_priv.hpp"
+
+#endif
@@ -0,0 +1,171 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_EXPLORE_HPP
+#define FI_EXPLORE_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief Error of a kernel computed with one fixed-point format.
+	 */
+	struct Exploration {
+
+		///Name of the tag of the grid, or empty.
+		std::string label;
+		///Signedness of the format.
+		Signedness signedness;
+		///Word length of the format.
+		std::size_t wordLength;
+		///Fraction length of the format.
+		std::size_t fractionLength;
+		/**Name of the overflow handler, like \c saturate, or empty for a
+		 *handler not provided by the library.
+		 */
+		std::string overflow;
+		/**Name of the rounding mode, like \c classic, or empty for a mode
+		 *not provided by the library.
+		 */
+		std::string rounding;
+		/**Root mean square error of the outputs against the reference,
+		 *infinite if the kernel threw an exception.
+		 */
+		double rmsError;
+		///Largest magnitude of an error, infinite if the kernel threw.
+		double maxError;
+
+		///Name of the format, like \c s16.8.
+		std::string format() const;
+
+	};
+
+	/**\internal
+	 *\brief A format of a grid and the instantiation of the kernel that
+	 *uses it.
+	 */
+	template<typename Kernel>
+	struct ExplorationJob;
+
+	/**\brief The formats of a word length from \c W_MIN to \c W_MAX and a
+	 *fraction length from \c F_MIN to the smaller of \c F_MAX and the word
+	 *length, with the given signedness and handlers.
+
+	 *Grids are combined with Fi::FormatGrids.
+
+	 *\tparam Tag Type with a static member function
+	 *<tt>const char* name()</tt> labelling the results, or \c void.
+	 */
+	template<std::size_t W_MIN, std::size_t W_MAX,
+	         std::size_t F_MIN, std::size_t F_MAX, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R,
+	         typename Tag = void>
+	struct FormatGrid {
+
+		/**\internal
+		 *\brief Append a job for every format of the grid.
+		 */
+		template<typename Kernel>
+		static void add(std::vector< ExplorationJob<Kernel> >& jobs);
+
+	};
+
+	/**\brief The union of two grids, either of which can be a union.
+	 */
+	template<typename G1, typename G2>
+	struct FormatGrids {
+
+		/**\internal
+		 *\brief Append the jobs of both grids.
+		 */
+		template<typename Kernel>
+		static void add(std::vector< ExplorationJob<Kernel> >& jobs);
+
+	};
+
+	/**\brief Run a kernel with every format of a grid in parallel, and
+	 *measure the error of its outputs against a reference.
+
+	 *Each format of the grid instantiates the kernel, so that a single
+	 *build explores all of them. \c Kernel has a member function
+	 *template <tt>template<typename FixedT> void run(std::vector<double>&
+	 *out) const</tt> that computes the model with \c FixedT and appends
+	 *its outputs, converted to \c double, to \c out. It is called
+	 *concurrently from several threads and should not modify shared
+	 *state.
+
+	 *The jobs are distributed among \c threads worker threads, or one
+	 *per processor if \c threads is 0. Without thread support, they run
+	 *in the calling thread.
+
+	 *\code
+	 #include "fi/Explore.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 struct Filter {
+	 	template<typename FixedT>
+	 	void run(std::vector<double>& out) const { ... }
+	 };
+
+	 typedef Fi::FormatGrid<8, 24, 4, 20, Fi::SIGNED,
+	                        Fi::Saturate, Fi::Classic> grid;
+
+	 std::vector<Fi::Exploration> r =
+	 	Fi::explore<grid>(Filter(), reference);
+	 Fi::reportExploration(std::cout, Fi::paretoFront(r));
+	 \endcode
+
+	 *\param kernel Model to run.
+	 *\param reference Outputs of the model computed in double precision.
+	 *\param threads Number of worker threads, or 0 for one per processor.
+	 *\return One result per format, in the order of the grid.
+	 *\throw std::invalid_argument if the kernel produces a number of
+	 *outputs different from that of \c reference.
+	 */
+	template<typename Grid, typename Kernel>
+	std::vector<Exploration> explore(const Kernel& kernel,
+	                                 const std::vector<double>& reference,
+	                                 std::size_t threads = 0);
+
+	/**\brief The results not dominated by another: no result of at most
+	 *the same word length has a smaller or equal root mean square error,
+	 *with at least one of the two strictly better. Sorted by word length.
+	 */
+	inline std::vector<Exploration>
+	paretoFront(const std::vector<Exploration>& results);
+
+	/**\brief Print a table of results.
+	 */
+	inline void reportExploration(std::ostream& os,
+	                              const std::vector<Exploration>& results);
+
+}
+
+#include "private/Explore_priv.hpp"
+
+#endif
@@ -0,0 +1,221 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_FFT_HPP
+#define FI_FFT_HPP
+
+#include "Complex.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief Butterfly of an FFT, which decides where the twiddle factors
+	 *are applied and so how the data are rounded. Both take and return
+	 *data in natural order.
+	 */
+	enum FFTDecimation {
+		///Twiddle factors applied to the inputs, before the sums.
+		DECIMATION_IN_TIME,
+		///Twiddle factors applied to the outputs, after the sums.
+		DECIMATION_IN_FREQUENCY
+	};
+
+	/**\brief How an FFT prevents the growth of its data between stages.
+	 */
+	enum FFTScaling {
+		///No scaling; overflow is handled by the overflow handler.
+		NO_SCALING,
+		///Each stage divides its outputs by a fixed power of two.
+		SHIFT_SCALING,
+		/**Block floating point: before each stage, the whole block is
+		 *examined and the stage divides its outputs by the smallest power
+		 *of two, up to <tt>2^MAX_SHIFT</tt>, that leaves \c MAX_SHIFT bits
+		 *of headroom above the largest magnitude.
+		 */
+		BLOCK_FLOATING_POINT
+	};
+
+	/**\internal
+	 *\brief Number of radix-\c RADIX stages in an \c N point FFT. Fails to
+	 *compile unless \c RADIX is 2 or 4 and \c N is a power of \c RADIX.
+	 */
+	template<std::size_t N, std::size_t RADIX>
+	struct StageCount {
+		typedef char RadixCheck[(RADIX == 2 || RADIX == 4) ? 1 : -1];
+		typedef char SizeCheck[(N % RADIX == 0) ? 1 : -1];
+		static const std::size_t value =
+			1 + StageCount<N/RADIX, RADIX>::value;
+	};
+
+	template<std::size_t RADIX>
+	struct StageCount<1, RADIX> {
+		static const std::size_t value = 0;
+	};
+
+	/**\brief In-place fixed-point FFT of a fixed size.
+
+	 *The transform is computed in \c log_RADIX(N) stages of butterflies.
+	 *Each output of a butterfly is computed exactly and then quantized
+	 *once to \c FixedT using its rounding mode and overflow handler,
+	 *after being divided by \c 2^s where \c s is the shift of the stage.
+	 *With twiddle factor \c w, and \c j applied exactly:
+
+	 *- radix-2 decimation in frequency: <tt>a + b</tt>, <tt>(a - b)w</tt>
+	 *- radix-2 decimation in time: <tt>a + bw</tt>, <tt>a - bw</tt>
+	 *- radix-4: the four-point DFT of the inputs, with the twiddle
+	 *  factors applied to the outputs (frequency) or inputs (time).
+
+	 *Inputs and outputs are in natural order. Twiddle factors are
+	 *rounded from their exact values by the constructor of \c CoefT, so
+	 *\c CoefT should saturate unless it can represent 1.
+
+	 *The inverse transform uses conjugate twiddle factors and is not
+	 *divided by \c N. After a transform, exponent() gives the total
+	 *shift: the exact DFT is the output multiplied by
+	 *<tt>2^exponent()</tt>.
+
+	 *When vector instructions are available, butterflies are computed
+	 *on four complex numbers at a time for signed \c FixedT of at most 15
+	 *bits (14 for radix-4) and signed \c CoefT of at most 15 bits. The
+	 *results are identical to those of the scalar code.
+
+	 *\code
+	 #include "fi/FFT.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> sample;
+	 typedef Fi::Fixed<14, 13, Fi::SIGNED, Fi::Saturate, Fi::Classic> coef;
+
+	 Fi::FFT<sample, 256, coef, 4> fft(Fi::BLOCK_FLOATING_POINT);
+	 Fi::ComplexVector<sample> x(256);
+	 ...
+	 fft.forward(x);
+	 int e = fft.exponent();
+	 \endcode
+
+	 *\tparam FixedT Signed Fi::Fixed type of the data.
+	 *\tparam N Number of points, a power of \c RADIX.
+	 *\tparam CoefT Signed Fi::Fixed type of the twiddle factors.
+	 *\tparam RADIX 2 or 4.
+	 *\tparam D Decimation in time or in frequency.
+	 */
+	template<typename FixedT, std::size_t N, typename CoefT = FixedT,
+	         std::size_t RADIX = 2,
+	         FFTDecimation D = DECIMATION_IN_FREQUENCY>
+	class FFT {
+
+	public:
+
+		///Number of points.
+		static const std::size_t SIZE = N;
+
+		///Number of stages.
+		static const std::size_t STAGES = StageCount<N, RADIX>::value;
+
+		///Largest shift of a stage.
+		static const unsigned MAX_SHIFT = (RADIX == 4) ? 3 : 2;
+
+		/**
+		 *\brief Creates the engine and its twiddle tables.
+
+		 *With Fi::SHIFT_SCALING every stage shifts by \c log2(RADIX)
+		 *bits, which divides the output by \c N, unless changed using
+		 *setShift().
+		 */
+		explicit FFT(FFTScaling scaling = NO_SCALING);
+
+		///Scaling method.
+		FFTScaling scaling() const;
+
+		/**
+		 *\brief Set the shift of a stage for Fi::SHIFT_SCALING.
+		 *\throw std::invalid_argument if \c stage is not less than \c STAGES
+		 *or \c bits is greater than \c MAX_SHIFT.
+		 */
+		void setShift(std::size_t stage, unsigned bits);
+
+		///Shift of a stage for Fi::SHIFT_SCALING.
+		unsigned shift(std::size_t stage) const;
+
+		/**
+		 *\brief Total shift applied by the last transform.
+		 */
+		int exponent() const;
+
+		/**
+		 *\brief In-place forward transform of \c N interleaved complex
+		 *numbers.
+		 */
+		void forward(FixedT* data);
+
+		/**
+		 *\brief In-place inverse transform of \c N interleaved complex
+		 *numbers.
+		 */
+		void inverse(FixedT* data);
+
+		/**
+		 *\brief In-place forward transform.
+		 *\throw std::invalid_argument if the size of \c x is not \c N.
+		 */
+		template<typename Alloc>
+		void forward(ComplexVector<FixedT, Alloc>& x);
+
+		/**
+		 *\brief In-place inverse transform.
+		 *\throw std::invalid_argument if the size of \c x is not \c N.
+		 */
+		template<typename Alloc>
+		void inverse(ComplexVector<FixedT, Alloc>& x);
+
+		/**
+		 *\brief Twiddle factor <tt>exp(-2*pi*j*i/N)</tt> in the format
+		 *used by the engine.
+		 */
+		static const Complex<CoefT> twiddle(std::size_t i);
+
+	private:
+
+		static std::size_t span(std::size_t stage);
+
+		void transform(FixedT* data, bool inverse);
+		void permute(FixedT* data) const;
+		unsigned stageShift(std::size_t stage, const FixedT* data) const;
+		void stage(FixedT* data, std::size_t stage, bool inverse, unsigned s);
+
+		FFTScaling _scaling;
+		unsigned _shift[STAGES];
+		int _exponent;
+
+		std::size_t _offset[STAGES];
+		ComplexVector<CoefT> _twiddles;
+		std::vector<std::size_t> _reversed;
+
+	};
+
+}
+
+#include "private/FFT_priv.hpp"
+
+#endif
@@ -0,0 +1,174 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_FIR_HPP
+#define FI_FIR_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Fi {
+
+	template<typename InT, typename CoefT>
+	struct FIRKernel;
+
+	/**\brief Streaming polyphase FIR filter with a guard-bit accumulator.
+
+	 *The filter upsamples its input by \c interpolation (inserting
+	 *zeros), filters it with the taps, and keeps every \c decimation-th
+	 *output. It is implemented as a polyphase filter that only computes
+	 *the outputs that are kept, without multiplying by the inserted
+	 *zeros.
+
+	 *Each product of an input and a tap is computed exactly and
+	 *converted to \c AccT, then added to the accumulator using the
+	 *operators of \c AccT, from the oldest input to the newest. The sum
+	 *is converted once to \c OutT using its rounding mode and overflow
+	 *handler. The filter keeps its state between calls to process(), so
+	 *a signal can be filtered in blocks of any size.
+
+	 *When \c AccT is signed, has as many fractional bits as the products
+	 *and enough integer bits that no sum of the taps can overflow it, see
+	 *overflowFree(), the dot products are computed using integer
+	 *arithmetic, and using 16-bit multiply-add instructions for signed
+	 *inputs and taps of at most 16 bits. The results are the same as
+	 *those of the operators.
+
+	 *\code
+	 #include "fi/FIR.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<12, 11, Fi::SIGNED, Fi::Saturate, Fi::Classic> sample;
+	 typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> coef;
+	 typedef Fi::Fixed<32, 26, Fi::SIGNED, Fi::Saturate, Fi::Classic> acc;
+
+	 std::vector<coef> taps = ...;
+	 Fi::FIR<sample, coef, acc, sample> decimator(taps, 1, 4);
+
+	 std::vector<sample> in = ..., out;
+	 decimator.process(in, out);
+	 \endcode
+
+	 *\tparam InT Fi::Fixed type of the input.
+	 *\tparam CoefT Fi::Fixed type of the taps.
+	 *\tparam AccT Fi::Fixed type of the accumulator. The difference
+	 *between its fractional length and that of the products, and that of
+	 *\c OutT, must be less than 31 bits.
+	 *\tparam OutT Fi::Fixed type of the output.
+	 */
+	template<typename InT, typename CoefT, typename AccT, typename OutT = InT>
+	class FIR {
+
+	public:
+
+		/**
+		 *\brief Creates a filter with its state set to zero.
+		 *\param taps Impulse response of the filter.
+		 *\param interpolation Upsampling factor.
+		 *\param decimation Downsampling factor.
+		 *\throw std::invalid_argument if there are no taps or a factor is
+		 *zero.
+		 */
+		explicit FIR(const std::vector<CoefT>& taps,
+		             std::size_t interpolation = 1,
+		             std::size_t decimation = 1);
+
+		/**
+		 *\brief Creates a filter from an array of \c count taps.
+		 *\throw std::invalid_argument if there are no taps or a factor is
+		 *zero.
+		 */
+		FIR(const CoefT* taps, std::size_t count,
+		    std::size_t interpolation = 1, std::size_t decimation = 1);
+
+		///Number of taps.
+		std::size_t size() const;
+
+		///Upsampling factor.
+		std::size_t interpolation() const;
+
+		///Downsampling factor.
+		std::size_t decimation() const;
+
+		/**
+		 *\brief \c true if the accumulator can neither round nor overflow
+		 *for any input.
+		 */
+		bool overflowFree() const;
+
+		/**
+		 *\brief Largest number of outputs produced from \c n inputs.
+		 */
+		std::size_t maxOutputs(std::size_t n) const;
+
+		/**
+		 *\brief Filter a block of inputs.
+		 *\param in Inputs.
+		 *\param n Number of inputs.
+		 *\param out Outputs, with room for at least <tt>maxOutputs(n)</tt>
+		 *values.
+		 *\return Number of outputs.
+		 */
+		std::size_t process(const InT* in, std::size_t n, OutT* out);
+
+		/**
+		 *\brief Filter a block of inputs, replacing the contents of
+		 *\c out with the outputs.
+		 */
+		template<typename InAlloc, typename OutAlloc>
+		void process(const std::vector<InT, InAlloc>& in,
+		             std::vector<OutT, OutAlloc>& out);
+
+		/**
+		 *\brief Set the state to zero, as after construction.
+		 */
+		void reset();
+
+	private:
+
+		typedef FIRKernel<InT, CoefT> Kernel;
+		typedef typename Kernel::raw_type Raw;
+
+		void init(const CoefT* taps, std::size_t count);
+		const OutT output(const Raw* x, std::size_t phase) const;
+
+		std::size_t _size;
+		std::size_t _interpolation;
+		std::size_t _decimation;
+
+		std::size_t _length;
+		std::vector<Raw> _phases;
+		bool _overflowFree;
+
+		std::vector<Raw> _buffer;
+		std::size_t _time;
+
+	};
+
+}
+
+#include "private/FIR_priv.hpp"
+
+#endif
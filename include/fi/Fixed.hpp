@@ -24,6 +24,7 @@
 #define FI_FIXED_HPP
 
 #include "private/Fi.hpp"
+#include "private/Constexpr.hpp"
 #include "private/Traits.hpp"
 #include "private/OverflowDetector.hpp"
 #include "private/StaticAssert.hpp"
@@ -140,6 +141,10 @@ namespace Fi {
 		///A mask to obtain the sign bit.
 		static const valtype S_MASK = TR::S_MASK;
 
+		///Size of a buffer large enough to hold the output of toString().
+		static const std::size_t STRING_LENGTH =
+			StringConversion::BufferLength<TR>::value;
+
 		///Overflow handler.
 		typedef OverflowDetector< TR, OF > OFH;
 		///Rounding handler.
@@ -148,12 +153,12 @@ namespace Fi {
 		/**
 		 *\brief Creates a new Fixed object initialized to zero.
 		 */
-		Fixed();
+		FI_CONSTEXPR Fixed();
 
 		/**
 		 *\brief Copies a Fixed object.
 		 */
-		Fixed(const Fixed& a);
+		FI_CONSTEXPR Fixed(const Fixed& a);
 
 		/**
 		 *\brief Creates a new Fixed object from a double-precision 
@@ -161,7 +166,7 @@ namespace Fi {
 		 *
 		 *\param f Floating-point number.
 		 */
-		explicit Fixed(double f);
+		explicit FI_CONSTEXPR Fixed(double f);
 
 		/**
 		 *\brief Creates a new Fixed object from a string.
@@ -199,23 +204,23 @@ namespace Fi {
 		 *\return A fixed-point number.
 		 *\note All but the first W bits will be ignored.
 		 */
-		static Fixed fromBinary(valtype value);
+		static FI_CONSTEXPR Fixed fromBinary(valtype value);
 
 		/**
 		 *\brief Assignment operator.
 		 *\param that Fixed object to assign from.
 		 */
-		Fixed& operator=(const Fixed& that);
+		FI_CONSTEXPR Fixed& operator=(const Fixed& that);
 
 		/**
 		 *\brief Less-than comparison operator.
 		 */
-		bool operator<(const Fixed& x) const;
+		FI_CONSTEXPR bool operator<(const Fixed& x) const;
 
 		/**
 		 *\brief Equality comparison operator
 		 */
-		bool operator==(const Fixed& x) const;
+		FI_CONSTEXPR bool operator==(const Fixed& x) const;
 
 		/**
 		 *\brief Increment operator.
@@ -224,7 +229,7 @@ namespace Fi {
 
 		 *\param x Increment amount.
 		 */
-		Fixed& operator+=(const Fixed& x);
+		FI_CONSTEXPR Fixed& operator+=(const Fixed& x);
 
 		/**
 		 *\brief Decrement operator.
@@ -233,7 +238,7 @@ namespace Fi {
 
 		 *\param x Decrement amount.
 		 */
-		Fixed& operator-=(const Fixed& x);
+		FI_CONSTEXPR Fixed& operator-=(const Fixed& x);
 
 		/**
 		 *\brief Multiply and store operator.
@@ -242,7 +247,7 @@ namespace Fi {
 
 		 *\param x Multiplicand.
 		 */
-		Fixed& operator*=(const Fixed& x);
+		FI_CONSTEXPR Fixed& operator*=(const Fixed& x);
 
 		/**
 		 *\brief Divide and store operator.
@@ -251,12 +256,12 @@ namespace Fi {
 
 		 *\param x Divisor.
 		 */
-		Fixed& operator/=(const Fixed& x);
+		FI_CONSTEXPR Fixed& operator/=(const Fixed& x);
 
 		/**
 		 *\brief Bit-wise \c NOT.
 		 */
-		const Fixed operator~() const;
+		FI_CONSTEXPR const Fixed operator~() const;
 
 		/**
 		 *\brief Bit-wise \c OR and store.
@@ -265,7 +270,7 @@ namespace Fi {
 
 		 *\param x \c OR operand.
 		 */
-		Fixed& operator|=(const Fixed& x);
+		FI_CONSTEXPR Fixed& operator|=(const Fixed& x);
 
 		/**
 		 *\brief Bit-wise \c AND and store.
@@ -274,7 +279,7 @@ namespace Fi {
 
 		 *\param x \c AND operand.
 		 */
-		Fixed& operator&=(const Fixed& x);
+		FI_CONSTEXPR Fixed& operator&=(const Fixed& x);
 
 		/**
 		 *\brief Bit-wise \c XOR and store.
@@ -283,7 +288,7 @@ namespace Fi {
 
 		 *\param x \c XOR operand.
 		 */
-		Fixed& operator^=(const Fixed& x);
+		FI_CONSTEXPR Fixed& operator^=(const Fixed& x);
 
 		/**
 		 *\brief Binary right-shift and store.
@@ -293,7 +298,7 @@ namespace Fi {
 		 *However, for signed numbers, the behavior is defined by
 		 *the compiler.
 		 */
-		Fixed& operator>>=(std::size_t pos);
+		FI_CONSTEXPR Fixed& operator>>=(std::size_t pos);
 
 		/**
 		 *\brief Binary left-shift and store.
@@ -301,7 +306,7 @@ namespace Fi {
 
 		 *\note Zeros are shifted in.
 		 */
-		Fixed& operator<<=(std::size_t pos);
+		FI_CONSTEXPR Fixed& operator<<=(std::size_t pos);
 
 		/**
 		 *\brief Convert to \c float.
@@ -312,7 +317,7 @@ namespace Fi {
 		 *\sa Fixed::toString() for a higher-precision display method.
 		 *\return floating-point number.
 		 */
-		float toFloat() const;
+		FI_CONSTEXPR float toFloat() const;
 
 		/**
 		 *\brief Convert to \c double.
@@ -323,7 +328,7 @@ namespace Fi {
 		 *\sa Fixed::toString() for a higher-precision display method.
 		 *\return floating-point number.
 		 */
-		double toDouble() const;
+		FI_CONSTEXPR double toDouble() const;
 
 		/**
 		 *\brief Integer part of number.
@@ -357,6 +362,20 @@ namespace Fi {
 		 */
 		std::string toString() const;
 
+		/**
+		 *\brief Writes the string representation of number to a buffer.
+
+		 *Writes the same characters as Fixed::toString(), followed by a
+		 *null character, without allocating any memory. The output is
+		 *truncated if \c size is less than Fixed::STRING_LENGTH.
+
+		 *\param buffer Destination buffer.
+		 *\param size Size of \c buffer in characters.
+		 *\returns Length of the full string representation, excluding the
+		 *null character.
+		 */
+		std::size_t toString(char* buffer, std::size_t size) const;
+
 		/**
 		 *\brief Returns a string containing the binary representation of number.
 
@@ -373,7 +392,7 @@ namespace Fi {
 		 *negative numbers might appear to the compiler as positive if
 		 *W < sizeof(valtype)
 		 */
-		valtype toBinary(bool extendSign=false) const;
+		FI_CONSTEXPR valtype toBinary(bool extendSign=false) const;
 
 		/**
 		 *\brief Maximum possible value.
@@ -382,7 +401,7 @@ namespace Fi {
 
 		 *\return Maximum possible value.
 		 */
-		static Fixed MaxVal();
+		static FI_CONSTEXPR Fixed MaxVal();
 
 		/**
 		 *\brief Minimum possible value.
@@ -391,7 +410,7 @@ namespace Fi {
 
 		 *\return Minimum possible value.
 		 */
-		static Fixed MinVal();
+		static FI_CONSTEXPR Fixed MinVal();
 
 	private:
 
@@ -409,7 +428,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator==(const Fi::Fixed<W, F, S, OF, R>& x, 
+	inline FI_CONSTEXPR bool operator==(const Fi::Fixed<W, F, S, OF, R>& x, 
 	                       const Fi::Fixed<W, F, S, OF, R>& y);
 
 	/**
@@ -419,7 +438,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator!=(const Fi::Fixed<W, F, S, OF, R>& x, 
+	inline FI_CONSTEXPR bool operator!=(const Fi::Fixed<W, F, S, OF, R>& x, 
 	                       const Fi::Fixed<W, F, S, OF, R>& y);
 
 	/**
@@ -429,7 +448,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator<(const Fi::Fixed<W, F, S, OF, R>& x, 
+	inline FI_CONSTEXPR bool operator<(const Fi::Fixed<W, F, S, OF, R>& x, 
 	                      const Fi::Fixed<W, F, S, OF, R>& y);
 
 	/**
@@ -439,7 +458,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator<=(const Fi::Fixed<W, F, S, OF, R>& x, 
+	inline FI_CONSTEXPR bool operator<=(const Fi::Fixed<W, F, S, OF, R>& x, 
 	                       const Fi::Fixed<W, F, S, OF, R>& y);
 
 	/**
@@ -449,7 +468,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator>(const Fi::Fixed<W, F, S, OF, R>& x, 
+	inline FI_CONSTEXPR bool operator>(const Fi::Fixed<W, F, S, OF, R>& x, 
 	                      const Fi::Fixed<W, F, S, OF, R>& y);
 
 	/**
@@ -460,7 +479,7 @@ namespace Fi {
 	         template <typename> class OF,
 	         template <typename> class R>
 
-	inline bool operator>=(const Fi::Fixed<W, F, S, OF, R>& x, 
+	inline FI_CONSTEXPR bool operator>=(const Fi::Fixed<W, F, S, OF, R>& x, 
 	                       const Fi::Fixed<W, F, S, OF, R>& y);
 
 	//@}
@@ -475,7 +494,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R> 
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R> 
 	operator+(const Fi::Fixed<W, F, S, OF, R>& x, 
 	          const Fi::Fixed<W, F, S, OF, R>& y);
 
@@ -486,7 +505,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R> 
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R> 
 	operator-(const Fi::Fixed<W, F, S, OF, R>& x, 
 	          const Fi::Fixed<W, F, S, OF, R>& y);
 
@@ -502,7 +521,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R> 
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R> 
 	operator-(const Fi::Fixed<W, F, S, OF, R>& a);
 
 	/**
@@ -512,7 +531,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R>
 	operator*(const Fi::Fixed<W, F, S, OF, R>& x, 
 	          const Fi::Fixed<W, F, S, OF, R>& y);
 
@@ -523,7 +542,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R>
 	operator/(const Fi::Fixed<W, F, S, OF, R>& x, 
 	          const Fi::Fixed<W, F, S, OF, R>& y);
 
@@ -534,7 +553,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R>
 	min(const Fi::Fixed<W, F, S, OF, R>& x, 
 	    const Fi::Fixed<W, F, S, OF, R>& y);
 
@@ -545,7 +564,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R>
 	max(const Fi::Fixed<W, F, S, OF, R>& x, 
 	    const Fi::Fixed<W, F, S, OF, R>& y);
 	
@@ -561,7 +580,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R> 
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R> 
 	operator~(const Fi::Fixed<W, F, S, OF, R>& x);
 
 	/**
@@ -571,7 +590,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R> 
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R> 
 	operator|(const Fi::Fixed<W, F, S, OF, R>& x, 
 	          const Fi::Fixed<W, F, S, OF, R>& y);
 
@@ -582,7 +601,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R> 
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R> 
 	operator&(const Fi::Fixed<W, F, S, OF, R>& x, 
 	          const Fi::Fixed<W, F, S, OF, R>& y);
 
@@ -593,7 +612,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R> 
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R> 
 	operator^(const Fi::Fixed<W, F, S, OF, R>& x, 
 	          const Fi::Fixed<W, F, S, OF, R>& y);
 
@@ -609,7 +628,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R> 
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R> 
 	operator<<(const Fi::Fixed<W, F, S, OF, R>& x, std::size_t pos);
 
 	/**
@@ -626,8 +645,149 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fi::Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fi::Fixed<W, F, S, OF, R>
 	operator>>(const Fi::Fixed<W, F, S, OF, R>& x, std::size_t pos);
+
+	/**
+	 *\brief Number of leading zeros in the \c W bits of the raw value,
+	 *or \c W if the value is zero.
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	std::size_t clz(const Fi::Fixed<W, F, S, OF, R>& x);
+
+	/**
+	 *\brief Number of leading sign bits, excluding the sign bit itself.
+
+	 *This is the number of positions by which a signed number can be
+	 *shifted to the left without overflow, from 0 up to <tt>W - 1</tt>
+	 *for 0 and -1. For unsigned numbers, it is the same as clz().
+
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	std::size_t cls(const Fi::Fixed<W, F, S, OF, R>& x);
+
+	/**
+	 *\brief Shift the bits of a number to the left by cls(), so that the
+	 *bit below the sign bit differs from it, or the most significant bit
+	 *of an unsigned number is set.
+	 *\return The shift.
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	std::size_t normalize(Fi::Fixed<W, F, S, OF, R>& x);
+
+	/**
+	 *\brief Bits \c HI down to \c LO of the raw value, as an unsigned
+	 *integer.
+
+	 *Bit 0 is the least significant bit. The result has the overflow
+	 *handler and rounding mode of \c x.
+
+	 *\code
+	 Fi::Fixed<16, 8, Fi::SIGNED> x = ...;
+	 Fi::Fixed<4, 0, Fi::UNSIGNED> nibble = Fi::slice<11, 8>(x);
+	 \endcode
+
+	 *\tparam HI Index of the most significant bit, less than \c W.
+	 *\tparam LO Index of the least significant bit, at most \c HI.
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t HI, std::size_t LO,
+	         std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	const Fi::Fixed<HI - LO + 1, 0, Fi::UNSIGNED, OF, R>
+	slice(const Fi::Fixed<W, F, S, OF, R>& x);
+
+	/**
+	 *\brief The raw bits of \c a followed by those of \c b.
+
+	 *The result has the signedness, overflow handler and rounding mode of
+	 *\c a, and the fractional bits of \c b. Its word length, the sum of
+	 *those of \c a and \c b, must not exceed 32 bits.
+
+	 *\code
+	 Fi::Fixed<8, 0, Fi::SIGNED> i = ...;
+	 Fi::Fixed<8, 8, Fi::UNSIGNED> f = ...;
+	 Fi::Fixed<16, 8, Fi::SIGNED> x = Fi::concat(i, f);
+	 \endcode
+
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t W1, std::size_t F1, Fi::Signedness S1,
+	         template <typename> class OF1,
+	         template <typename> class R1,
+	         std::size_t W2, std::size_t F2, Fi::Signedness S2,
+	         template <typename> class OF2,
+	         template <typename> class R2>
+	const Fi::Fixed<W1 + W2, F2, S1, OF1, R1>
+	concat(const Fi::Fixed<W1, F1, S1, OF1, R1>& a,
+	       const Fi::Fixed<W2, F2, S2, OF2, R2>& b);
+
+	/**
+	 *\brief clz() of each element of an array.
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	void clz(const Fi::Fixed<W, F, S, OF, R>* x, std::size_t* out,
+	         std::size_t n);
+
+	/**
+	 *\brief cls() of each element of an array.
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	void cls(const Fi::Fixed<W, F, S, OF, R>* x, std::size_t* out,
+	         std::size_t n);
+
+	/**
+	 *\brief normalize() each element of an array, storing the shifts in
+	 *\c shifts.
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	void normalize(Fi::Fixed<W, F, S, OF, R>* x, std::size_t* shifts,
+	               std::size_t n);
+
+	/**
+	 *\brief slice() of each element of an array.
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t HI, std::size_t LO,
+	         std::size_t W, std::size_t F, Fi::Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	void slice(const Fi::Fixed<W, F, S, OF, R>* x,
+	           Fi::Fixed<HI - LO + 1, 0, Fi::UNSIGNED, OF, R>* out,
+	           std::size_t n);
+
+	/**
+	 *\brief concat() of the elements of two arrays.
+	 *\relates Fi::Fixed
+	 */
+	template<std::size_t W1, std::size_t F1, Fi::Signedness S1,
+	         template <typename> class OF1,
+	         template <typename> class R1,
+	         std::size_t W2, std::size_t F2, Fi::Signedness S2,
+	         template <typename> class OF2,
+	         template <typename> class R2>
+	void concat(const Fi::Fixed<W1, F1, S1, OF1, R1>* a,
+	            const Fi::Fixed<W2, F2, S2, OF2, R2>* b,
+	            Fi::Fixed<W1 + W2, F2, S1, OF1, R1>* out, std::size_t n);
 	//@}
 
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
@@ -635,13 +795,78 @@ namespace Fi {
 	         template <typename> class R>
 	std::ostream& 
 	operator<<(std::ostream& os, const Fi::Fixed<W, F, S, OF, R>& x);
+
+#if __cplusplus >= 201402L
+	/**\brief Value of a fixed-point literal, see Fi::literals.
+
+	 *Converts implicitly to any Fi::Fixed type. The conversion is the same
+	 *as Fixed(double), so the value is rounded by the rounding mode and
+	 *checked by the overflow handler of the destination type. The result
+	 *is a compile-time constant when the destination is \c constexpr.
+
+	 *\note Requires C++14.
+	 */
+	class FixedLiteral {
+
+	public:
+
+		///Creates a literal with value \c value.
+		explicit constexpr FixedLiteral(double value);
+
+		///Converts the literal to a fixed-point number.
+		template<std::size_t W, std::size_t F, Fi::Signedness S,
+		         template <typename> class OF,
+		         template <typename> class R>
+		constexpr operator Fi::Fixed<W, F, S, OF, R>() const;
+
+		///Value of the literal.
+		constexpr double value() const;
+
+	private:
+
+		double _value;
+
+	};
+
+	/**\brief User-defined literals for fixed-point numbers.
+
+	 *\code
+	 #include "fi/Fixed.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 using namespace Fi::literals;
+
+	 typedef Fi::Fixed<16, 12, Fi::SIGNED, Fi::Saturate, Fi::Classic> coef;
+
+	 constexpr coef pi = 3.14159_fx;
+	 constexpr coef twoPi = pi + pi;
+	 static_assert(twoPi.toBinary() == 25736, "");
+	 \endcode
+
+	 *The literal is first converted to \c double, as would be done by
+	 *writing the same number without the suffix.
+
+	 *\note Requires C++14.
+	 */
+	namespace literals {
+
+		///Fixed-point literal from a floating-point number.
+		constexpr FixedLiteral operator"" _fx(long double value);
+
+		///Fixed-point literal from an integer.
+		constexpr FixedLiteral operator"" _fx(unsigned long long value);
+
+	}
+#endif
+
 }
 
 namespace std {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fi::Fixed<W, F, S, OF, R> abs(const Fi::Fixed<W, F, S, OF, R>& x);
+	FI_CONSTEXPR Fi::Fixed<W, F, S, OF, R> abs(const Fi::Fixed<W, F, S, OF, R>& x);
 }
 
 #include "private/Fixed_priv.hpp"
@@ -0,0 +1,116 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef FI_LLR_HPP
+#define FI_LLR_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+
+namespace Fi {
+
+	/**\brief Check-node kernels of LDPC and polar decoders on saturating
+	 *log-likelihood ratios.
+
+	 *The LLRs are signed Fi::Fixed numbers with the Fi::Saturate overflow
+	 *handler; other types fail to compile. Every operation saturates as
+	 *the operators of the type do: the magnitude of an LLR is
+	 *<tt>x < 0 ? -x : x</tt>, so the most negative value has the
+	 *largest positive magnitude, and sums and differences saturate after
+	 *each step. The results are the same as those of the compositions of
+	 *Fi::Fixed operators given for each function.
+
+	 *The check-node functions process \c n check nodes of the same
+	 *\c degree at once. Their messages are stored edge by edge: message
+	 *\c j of node \c k is at <tt>j*n + k</tt>. Output \c j of a node is
+	 *computed from all of its inputs except input \c j, and \c out may be
+	 *\c in.
+
+	 *For types of at most 16 bits, vector instructions process eight
+	 *nodes or elements at a time.
+
+	 *\code
+	 #include "fi/Llr.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Floor.hpp"
+
+	 typedef Fi::Fixed<6, 1, Fi::SIGNED, Fi::Saturate, Fi::Floor> llr;
+
+	 std::vector<llr> v2c(6*z), c2v(6*z); //z nodes of degree 6
+	 Fi::llr::offsetMinSum(&v2c[0], &c2v[0], 6, z, llr(0.5));
+	 \endcode
+	 */
+	namespace llr {
+
+		/**
+		 *\brief Min-sum check-node update: the product of the signs and
+		 *the smallest magnitude of the other inputs.
+		 *\throw std::invalid_argument if \c degree is less than 2.
+		 */
+		template<typename T>
+		void minSum(const T* in, T* out, std::size_t degree, std::size_t n);
+
+		/**
+		 *\brief Offset min-sum check-node update: the smallest magnitude
+		 *is reduced by \c offset, <tt>max(m - offset, 0)</tt>, before the
+		 *sign is applied.
+		 *\throw std::invalid_argument if \c degree is less than 2 or
+		 *\c offset is negative.
+		 */
+		template<typename T>
+		void offsetMinSum(const T* in, T* out, std::size_t degree,
+		                  std::size_t n, const T& offset);
+
+		/**
+		 *\brief Normalized min-sum check-node update: the smallest
+		 *magnitude is multiplied by \c scale, <tt>m*scale</tt> with the
+		 *rounding mode of \c T, before the sign is applied.
+		 *\throw std::invalid_argument if \c degree is less than 2 or
+		 *\c scale is negative.
+		 */
+		template<typename T>
+		void normalizedMinSum(const T* in, T* out, std::size_t degree,
+		                      std::size_t n, const T& scale);
+
+		/**
+		 *\brief Element-wise box-plus of two LLRs,
+		 *<tt>2*atanh(tanh(a/2)*tanh(b/2))</tt>, with the correction terms
+		 *approximated piecewise linearly:
+
+		 *<tt>s*min(|a|, |b|) + c(|a + b|) - c(|a - b|)</tt>
+
+		 *where \c s is the product of the signs and
+		 *<tt>c(x) = max(T(0.625) - (x >> 2), 0)</tt> approximates
+		 *<tt>log(1 + exp(-x))</tt>.
+		 */
+		template<typename T>
+		void boxplus(const T* a, const T* b, T* out, std::size_t n);
+
+	}
+
+}
+
+#include "private/Llr_priv.hpp"
+
+#endif
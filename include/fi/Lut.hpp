@@ -0,0 +1,135 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_LUT_HPP
+#define FI_LUT_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+
+namespace Fi {
+
+	/**\brief Table-driven approximations of elementary functions, in the
+	 *style of hardware lookup-table blocks.
+
+	 *The input is normalized to a mantissa and an exponent using its
+	 *leading one, the \c TableBits bits below the leading one select a
+	 *segment of a table, and the remaining bits \c t, truncated to 30
+	 *bits, interpolate within the segment. The function of the mantissa
+	 *is computed with 30 fractional bits using integer arithmetic, scaled
+	 *by the power of two given by the exponent, and quantized once to
+	 *\c OutT using its rounding mode and overflow handler.
+
+	 *The tables are generated the first time a function is used with a
+	 *given set of template arguments.
+
+	 *\code
+	 #include "fi/Lut.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<16, 8, Fi::UNSIGNED, Fi::Saturate, Fi::Classic> in;
+	 typedef Fi::Fixed<16, 14, Fi::UNSIGNED, Fi::Saturate, Fi::Classic> out;
+
+	 out r = Fi::lut::reciprocal<in, out, 6>(in(3.5));
+	 out s = Fi::lut::rsqrt<in, out, 5, Fi::lut::QUADRATIC>(in(3.5));
+	 \endcode
+	 */
+	namespace lut {
+
+		/**\brief Evaluation of the segments of a table, trading accuracy
+		 *for table size and arithmetic.
+		 */
+		enum Interpolation {
+			///The value at the middle of the segment.
+			NEAREST,
+			///<tt>c0 + c1*t</tt> through the ends of the segment.
+			LINEAR,
+			/**<tt>c0 + c1*t + c2*t*(t - 1)</tt> through the ends and the
+			 *middle of the segment.
+			 */
+			QUADRATIC
+		};
+
+		/**
+		 *\brief <tt>1/x</tt>, from a table of <tt>1/m</tt> over
+		 *<tt>[1, 2)</tt>.
+		 *\tparam TableBits Number of index bits, between 1 and 16.
+		 *\throw std::domain_error if \c x is zero.
+		 */
+		template<typename InT, typename OutT, std::size_t TableBits,
+		         Interpolation I>
+		const OutT reciprocal(const InT& x);
+
+		///Linearly interpolated reciprocal(). \sa reciprocal()
+		template<typename InT, typename OutT, std::size_t TableBits>
+		const OutT reciprocal(const InT& x);
+
+		/**
+		 *\brief <tt>1/sqrt(x)</tt>, from a table of <tt>1/sqrt(m)</tt> over
+		 *<tt>[1, 4)</tt> with <tt>2^(TableBits + 1)</tt> segments.
+		 *\tparam TableBits Number of index bits, between 1 and 16.
+		 *\throw std::domain_error if \c x is not positive.
+		 */
+		template<typename InT, typename OutT, std::size_t TableBits,
+		         Interpolation I>
+		const OutT rsqrt(const InT& x);
+
+		///Linearly interpolated rsqrt(). \sa rsqrt()
+		template<typename InT, typename OutT, std::size_t TableBits>
+		const OutT rsqrt(const InT& x);
+
+		/**
+		 *\brief <tt>log2(x)</tt>: the exponent plus a table of
+		 *<tt>log2(m)</tt> over <tt>[1, 2)</tt>.
+		 *\tparam TableBits Number of index bits, between 1 and 16.
+		 *\throw std::domain_error if \c x is not positive.
+		 */
+		template<typename InT, typename OutT, std::size_t TableBits,
+		         Interpolation I>
+		const OutT log2(const InT& x);
+
+		///Linearly interpolated log2(). \sa log2()
+		template<typename InT, typename OutT, std::size_t TableBits>
+		const OutT log2(const InT& x);
+
+		/**
+		 *\brief <tt>2^x</tt>: a table of <tt>2^f</tt> over <tt>[0, 1)</tt>
+		 *for the fractional part of \c x, scaled by its integer part.
+		 *\tparam TableBits Number of index bits, between 1 and 16.
+		 */
+		template<typename InT, typename OutT, std::size_t TableBits,
+		         Interpolation I>
+		const OutT exp2(const InT& x);
+
+		///Linearly interpolated exp2(). \sa exp2()
+		template<typename InT, typename OutT, std::size_t TableBits>
+		const OutT exp2(const InT& x);
+
+	}
+
+}
+
+#include "private/Lut_priv.hpp"
+
+#endif
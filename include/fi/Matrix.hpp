@@ -0,0 +1,190 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_MATRIX_HPP
+#define FI_MATRIX_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief A dense matrix of fixed-point numbers.
+
+	 *Elements are stored row by row. Every row starts on a boundary of
+	 *\c ALIGNMENT bytes, so rows are padded to stride() elements; the
+	 *padding is kept at zero.
+
+	 *Products are computed at full precision and then quantized once per
+	 *element using the rounding mode and overflow handler of the product
+	 *type, instead of once per partial product as when composing
+	 *Fi::Fixed operators. The product type is chosen for each operation:
+
+	 *\code
+	 #include "fi/Matrix.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> sample;
+	 typedef Fi::Fixed<16, 14, Fi::SIGNED, Fi::Saturate, Fi::Classic> coef;
+	 typedef Fi::Fixed<16, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> product;
+
+	 Fi::Matrix<coef> h(4, 4);
+	 Fi::Matrix<sample> x(4, 1024);
+	 ...
+	 Fi::Matrix<product> y;
+	 Fi::multiply(h, x, y);
+	 Fi::Matrix<coef> g = Fi::multiply<coef>(Fi::transpose(h), h);
+	 \endcode
+
+	 *Matrix products are computed in tiles that stay in the cache, in
+	 *parallel when compiled with OpenMP. For inputs that fit 16-bit signed
+	 *integers, whose sums are known not to overflow 32 bits from the
+	 *values of the operands, the sums are computed using 16-bit
+	 *multiply-add instructions. The results do not depend on the path.
+
+	 *With OpenMP, row tiles run in parallel only for C++11 or later. An
+	 *exception thrown by the overflow handler of the product type is then
+	 *rethrown once all the tiles are done, that of the first tile if
+	 *several throw.
+
+	 *\tparam T A Fi::Fixed type.
+	 */
+	template<typename T>
+	class Matrix {
+
+	public:
+
+		typedef T value_type;
+
+		///Alignment of the rows in bytes.
+		static const std::size_t ALIGNMENT = 64;
+
+		/**
+		 *\brief Creates an empty matrix.
+		 */
+		Matrix();
+
+		/**
+		 *\brief Creates a matrix of zeros.
+		 */
+		Matrix(std::size_t rows, std::size_t cols);
+
+		Matrix(const Matrix& that);
+		Matrix& operator=(const Matrix& that);
+
+		///Number of rows.
+		std::size_t rows() const;
+
+		///Number of columns.
+		std::size_t cols() const;
+
+		///Distance between the first elements of consecutive rows.
+		std::size_t stride() const;
+
+		/**
+		 *\brief Change the size of the matrix, setting all elements to
+		 *zero.
+		 */
+		void resize(std::size_t rows, std::size_t cols);
+
+		///Element in row \c i and column \c j.
+		T& operator()(std::size_t i, std::size_t j);
+		///Element in row \c i and column \c j.
+		const T& operator()(std::size_t i, std::size_t j) const;
+
+		///First element of row \c i.
+		T* row(std::size_t i);
+		///First element of row \c i.
+		const T* row(std::size_t i) const;
+
+	private:
+
+		void allocate();
+
+		std::size_t _rows;
+		std::size_t _cols;
+		std::size_t _stride;
+
+		std::vector<T> _storage;
+		T* _data;
+
+	};
+
+	/**\relates Fi::Matrix
+	 *\brief Matrix product, <tt>out = x*y</tt>.
+
+	 *Each element of the exact product is quantized once to \c ProdT. The
+	 *difference between the sum of the fractional lengths of \c T1 and
+	 *\c T2 and the fractional length of \c ProdT must be less than 31
+	 *bits.
+
+	 *\note \c out is resized to <tt>x.rows()</tt> by <tt>y.cols()</tt>.
+	 *\throw std::invalid_argument if <tt>x.cols()</tt> differs from
+	 *<tt>y.rows()</tt>.
+	 *\throw std::overflow_error if the values of the operands do not
+	 *guarantee that the exact sums fit 64 bits.
+	 */
+	template<typename ProdT, typename T1, typename T2>
+	void multiply(const Matrix<T1>& x, const Matrix<T2>& y,
+	              Matrix<ProdT>& out);
+
+	/**\relates Fi::Matrix
+	 *\brief Matrix product, <tt>x*y</tt>, quantized to \c ProdT.
+	 */
+	template<typename ProdT, typename T1, typename T2>
+	const Matrix<ProdT> multiply(const Matrix<T1>& x, const Matrix<T2>& y);
+
+	/**\relates Fi::Matrix
+	 *\brief Matrix-vector product, <tt>out = x*y</tt>, with the same
+	 *quantization as the matrix product.
+	 *\note \c out is resized to <tt>x.rows()</tt>.
+	 *\throw std::invalid_argument if <tt>x.cols()</tt> differs from
+	 *<tt>y.size()</tt>.
+	 *\throw std::overflow_error if the values of the operands do not
+	 *guarantee that the exact sums fit 64 bits.
+	 */
+	template<typename ProdT, typename T1, typename T2>
+	void multiply(const Matrix<T1>& x, const std::vector<T2>& y,
+	              std::vector<ProdT>& out);
+
+	/**\relates Fi::Matrix
+	 *\brief Transpose.
+	 *\note \c out is resized to <tt>x.cols()</tt> by <tt>x.rows()</tt>
+	 *and must not be \c x.
+	 */
+	template<typename T>
+	void transpose(const Matrix<T>& x, Matrix<T>& out);
+
+	/**\relates Fi::Matrix
+	 *\brief Transpose.
+	 */
+	template<typename T>
+	const Matrix<T> transpose(const Matrix<T>& x);
+
+}
+
+#include "private/Matrix_priv.hpp"
+
+#endif
@@ -0,0 +1,148 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_NCO_HPP
+#define FI_NCO_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief Numerically controlled oscillator (direct digital
+	 *synthesizer) generating blocks of sine and cosine samples.
+
+	 *The phase is a fraction of a cycle held in \c PhaseT, which must
+	 *have as many fractional bits as bits, and is advanced by the
+	 *increment modulo one cycle using native integer arithmetic, whatever
+	 *the overflow handler of \c PhaseT. Sample \c n is
+
+	 *<tt>table[((phase + dither(n)) mod 2^W) >> (W - TableBits)]</tt>
+
+	 *where the table holds <tt>sin(2*pi*i/2^TableBits)</tt> converted to
+	 *\c OutT by its constructor, so that discarding the
+	 *<tt>W - TableBits</tt> least significant bits of the phase models
+	 *phase truncation. The cosine uses the same table a quarter cycle
+	 *ahead.
+
+	 *With dithering, <tt>dither(n)</tt> is uniformly distributed over the
+	 *discarded bits of the phase, which spreads the spurs caused by
+	 *truncation into noise. It is an integer hash of the seed plus the
+	 *sample count, so a sequence depends only on the seed and the number
+	 *of samples generated, not on how it is split into blocks. Without
+	 *dithering it is zero.
+
+	 *Phases and table indices are computed four samples at a time using
+	 *vector instructions, and the table is read with gather instructions
+	 *when available; the samples are the same as those of the scalar
+	 *code.
+
+	 *\code
+	 #include "fi/NCO.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/overflow/Wrap.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<32, 32, Fi::UNSIGNED, Fi::Wrap> phase;
+	 typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> sample;
+
+	 Fi::NCO<phase, sample, 12> nco(phase(0.01), true);
+	 std::vector<sample> s(256), c(256);
+	 nco.sincos(&s[0], &c[0], s.size());
+	 \endcode
+
+	 *\tparam PhaseT Fi::Fixed type of the phase, with
+	 *<tt>FRACTION_LENGTH == WORD_LENGTH</tt>.
+	 *\tparam OutT Signed Fi::Fixed type of the samples.
+	 *\tparam TableBits Number of phase bits addressing the table, between
+	 *2 and 16 and at most the word length of \c PhaseT.
+	 */
+	template<typename PhaseT, typename OutT, std::size_t TableBits>
+	class NCO {
+
+	public:
+
+		///Number of table entries.
+		static const std::size_t TABLE_SIZE = std::size_t(1) << TableBits;
+
+		/**
+		 *\brief Creates an oscillator at phase zero.
+		 *\param increment Phase increment per sample, in cycles.
+		 *\param dither Whether to dither the phase before truncation.
+		 *\param seed Seed of the dither sequence.
+		 */
+		explicit NCO(const PhaseT& increment = PhaseT(), bool dither = false,
+		             uint32_t seed = 0);
+
+		///Phase increment per sample.
+		const PhaseT increment() const;
+
+		///Set the phase increment, keeping the phase.
+		void setIncrement(const PhaseT& increment);
+
+		///Phase of the next sample.
+		const PhaseT phase() const;
+
+		///Set the phase of the next sample.
+		void setPhase(const PhaseT& phase);
+
+		///Whether the phase is dithered.
+		bool dither() const;
+
+		///Restart the phase at zero and the dither sequence at its seed.
+		void reset();
+
+		///Table entry \c i, <tt>sin(2*pi*i/TABLE_SIZE)</tt>.
+		const OutT table(std::size_t i) const;
+
+		///Generate \c n sine samples.
+		void sin(OutT* out, std::size_t n);
+
+		///Generate \c n cosine samples.
+		void cos(OutT* out, std::size_t n);
+
+		///Generate \c n sine and cosine samples.
+		void sincos(OutT* s, OutT* c, std::size_t n);
+
+	private:
+
+		template<bool SIN, bool COS>
+		void generate(OutT* s, OutT* c, std::size_t n);
+
+		uint32_t _increment;
+		uint32_t _phase;
+		bool _dither;
+		uint32_t _seed;
+		uint32_t _count;
+
+		std::vector<int32_t> _table;
+
+	};
+
+}
+
+#include "private/NCO_priv.hpp"
+
+#endif
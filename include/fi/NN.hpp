@@ -0,0 +1,157 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_NN_HPP
+#define FI_NN_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+
+namespace Fi {
+
+	/**\brief Matrix product and convolution kernels of quantized neural
+	 *network layers.
+
+	 *Inputs, weights, biases and outputs may each have any Fi::Fixed
+	 *format. Each output is computed as in Fi::FIR: the bias is converted
+	 *to the accumulator type \c AccT, then each product of an input and a
+	 *weight is computed exactly, converted to \c AccT and added to the
+	 *accumulator using the operators of \c AccT, in order of increasing
+	 *\c k. The sum is converted once to the output type using its
+	 *rounding mode and overflow handler.
+
+	 *When \c AccT has as many fractional bits as the products and enough
+	 *integer bits that no output of the layer can overflow it, given the
+	 *weights and biases, the sums are computed using integer arithmetic,
+	 *and using 16-bit multiply-add instructions for inputs and weights
+	 *that fit 16-bit signed integers, such as 8-bit signed or unsigned
+	 *types. The results are the same as those of the operators.
+
+	 *The difference between the fractional length of \c AccT and that
+	 *of the products, and that of the output type, must be less than 31
+	 *bits.
+
+	 *\code
+	 #include "fi/NN.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/NearEven.hpp"
+
+	 typedef Fi::Fixed<8, 4, Fi::UNSIGNED, Fi::Saturate, Fi::NearEven> act;
+	 typedef Fi::Fixed<8, 7, Fi::SIGNED, Fi::Saturate, Fi::NearEven> weight;
+	 typedef Fi::Fixed<32, 11, Fi::SIGNED, Fi::Saturate, Fi::NearEven> acc;
+
+	 std::vector<act> x(batch*inputs), y(batch*outputs);
+	 std::vector<weight> w(outputs*inputs);
+	 std::vector<acc> b(outputs);
+	 ...
+	 Fi::nn::dense<acc>(&x[0], &w[0], &b[0], &y[0], batch, inputs, outputs);
+	 \endcode
+	 */
+	namespace nn {
+
+		/**
+		 *\brief Shape of a two-dimensional convolution.
+
+		 *The input is an image of \c height rows of \c width pixels of
+		 *\c channels values, row by row and pixel by pixel. It is
+		 *surrounded by \c padding pixels of zeros on every side. Each of
+		 *the \c filters filters has \c kernelHeight rows of
+		 *\c kernelWidth pixels of \c channels weights, stored in the same
+		 *order, and is moved by \c stride pixels between outputs. The
+		 *output has outputHeight() rows of outputWidth() pixels of
+		 *\c filters values.
+		 */
+		struct Conv2D {
+
+			/**
+			 *\throw std::invalid_argument if a size or the stride is zero,
+			 *or the kernel is larger than the padded input.
+			 */
+			Conv2D(std::size_t height, std::size_t width,
+			       std::size_t channels, std::size_t filters,
+			       std::size_t kernelHeight, std::size_t kernelWidth,
+			       std::size_t stride = 1, std::size_t padding = 0);
+
+			///Number of rows of the output.
+			std::size_t outputHeight() const;
+
+			///Number of columns of the output.
+			std::size_t outputWidth() const;
+
+			///Number of weights of a filter.
+			std::size_t filterSize() const;
+
+			std::size_t height;
+			std::size_t width;
+			std::size_t channels;
+			std::size_t filters;
+			std::size_t kernelHeight;
+			std::size_t kernelWidth;
+			std::size_t stride;
+			std::size_t padding;
+
+		};
+
+		/**
+		 *\brief Matrix product <tt>out = a*b</tt> of an \c m by \c k
+		 *matrix and a \c k by \c n matrix, stored row by row.
+		 */
+		template<typename AccT, typename InT, typename WT, typename OutT>
+		void gemm(const InT* a, const WT* b, OutT* out,
+		          std::size_t m, std::size_t n, std::size_t k);
+
+		/**
+		 *\brief Fully connected layer: output \c j of row \c i is
+		 *<tt>bias[j] + sum(x[i*inputs + k]*w[j*inputs + k])</tt>.
+		 *\param x \c batch rows of \c inputs values.
+		 *\param w \c outputs rows of \c inputs weights.
+		 *\param bias \c outputs values.
+		 *\param out \c batch rows of \c outputs values.
+		 */
+		template<typename AccT, typename InT, typename WT, typename BiasT,
+		         typename OutT>
+		void dense(const InT* x, const WT* w, const BiasT* bias, OutT* out,
+		           std::size_t batch, std::size_t inputs,
+		           std::size_t outputs);
+
+		/**
+		 *\brief Two-dimensional convolution (cross-correlation) of an
+		 *image with a bank of filters, plus one bias per filter.
+		 *\param shape Sizes of the image, the filters and the output.
+		 *\param in The image.
+		 *\param w <tt>shape.filters</tt> filters.
+		 *\param bias <tt>shape.filters</tt> values.
+		 *\param out The output image.
+		 */
+		template<typename AccT, typename InT, typename WT, typename BiasT,
+		         typename OutT>
+		void conv2d(const Conv2D& shape, const InT* in, const WT* w,
+		            const BiasT* bias, OutT* out);
+
+	}
+
+}
+
+#include "private/NN_priv.hpp"
+
+#endif
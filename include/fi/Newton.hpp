@@ -0,0 +1,122 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_NEWTON_HPP
+#define FI_NEWTON_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+
+namespace Fi {
+
+	/**\brief Format of the Newton-Raphson iterations for inputs of type
+	 *\c T.
+
+	 *A signed type with the overflow handler and rounding mode of \c T,
+	 *<tt>FRACTION_LENGTH = min(W, 28)</tt> fractional bits and three
+	 *integer bits, where \c W is the word length of \c T.
+	 */
+	template<typename T>
+	struct NewtonFormat;
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	struct NewtonFormat< Fixed<W, F, S, OF, R> > {
+		static const std::size_t FRACTION_LENGTH = (W < 28) ? W : 28;
+		typedef Fixed<FRACTION_LENGTH + 3, FRACTION_LENGTH, SIGNED, OF, R> type;
+	};
+
+	/**
+	 *\brief Reciprocal by Newton-Raphson iterations.
+
+	 *\c |x| is normalized to <tt>m*2^e</tt> with \c m in <tt>[1, 2)</tt>,
+	 *held in Fi::NewtonFormat (truncated if \c T has more than 28 bits).
+	 *The seed \c y is the reciprocal of the middle of one of 16 segments of
+	 *<tt>[1, 2)</tt>, selected by the four bits below the leading one of
+	 *\c m. Each iteration computes, in Fi::NewtonFormat,
+
+	 *<tt>t = m*y</tt>, <tt>y = y*(2 - t)</tt>
+
+	 *where each product is rounded and each result is overflow-handled
+	 *by the policies of \c T. The result <tt>+-y*2^-e</tt> is then rounded
+	 *to \c T. Each iteration roughly doubles the number of correct bits,
+	 *starting from about 5.
+
+	 *\code
+	 #include "fi/Newton.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<16, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> gain;
+
+	 gain g = Fi::newtonReciprocal<gain, 2>(gain(3.25));
+	 \endcode
+
+	 *\throw std::domain_error if \c x is zero.
+	 */
+	template<typename T, std::size_t Iterations>
+	const T newtonReciprocal(const T& x);
+
+	/**
+	 *\brief Reciprocal square root by Newton-Raphson iterations.
+
+	 *\c x is normalized to <tt>m*4^e</tt> with \c m in <tt>[1, 4)</tt>,
+	 *and the seed is taken from 16 segments of <tt>[1, 2)</tt> and 16 of
+	 *<tt>[2, 4)</tt>. Each iteration computes, in Fi::NewtonFormat,
+
+	 *<tt>t = y*y</tt>, <tt>t = m*t</tt>, <tt>y = y*(3 - t)/2</tt>
+
+	 *rounding each product, the last including the division by two, and
+	 *overflow-handling each result with the policies of \c T. The result
+	 *<tt>y*2^-e</tt> is then rounded to \c T.
+
+	 *\throw std::domain_error if \c x is not positive.
+	 */
+	template<typename T, std::size_t Iterations>
+	const T newtonRsqrt(const T& x);
+
+	/**
+	 *\brief Element-wise newtonReciprocal().
+
+	 *When vector instructions are available, the iterations run on four
+	 *elements at a time if Fi::NewtonFormat has at most 23 fractional
+	 *bits and the rounding mode of \c T has a vector implementation. The
+	 *results are the same as those of the scalar function.
+	 *\throw std::domain_error if an element is zero.
+	 */
+	template<typename T, std::size_t Iterations>
+	void newtonReciprocal(const T* x, T* out, std::size_t n);
+
+	/**
+	 *\brief Element-wise newtonRsqrt(). \sa newtonReciprocal(const T*, T*, std::size_t)
+	 *\throw std::domain_error if an element is not positive.
+	 */
+	template<typename T, std::size_t Iterations>
+	void newtonRsqrt(const T* x, T* out, std::size_t n);
+
+}
+
+#include "private/Newton_priv.hpp"
+
+#endif
@@ -0,0 +1,117 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef FI_POLAR_HPP
+#define FI_POLAR_HPP
+
+#include "Fixed.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+
+namespace Fi {
+
+	/**\brief Node operations of successive-cancellation decoders of polar
+	 *codes on saturating log-likelihood ratios.
+
+	 *A node of size \c 2n receives \c 2n LLRs, <tt>a = alpha[0, n)</tt>
+	 *and <tt>b = alpha[n, 2n)</tt>. Its left child receives
+	 *<tt>f(a, b)</tt>; once the left child has returned its partial
+	 *sums \c u, the right child receives <tt>g(a, b, u)</tt>; the node
+	 *returns <tt>combine(u, v)</tt> of the partial sums of its children.
+
+	 *The LLRs are signed Fi::Fixed numbers with the Fi::Saturate overflow
+	 *handler, as in Fi::llr, and the results are those of the given
+	 *compositions of Fi::Fixed operators. Bits are \c uint8_t values
+	 *that are 0 or 1. For types of at most 16 bits, vector instructions
+	 *process eight LLRs or sixteen bits at a time. Each function has an
+	 *overload taking the size of the node as a template argument, so
+	 *that the loops of small nodes are unrolled.
+
+	 *\code
+	 #include "fi/Polar.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+
+	 typedef Fi::Fixed<6, 1, Fi::SIGNED, Fi::Saturate> llr;
+
+	 llr alpha[64], left[32], right[32];
+	 uint8_t u[32], v[32], beta[64];
+
+	 Fi::polar::f<32>(alpha, alpha + 32, left);
+	 ... //decode left into u
+	 Fi::polar::g<32>(alpha, alpha + 32, u, right);
+	 ... //decode right into v
+	 Fi::polar::combine<32>(u, v, beta);
+	 \endcode
+	 */
+	namespace polar {
+
+		/**
+		 *\brief Min-sum approximation of the check-node operation,
+		 *<tt>s*min(|a|, |b|)</tt> where \c s is the product of the signs
+		 *and <tt>|x| = x < 0 ? -x : x</tt>.
+		 */
+		template<typename T>
+		void f(const T* a, const T* b, T* out, std::size_t n);
+
+		///f() on a node of size \c 2N.
+		template<std::size_t N, typename T>
+		void f(const T* a, const T* b, T* out);
+
+		/**
+		 *\brief Variable-node operation, <tt>u ? b - a : b + a</tt>.
+		 */
+		template<typename T>
+		void g(const T* a, const T* b, const uint8_t* u, T* out,
+		       std::size_t n);
+
+		///g() on a node of size \c 2N.
+		template<std::size_t N, typename T>
+		void g(const T* a, const T* b, const uint8_t* u, T* out);
+
+		/**
+		 *\brief Partial sums of a node of size \c 2n from those of its
+		 *children: <tt>out[i] = u[i] ^ v[i]</tt> and
+		 *<tt>out[n + i] = v[i]</tt>. \c out may be \c u when \c v is
+		 *<tt>u + n</tt>.
+		 */
+		void combine(const uint8_t* u, const uint8_t* v, uint8_t* out,
+		             std::size_t n);
+
+		///combine() on a node of size \c 2N.
+		template<std::size_t N>
+		void combine(const uint8_t* u, const uint8_t* v, uint8_t* out);
+
+		/**
+		 *\brief Hard decisions, 1 for negative LLRs and 0 otherwise.
+		 */
+		template<typename T>
+		void decide(const T* x, uint8_t* u, std::size_t n);
+
+	}
+
+}
+
+#include "private/Polar_priv.hpp"
+
+#endif
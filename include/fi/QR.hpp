@@ -0,0 +1,146 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_QR_HPP
+#define FI_QR_HPP
+
+#include "Cordic.hpp"
+#include "Matrix.hpp"
+
+#include <cstddef>
+
+namespace Fi {
+
+	/**\brief QR decomposition by a triangular systolic array of CORDIC
+	 *Givens rotations.
+
+	 *The rows of the input are fed one at a time into a triangular array
+	 *of cells that holds \c R, as in the array of Gentleman and Kung.
+	 *When a row reaches row \c i of the array, the boundary cell
+	 *<tt>(i, i)</tt> runs \c Iterations circular CORDIC iterations in
+	 *vectoring mode on <tt>(r_ii, x_i)</tt>, which zeros \c x_i, and
+	 *passes the direction of each iteration along the row. Each internal
+	 *cell <tt>(i, j)</tt> repeats the same iterations in rotation mode on
+	 *<tt>(r_ij, x_j)</tt>, keeps the first result and passes the second
+	 *one down to row <tt>i + 1</tt>. No angle is ever computed.
+
+	 *Boundary cells have the format \c BoundaryT and internal cells the
+	 *format \c InternalT. Every cell holds raw values with the fractional
+	 *length of its format, and shifts truncate as in Fi::Cordic. Each
+	 *output of a cell is then multiplied by the gain compensation constant
+	 *\c 1/A, truncated, and passed through the overflow handler of its
+	 *format. Inputs, and values passed from an internal cell to a
+	 *boundary cell, are converted to the format of the receiving cell
+	 *using its rounding mode and overflow handler. The results depend
+	 *only on the formats and the number of iterations, and are those of a
+	 *hardware array with these cells. All outputs have the type
+	 *\c InternalT: the diagonal of \c R is converted the same way.
+
+	 *Columns appended to the input, such as the received vector of a
+	 *MIMO detector, go through internal cells only, so the array also
+	 *computes <tt>Q^T b</tt>: <tt>a*x = b</tt> is solved by back
+	 *substitution of <tt>R*x = Q^T b</tt>. Complex matrices are handled
+	 *through their real-valued equivalents.
+
+	 *The batch functions decompose four matrices at a time using vector
+	 *instructions when both cell types are the same, with at most 29 bits
+	 *and 28 fractional bits, with the same results as the other functions.
+
+	 *\code
+	 #include "fi/QR.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<12, 9, Fi::SIGNED, Fi::Saturate, Fi::Classic> sample;
+	 typedef Fi::Fixed<18, 13, Fi::SIGNED, Fi::Saturate, Fi::Classic> cell;
+	 typedef Fi::QR<cell, 14> qr;
+
+	 //1000 channels of 8 rows, 8 columns and the received vector
+	 std::vector<sample> h(1000*8*9);
+	 std::vector<cell> r(1000*8*9);
+	 ...
+	 qr::batch<8, 8, 9>(&h[0], &r[0], 1000);
+	 \endcode
+
+	 *\tparam BoundaryT Signed Fi::Fixed type of the boundary cells, with
+	 *at most 31 fractional bits.
+	 *\tparam Iterations Number of CORDIC iterations, between 1 and 48.
+	 *\tparam InternalT Signed Fi::Fixed type of the internal cells, with
+	 *at most 31 fractional bits.
+	 */
+	template<typename BoundaryT, std::size_t Iterations,
+	         typename InternalT = BoundaryT>
+	class QR {
+
+	public:
+
+		///Number of CORDIC iterations of a cell.
+		static const std::size_t ITERATIONS = Iterations;
+
+		/**
+		 *\brief Decompose an \c m by \c n matrix.
+		 *\param a The matrix.
+		 *\param r Set to the \c n by \c n upper triangular factor, with a
+		 *non-negative diagonal.
+		 */
+		template<typename InT>
+		static void decompose(const Matrix<InT>& a, Matrix<InternalT>& r);
+
+		/**
+		 *\brief Decompose a matrix and rotate additional columns.
+		 *\param a The \c m by \c n matrix.
+		 *\param b An \c m by \c p matrix.
+		 *\param r Set to the \c n by \c n upper triangular factor.
+		 *\param qtb Set to the first \c n rows of <tt>Q^T b</tt>.
+		 *\throw std::invalid_argument if \c a and \c b do not have the same
+		 *number of rows.
+		 */
+		template<typename InT>
+		static void decompose(const Matrix<InT>& a, const Matrix<InT>& b,
+		                      Matrix<InternalT>& r, Matrix<InternalT>& qtb);
+
+		/**
+		 *\brief Decompose \c count matrices of \c M rows and \c C
+		 *columns, whose first \c N columns are triangularized and whose
+		 *others are rotated.
+		 *\param a \c count matrices, stored one after the other, row by
+		 *row.
+		 *\param r \c count matrices of \c N rows and \c C columns: \c R
+		 *followed by <tt>Q^T b</tt>.
+		 */
+		template<std::size_t M, std::size_t N, std::size_t C, typename InT>
+		static void batch(const InT* a, InternalT* r, std::size_t count);
+
+		/**
+		 *\brief Decompose \c count matrices of \c M rows and \c N columns
+		 *into \c count \c N by \c N upper triangular factors.
+		 */
+		template<std::size_t M, std::size_t N, typename InT>
+		static void batch(const InT* a, InternalT* r, std::size_t count);
+
+	};
+
+}
+
+#include "private/QR_priv.hpp"
+
+#endif
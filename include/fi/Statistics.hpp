@@ -0,0 +1,172 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_STATISTICS_HPP
+#define FI_STATISTICS_HPP
+
+#include "Fixed.hpp"
+
+#include <map>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+namespace Fi {
+
+	/**\brief Overflow and rounding statistics of a variable.
+
+	 *Amounts are in units of the least significant bit of the result.
+	 */
+	struct Statistics {
+
+		///Creates empty statistics.
+		Statistics();
+
+		///Number of positive overflows.
+		uint64_t positiveOverflows;
+		///Number of negative overflows.
+		uint64_t negativeOverflows;
+		///Largest amount by which a value exceeded the range.
+		double maxExcess;
+
+		///Number of rounded results, including exact ones.
+		uint64_t roundings;
+		///Sum of the rounding errors, rounded minus exact value.
+		double errorSum;
+		///Sum of the squared rounding errors.
+		double squaredErrorSum;
+		///Largest magnitude of a rounding error.
+		double maxError;
+
+		///Mean rounding error, the bias.
+		double meanError() const;
+		///Root mean square rounding error.
+		double rmsError() const;
+
+		///Add the counts of \c s.
+		void merge(const Statistics& s);
+
+	};
+
+	/**\brief Overflow handler that records statistics, then applies \c OF.
+
+	 *Statistics are kept per tag: \c Tag is a type with a static member
+	 *function <tt>const char* name()</tt>. With the default \c void tag,
+	 *they are kept per format, named like \c s16.8 for a signed number
+	 *of 16 bits with 8 fractional bits.
+
+	 *Each thread counts into its own buffers, which are merged by name by
+	 *Fi::statistics() and Fi::reportStatistics(). These should be called
+	 *when no other thread is updating statistics. The list of buffers is
+	 *locked with \c std::mutex, or before C++11 with POSIX threads or a
+	 *Windows slim reader/writer lock; other platforms are not supported.
+
+	 *The excess of a conversion from \c double or a string is measured on
+	 *the value after reduction to twice the range of the type.
+
+	 *If \c FI_NO_STATISTICS is defined, nothing is recorded. The
+	 *FI_OVERFLOW_STATISTICS() and FI_ROUNDING_STATISTICS() macros then
+	 *name \c OF and \c R themselves, so that the types are identical to
+	 *uninstrumented ones, including in vector kernels, which otherwise
+	 *use scalar code for instrumented types.
+
+	 *Inside a template, when \c Tag or the handler depends on a template
+	 *parameter, use FI_OVERFLOW_STATISTICS_TPL() and
+	 *FI_ROUNDING_STATISTICS_TPL() instead, which add the \c template
+	 *keyword that the nested \c Handler then requires.
+
+	 *\code
+	 #include "fi/Statistics.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 struct Gain { static const char* name() { return "gain"; } };
+
+	 typedef Fi::Fixed<16, 8, Fi::SIGNED,
+	                   FI_OVERFLOW_STATISTICS(Gain, Fi::Saturate),
+	                   FI_ROUNDING_STATISTICS(Gain, Fi::Classic)> gain;
+	 ...
+	 Fi::reportStatistics(std::cout);
+	 \endcode
+
+	 *\tparam Tag Name of the statistics, or \c void.
+	 *\tparam OF Overflow handler applied after recording.
+	 */
+	template<typename Tag, template <typename> class OF>
+	struct OverflowStatistics {
+		template<typename T>
+		struct Handler;
+	};
+
+	/**\brief Rounding handler that applies \c R, then records the rounding
+	 *error.
+
+	 *Statistics are kept as for Fi::OverflowStatistics.
+
+	 *\tparam Tag Name of the statistics, or \c void.
+	 *\tparam R Rounding handler.
+	 */
+	template<typename Tag, template <typename> class R>
+	struct RoundingStatistics {
+		template<typename T>
+		struct Handler;
+	};
+
+	/**\brief Statistics recorded by all threads, merged by name.
+	 */
+	inline std::map<std::string, Statistics> statistics();
+
+	/**\brief Clear the statistics of all threads.
+	 */
+	inline void resetStatistics();
+
+	/**\brief Write a table of the statistics of all threads, one line per
+	 *name.
+	 */
+	inline void reportStatistics(std::ostream& os);
+
+}
+
+#ifdef FI_NO_STATISTICS
+#define FI_OVERFLOW_STATISTICS(Tag, OF) OF
+#define FI_ROUNDING_STATISTICS(Tag, R) R
+#define FI_OVERFLOW_STATISTICS_TPL(Tag, OF) OF
+#define FI_ROUNDING_STATISTICS_TPL(Tag, R) R
+#else
+///\brief Overflow handler \c OF recording statistics under \c Tag.
+#define FI_OVERFLOW_STATISTICS(Tag, OF) Fi::OverflowStatistics<Tag, OF>::Handler
+///\brief Rounding handler \c R recording statistics under \c Tag.
+#define FI_ROUNDING_STATISTICS(Tag, R) Fi::RoundingStatistics<Tag, R>::Handler
+/**\brief FI_OVERFLOW_STATISTICS() for a \c Tag or \c OF that depends on
+ *a template parameter.
+ */
+#define FI_OVERFLOW_STATISTICS_TPL(Tag, OF) \
+	Fi::OverflowStatistics<Tag, OF>::template Handler
+/**\brief FI_ROUNDING_STATISTICS() for a \c Tag or \c R that depends on
+ *a template parameter.
+ */
+#define FI_ROUNDING_STATISTICS_TPL(Tag, R) \
+	Fi::RoundingStatistics<Tag, R>::template Handler
+#endif
+
+#include "private/Statistics_priv.hpp"
+
+#endif
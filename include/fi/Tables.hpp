@@ -0,0 +1,141 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef FI_TABLES_HPP
+#define FI_TABLES_HPP
+
+#include "Fixed.hpp"
+
+#if __cplusplus < 201402L
+#error "fi/Tables.hpp requires C++14"
+#endif
+
+#include <array>
+#include <cstddef>
+
+namespace Fi {
+
+	/**\brief Coefficient and lookup tables generated at compile time.
+
+	 *Entry \c i of a table is <tt>T(gen(i))</tt>, where \c gen returns a
+	 *\c double. Since Fixed(double) is \c constexpr, the entries are
+	 *rounded by the rounding mode and checked by the overflow handler of
+	 *\c T exactly as the same conversion at run time, and a table
+	 *declared \c constexpr costs nothing at startup.
+
+	 *The sines and cosines are computed by sinCycle() and cosCycle() from
+	 *the integer ratio <tt>i/N</tt> of a cycle, without rounding the
+	 *angle, so multiples of a quarter cycle are exact. They can differ
+	 *from \c std::sin and \c std::cos of the rounded angle
+	 *<tt>2*pi*i/N</tt> in the last places, which changes a quantized
+	 *entry only when the value is on a rounding boundary, such as
+	 *<tt>sin(7*pi/6) = -0.5</tt> with Fi::Floor.
+
+	 *\code
+	 #include "fi/Tables.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> coef;
+
+	 constexpr std::array<coef, 1024> w = Fi::table::hann<coef, 1024>();
+	 constexpr std::array<coef, 2*256> tw = Fi::table::twiddles<coef, 256>();
+	 \endcode
+
+	 *Generators are \c constexpr functions or function objects with a
+	 *\c constexpr call operator taking the index as a \c std::size_t:
+
+	 *\code
+	 constexpr double ramp(std::size_t i) { return i/64.0; }
+
+	 constexpr std::array<coef, 64> r = Fi::table::generate<coef, 64>(ramp);
+	 \endcode
+
+	 *\note Requires C++14.
+	 */
+	namespace table {
+
+		/**
+		 *\brief Table of \c N entries, entry \c i being <tt>T(gen(i))</tt>.
+		 *\tparam T A Fi::Fixed type.
+		 *\tparam G Generator callable as <tt>gen(std::size_t)</tt>.
+		 */
+		template<typename T, std::size_t N, typename G>
+		constexpr std::array<T, N> generate(const G& gen);
+
+		///<tt>sin(2*pi*i/N)</tt>.
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> sine();
+
+		///<tt>cos(2*pi*i/N)</tt>.
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> cosine();
+
+		/**
+		 *\brief Twiddle factors <tt>exp(-2*pi*j*i/N)</tt>, the real and
+		 *imaginary parts of factor \c i at \c 2*i and <tt>2*i + 1</tt>.
+
+		 *The factors are those of Fi::FFT::twiddle() for the same
+		 *coefficient type, except on rounding boundaries as described
+		 *above.
+		 */
+		template<typename T, std::size_t N>
+		constexpr std::array<T, 2*N> twiddles();
+
+		///Symmetric Hann window, <tt>0.5 - 0.5*cos(2*pi*i/(N - 1))</tt>.
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> hann();
+
+		///Symmetric Hamming window, <tt>0.54 - 0.46*cos(2*pi*i/(N - 1))</tt>.
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> hamming();
+
+		/**
+		 *\brief Symmetric Blackman window,
+		 *<tt>0.42 - 0.5*cos(2*pi*i/(N - 1)) + 0.08*cos(4*pi*i/(N - 1))</tt>.
+		 */
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> blackman();
+
+		/**
+		 *\brief Reciprocal of the middle of each of the
+		 *<tt>2^TableBits</tt> segments of <tt>[1, 2)</tt>, the seeds of a
+		 *Newton-Raphson reciprocal.
+		 *\tparam TableBits Number of index bits, between 1 and 16.
+		 */
+		template<typename T, std::size_t TableBits>
+		constexpr std::array<T, std::size_t(1) << TableBits>
+		reciprocalSeeds();
+
+		///<tt>sin(2*pi*i/n)</tt>, a compile-time replacement for \c std::sin.
+		constexpr double sinCycle(std::size_t i, std::size_t n);
+
+		///<tt>cos(2*pi*i/n)</tt>, a compile-time replacement for \c std::cos.
+		constexpr double cosCycle(std::size_t i, std::size_t n);
+
+	}
+
+}
+
+#include "private/Tables_priv.hpp"
+
+#endif
@@ -0,0 +1,341 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_TRACKED_HPP
+#define FI_TRACKED_HPP
+
+#include "Fixed.hpp"
+#include "Statistics.hpp"
+
+#include <map>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+namespace Fi {
+
+	/**\brief Range and quantization error of a variable.
+
+	 *Values are in the units of the variable, not its least significant
+	 *bit.
+	 */
+	struct ValueRange {
+
+		///Creates an empty range.
+		ValueRange();
+
+		///Number of recorded values.
+		uint64_t samples;
+		///Smallest recorded value.
+		double minimum;
+		///Largest recorded value.
+		double maximum;
+		/**Number of fractional bits needed to represent every recorded
+		 *value exactly; negative if all are multiples of a power of two
+		 *greater than one.
+		 */
+		int precision;
+
+		///Sum of the errors, value minus shadow.
+		double errorSum;
+		///Sum of the squared errors.
+		double squaredErrorSum;
+		///Largest magnitude of an error.
+		double maxError;
+
+		///Mean error, the bias.
+		double meanError() const;
+		///Root mean square error.
+		double rmsError() const;
+
+		///Fi::SIGNED if a negative value was recorded.
+		Signedness signedness() const;
+
+		/**
+		 *\brief Smallest number of integer bits, including the sign bit
+		 *of a signed format, that hold every recorded value.
+		 */
+		int integerLength() const;
+
+		/**
+		 *\brief Suggested number of fractional bits.
+
+		 *The smallest number that represents every recorded value
+		 *exactly, but no more than \c guard bits below the root mean
+		 *square error, if any was measured: bits that are smaller than
+		 *the error accumulated by the computation carry only noise.
+		 */
+		int fractionLength(int guard = 2) const;
+
+		///integerLength() + fractionLength(guard).
+		int wordLength(int guard = 2) const;
+
+		///Add the values of \c r.
+		void merge(const ValueRange& r);
+
+	};
+
+	/**\internal
+	 *\brief Double-precision shadow of a Fi::Tracked variable, empty
+	 *unless \c SHADOW is \c true.
+	 */
+	template<bool SHADOW>
+	struct TrackedShadow;
+
+	/**\brief Fixed-point variable that records the range of its values.
+
+	 *Every value stored into a variable is recorded under the name of
+	 *its tag: \c Tag is a type with a static member function
+	 *<tt>const char* name()</tt>. A value is stored by construction from
+	 *a Fi::Fixed, a \c double or a variable of another tag, and by
+	 *assignment and compound assignment. Copying a variable of the same
+	 *tag records nothing, as its value was recorded when stored.
+
+	 *The arithmetic operators compute with the operators of \c FixedT
+	 *and return a variable with the \c void tag, which records nothing,
+	 *so that only the variables that a result is stored into are
+	 *recorded.
+
+	 *If \c SHADOW is \c true, each variable also carries the value
+	 *computed in double precision by the same operations, starting from
+	 *the \c double a variable was created from, and records the
+	 *difference between its value and its shadow: the quantization error
+	 *accumulated up to that variable.
+
+	 *Like Fi::Statistics, each thread records into its own buffers
+	 *without locking, merged by name by Fi::ranges() and
+	 *Fi::reportRanges(), which suggests a format for each variable. A
+	 *value is recorded with a few comparisons and additions.
+
+	 *\code
+	 #include "fi/Tracked.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+	 #include "fi/rounding/Classic.hpp"
+
+	 typedef Fi::Fixed<32, 16, Fi::SIGNED, Fi::Saturate, Fi::Classic> wide;
+
+	 struct Acc { static const char* name() { return "acc"; } };
+	 struct Coef { static const char* name() { return "coef"; } };
+
+	 Fi::Tracked<wide, Coef, true> c(0.3);
+	 Fi::Tracked<wide, Acc, true> acc;
+	 ...
+	 acc += c*x;
+	 ...
+	 Fi::reportRanges(std::cout);
+	 \endcode
+
+	 *\tparam FixedT A Fi::Fixed type.
+	 *\tparam Tag Name of the variable, or \c void.
+	 *\tparam SHADOW Whether to keep a double-precision shadow value.
+	 */
+	template<typename FixedT, typename Tag = void, bool SHADOW = false>
+	class Tracked {
+
+	public:
+
+		///Type of the value.
+		typedef FixedT value_type;
+
+		/**
+		 *\brief Creates a variable equal to zero, without recording it.
+		 */
+		Tracked();
+
+		/**
+		 *\brief Creates a variable from a fixed-point value.
+		 */
+		Tracked(const FixedT& x);
+
+		/**
+		 *\brief Creates a variable from a value and its shadow.
+		 */
+		Tracked(const FixedT& x, double shadow);
+
+		/**
+		 *\brief Creates a variable from the conversion of \c x, with \c x
+		 *as its shadow.
+		 */
+		explicit Tracked(double x);
+
+		/**
+		 *\brief Copies a variable without recording it.
+		 */
+		Tracked(const Tracked& x);
+
+		/**
+		 *\brief Creates a variable from one of another tag.
+		 */
+		template<typename Tag2>
+		Tracked(const Tracked<FixedT, Tag2, SHADOW>& x);
+
+		/**
+		 *\brief Copies a variable without recording it.
+		 */
+		Tracked& operator=(const Tracked& x);
+
+		/**
+		 *\brief Assigns from a variable of another tag.
+		 */
+		template<typename Tag2>
+		Tracked& operator=(const Tracked<FixedT, Tag2, SHADOW>& x);
+
+		///Increment operator.
+		template<typename Tag2>
+		Tracked& operator+=(const Tracked<FixedT, Tag2, SHADOW>& x);
+
+		///Decrement operator.
+		template<typename Tag2>
+		Tracked& operator-=(const Tracked<FixedT, Tag2, SHADOW>& x);
+
+		///Multiply and store operator.
+		template<typename Tag2>
+		Tracked& operator*=(const Tracked<FixedT, Tag2, SHADOW>& x);
+
+		///Divide and store operator.
+		template<typename Tag2>
+		Tracked& operator/=(const Tracked<FixedT, Tag2, SHADOW>& x);
+
+		///Fixed-point value.
+		const FixedT& value() const;
+
+		///Shadow value, or the value converted to double without a shadow.
+		double shadow() const;
+
+	private:
+
+		void record() const;
+
+		FixedT _value;
+		TrackedShadow<SHADOW> _shadow;
+
+	};
+
+	/** \name Arithmetic operators */
+	//@{
+
+	/**\relates Fi::Tracked
+	 *\brief Addition operator.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	const Tracked<FixedT, void, SHADOW>
+	operator+(const Tracked<FixedT, Tag1, SHADOW>& x,
+	          const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	/**\relates Fi::Tracked
+	 *\brief Subtraction operator.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	const Tracked<FixedT, void, SHADOW>
+	operator-(const Tracked<FixedT, Tag1, SHADOW>& x,
+	          const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	/**\relates Fi::Tracked
+	 *\brief Negation operator.
+	 */
+	template<typename FixedT, typename Tag, bool SHADOW>
+	const Tracked<FixedT, void, SHADOW>
+	operator-(const Tracked<FixedT, Tag, SHADOW>& x);
+
+	/**\relates Fi::Tracked
+	 *\brief Multiplication operator.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	const Tracked<FixedT, void, SHADOW>
+	operator*(const Tracked<FixedT, Tag1, SHADOW>& x,
+	          const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	/**\relates Fi::Tracked
+	 *\brief Division operator.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	const Tracked<FixedT, void, SHADOW>
+	operator/(const Tracked<FixedT, Tag1, SHADOW>& x,
+	          const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	//@}
+
+	/** \name Comparison operators */
+	//@{
+
+	/**\relates Fi::Tracked
+	 *\brief Equality operator, comparing values.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	bool operator==(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	/**\relates Fi::Tracked
+	 *\brief Inequality operator, comparing values.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	bool operator!=(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	/**\relates Fi::Tracked
+	 *\brief Less than operator, comparing values.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	bool operator<(const Tracked<FixedT, Tag1, SHADOW>& x,
+	               const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	/**\relates Fi::Tracked
+	 *\brief Less than or equals operator, comparing values.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	bool operator<=(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	/**\relates Fi::Tracked
+	 *\brief Greater than operator, comparing values.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	bool operator>(const Tracked<FixedT, Tag1, SHADOW>& x,
+	               const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	/**\relates Fi::Tracked
+	 *\brief Greater than or equals operator, comparing values.
+	 */
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	bool operator>=(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                const Tracked<FixedT, Tag2, SHADOW>& y);
+
+	//@}
+
+	/**\brief Ranges recorded by all threads, merged by name.
+	 */
+	inline std::map<std::string, ValueRange> ranges();
+
+	/**\brief Clear the ranges of all threads.
+	 */
+	inline void resetRanges();
+
+	/**\brief Print a table of the ranges recorded by all threads, with
+	 *the format suggested for each variable, named like \c s16.8 for a
+	 *signed number of 16 bits with 8 fractional bits.
+	 */
+	inline void reportRanges(std::ostream& os);
+
+}
+
+#include "private/Tracked_priv.hpp"
+
+#endif
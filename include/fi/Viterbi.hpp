@@ -0,0 +1,197 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef FI_VITERBI_HPP
+#define FI_VITERBI_HPP
+
+#include "Fixed.hpp"
+#include "overflow/Wrap.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace Fi {
+
+	/**\brief Modular comparison of wrapping numbers.
+
+	 *\c true if <tt>a - b</tt>, computed modulo <tt>2^W</tt>, is negative
+	 *as a signed number. This orders values that are less than
+	 *<tt>2^(W - 1)</tt> apart correctly even after they have wrapped
+	 *around, which operator<() does not.
+	 */
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class R>
+	bool modularLess(const Fixed<W, F, S, Wrap, R>& a,
+	                 const Fixed<W, F, S, Wrap, R>& b);
+
+	/**\brief Trellis of a feedforward convolutional code of rate
+	 *<tt>1/2</tt> or <tt>1/3</tt>.
+
+	 *The encoder shifts each input bit into a register of \c K bits;
+	 *output \c r is the parity of the register masked by generator \c Gr,
+	 *whose least significant bit taps the newest input. The state is the
+	 *<tt>K - 1</tt> newest bits, the newest in the least significant bit.
+
+	 *\code
+	 typedef Fi::Trellis<7, 0171, 0133> k7; //the NASA standard code
+	 \endcode
+
+	 *\tparam K Constraint length, between 2 and 16.
+	 *\tparam G0, G1, G2 Generator polynomials; \c G2 is 0 for rate
+	 *<tt>1/2</tt> codes.
+	 */
+	template<std::size_t K, uint32_t G0, uint32_t G1, uint32_t G2 = 0>
+	struct Trellis {
+
+		typedef char LengthCheck[(K >= 2 && K <= 16) ? 1 : -1];
+
+		///Constraint length.
+		static const std::size_t CONSTRAINT_LENGTH = K;
+
+		///Number of states.
+		static const std::size_t STATES = std::size_t(1) << (K - 1);
+
+		///Number of output bits per input bit.
+		static const std::size_t RATE = (G2 == 0) ? 2 : 3;
+
+		///State after \c bit enters the encoder in \c state.
+		static std::size_t next(std::size_t state, unsigned bit);
+
+		/**
+		 *\brief Output bits when \c bit enters the encoder in \c state,
+		 *output \c r in bit \c r.
+		 */
+		static unsigned output(std::size_t state, unsigned bit);
+
+		/**
+		 *\brief Encode \c n bits starting from state zero, writing
+		 *<tt>n*RATE</tt> bits to \c out.
+		 */
+		static void encode(const uint8_t* bits, std::size_t n, uint8_t* out);
+
+	};
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	struct ViterbiTypes;
+
+	/**\brief Viterbi decoder with modular path metrics.
+
+	 *Received symbols are soft decisions in \c SymT, positive for a 0
+	 *bit. The branch metric of a transition is the sum over its output
+	 *bits of <tt>c ? y : -y</tt>, and the decoder keeps, for each state,
+	 *the path with the smallest metric.
+
+	 *Path metrics are never renormalized: they are \c PathT numbers with
+	 *the Fi::Wrap overflow handler and are compared with modularLess().
+	 *As in hardware, this is exact as long as the metrics of all states
+	 *stay within <tt>2^(W - 1)</tt> of each other, which holds when
+	 *\c PathT has more than <tt>log2(2*K*RATE)</tt> more bits than
+	 *\c SymT; this is checked at compile time.
+
+	 *Add-compare-select is computed on eight states at a time using
+	 *vector instructions for path metrics of at most 16 bits and codes
+	 *of constraint length at least 5. The decisions are the same as
+	 *those of the scalar code.
+
+	 *\code
+	 #include "fi/Viterbi.hpp"
+	 #include "fi/overflow/Saturate.hpp"
+
+	 typedef Fi::Fixed<6, 2, Fi::SIGNED, Fi::Saturate> symbol;
+	 typedef Fi::Fixed<12, 2, Fi::SIGNED, Fi::Wrap> metric;
+
+	 Fi::Viterbi<Fi::Trellis<7, 0171, 0133>, symbol, metric> decoder;
+	 decoder.update(&received[0], n);
+	 decoder.decode(&bits[0]);
+	 \endcode
+
+	 *\tparam TrellisT Fi::Trellis of the code.
+	 *\tparam SymT Signed Fi::Fixed type of the received symbols.
+	 *\tparam PathT Fi::Fixed type of the path metrics, with the
+	 *Fi::Wrap overflow handler and the fraction length of \c SymT.
+	 */
+	template<typename TrellisT, typename SymT, typename PathT>
+	class Viterbi {
+
+	public:
+
+		///Number of states.
+		static const std::size_t STATES = TrellisT::STATES;
+
+		/**
+		 *\brief Creates a decoder starting in \c state.
+		 *\throw std::invalid_argument if \c state is not less than
+		 *\c STATES.
+		 */
+		explicit Viterbi(std::size_t state = 0);
+
+		/**
+		 *\brief Discard all steps and start again in \c state.
+		 *\throw std::invalid_argument if \c state is not less than
+		 *\c STATES.
+		 */
+		void reset(std::size_t state = 0);
+
+		/**
+		 *\brief Add \c steps trellis steps from <tt>steps*RATE</tt>
+		 *received symbols.
+		 */
+		void update(const SymT* symbols, std::size_t steps);
+
+		///Number of steps since the last reset.
+		std::size_t steps() const;
+
+		///Path metric of a state.
+		const PathT metric(std::size_t state) const;
+
+		///State with the smallest path metric.
+		std::size_t best() const;
+
+		/**
+		 *\brief Write the steps() bits of the path ending in \c state.
+		 *\throw std::invalid_argument if \c state is not less than
+		 *\c STATES.
+		 */
+		void traceback(std::size_t state, uint8_t* bits) const;
+
+		///Write the steps() bits of the best path.
+		void decode(uint8_t* bits) const;
+
+	private:
+
+		typedef ViterbiTypes<TrellisT, SymT, PathT> Types;
+		typedef typename Types::metric_type M;
+
+		std::vector<M> _metrics;
+		std::vector<M> _next;
+		std::vector<uint8_t> _decisions;
+		std::size_t _steps;
+
+	};
+
+}
+
+#include "private/Viterbi_priv.hpp"
+
+#endif
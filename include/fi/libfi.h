@@ -28,6 +28,7 @@
  *\li "modulus," the assigned value is the dynamic value mod the range of the variable: supported by Fi::Wrap.
  *\li "saturate," if the dynamic value exceeds the range of the variable, assign the nearest representable value: supported by Fi::Saturate.
  *\li "exception," if the dynamic value exceeds the range of the variable, throw an exception of type std::overflow_error: supported by Fi::Throw.
+ *\li "sticky," saturate or wrap and raise a flag of the calling thread, queried using Fi::overflowFlags(): supported by Fi::StickySaturate and Fi::StickyWrap.
 
  * If overflow occurs in "impossible" mode, the behavior will be undefined.
  */
@@ -35,6 +36,12 @@
 /**
  *\defgroup rounding Rounding
  *\brief Different mechanisms for rounding numbers.
+
+ *Fi::Classic, Fi::NearEven and Fi::NearOdd compare the discarded bits
+ *against half of the weight of the lowest kept bit, computed in the
+ *storage type. Results without fractional bits (F = 0) are therefore
+ *never rounded, and with 32 fractional bits ties are detected like with
+ *any other fraction length.
  */
 
 /**
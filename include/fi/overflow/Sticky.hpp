@@ -0,0 +1,101 @@
+/*
+
+ *Copyright © 2011-2012 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_OVERFLOW_STICKY_HPP
+#define FI_OVERFLOW_STICKY_HPP
+
+namespace Fi {
+
+	/**
+	 *\ingroup overflow
+	 *\brief Flags recording the overflows handled by Fi::StickySaturate
+	 *and Fi::StickyWrap.
+	 */
+	enum OverflowFlag {
+		///A value was larger than the largest representable value.
+		POSITIVE_OVERFLOW = 1,
+		///A value was smaller than the smallest representable value.
+		NEGATIVE_OVERFLOW = 2,
+		///Both flags.
+		ALL_OVERFLOW = POSITIVE_OVERFLOW | NEGATIVE_OVERFLOW
+	};
+
+	/**
+	 *\ingroup overflow
+	 *\brief Overflow flags raised in the calling thread since they were
+	 *last cleared, a combination of Fi::OverflowFlag values.
+	 */
+	inline unsigned overflowFlags();
+
+	/**
+	 *\ingroup overflow
+	 *\brief Clear overflow flags of the calling thread.
+	 *\param flags Combination of Fi::OverflowFlag values to clear.
+	 */
+	inline void clearOverflowFlags(unsigned flags = ALL_OVERFLOW);
+
+	/**
+	 *\ingroup overflow
+	 *\brief A saturating overflow handler that records overflow.
+
+	 *If overflow occurs, the assigned value is set to the nearest
+	 *representable value, and Fi::POSITIVE_OVERFLOW or
+	 *Fi::NEGATIVE_OVERFLOW is raised in a status word of the calling
+	 *thread, like the exception flags of IEEE floating point. The flags
+	 *stay set until cleared using Fi::clearOverflowFlags().
+
+	 *Nothing is thrown, so arithmetic operators can be inlined, and vector
+	 *kernels handle overflow in registers as for Fi::Saturate.
+
+	 *\code
+	 #include "fi/Fixed.hpp"
+	 #include "fi/overflow/Sticky.hpp"
+
+	 typedef Fi::Fixed<16, 8, Fi::SIGNED, Fi::StickySaturate> fx;
+
+	 Fi::clearOverflowFlags();
+	 ...
+	 if (Fi::overflowFlags() & Fi::POSITIVE_OVERFLOW) {
+	     ...
+	 }
+	 \endcode
+
+	 *\tparam T Fi::Traits of the fixed-point type.
+	 */
+	template <typename T>
+	struct StickySaturate;
+
+	/**
+	 *\ingroup overflow
+	 *\brief A wrap-around overflow handler that records overflow.
+
+	 *The same as Fi::Wrap, also raising flags like Fi::StickySaturate.
+
+	 *\tparam T Fi::Traits of the fixed-point type.
+	 */
+	template <typename T>
+	struct StickyWrap;
+
+}
+
+#include "fi/private/overflow/Sticky.hpp"
+
+#endif
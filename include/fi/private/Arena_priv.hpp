@@ -0,0 +1,322 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef PRIVATE_FI_ARENA_PRIV_HPP
+#define PRIVATE_FI_ARENA_PRIV_HPP
+
+#include <new>
+#include <limits>
+
+namespace Fi {
+
+	//Arena
+
+	inline Arena::Arena(std::size_t blockSize)
+		: _blockSize(blockSize),
+		  _first(0),
+		  _current(0),
+		  _ptr(0),
+		  _end(0),
+		  _usedBefore(0)
+	{ }
+
+
+	inline Arena::~Arena() {
+		release();
+	}
+
+
+	inline char* Arena::begin(Block* b) {
+		return reinterpret_cast<char*>(b) + sizeof(Block);
+	}
+
+
+	inline char* Arena::end(Block* b) {
+		return begin(b) + b->size;
+	}
+
+
+	inline void* Arena::allocate(std::size_t size, std::size_t alignment) {
+
+		if (size == 0) {
+			size = 1;
+		}
+
+		void* ret = bump(size, alignment);
+		return (ret != 0) ? ret : allocateSlow(size, alignment);
+
+	}
+
+
+	inline void* Arena::bump(std::size_t size, std::size_t alignment) {
+
+		if (_ptr == 0) {
+			return 0;
+		}
+
+		//Sizes are compared with the room left so that nothing overflows.
+		std::size_t addr = reinterpret_cast<std::size_t>(_ptr);
+		std::size_t room = reinterpret_cast<std::size_t>(_end) - addr;
+		std::size_t padding = (0 - addr) & (alignment - 1);
+
+		if ((padding > room) || (size > room - padding)) {
+			return 0;
+		}
+
+		_ptr += padding + size;
+		return reinterpret_cast<void*>(addr + padding);
+
+	}
+
+
+	inline void* Arena::allocateSlow(std::size_t size, std::size_t alignment) {
+
+		//Blocks kept from previous frames are visited in order, so the same
+		//sequence of requests lands in the same blocks after a reset.
+		while ((_current != 0) && (_current->next != 0)) {
+
+			_usedBefore += _ptr - begin(_current);
+			_current = _current->next;
+			_ptr = begin(_current);
+			_end = end(_current);
+
+			void* ret = bump(size, alignment);
+			if (ret != 0) {
+				return ret;
+			}
+
+		}
+
+		const std::size_t MAX_BLOCK =
+			std::numeric_limits<std::size_t>::max() - sizeof(Block);
+		if ((alignment > MAX_BLOCK) || (size > MAX_BLOCK - alignment)) {
+			throw std::bad_alloc();
+		}
+
+		std::size_t blockSize = size + alignment;
+		if (blockSize < _blockSize) {
+			blockSize = _blockSize;
+		}
+
+		Block* b = static_cast<Block*>(::operator new(sizeof(Block) + blockSize));
+		b->next = 0;
+		b->size = blockSize;
+
+		if (_current == 0) {
+			_first = b;
+		}
+		else {
+			_usedBefore += _ptr - begin(_current);
+			_current->next = b;
+		}
+
+		_current = b;
+		_ptr = begin(b);
+		_end = end(b);
+
+		return bump(size, alignment);
+
+	}
+
+
+	template<typename T>
+	inline T* Arena::allocateArray(std::size_t n) {
+
+		if (n > std::numeric_limits<std::size_t>::max()/sizeof(T)) {
+			throw std::bad_alloc();
+		}
+
+		return static_cast<T*>(allocate(n*sizeof(T)));
+
+	}
+
+
+	inline void Arena::reset() {
+
+		_current = _first;
+		_ptr = (_first != 0) ? begin(_first) : 0;
+		_end = (_first != 0) ? end(_first) : 0;
+		_usedBefore = 0;
+
+	}
+
+
+	inline void Arena::release() {
+
+		while (_first != 0) {
+			Block* next = _first->next;
+			::operator delete(_first);
+			_first = next;
+		}
+
+		_current = 0;
+		_ptr = 0;
+		_end = 0;
+		_usedBefore = 0;
+
+	}
+
+
+	inline std::size_t Arena::used() const {
+		return (_current != 0) ? _usedBefore + (_ptr - begin(_current)) : 0;
+	}
+
+
+	inline std::size_t Arena::capacity() const {
+
+		std::size_t ret = 0;
+
+		for (Block* b = _first; b != 0; b = b->next) {
+			ret += b->size;
+		}
+
+		return ret;
+
+	}
+
+
+	inline std::size_t Arena::blockCount() const {
+
+		std::size_t ret = 0;
+
+		for (Block* b = _first; b != 0; b = b->next) {
+			++ret;
+		}
+
+		return ret;
+
+	}
+
+
+	//ArenaAllocator
+
+	template<typename T>
+	ArenaAllocator<T>::ArenaAllocator(Arena& arena)
+		: _arena(&arena)
+	{ }
+
+
+	template<typename T>
+	template<typename U>
+	ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& that)
+		: _arena(&that.arena())
+	{ }
+
+
+	template<typename T>
+	typename ArenaAllocator<T>::pointer ArenaAllocator<T>::
+	address(reference x) const {
+		return &x;
+	}
+
+
+	template<typename T>
+	typename ArenaAllocator<T>::const_pointer ArenaAllocator<T>::
+	address(const_reference x) const {
+		return &x;
+	}
+
+
+	template<typename T>
+	typename ArenaAllocator<T>::pointer ArenaAllocator<T>::
+	allocate(size_type n, const void* /*hint*/) {
+
+		if (n > max_size()) {
+			throw std::bad_alloc();
+		}
+
+		return _arena->allocateArray<T>(n);
+
+	}
+
+
+	template<typename T>
+	void ArenaAllocator<T>::
+	deallocate(pointer /*p*/, size_type /*n*/) {
+		//Memory is reclaimed by Arena::reset()
+	}
+
+
+	template<typename T>
+	typename ArenaAllocator<T>::size_type ArenaAllocator<T>::
+	max_size() const {
+		return std::numeric_limits<size_type>::max()/sizeof(T);
+	}
+
+
+	template<typename T>
+	void ArenaAllocator<T>::
+	construct(pointer p, const T& val) {
+		new(static_cast<void*>(p)) T(val);
+	}
+
+
+	template<typename T>
+	void ArenaAllocator<T>::
+	destroy(pointer p) {
+		p->~T();
+	}
+
+
+	template<typename T>
+	Arena& ArenaAllocator<T>::
+	arena() const {
+		return *_arena;
+	}
+
+
+	template<typename T, typename U>
+	inline bool operator==(const ArenaAllocator<T>& x,
+	                       const ArenaAllocator<U>& y)
+	{
+
+		return &x.arena() == &y.arena();
+
+	}
+
+
+	template<typename T, typename U>
+	inline bool operator!=(const ArenaAllocator<T>& x,
+	                       const ArenaAllocator<U>& y)
+	{
+
+		return !(x == y);
+
+	}
+
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	const char* toString(const Fixed<W, F, S, OF, R>& x, Arena& arena)
+	{
+
+		typedef Fixed<W, F, S, OF, R> FixedT;
+
+		char* buffer = arena.allocateArray<char>(FixedT::STRING_LENGTH);
+		x.toString(buffer, FixedT::STRING_LENGTH);
+		return buffer;
+
+	}
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #define FI_PRIVATE_ARITHMETIC_HPP
 
 #include "Fi.hpp"
+#include "Constexpr.hpp"
 
 namespace Fi {
 
@@ -34,7 +35,7 @@ namespace Fi {
 	 *\tparam TR Fi::Traits of the fixed-point type.
 	 */
 	template<typename TR>
-	bool isNegative(const typename TR::valtype & val) {
+	FI_CONSTEXPR bool isNegative(const typename TR::valtype & val) {
 		return (((val & TR::S_MASK) >> (TR::WORD_LENGTH-1)) & 0x01) != 0;
 	}
 
@@ -0,0 +1,751 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef PRIVATE_FI_BIQUAD_PRIV_HPP
+#define PRIVATE_FI_BIQUAD_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Formats of a second-order section and the fractional lengths
+	 *of its terms.
+	 */
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT>
+	struct BiquadTypes {
+
+		typedef InT In;
+		typedef CoefT Coef;
+		typedef AccT Acc;
+		typedef StateT State;
+		typedef OutT Out;
+
+		static const std::size_t F_ACC = AccT::FRACTION_LENGTH;
+		static const std::size_t F_IN = InT::FRACTION_LENGTH;
+		static const std::size_t F_STATE = StateT::FRACTION_LENGTH;
+		static const std::size_t F_OUT = OutT::FRACTION_LENGTH;
+
+		///\internal \brief Products of a coefficient and a signal.
+		static const std::size_t F_CI = CoefT::FRACTION_LENGTH + F_IN;
+		static const std::size_t F_CS = CoefT::FRACTION_LENGTH + F_STATE;
+		static const std::size_t F_CO = CoefT::FRACTION_LENGTH + F_OUT;
+
+		/**\internal
+		 *\brief Bound on the raw value of a term in the adders, when
+		 *the term has \c F fractional bits and \c X is the format of the
+		 *signal.
+		 */
+		template<typename X, std::size_t F>
+		static double term(int64_t c = 1) {
+			return std::fabs(static_cast<double>(c))*rawMagnitude<X>()*
+				std::ldexp(1.0, static_cast<int>(F_ACC) - static_cast<int>(F));
+		}
+
+		///\internal \brief \c true if a node with this bound cannot overflow.
+		static bool fits(double bound) {
+			return bound <= static_cast<double>(AccT::TR::MAX_VAL);
+		}
+
+	};
+
+
+	/**\internal
+	 *\brief Shift aligning a term with \c SRC_F fractional bits with the
+	 *adders, when the adders have at least as many fractional bits.
+	 */
+	template<std::size_t SRC_F, std::size_t DST_F,
+	         bool UP = (SRC_F <= DST_F)>
+	struct BiquadAlign {
+		static const int SHIFT = static_cast<int>(DST_F - SRC_F);
+	};
+
+	template<std::size_t SRC_F, std::size_t DST_F>
+	struct BiquadAlign<SRC_F, DST_F, false> {
+		static const int SHIFT = 0;
+	};
+
+
+	/**\internal
+	 *\brief Nodes computed exactly on 64-bit integers. Only valid when
+	 *the adders can neither round nor overflow.
+	 */
+	template<typename T>
+	struct BiquadExact {
+
+		typedef int64_t value;
+
+		struct Sum {
+
+			int64_t n;
+
+			explicit Sum(BiquadExact&) : n(0) { }
+
+			template<std::size_t F>
+			void add(int64_t c, int64_t x) {
+				n += c*x*(int64_t(1) << BiquadAlign<F, T::F_ACC>::SHIFT);
+			}
+
+			template<std::size_t F>
+			void add(int64_t x) {
+				n += x*(int64_t(1) << BiquadAlign<F, T::F_ACC>::SHIFT);
+			}
+
+			template<typename NodeT>
+			int64_t result() const {
+				return Requantize<NodeT, T::F_ACC>::raw(n);
+			}
+
+		};
+
+	};
+
+
+	/**\internal
+	 *\brief Nodes computed using the operators of the adder format.
+	 */
+	template<typename T>
+	struct BiquadOperators {
+
+		typedef int64_t value;
+
+		struct Sum {
+
+			typename T::Acc acc;
+
+			explicit Sum(BiquadOperators&) { }
+
+			template<std::size_t F>
+			void add(int64_t c, int64_t x) {
+				acc += Requantize<typename T::Acc, F>::apply(c*x);
+			}
+
+			template<std::size_t F>
+			void add(int64_t x) {
+				acc += Requantize<typename T::Acc, F>::apply(x);
+			}
+
+			template<typename NodeT>
+			int64_t result() const {
+				return Requantize<NodeT, T::F_ACC>::raw(rawValue(acc));
+			}
+
+		};
+
+	};
+
+
+	/**\internal
+	 *\brief One sample of a section, written once for every way of
+	 *computing the nodes.
+
+	 *\c k holds <tt>b0, b1, b2, -a1, -a2</tt> and \c s the states.
+	 */
+	template<BiquadStructure S>
+	struct BiquadStep;
+
+	template<>
+	struct BiquadStep<DIRECT_FORM_I> {
+
+		static const std::size_t STATES = 4;
+
+		template<typename T>
+		struct Aligned {
+			static const bool value =
+				(T::F_CI <= T::F_ACC) && (T::F_CO <= T::F_ACC);
+		};
+
+		template<typename T>
+		static bool overflowFree(const int64_t* k) {
+			typedef typename T::In In;
+			typedef typename T::Out Out;
+			return Aligned<T>::value &&
+				T::fits(T::template term<In, T::F_CI>(k[0]) +
+				        T::template term<In, T::F_CI>(k[1]) +
+				        T::template term<In, T::F_CI>(k[2]) +
+				        T::template term<Out, T::F_CO>(k[3]) +
+				        T::template term<Out, T::F_CO>(k[4]));
+		}
+
+		template<typename T, typename B>
+		static typename B::value apply(B& b, const typename B::value* k,
+		                               typename B::value x,
+		                               typename B::value* s) {
+
+			typename B::Sum y(b);
+			y.template add<T::F_CI>(k[0], x);
+			y.template add<T::F_CI>(k[1], s[0]);
+			y.template add<T::F_CI>(k[2], s[1]);
+			y.template add<T::F_CO>(k[3], s[2]);
+			y.template add<T::F_CO>(k[4], s[3]);
+
+			typename B::value out = y.template result<typename T::Out>();
+
+			s[1] = s[0];
+			s[0] = x;
+			s[3] = s[2];
+			s[2] = out;
+
+			return out;
+
+		}
+
+	};
+
+	template<>
+	struct BiquadStep<DIRECT_FORM_II> {
+
+		static const std::size_t STATES = 2;
+
+		template<typename T>
+		struct Aligned {
+			static const bool value =
+				(T::F_IN <= T::F_ACC) && (T::F_CS <= T::F_ACC);
+		};
+
+		template<typename T>
+		static bool overflowFree(const int64_t* k) {
+			typedef typename T::In In;
+			typedef typename T::State State;
+			return Aligned<T>::value &&
+				T::fits(T::template term<In, T::F_IN>() +
+				        T::template term<State, T::F_CS>(k[3]) +
+				        T::template term<State, T::F_CS>(k[4])) &&
+				T::fits(T::template term<State, T::F_CS>(k[0]) +
+				        T::template term<State, T::F_CS>(k[1]) +
+				        T::template term<State, T::F_CS>(k[2]));
+		}
+
+		template<typename T, typename B>
+		static typename B::value apply(B& b, const typename B::value* k,
+		                               typename B::value x,
+		                               typename B::value* s) {
+
+			typename B::Sum w(b);
+			w.template add<T::F_IN>(x);
+			w.template add<T::F_CS>(k[3], s[0]);
+			w.template add<T::F_CS>(k[4], s[1]);
+
+			typename B::value state = w.template result<typename T::State>();
+
+			typename B::Sum y(b);
+			y.template add<T::F_CS>(k[0], state);
+			y.template add<T::F_CS>(k[1], s[0]);
+			y.template add<T::F_CS>(k[2], s[1]);
+
+			typename B::value out = y.template result<typename T::Out>();
+
+			s[1] = s[0];
+			s[0] = state;
+
+			return out;
+
+		}
+
+	};
+
+	template<>
+	struct BiquadStep<TRANSPOSED_DIRECT_FORM_II> {
+
+		static const std::size_t STATES = 2;
+
+		template<typename T>
+		struct Aligned {
+			static const bool value =
+				(T::F_CI <= T::F_ACC) && (T::F_CO <= T::F_ACC) &&
+				(T::F_STATE <= T::F_ACC);
+		};
+
+		template<typename T>
+		static bool overflowFree(const int64_t* k) {
+			typedef typename T::In In;
+			typedef typename T::State State;
+			typedef typename T::Out Out;
+			return Aligned<T>::value &&
+				T::fits(T::template term<In, T::F_CI>(k[0]) +
+				        T::template term<State, T::F_STATE>()) &&
+				T::fits(T::template term<In, T::F_CI>(k[1]) +
+				        T::template term<Out, T::F_CO>(k[3]) +
+				        T::template term<State, T::F_STATE>()) &&
+				T::fits(T::template term<In, T::F_CI>(k[2]) +
+				        T::template term<Out, T::F_CO>(k[4]));
+		}
+
+		template<typename T, typename B>
+		static typename B::value apply(B& b, const typename B::value* k,
+		                               typename B::value x,
+		                               typename B::value* s) {
+
+			typename B::Sum y(b);
+			y.template add<T::F_CI>(k[0], x);
+			y.template add<T::F_STATE>(s[0]);
+
+			typename B::value out = y.template result<typename T::Out>();
+
+			typename B::Sum s1(b);
+			s1.template add<T::F_CI>(k[1], x);
+			s1.template add<T::F_CO>(k[3], out);
+			s1.template add<T::F_STATE>(s[1]);
+
+			typename B::Sum s2(b);
+			s2.template add<T::F_CI>(k[2], x);
+			s2.template add<T::F_CO>(k[4], out);
+
+			s[0] = s1.template result<typename T::State>();
+			s[1] = s2.template result<typename T::State>();
+
+			return out;
+
+		}
+
+	};
+
+
+	/**\internal
+	 *\brief Filter one channel, whose states are
+	 *<tt>state[i*channels + c]</tt>.
+	 */
+	template<typename T, BiquadStructure S, typename B>
+	inline void biquadChannel(const int64_t* k, int64_t* state,
+	                          const typename T::In* in, typename T::Out* out,
+	                          std::size_t frames, std::size_t channels,
+	                          std::size_t c) {
+
+		typedef BiquadStep<S> Step;
+		typedef typename T::Out::valtype valtype;
+
+		B b;
+		int64_t s[Step::STATES];
+
+		for (std::size_t i = 0; i < Step::STATES; ++i) {
+			s[i] = state[i*channels + c];
+		}
+
+		for (std::size_t t = 0; t < frames; ++t) {
+			std::size_t i = t*channels + c;
+			int64_t y = Step::template apply<T>(b, k, rawValue(in[i]), s);
+			Simd::raw(out)[i] = static_cast<valtype>(y);
+		}
+
+		for (std::size_t i = 0; i < Step::STATES; ++i) {
+			state[i*channels + c] = s[i];
+		}
+
+	}
+
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether four channels of a section can be computed in
+		 *32-bit lanes.
+
+		 *The nodes must be signed, with rounding modes that have a vector
+		 *implementation, and the adders must keep every bit of the
+		 *terms. Sums then fit 32 bits whenever the section is free of
+		 *overflow.
+		 */
+		template<typename T, BiquadStructure S>
+		struct BiquadLanes {
+#ifdef FI_SIMD_SSE2
+			static const bool AVAILABLE =
+				(T::In::SIGNEDNESS == SIGNED) &&
+				(T::Coef::SIGNEDNESS == SIGNED) &&
+				(T::State::SIGNEDNESS == SIGNED) &&
+				(T::Out::SIGNEDNESS == SIGNED) &&
+				BiquadStep<S>::template Aligned<T>::value &&
+				(T::F_ACC >= T::F_STATE) && (T::F_ACC - T::F_STATE <= 30) &&
+				(T::F_ACC >= T::F_OUT) && (T::F_ACC - T::F_OUT <= 30) &&
+				VecRound<typename T::State::RH>::AVAILABLE &&
+				VecRound<typename T::Out::RH>::AVAILABLE;
+#else
+			static const bool AVAILABLE = false;
+#endif
+		};
+
+#ifdef FI_SIMD_SSE2
+		/**\internal
+		 *\brief Nodes of four channels computed in 32-bit lanes. \c ok
+		 *is cleared when a node overflows without a vector overflow
+		 *handler.
+		 */
+		template<typename T>
+		struct BiquadVector {
+
+			typedef vec value;
+
+			bool ok;
+
+			BiquadVector() : ok(true) { }
+
+			struct Sum {
+
+				BiquadVector& b;
+				vec n;
+
+				explicit Sum(BiquadVector& b) : b(b), n(zero()) { }
+
+				template<std::size_t F>
+				void add(vec c, vec x) {
+					vec p = Lanes32::mullo(c, x);
+					n = Lanes32::add(n, Lanes32::slli(p, BiquadAlign<F, T::F_ACC>::SHIFT));
+				}
+
+				template<std::size_t F>
+				void add(vec x) {
+					n = Lanes32::add(n, Lanes32::slli(x, BiquadAlign<F, T::F_ACC>::SHIFT));
+				}
+
+				template<typename NodeT>
+				vec result() {
+					const int k = static_cast<int>(T::F_ACC - NodeT::FRACTION_LENGTH);
+					vec v = n;
+					if (k > 0) {
+						v = VecRound<typename NodeT::RH>::template apply<Lanes32>(v, k);
+					}
+					if (!VecOverflow<typename NodeT::OFH>::template apply<Lanes32>(v)) {
+						b.ok = false;
+					}
+					return v;
+				}
+
+			};
+
+		};
+#endif
+
+	}
+
+
+	/**\internal
+	 *\brief Filter the channels of a section four at a time. Returns the
+	 *number of channels filtered; a sample of four channels that
+	 *overflows without a vector overflow handler is computed with the
+	 *scalar code.
+	 */
+	template<typename T, BiquadStructure S,
+	         bool ENABLE = Simd::BiquadLanes<T, S>::AVAILABLE>
+	struct BiquadKernel {
+		static std::size_t apply(const int64_t*, int64_t*,
+		                         const typename T::In*, typename T::Out*,
+		                         std::size_t, std::size_t) {
+			return 0;
+		}
+	};
+
+#ifdef FI_SIMD_SSE2
+	template<typename T, BiquadStructure S>
+	struct BiquadKernel<T, S, true> {
+
+		static std::size_t apply(const int64_t* k, int64_t* state,
+		                         const typename T::In* in,
+		                         typename T::Out* out,
+		                         std::size_t frames, std::size_t channels) {
+
+			using namespace Simd;
+
+			typedef BiquadStep<S> Step;
+			const std::size_t STATES = Step::STATES;
+			const std::size_t LANES = Lanes32::COUNT;
+
+			vec kv[5];
+			for (std::size_t i = 0; i < 5; ++i) {
+				kv[i] = Lanes32::set1(k[i]);
+			}
+
+			std::size_t c = 0;
+
+			for (; c + LANES <= channels; c += LANES) {
+
+				vec s[STATES];
+				for (std::size_t i = 0; i < STATES; ++i) {
+					s[i] = load4(&state[i*channels + c]);
+				}
+
+				for (std::size_t t = 0; t < frames; ++t) {
+
+					std::size_t first = t*channels + c;
+
+					vec saved[STATES];
+					std::copy(s, s + STATES, saved);
+
+					BiquadVector<T> b;
+					vec y = Step::template apply<T>(b, kv, load4(raw(in + first)), s);
+
+					if (b.ok) {
+						store4(raw(out + first), y);
+						continue;
+					}
+
+					for (std::size_t i = 0; i < STATES; ++i) {
+						store4(&state[i*channels + c], saved[i]);
+					}
+
+					for (std::size_t j = c; j < c + LANES; ++j) {
+						biquadChannel<T, S, BiquadExact<T> >(
+							k, state, in + t*channels, out + t*channels,
+							1, channels, j);
+					}
+
+					for (std::size_t i = 0; i < STATES; ++i) {
+						s[i] = load4(&state[i*channels + c]);
+					}
+
+				}
+
+				for (std::size_t i = 0; i < STATES; ++i) {
+					store4(&state[i*channels + c], s[i]);
+				}
+
+			}
+
+			return c;
+
+		}
+
+	};
+#endif
+
+
+	//BiquadCoefficients
+
+	template<typename CoefT>
+	BiquadCoefficients<CoefT>::BiquadCoefficients()
+	{ }
+
+
+	template<typename CoefT>
+	BiquadCoefficients<CoefT>::
+	BiquadCoefficients(const CoefT& b0, const CoefT& b1, const CoefT& b2,
+	                   const CoefT& a1, const CoefT& a2)
+		: b0(b0), b1(b1), b2(b2), a1(a1), a2(a2)
+	{ }
+
+
+	//Biquad
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	Biquad<InT, CoefT, AccT, StateT, OutT, S>::
+	Biquad(const BiquadCoefficients<CoefT>& coefficients,
+	       std::size_t channels)
+		: _coefficients(coefficients),
+		  _channels(channels)
+	{
+
+		if (channels == 0) {
+			throw std::invalid_argument("Biquad has no channels");
+		}
+
+		_k[0] = rawValue(coefficients.b0);
+		_k[1] = rawValue(coefficients.b1);
+		_k[2] = rawValue(coefficients.b2);
+		_k[3] = -rawValue(coefficients.a1);
+		_k[4] = -rawValue(coefficients.a2);
+
+		_overflowFree = BiquadStep<S>::template overflowFree<Types>(_k);
+
+		reset();
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	const BiquadCoefficients<CoefT>&
+	Biquad<InT, CoefT, AccT, StateT, OutT, S>::coefficients() const {
+		return _coefficients;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	std::size_t Biquad<InT, CoefT, AccT, StateT, OutT, S>::channels() const {
+		return _channels;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	bool Biquad<InT, CoefT, AccT, StateT, OutT, S>::overflowFree() const {
+		return _overflowFree;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	void Biquad<InT, CoefT, AccT, StateT, OutT, S>::
+	process(const InT* in, OutT* out, std::size_t frames) {
+
+		int64_t* state = &_state[0];
+		std::size_t c = 0;
+
+		if (_overflowFree) {
+
+			c = BiquadKernel<Types, S>::apply(_k, state, in, out, frames,
+			                                  _channels);
+
+			for (; c < _channels; ++c) {
+				biquadChannel<Types, S, BiquadExact<Types> >(
+					_k, state, in, out, frames, _channels, c);
+			}
+
+		}
+		else {
+
+			for (; c < _channels; ++c) {
+				biquadChannel<Types, S, BiquadOperators<Types> >(
+					_k, state, in, out, frames, _channels, c);
+			}
+
+		}
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	template<typename InAlloc, typename OutAlloc>
+	void Biquad<InT, CoefT, AccT, StateT, OutT, S>::
+	process(const std::vector<InT, InAlloc>& in,
+	        std::vector<OutT, OutAlloc>& out) {
+
+		if (in.size() % _channels != 0) {
+			throw std::invalid_argument("Biquad input is not a whole number "
+			                            "of frames");
+		}
+
+		out.resize(in.size());
+
+		if (!in.empty()) {
+			process(&in[0], &out[0], in.size()/_channels);
+		}
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	void Biquad<InT, CoefT, AccT, StateT, OutT, S>::reset() {
+		_state.assign(BiquadStep<S>::STATES*_channels, 0);
+	}
+
+
+	//BiquadCascade
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	BiquadCascade<InT, CoefT, AccT, StateT, OutT, S>::
+	BiquadCascade(const std::vector< BiquadCoefficients<CoefT> >& sections,
+	              std::size_t channels)
+		: _first(front(sections), channels)
+	{
+
+		for (std::size_t i = 1; i < sections.size(); ++i) {
+			_rest.push_back(Section(sections[i], channels));
+		}
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	const BiquadCoefficients<CoefT>&
+	BiquadCascade<InT, CoefT, AccT, StateT, OutT, S>::
+	front(const std::vector< BiquadCoefficients<CoefT> >& sections) {
+
+		if (sections.empty()) {
+			throw std::invalid_argument("Biquad cascade has no sections");
+		}
+
+		return sections[0];
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	std::size_t BiquadCascade<InT, CoefT, AccT, StateT, OutT, S>::
+	size() const {
+		return 1 + _rest.size();
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	std::size_t BiquadCascade<InT, CoefT, AccT, StateT, OutT, S>::
+	channels() const {
+		return _first.channels();
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	void BiquadCascade<InT, CoefT, AccT, StateT, OutT, S>::
+	process(const InT* in, OutT* out, std::size_t frames) {
+
+		_first.process(in, out, frames);
+
+		for (std::size_t i = 0; i < _rest.size(); ++i) {
+			_rest[i].process(out, out, frames);
+		}
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	template<typename InAlloc, typename OutAlloc>
+	void BiquadCascade<InT, CoefT, AccT, StateT, OutT, S>::
+	process(const std::vector<InT, InAlloc>& in,
+	        std::vector<OutT, OutAlloc>& out) {
+
+		_first.process(in, out);
+
+		for (std::size_t i = 0; i < _rest.size() && !out.empty(); ++i) {
+			_rest[i].process(&out[0], &out[0], out.size()/channels());
+		}
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename StateT,
+	         typename OutT, BiquadStructure S>
+	void BiquadCascade<InT, CoefT, AccT, StateT, OutT, S>::reset() {
+
+		_first.reset();
+
+		for (std::size_t i = 0; i < _rest.size(); ++i) {
+			_rest[i].reset();
+		}
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,46 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_PRIVATE_BITS_HPP
+#define FI_PRIVATE_BITS_HPP
+
+#include <stdint.h>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Index of the most significant set bit of a non-zero value.
+	 */
+	inline int leadingOne(uint64_t v) {
+#ifdef __GNUC__
+		return 63 - __builtin_clzll(v);
+#else
+		int p = 0;
+		while (v >>= 1) {
+			++p;
+		}
+		return p;
+#endif
+	}
+
+}
+
+#endif
@@ -0,0 +1,480 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_BLOCKFLOAT_PRIV_HPP
+#define PRIVATE_FI_BLOCKFLOAT_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Fi {
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Vector kernels of Fi::BlockFloat::normalize(). Each
+		 *returns the number of elements it handled.
+		 */
+		template<typename FixedT,
+		         std::size_t LANES = Lanes<typename FixedT::valtype>::COUNT>
+		struct BlockNormalize {
+
+#ifdef FI_SIMD_SSE2
+			typedef typename FixedT::valtype V;
+			typedef Lanes<V> L;
+
+			/**\internal
+			 *\brief Accumulate into \c m the OR of the raw values, with
+			 *negative values complemented.
+			 */
+			static std::size_t magnitude(const FixedT* x, std::size_t n,
+			                             uint64_t& m) {
+
+				std::size_t i = 0;
+				vec acc = zero();
+
+				for (; i + LANES <= n; i += LANES) {
+					vec v = load(raw(x + i));
+					acc = _mm_or_si128(acc,
+						_mm_xor_si128(v, L::srai(v, L::BITS - 1)));
+				}
+
+				V lanes[LANES];
+				store(lanes, acc);
+				for (std::size_t j = 0; j < LANES; ++j) {
+					m |= static_cast<uint64_t>(lanes[j]);
+				}
+
+				return i;
+
+			}
+
+			///\internal \brief Shift the raw values left by \c k bits.
+			static std::size_t shift(FixedT* x, std::size_t n, int k) {
+
+				std::size_t i = 0;
+
+				for (; i + LANES <= n; i += LANES) {
+					store(raw(x + i), L::slli(load(raw(x + i)), k));
+				}
+
+				return i;
+
+			}
+#endif
+
+		};
+
+		template<typename FixedT>
+		struct BlockNormalize<FixedT, 1> {
+
+			static std::size_t magnitude(const FixedT*, std::size_t,
+			                             uint64_t&) {
+				return 0;
+			}
+
+			static std::size_t shift(FixedT*, std::size_t, int) {
+				return 0;
+			}
+
+		};
+
+	}
+
+	/**\internal
+	 *\brief Removes two guard bits using the rounding mode of a
+	 *fixed-point type.
+	 */
+	template<typename FixedT>
+	struct GuardRound;
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	struct GuardRound< Fixed<W, F, S, OF, R> > {
+		static int64_t apply(int64_t n) {
+			return RoundBits<R, 2>::apply(n);
+		}
+	};
+
+	/**\internal
+	 *\brief Normalization and arithmetic of Fi::BlockFloat on exact
+	 *64-bit intermediate results.
+	 */
+	template<typename MantT, std::size_t N, std::size_t E>
+	struct BlockFloatOps {
+
+		typedef BlockFloat<MantT, N, E> Block;
+
+		static const int W = static_cast<int>(MantT::WORD_LENGTH);
+		static const int F = static_cast<int>(MantT::FRACTION_LENGTH);
+
+		/**\internal
+		 *\brief \c n scaled by <tt>2^(2 - s)</tt>, i.e. with two guard
+		 *bits after a right shift by \c s. Bits shifted out are folded into
+		 *the least significant bit; values too large for 62 bits are
+		 *limited to <tt>+/-2^62</tt>. A left shift would turn such a folded
+		 *bit into a value, so only exact values may be shifted left:
+		 *fromDouble() and add() fold bits only below the scale of the
+		 *largest exponent.
+		 */
+		static int64_t guard(int64_t n, int s) {
+
+			if (n == 0) {
+				return 0;
+			}
+
+			if (s <= 2) {
+				const int l = 2 - s;
+				const int64_t limit = (l < 62) ? int64_t(1) << (62 - l) : 1;
+				if (n >= limit) {
+					return int64_t(1) << 62;
+				}
+				if (n <= -limit) {
+					return -(int64_t(1) << 62);
+				}
+				return n * (int64_t(1) << l);
+			}
+
+			const int k = s - 2;
+			if (k >= 63) {
+				return (n < 0) ? -1 : 1;
+			}
+
+			const int64_t lost = n & ((int64_t(1) << k) - 1);
+			return (n >> k) | ((lost != 0) ? 1 : 0);
+
+		}
+
+		/**\internal
+		 *\brief Normalized block of the values <tt>n[i]*2^(e0 - F)</tt>.
+		 */
+		static const Block pack(const int64_t* n, int e0) {
+
+			uint64_t m = 0;
+			bool zero = true;
+			for (std::size_t i = 0; i < N; ++i) {
+				m |= static_cast<uint64_t>(n[i] ^ (n[i] >> 63));
+				zero = zero && (n[i] == 0);
+			}
+
+			if (zero) {
+				return Block();
+			}
+
+			//Shift that leaves W significant bits, limited by the range
+			//of the exponent. Values of -1 need a single bit.
+			int s = ((m == 0) ? 1 : leadingOne(m) + 2) - W;
+			s = std::min(std::max(e0 + s, +Block::MIN_EXPONENT),
+			             +Block::MAX_EXPONENT) - e0;
+
+			const int64_t maxVal = MantT::TR::MAX_VAL;
+			const int64_t minVal = MantT::TR::MIN_VAL;
+
+			int64_t r[N];
+
+			for (;;) {
+
+				bool carry = false;
+				for (std::size_t i = 0; i < N; ++i) {
+					r[i] = GuardRound<MantT>::apply(guard(n[i], s));
+					carry = carry || (r[i] > maxVal) || (r[i] < minVal);
+				}
+
+				//Rounding carried out of the word: one more bit.
+				if (!carry || e0 + s == Block::MAX_EXPONENT) {
+					break;
+				}
+				++s;
+
+			}
+
+			MantT mantissas[N];
+			for (std::size_t i = 0; i < N; ++i) {
+				mantissas[i] =
+					Requantize<MantT, MantT::FRACTION_LENGTH>::apply(r[i]);
+			}
+
+			return Block(mantissas, e0 + s);
+
+		}
+
+		///\internal \brief Element-wise <tt>x + sign*y</tt>.
+		static const Block add(const Block& x, const Block& y, int sign) {
+
+			Block a(x);
+			Block b(y);
+			a.normalize();
+			b.normalize();
+
+			//Align to the smaller exponent, limiting the left shift of the
+			//larger operand to 61 - W bits.
+			const int limit = 61 - W;
+			const int e0 = std::max(std::min(a.exponent(), b.exponent()),
+			                        std::max(a.exponent(), b.exponent()) - limit);
+			const int sa = a.exponent() - e0;
+			const int sb = b.exponent() - e0;
+
+			int64_t n[N];
+			for (std::size_t i = 0; i < N; ++i) {
+				n[i] = align(rawValue(a.mantissa(i)), sa)
+					+ sign*align(rawValue(b.mantissa(i)), sb);
+			}
+
+			return pack(n, e0);
+
+		}
+
+		/**\internal
+		 *\brief \c n shifted left by \c s bits, or right with the bits
+		 *shifted out folded into the least significant bit.
+		 */
+		static int64_t align(int64_t n, int s) {
+			if (s >= 0) {
+				return n * (int64_t(1) << s);
+			}
+			return guard(n, 2 - s);
+		}
+
+		static const Block multiply(const Block& x, const Block& y) {
+
+			int64_t n[N];
+			for (std::size_t i = 0; i < N; ++i) {
+				n[i] = rawValue(x.mantissa(i))*rawValue(y.mantissa(i));
+			}
+
+			return pack(n, x.exponent() + y.exponent() - F);
+
+		}
+
+	};
+
+	//BlockFloat
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	BlockFloat<MantT, N, E>::BlockFloat()
+		: _exponent(MIN_EXPONENT)
+	{
+
+		typedef char SignCheck[(MantT::SIGNEDNESS == SIGNED) ? 1 : -1];
+		typedef char SizeCheck[(N >= 1) ? 1 : -1];
+		typedef char ExponentCheck[(E >= 2 && E <= 16) ? 1 : -1];
+		(void)sizeof(SignCheck);
+		(void)sizeof(SizeCheck);
+		(void)sizeof(ExponentCheck);
+
+		for (std::size_t i = 0; i < N; ++i) {
+			_mantissas[i] = MantT::fromBinary(0);
+		}
+
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	BlockFloat<MantT, N, E>::BlockFloat(const MantT* mantissas, int exponent)
+		: _exponent(exponent)
+	{
+
+		if (exponent < MIN_EXPONENT || exponent > MAX_EXPONENT) {
+			throw std::invalid_argument("BlockFloat: exponent out of range.");
+		}
+
+		std::copy(mantissas, mantissas + N, _mantissas);
+
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	template<typename FixedT>
+	const BlockFloat<MantT, N, E>
+	BlockFloat<MantT, N, E>::fromFixed(const FixedT* x) {
+
+		int64_t n[N];
+		for (std::size_t i = 0; i < N; ++i) {
+			n[i] = rawValue(x[i]);
+		}
+
+		return BlockFloatOps<MantT, N, E>::pack(n,
+			static_cast<int>(MantT::FRACTION_LENGTH)
+			- static_cast<int>(FixedT::FRACTION_LENGTH));
+
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	const BlockFloat<MantT, N, E>
+	BlockFloat<MantT, N, E>::fromDouble(const double* x) {
+
+		int emax = 0;
+		bool nonZero = false;
+		for (std::size_t i = 0; i < N; ++i) {
+			if (x[i] != 0) {
+				int e;
+				std::frexp(x[i], &e);
+				emax = nonZero ? std::max(emax, e) : e;
+				nonZero = true;
+			}
+		}
+
+		if (!nonZero) {
+			return BlockFloat();
+		}
+
+		//Scaled to 60 bits, which holds every significand of the largest
+		//values, with inexact values marked by the least significant bit.
+		//The scale is at least two bits finer than the largest exponent,
+		//so that packing never shifts an inexact value left; larger values
+		//are limited to 2^62 and overflow.
+		const int e0 = std::min(
+			emax - 60 + static_cast<int>(MantT::FRACTION_LENGTH),
+			MAX_EXPONENT - 2);
+		const double limit = std::ldexp(1.0, 62);
+		int64_t n[N];
+		for (std::size_t i = 0; i < N; ++i) {
+			const double y = std::max(std::min(std::ldexp(x[i],
+				static_cast<int>(MantT::FRACTION_LENGTH) - e0), limit), -limit);
+			const double t = std::floor(y);
+			n[i] = static_cast<int64_t>(t) | ((t != y) ? 1 : 0);
+		}
+
+		return BlockFloatOps<MantT, N, E>::pack(n, e0);
+
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	template<typename FixedT>
+	void BlockFloat<MantT, N, E>::toFixed(FixedT* out) const {
+
+		//Left shifts are limited to 32 bits, which overflows any
+		//destination unless the mantissa is zero.
+		const int d = _exponent - static_cast<int>(MantT::FRACTION_LENGTH)
+			+ static_cast<int>(FixedT::FRACTION_LENGTH);
+
+		for (std::size_t i = 0; i < N; ++i) {
+			const int64_t m = rawValue(_mantissas[i]);
+			if (d >= 0) {
+				out[i] = Requantize<FixedT, FixedT::FRACTION_LENGTH>::apply(
+					m * (int64_t(1) << std::min(d, 32)));
+			}
+			else {
+				out[i] = requantizeScaled<FixedT,
+				                          FixedT::FRACTION_LENGTH + 2>(4*m, d);
+			}
+		}
+
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	void BlockFloat<MantT, N, E>::toDouble(double* out) const {
+		for (std::size_t i = 0; i < N; ++i) {
+			out[i] = value(i);
+		}
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	double BlockFloat<MantT, N, E>::value(std::size_t i) const {
+		return std::ldexp(static_cast<double>(rawValue(_mantissas[i])),
+		                  _exponent - static_cast<int>(MantT::FRACTION_LENGTH));
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	const MantT& BlockFloat<MantT, N, E>::mantissa(std::size_t i) const {
+		return _mantissas[i];
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	int BlockFloat<MantT, N, E>::exponent() const {
+		return _exponent;
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	int BlockFloat<MantT, N, E>::headroom() const {
+
+		uint64_t m = 0;
+		std::size_t i = Simd::BlockNormalize<MantT>::magnitude(_mantissas, N, m);
+
+		for (; i < N; ++i) {
+			const int64_t v = rawValue(_mantissas[i]);
+			m |= static_cast<uint64_t>(v ^ (v >> 63));
+		}
+
+		const int w = static_cast<int>(MantT::WORD_LENGTH);
+		return (m == 0) ? w - 1 : w - 2 - leadingOne(m);
+
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	void BlockFloat<MantT, N, E>::normalize() {
+
+		const int h = headroom();
+
+		if (h == static_cast<int>(MantT::WORD_LENGTH) - 1) {
+			bool zero = true;
+			for (std::size_t i = 0; i < N; ++i) {
+				zero = zero && (rawValue(_mantissas[i]) == 0);
+			}
+			if (zero) {
+				_exponent = MIN_EXPONENT;
+				return;
+			}
+		}
+
+		const int k = std::min(h, _exponent - MIN_EXPONENT);
+		if (k == 0) {
+			return;
+		}
+
+		std::size_t i = Simd::BlockNormalize<MantT>::shift(_mantissas, N, k);
+
+		for (; i < N; ++i) {
+			_mantissas[i] = MantT::fromBinary(
+				static_cast<typename MantT::valtype>(
+					rawValue(_mantissas[i]) * (int64_t(1) << k)));
+		}
+
+		_exponent -= k;
+
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	const BlockFloat<MantT, N, E> operator+(const BlockFloat<MantT, N, E>& x,
+	                                        const BlockFloat<MantT, N, E>& y) {
+		return BlockFloatOps<MantT, N, E>::add(x, y, 1);
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	const BlockFloat<MantT, N, E> operator-(const BlockFloat<MantT, N, E>& x,
+	                                        const BlockFloat<MantT, N, E>& y) {
+		return BlockFloatOps<MantT, N, E>::add(x, y, -1);
+	}
+
+	template<typename MantT, std::size_t N, std::size_t E>
+	const BlockFloat<MantT, N, E> operator*(const BlockFloat<MantT, N, E>& x,
+	                                        const BlockFloat<MantT, N, E>& y) {
+		return BlockFloatOps<MantT, N, E>::multiply(x, y);
+	}
+
+}
+
+#endif
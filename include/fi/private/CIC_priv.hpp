@@ -0,0 +1,420 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_CIC_PRIV_HPP
+#define PRIVATE_FI_CIC_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Register widths and pruning of a CIC filter, computed once
+	 *per instantiation.
+	 */
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	class CICDesign {
+
+	public:
+
+		typedef CICFormat<InT, N, R, M, T> Format;
+
+		typedef char OutputCheck[(Format::FRACTION_LENGTH <
+		                          OutT::FRACTION_LENGTH + 31) ? 1 : -1];
+
+		///\internal \brief Bits discarded by the output conversion.
+		static const std::size_t DROPPED =
+			(Format::FRACTION_LENGTH > OutT::FRACTION_LENGTH) ?
+			Format::FRACTION_LENGTH - OutT::FRACTION_LENGTH : 0;
+
+		static const CICDesign& instance() {
+			static const CICDesign d;
+			return d;
+		}
+
+		///\internal \brief Width of the registers of a stage.
+		std::size_t width(std::size_t stage) const {
+			return _width[stage];
+		}
+
+		///\internal \brief Bits discarded up to and including a stage.
+		std::size_t pruned(std::size_t stage) const {
+			return _pruned[stage];
+		}
+
+		///\internal \brief Bits discarded at the input of a stage.
+		std::size_t shift(std::size_t stage) const {
+			return (stage == 0) ? _pruned[0] :
+				_pruned[stage] - _pruned[stage - 1];
+		}
+
+	private:
+
+		CICDesign() : _width(2*N), _pruned(2*N, 0) {
+			if (T == CIC_DECIMATOR) {
+				decimator();
+			}
+			else {
+				interpolator();
+			}
+		}
+
+		/**\internal
+		 *\brief Sum of the squares of the impulse response from the
+		 *input of a stage to the output.
+		 */
+		static double noiseGain(std::size_t stage) {
+
+			const std::size_t RM = R*M;
+
+			if (stage >= N) {
+				//(1 - z^-M)^m at the low rate: sum is binomial(2m, m)
+				const std::size_t m = 2*N - stage;
+				double b = 1.0;
+				for (std::size_t k = 1; k <= m; ++k) {
+					b = b*static_cast<double>(m + k)/static_cast<double>(k);
+				}
+				return b;
+			}
+
+			//(1 + ... + z^-(RM - 1))^(N - stage) (1 - z^-RM)^stage
+			std::vector<double> h(1, 1.0);
+			for (std::size_t i = 0; i < N; ++i) {
+				const bool box = (i < N - stage);
+				std::vector<double> g(h.size() + (box ? RM - 1 : RM), 0.0);
+				for (std::size_t k = 0; k < h.size(); ++k) {
+					if (box) {
+						for (std::size_t d = 0; d < RM; ++d) {
+							g[k + d] += h[k];
+						}
+					}
+					else {
+						g[k] += h[k];
+						g[k + RM] -= h[k];
+					}
+				}
+				h.swap(g);
+			}
+
+			double sum = 0.0;
+			for (std::size_t k = 0; k < h.size(); ++k) {
+				sum += h[k]*h[k];
+			}
+			return sum;
+
+		}
+
+		void decimator() {
+
+			//Hogenauer: the error added by discarding B bits at a stage
+			//is at most 1/(2N) of that of the output quantization.
+			const std::size_t dropped = DROPPED;
+			std::size_t previous = 0;
+
+			for (std::size_t j = 0; j < 2*N; ++j) {
+
+				double b = 0.0;
+				if (dropped > 0) {
+					b = std::floor(static_cast<double>(dropped) - 0.5*
+						std::log(2.0*N*noiseGain(j))/std::log(2.0));
+				}
+
+				std::size_t p = (b > 0.0) ? static_cast<std::size_t>(b) : 0;
+				p = std::min(std::max(p, previous), dropped);
+
+				_pruned[j] = p;
+				_width[j] = Format::WORD_LENGTH - p;
+				previous = p;
+
+			}
+
+		}
+
+		void interpolator() {
+
+			//Hogenauer: gain up to comb j is 2^j, up to integrator j is
+			//2^(2N - j) (RM)^(j - N)/R.
+			const double rm = std::log(static_cast<double>(R*M))/std::log(2.0);
+			const double r = std::log(static_cast<double>(R))/std::log(2.0);
+
+			for (std::size_t j = 1; j <= 2*N; ++j) {
+
+				double g = static_cast<double>(j);
+				if (j > N) {
+					g = static_cast<double>(2*N - j) +
+						static_cast<double>(j - N)*rm - r;
+				}
+
+				g = std::ceil(g - 1e-9);
+				const std::size_t w = Format::INPUT_LENGTH +
+					((g > 0.0) ? static_cast<std::size_t>(g) : 0);
+				_width[j - 1] = std::min<std::size_t>(w, 64);
+
+			}
+
+			_width[2*N - 1] = Format::WORD_LENGTH;
+
+		}
+
+		std::vector<std::size_t> _width;
+		std::vector<std::size_t> _pruned;
+
+	};
+
+
+	/**\internal
+	 *\brief Sign-extend the \c w least significant bits of \c v.
+	 */
+	inline int64_t wrapBits(int64_t v, std::size_t w) {
+		if (w >= 64) {
+			return v;
+		}
+		const int s = static_cast<int>(64 - w);
+		return static_cast<int64_t>(static_cast<uint64_t>(v) << s) >> s;
+	}
+
+
+	//CIC
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	CIC<InT, N, R, M, T, OutT>::CIC(std::size_t channels)
+		: _channels(channels)
+	{
+
+		if (channels == 0) {
+			throw std::invalid_argument("CIC: no channels");
+		}
+
+		CICDesign<InT, N, R, M, T, OutT>::instance();
+		reset();
+
+	}
+
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	std::size_t CIC<InT, N, R, M, T, OutT>::channels() const {
+		return _channels;
+	}
+
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	std::size_t CIC<InT, N, R, M, T, OutT>::registerWidth(std::size_t stage) {
+		if (stage >= 2*N) {
+			throw std::invalid_argument("CIC::registerWidth: no such stage");
+		}
+		return CICDesign<InT, N, R, M, T, OutT>::instance().width(stage);
+	}
+
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	std::size_t CIC<InT, N, R, M, T, OutT>::pruned(std::size_t stage) {
+		if (stage >= 2*N) {
+			throw std::invalid_argument("CIC::pruned: no such stage");
+		}
+		return CICDesign<InT, N, R, M, T, OutT>::instance().pruned(stage);
+	}
+
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	std::size_t CIC<InT, N, R, M, T, OutT>::
+	maxOutputs(std::size_t n) const {
+
+		if (T == CIC_INTERPOLATOR) {
+			return n*R;
+		}
+
+		//Input i is kept if _time + i is a multiple of R.
+		const std::size_t first = (R - _time) % R;
+		return (n > first) ? (n - first - 1)/R + 1 : 0;
+
+	}
+
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	std::size_t CIC<InT, N, R, M, T, OutT>::
+	process(const InT* in, std::size_t n, OutT* out) {
+
+		const std::size_t C = _channels;
+		std::size_t count = 0;
+
+		for (std::size_t i = 0; i < n; ++i) {
+
+			for (std::size_t c = 0; c < C; ++c) {
+				_work[c] = rawValue(in[i*C + c]);
+			}
+
+			if (T == CIC_DECIMATOR) {
+				integrate(&_work[0]);
+				if (_time == 0) {
+					output(comb(&_integrators[(N - 1)*C]),
+					       out + C*count++);
+				}
+				_time = (_time + 1) % R;
+			}
+			else {
+				integrate(comb(&_work[0]));
+				output(&_integrators[(N - 1)*C], out + C*count++);
+				for (std::size_t r = 1; r < R; ++r) {
+					integrate(0);
+					output(&_integrators[(N - 1)*C], out + C*count++);
+				}
+			}
+
+		}
+
+		return count;
+
+	}
+
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	template<typename InAlloc, typename OutAlloc>
+	void CIC<InT, N, R, M, T, OutT>::
+	process(const std::vector<InT, InAlloc>& in,
+	        std::vector<OutT, OutAlloc>& out) {
+
+		if (in.size() % _channels != 0) {
+			throw std::invalid_argument("CIC::process: partial frame");
+		}
+
+		const std::size_t n = in.size()/_channels;
+		out.resize(maxOutputs(n)*_channels);
+
+		if (!in.empty()) {
+			out.resize(process(&in[0], n, out.empty() ? 0 : &out[0])*
+			           _channels);
+		}
+		else {
+			out.clear();
+		}
+
+	}
+
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	void CIC<InT, N, R, M, T, OutT>::reset() {
+		_integrators.assign(N*_channels, 0);
+		_combs.assign(N*M*_channels, 0);
+		_work.assign(_channels, 0);
+		_slot = 0;
+		_time = 0;
+	}
+
+
+	/**\internal
+	 *\brief Run the integrators on a frame, or on zeros if \c x is null.
+	 */
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	void CIC<InT, N, R, M, T, OutT>::
+	integrate(const int64_t* x) {
+
+		typedef CICDesign<InT, N, R, M, T, OutT> Design;
+		const Design& design = Design::instance();
+		const std::size_t C = _channels;
+		const std::size_t first = (T == CIC_DECIMATOR) ? 0 : N;
+
+		for (std::size_t j = 0; j < N; ++j) {
+
+			int64_t* acc = &_integrators[j*C];
+			const std::size_t s = design.shift(first + j);
+			const std::size_t w = design.width(first + j);
+
+			if (x != 0) {
+				for (std::size_t c = 0; c < C; ++c) {
+					acc[c] = wrapBits(acc[c] + (x[c] >> s), w);
+				}
+			}
+			x = acc;
+
+		}
+
+	}
+
+
+	/**\internal
+	 *\brief Run the combs on a frame.
+	 *\return The outputs of the last comb.
+	 */
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	const int64_t* CIC<InT, N, R, M, T, OutT>::
+	comb(const int64_t* x) {
+
+		typedef CICDesign<InT, N, R, M, T, OutT> Design;
+		const Design& design = Design::instance();
+		const std::size_t C = _channels;
+		const std::size_t first = (T == CIC_DECIMATOR) ? N : 0;
+		int64_t* y = &_work[0];
+
+		for (std::size_t j = 0; j < N; ++j) {
+
+			int64_t* line = &_combs[(j*M + _slot)*C];
+			const std::size_t s = design.shift(first + j);
+			const std::size_t w = design.width(first + j);
+
+			for (std::size_t c = 0; c < C; ++c) {
+				const int64_t v = x[c] >> s;
+				y[c] = wrapBits(v - line[c], w);
+				line[c] = v;
+			}
+			x = y;
+
+		}
+
+		_slot = (_slot + 1) % M;
+		return y;
+
+	}
+
+
+	template<typename InT, std::size_t N, std::size_t R, std::size_t M,
+	         CICType T, typename OutT>
+	void CIC<InT, N, R, M, T, OutT>::
+	output(const int64_t* x, OutT* out) const {
+
+		typedef CICDesign<InT, N, R, M, T, OutT> Design;
+		const int k = static_cast<int>(Design::instance().pruned(2*N - 1));
+
+		for (std::size_t c = 0; c < _channels; ++c) {
+			out[c] = requantizeScaled<OutT, FRACTION_LENGTH>(x[c], k);
+		}
+
+	}
+
+}
+
+#endif
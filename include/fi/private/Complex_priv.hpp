@@ -0,0 +1,626 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef PRIVATE_FI_COMPLEX_PRIV_HPP
+#define PRIVATE_FI_COMPLEX_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <stdexcept>
+
+namespace Fi {
+
+	//Complex
+
+	template<typename T>
+	Complex<T>::Complex()
+		: _re(), _im()
+	{ }
+
+
+	template<typename T>
+	Complex<T>::Complex(const T& re, const T& im)
+		: _re(re), _im(im)
+	{ }
+
+
+	template<typename T>
+	const T& Complex<T>::real() const {
+		return _re;
+	}
+
+
+	template<typename T>
+	const T& Complex<T>::imag() const {
+		return _im;
+	}
+
+
+	template<typename T>
+	void Complex<T>::real(const T& re) {
+		_re = re;
+	}
+
+
+	template<typename T>
+	void Complex<T>::imag(const T& im) {
+		_im = im;
+	}
+
+
+	template<typename T>
+	Complex<T>& Complex<T>::operator+=(const Complex<T>& x) {
+		_re += x._re;
+		_im += x._im;
+		return *this;
+	}
+
+
+	template<typename T>
+	Complex<T>& Complex<T>::operator-=(const Complex<T>& x) {
+		_re -= x._re;
+		_im -= x._im;
+		return *this;
+	}
+
+
+	template<typename T>
+	Complex<T>& Complex<T>::operator*=(const Complex<T>& x) {
+		*this = multiply<T>(*this, x);
+		return *this;
+	}
+
+
+	template<typename T>
+	bool operator==(const Complex<T>& x, const Complex<T>& y) {
+		return (x.real() == y.real()) && (x.imag() == y.imag());
+	}
+
+
+	template<typename T>
+	bool operator!=(const Complex<T>& x, const Complex<T>& y) {
+		return !(x == y);
+	}
+
+
+	template<typename T>
+	const Complex<T> operator+(const Complex<T>& x, const Complex<T>& y) {
+		return Complex<T>(x) += y;
+	}
+
+
+	template<typename T>
+	const Complex<T> operator-(const Complex<T>& x, const Complex<T>& y) {
+		return Complex<T>(x) -= y;
+	}
+
+
+	template<typename T>
+	const Complex<T> operator-(const Complex<T>& x) {
+		return Complex<T>(-x.real(), -x.imag());
+	}
+
+
+	template<typename T>
+	const Complex<T> operator*(const Complex<T>& x, const Complex<T>& y) {
+		return Complex<T>(x) *= y;
+	}
+
+
+	template<typename T>
+	const Complex<T> conj(const Complex<T>& x) {
+		return Complex<T>(x.real(), -x.imag());
+	}
+
+
+	/**\internal
+	 *\brief Rejects operands whose products, plus \c GUARD bits for the
+	 *post-adders, do not fit 63 bits.
+	 */
+	template<std::size_t W1, std::size_t W2, std::size_t GUARD>
+	struct ComplexWidth {
+		typedef char WidthCheck[(W1 + W2 + GUARD <= 63) ? 1 : -1];
+		static void check() { }
+	};
+
+	/**\internal
+	 *\brief A pre-adder of the three-multiplier structure, which
+	 *quantizes the exact sum of two raw values with \c F fractional bits
+	 *to \c PreT.
+	 */
+	template<typename PreT, std::size_t F, std::size_t W>
+	struct PreAdder {
+
+		static const std::size_t FRACTION_LENGTH = PreT::FRACTION_LENGTH;
+		static const std::size_t WORD_LENGTH = PreT::WORD_LENGTH;
+
+		static int64_t apply(int64_t sum) {
+			return rawValue(Requantize<PreT, F>::apply(sum));
+		}
+
+	};
+
+	///\internal \brief An exact pre-adder, one bit wider than its operands.
+	template<std::size_t F, std::size_t W>
+	struct PreAdder<void, F, W> {
+
+		static const std::size_t FRACTION_LENGTH = F;
+		static const std::size_t WORD_LENGTH = W + 1;
+
+		static int64_t apply(int64_t sum) {
+			return sum;
+		}
+
+	};
+
+	/**\internal
+	 *\brief Complex multiplication with a single quantization per
+	 *component.
+
+	 *The products of the real multipliers and the sums of the
+	 *post-adders are exact in 64 bits.
+	 */
+	template<typename ProdT, typename M>
+	struct ComplexMultiply;
+
+	template<typename ProdT>
+	struct ComplexMultiply<ProdT, FourMultipliers> {
+
+		template<typename T1, typename T2>
+		static const Complex<ProdT> apply(const Complex<T1>& x,
+		                                  const Complex<T2>& y) {
+
+			typedef Requantize<ProdT, T1::FRACTION_LENGTH +
+			                   T2::FRACTION_LENGTH> Q;
+
+			ComplexWidth<T1::WORD_LENGTH, T2::WORD_LENGTH, 1>::check();
+
+			const int64_t xr = rawValue(x.real());
+			const int64_t xi = rawValue(x.imag());
+			const int64_t yr = rawValue(y.real());
+			const int64_t yi = rawValue(y.imag());
+
+			ProdT re = Q::apply(xr*yr - xi*yi);
+			ProdT im = Q::apply(xr*yi + xi*yr);
+
+			return Complex<ProdT>(re, im);
+
+		}
+
+	};
+
+	template<typename ProdT, typename PreT>
+	struct ComplexMultiply<ProdT, ThreeMultipliers<PreT> > {
+
+		template<typename T1, typename T2>
+		static const Complex<ProdT> apply(const Complex<T1>& x,
+		                                  const Complex<T2>& y) {
+
+			//ar + ai, and br - bi and br + bi
+			typedef PreAdder<PreT, T1::FRACTION_LENGTH, T1::WORD_LENGTH> PX;
+			typedef PreAdder<PreT, T2::FRACTION_LENGTH, T2::WORD_LENGTH> PY;
+
+			//k1 has the fractional bits of br*PX, k2 and k3 those of
+			//ar*PY; the smaller is shifted to the larger.
+			static const std::size_t F1 = T2::FRACTION_LENGTH +
+				PX::FRACTION_LENGTH;
+			static const std::size_t F2 = T1::FRACTION_LENGTH +
+				PY::FRACTION_LENGTH;
+			static const std::size_t F = (F1 > F2) ? F1 : F2;
+
+			typedef Requantize<ProdT, F> Q;
+
+			ComplexWidth<T2::WORD_LENGTH + PX::WORD_LENGTH, F - F1, 1>::check();
+			ComplexWidth<T1::WORD_LENGTH + PY::WORD_LENGTH, F - F2, 1>::check();
+
+			const int64_t xr = rawValue(x.real());
+			const int64_t xi = rawValue(x.imag());
+			const int64_t yr = rawValue(y.real());
+			const int64_t yi = rawValue(y.imag());
+
+			const int64_t k1 = yr*PX::apply(xr + xi)*(int64_t(1) << (F - F1));
+			const int64_t k2 = xr*PY::apply(yi - yr)*(int64_t(1) << (F - F2));
+			const int64_t k3 = xi*PY::apply(yr + yi)*(int64_t(1) << (F - F2));
+
+			ProdT re = Q::apply(k1 - k3);
+			ProdT im = Q::apply(k1 + k2);
+
+			return Complex<ProdT>(re, im);
+
+		}
+
+	};
+
+
+	template<typename ProdT, typename T1, typename T2>
+	const Complex<ProdT> multiply(const Complex<T1>& x, const Complex<T2>& y) {
+		return ComplexMultiply<ProdT, FourMultipliers>::apply(x, y);
+	}
+
+
+	template<typename ProdT, typename M, typename T1, typename T2>
+	const Complex<ProdT> multiply(const Complex<T1>& x, const Complex<T2>& y) {
+		return ComplexMultiply<ProdT, M>::apply(x, y);
+	}
+
+
+	template<typename T>
+	std::ostream& operator<<(std::ostream& os, const Complex<T>& x) {
+		return os << '(' << x.real() << ',' << x.imag() << ')';
+	}
+
+
+	/**\internal
+	 *\brief Whether a multiplier structure gives the exact sums of
+	 *products: always, except for pre-adders of type \c PreT that cannot
+	 *hold every sum of two numbers of type \c T1 or \c T2.
+	 */
+	template<typename M, typename T1, typename T2>
+	struct ExactStructure {
+		static const bool value = true;
+	};
+
+	template<typename PreT, typename T1, typename T2>
+	struct ExactStructure<ThreeMultipliers<PreT>, T1, T2> {
+
+		template<typename T>
+		struct Holds {
+			static const bool value =
+				(PreT::SIGNEDNESS == SIGNED) &&
+				(PreT::FRACTION_LENGTH >= T::FRACTION_LENGTH) &&
+				(PreT::WORD_LENGTH - PreT::FRACTION_LENGTH >=
+				 T::WORD_LENGTH - T::FRACTION_LENGTH + 1 +
+				 ((T::SIGNEDNESS == SIGNED) ? 0 : 1));
+		};
+
+		static const bool value = Holds<T1>::value && Holds<T2>::value;
+
+	};
+
+	template<typename T1, typename T2>
+	struct ExactStructure<ThreeMultipliers<void>, T1, T2> {
+		static const bool value = true;
+	};
+
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether an interleaved complex product can use 16-bit
+		 *multiply-add instructions.
+
+		 *The operands must be signed and have the same type of at most 15
+		 *bits, so that negating the imaginary part cannot overflow and
+		 *the sum of two products fits 31 bits. The product must be signed
+		 *with at most 16 bits and be rounded by at most 29 bits.
+		 */
+		template<typename ProdT, typename T1, typename T2>
+		struct ComplexMadd {
+			static const bool AVAILABLE = false;
+		};
+
+		template<typename ProdT, typename T>
+		struct ComplexMadd<ProdT, T, T> {
+
+			static const int SHIFT = 2*static_cast<int>(T::FRACTION_LENGTH) -
+				static_cast<int>(ProdT::FRACTION_LENGTH);
+
+#ifdef FI_SIMD_SSE2
+			static const bool AVAILABLE =
+				(T::SIGNEDNESS == SIGNED) &&
+				(T::WORD_LENGTH > 4) && (T::WORD_LENGTH <= 15) &&
+				(ProdT::SIGNEDNESS == SIGNED) &&
+				(ProdT::WORD_LENGTH > 4) && (ProdT::WORD_LENGTH <= 16) &&
+				(SHIFT == 0 || (SHIFT > 0 && SHIFT <= 29 &&
+				                VecRound<typename ProdT::RH>::AVAILABLE));
+#else
+			static const bool AVAILABLE = false;
+#endif
+
+		};
+
+
+		/**\internal
+		 *\brief Element-wise complex product of interleaved arrays.
+
+		 *Processes groups of four complex numbers and returns the number
+		 *of complex numbers handled. A group for which the overflow
+		 *handler of \c ProdT has no vector implementation and overflows
+		 *is computed with the scalar code. Pre-adders that round or
+		 *overflow are only modeled by the scalar code.
+		 */
+		template<typename ProdT, typename M, typename T1, typename T2,
+		         bool ENABLE = ComplexMadd<ProdT, T1, T2>::AVAILABLE &&
+		                       ExactStructure<M, T1, T2>::value>
+		struct ComplexProduct {
+			static std::size_t apply(const T1*, const T2*, ProdT*,
+			                         std::size_t) {
+				return 0;
+			}
+		};
+
+#ifdef FI_SIMD_SSE2
+		template<typename ProdT, typename M, typename T>
+		struct ComplexProduct<ProdT, M, T, T, true> {
+
+			typedef VecOverflow<typename ProdT::OFH> VO;
+			typedef VecRound<typename ProdT::RH> VR;
+
+			static const int SHIFT = ComplexMadd<ProdT, T, T>::SHIFT;
+
+			static std::size_t apply(const T* a, const T* b, ProdT* out,
+			                         std::size_t n) {
+
+				std::size_t i = 0;
+
+				for (; i + 4 <= n; i += 4) {
+
+					vec x = load16(raw(a + 2*i));
+					vec y = load16(raw(b + 2*i));
+
+					vec ySwap = swapPairs16(y);
+					vec yConj = select(Lanes16::odd(), Lanes16::sub(zero(), y), y);
+
+					//Exact pre-adders give the same sums with three multipliers
+					vec re = _mm_madd_epi16(x, yConj);
+					vec im = _mm_madd_epi16(x, ySwap);
+
+					if (SHIFT > 0) {
+						re = VR::template apply<Lanes32>(re, SHIFT);
+						im = VR::template apply<Lanes32>(im, SHIFT);
+					}
+
+					vec lo = _mm_unpacklo_epi32(re, im);
+					vec hi = _mm_unpackhi_epi32(re, im);
+
+					bool ok = VO::template apply<Lanes32>(lo);
+					ok = ok && VO::template apply<Lanes32>(hi);
+
+					if (ok) {
+						store32(raw(out + 2*i), lo, hi);
+					}
+					else {
+						for (std::size_t j = i; j < i + 4; ++j) {
+							Complex<ProdT> p = ComplexMultiply<ProdT, M>::apply(
+								Complex<T>(a[2*j], a[2*j + 1]),
+								Complex<T>(b[2*j], b[2*j + 1]));
+							out[2*j] = p.real();
+							out[2*j + 1] = p.imag();
+						}
+					}
+
+				}
+
+				return i;
+
+			}
+
+		};
+#endif
+
+
+		/**\internal
+		 *\brief Element-wise conjugate of an interleaved array of \c n
+		 *complex numbers, identical to <tt>conj()</tt>.
+		 */
+		template<typename T,
+		         std::size_t LANES = Lanes<typename T::valtype>::COUNT>
+		struct Conjugate {
+
+#ifdef FI_SIMD_SSE2
+			typedef Lanes<typename T::valtype> L;
+			typedef VecOverflow<typename T::OFH> VO;
+
+			static std::size_t apply(const T* a, T* out, std::size_t n) {
+
+				const std::size_t STEP = LANES/2;
+				std::size_t i = 0;
+
+				for (; i + STEP <= n; i += STEP) {
+
+					vec v = load(raw(a + 2*i));
+					v = select(L::odd(), L::sub(zero(), v), v);
+
+					if (VO::template apply<L>(v)) {
+						store(raw(out + 2*i), v);
+					}
+					else {
+						for (std::size_t j = i; j < i + STEP; ++j) {
+							out[2*j] = a[2*j];
+							out[2*j + 1] = -a[2*j + 1];
+						}
+					}
+
+				}
+
+				return i;
+
+			}
+#endif
+
+		};
+
+		template<typename T>
+		struct Conjugate<T, 1> {
+			static std::size_t apply(const T*, T*, std::size_t) {
+				return 0;
+			}
+		};
+
+	}
+
+
+	//ComplexVector
+
+	template<typename T, typename Alloc>
+	ComplexVector<T, Alloc>::ComplexVector(const Alloc& alloc)
+		: _data(alloc)
+	{ }
+
+
+	template<typename T, typename Alloc>
+	ComplexVector<T, Alloc>::ComplexVector(std::size_t n, const Alloc& alloc)
+		: _data(2*n, T(), alloc)
+	{ }
+
+
+	template<typename T, typename Alloc>
+	std::size_t ComplexVector<T, Alloc>::size() const {
+		return _data.size()/2;
+	}
+
+
+	template<typename T, typename Alloc>
+	void ComplexVector<T, Alloc>::resize(std::size_t n) {
+		_data.resize(2*n);
+	}
+
+
+	template<typename T, typename Alloc>
+	const Complex<T> ComplexVector<T, Alloc>::operator[](std::size_t i) const {
+		return Complex<T>(_data[2*i], _data[2*i + 1]);
+	}
+
+
+	template<typename T, typename Alloc>
+	void ComplexVector<T, Alloc>::set(std::size_t i, const Complex<T>& x) {
+		_data[2*i] = x.real();
+		_data[2*i + 1] = x.imag();
+	}
+
+
+	template<typename T, typename Alloc>
+	T* ComplexVector<T, Alloc>::data() {
+		return _data.empty() ? 0 : &_data[0];
+	}
+
+
+	template<typename T, typename Alloc>
+	const T* ComplexVector<T, Alloc>::data() const {
+		return _data.empty() ? 0 : &_data[0];
+	}
+
+
+	/**\internal
+	 *\brief Throws if the operands of an element-wise operation have
+	 *different sizes.
+	 */
+	template<typename T1, typename A1, typename T2, typename A2>
+	void checkSizes(const ComplexVector<T1, A1>& x,
+	                const ComplexVector<T2, A2>& y)
+	{
+
+		if (x.size() != y.size()) {
+			throw std::invalid_argument("ComplexVector operands have "
+			                            "different sizes");
+		}
+
+	}
+
+
+	template<typename T, typename A1, typename A2, typename A3>
+	void add(const ComplexVector<T, A1>& x, const ComplexVector<T, A2>& y,
+	         ComplexVector<T, A3>& out)
+	{
+
+		checkSizes(x, y);
+		out.resize(x.size());
+		Simd::add(x.data(), y.data(), out.data(), 2*x.size());
+
+	}
+
+
+	template<typename T, typename A1, typename A2, typename A3>
+	void subtract(const ComplexVector<T, A1>& x, const ComplexVector<T, A2>& y,
+	              ComplexVector<T, A3>& out)
+	{
+
+		checkSizes(x, y);
+		out.resize(x.size());
+		Simd::subtract(x.data(), y.data(), out.data(), 2*x.size());
+
+	}
+
+
+	template<typename T, typename A1, typename A2>
+	void conjugate(const ComplexVector<T, A1>& x, ComplexVector<T, A2>& out) {
+
+		const std::size_t n = x.size();
+		out.resize(n);
+
+		const T* a = x.data();
+		T* o = out.data();
+
+		std::size_t i = Simd::Conjugate<T>::apply(a, o, n);
+
+		for (; i < n; ++i) {
+			o[2*i] = a[2*i];
+			o[2*i + 1] = -a[2*i + 1];
+		}
+
+	}
+
+
+	template<typename ProdT, typename M, typename T1, typename T2,
+	         typename A1, typename A2, typename A3>
+	void multiply(const ComplexVector<T1, A1>& x,
+	              const ComplexVector<T2, A2>& y,
+	              ComplexVector<ProdT, A3>& out)
+	{
+
+		checkSizes(x, y);
+
+		const std::size_t n = x.size();
+		out.resize(n);
+
+		const T1* a = x.data();
+		const T2* b = y.data();
+		ProdT* o = out.data();
+
+		std::size_t i =
+			Simd::ComplexProduct<ProdT, M, T1, T2>::apply(a, b, o, n);
+
+		for (; i < n; ++i) {
+			Complex<ProdT> p = ComplexMultiply<ProdT, M>::apply(
+				Complex<T1>(a[2*i], a[2*i + 1]),
+				Complex<T2>(b[2*i], b[2*i + 1]));
+			o[2*i] = p.real();
+			o[2*i + 1] = p.imag();
+		}
+
+	}
+
+
+	template<typename ProdT, typename T1, typename T2,
+	         typename A1, typename A2, typename A3>
+	void multiply(const ComplexVector<T1, A1>& x,
+	              const ComplexVector<T2, A2>& y,
+	              ComplexVector<ProdT, A3>& out)
+	{
+
+		multiply<ProdT, FourMultipliers>(x, y, out);
+
+	}
+
+}
+
+#endif
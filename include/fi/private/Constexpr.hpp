@@ -0,0 +1,33 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_PRIVATE_CONSTEXPR_HPP
+#define FI_PRIVATE_CONSTEXPR_HPP
+
+//Functions that can be evaluated at compile time. C++11 limits constexpr
+//functions to a single return statement, so C++14 is required.
+#if __cplusplus >= 201402L
+#define FI_CONSTEXPR constexpr
+#else
+#define FI_CONSTEXPR
+#endif
+
+#endif
@@ -0,0 +1,803 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_CORDIC_PRIV_HPP
+#define PRIVATE_FI_CORDIC_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <stdexcept>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Compile-time constants of the CORDIC algorithm, computed with
+	 *64-bit integer arithmetic so that they do not depend on the floating
+	 *point of the compiler.
+	 */
+	namespace CordicConstants {
+
+		///\internal \brief One with 62 fractional bits.
+		const int64_t ONE_Q62 = int64_t(1) << 62;
+
+		/**\internal
+		 *\brief Partial sum of the series
+		 *<tt>atan(1/N) = sum((-1)^k / ((2k + 1) N^(2k + 1)))</tt> from term
+		 *\c K, where \c P is <tt>2^62 / N^(2K + 1)</tt>.
+		 */
+		template<int64_t N, int64_t P, int64_t K>
+		struct AtanSeries {
+			static const int64_t value = ((K % 2 == 0) ? 1 : -1)*(P/(2*K + 1)) +
+				AtanSeries<N, P/N/N, K + 1>::value;
+		};
+
+		template<int64_t N, int64_t K>
+		struct AtanSeries<N, 0, K> {
+			static const int64_t value = 0;
+		};
+
+		///\internal \brief <tt>atan(1/N)</tt> with 62 fractional bits.
+		template<int64_t N>
+		struct AtanInverse {
+			static const int64_t value = AtanSeries<N, ONE_Q62/N, 0>::value;
+		};
+
+		/**\internal
+		 *\brief <tt>atan(2^-I)</tt> with 62 fractional bits, using
+		 *<tt>atan(1) = atan(1/2) + atan(1/3)</tt>.
+		 */
+		template<std::size_t I>
+		struct Atan {
+			static const int64_t value = AtanInverse<(int64_t(1) << I)>::value;
+		};
+
+		template<>
+		struct Atan<0> {
+			static const int64_t value =
+				AtanInverse<2>::value + AtanInverse<3>::value;
+		};
+
+		///\internal \brief \c V with \c FROM fractional bits, rounded to \c TO.
+		template<int64_t V, std::size_t FROM, std::size_t TO>
+		struct Round {
+			static const int64_t value =
+				(V + (int64_t(1) << (FROM - TO - 1))) >> (FROM - TO);
+		};
+
+		template<int64_t V, std::size_t F>
+		struct Round<V, F, F> {
+			static const int64_t value = V;
+		};
+
+		///\internal \brief <tt>atan(2^-I)</tt> rounded to \c F bits.
+		template<std::size_t F, std::size_t I>
+		struct Angle {
+			static const int64_t value = Round<Atan<I>::value, 62, F>::value;
+		};
+
+		///\internal \brief \c pi rounded to \c F bits.
+		template<std::size_t F>
+		struct Pi {
+			static const int64_t value = Round<Atan<0>::value, 60, F>::value;
+		};
+
+		///\internal \brief <tt>pi/2</tt> rounded to \c F bits.
+		template<std::size_t F>
+		struct HalfPi {
+			static const int64_t value = Round<Atan<0>::value, 61, F>::value;
+		};
+
+		///\internal \brief <tt>floor(sqrt(N))</tt> for \c N below <tt>2^62</tt>.
+		template<int64_t N, int64_t LO = 0, int64_t HI = (int64_t(1) << 31),
+		         bool DONE = (LO >= HI)>
+		struct Sqrt {
+			static const int64_t MID = (LO + HI + 1)/2;
+			static const bool BELOW = (MID*MID <= N);
+			static const int64_t value =
+				Sqrt<N, BELOW ? MID : LO, BELOW ? HI : MID - 1>::value;
+		};
+
+		template<int64_t N, int64_t LO, int64_t HI>
+		struct Sqrt<N, LO, HI, true> {
+			static const int64_t value = LO;
+		};
+
+		/**\internal
+		 *\brief <tt>cos(atan(2^-I)) = 1/sqrt(1 + 2^-2I)</tt> with 31
+		 *fractional bits.
+		 */
+		template<std::size_t I, bool SMALL = (I < 31)>
+		struct Cosine {
+			static const int64_t value =
+				Sqrt<ONE_Q62 - ONE_Q62/((int64_t(1) << 2*I) + 1)>::value;
+		};
+
+		template<std::size_t I>
+		struct Cosine<I, false> {
+			static const int64_t value = int64_t(1) << 31;
+		};
+
+		///\internal \brief <tt>cosh(atanh(2^-I)) = sqrt(1 - 2^-2I)</tt>.
+		template<std::size_t I, bool SMALL = (I < 31)>
+		struct HyperbolicCosine {
+			static const int64_t value =
+				Sqrt<ONE_Q62 - (ONE_Q62 >> 2*I)>::value;
+		};
+
+		template<std::size_t I>
+		struct HyperbolicCosine<I, false> {
+			static const int64_t value = int64_t(1) << 31;
+		};
+
+		///\internal \brief Product of 31-bit fractions, rounded.
+		template<int64_t A, int64_t B>
+		struct Product {
+			static const int64_t value =
+				(A*B + (int64_t(1) << 30)) >> 31;
+		};
+
+		/**\internal
+		 *\brief Circular gain compensation \c 1/A of \c N iterations with
+		 *31 fractional bits.
+		 */
+		template<std::size_t N>
+		struct Gain {
+			static const int64_t value =
+				Product<Gain<N - 1>::value, Cosine<N - 1>::value>::value;
+		};
+
+		template<>
+		struct Gain<0> {
+			static const int64_t value = int64_t(1) << 31;
+		};
+
+		///\internal \brief Whether hyperbolic shift \c I is repeated.
+		template<std::size_t I>
+		struct Repeated {
+			static const bool value = (I == 4 || I == 13 || I == 40);
+		};
+
+		/**\internal
+		 *\brief Hyperbolic gain \c A_h of shifts 1 to \c N, with repeats,
+		 *with 31 fractional bits.
+		 */
+		template<std::size_t N>
+		struct HyperbolicGain {
+			static const int64_t ONCE =
+				Product<HyperbolicGain<N - 1>::value,
+				        HyperbolicCosine<N>::value>::value;
+			static const int64_t value = Repeated<N>::value ?
+				Product<ONCE, HyperbolicCosine<N>::value>::value : ONCE;
+		};
+
+		template<>
+		struct HyperbolicGain<0> {
+			static const int64_t value = int64_t(1) << 31;
+		};
+
+		///\internal \brief <tt>1/A_h^2</tt> with 28 fractional bits.
+		template<std::size_t N>
+		struct SqrtScale {
+			static const int64_t value = (int64_t(1) << 59)/
+				Product<HyperbolicGain<N>::value,
+				        HyperbolicGain<N>::value>::value;
+		};
+
+	}
+
+
+	/**\internal
+	 *\brief Scalar CORDIC iterations on 64-bit raw values.
+	 */
+	struct CordicScalar {
+
+		typedef int64_t value;
+
+		template<std::size_t I>
+		static void rotation(int64_t& x, int64_t& y, int64_t& z, int64_t a) {
+			const int64_t xs = x >> I;
+			const int64_t ys = y >> I;
+			if (z >= 0) {
+				x -= ys;
+				y += xs;
+				z -= a;
+			}
+			else {
+				x += ys;
+				y -= xs;
+				z += a;
+			}
+		}
+
+		template<std::size_t I>
+		static void vectoring(int64_t& x, int64_t& y, int64_t& z, int64_t a) {
+			const int64_t xs = x >> I;
+			const int64_t ys = y >> I;
+			if (y < 0) {
+				x -= ys;
+				y += xs;
+				z -= a;
+			}
+			else {
+				x += ys;
+				y -= xs;
+				z += a;
+			}
+		}
+
+		template<std::size_t I>
+		static void hyperbolic(int64_t& x, int64_t& y) {
+			const int64_t xs = x >> I;
+			const int64_t ys = y >> I;
+			if (y < 0) {
+				x += ys;
+				y += xs;
+			}
+			else {
+				x -= ys;
+				y -= xs;
+			}
+		}
+
+	};
+
+
+	/**\internal
+	 *\brief Circular iterations \c I to <tt>N - 1</tt>, unrolled, with
+	 *angles of \c FA fractional bits.
+	 *\tparam B Scalar or vector backend.
+	 */
+	template<typename B, std::size_t FA, std::size_t I, std::size_t N>
+	struct CordicCircular {
+
+		typedef typename B::value V;
+
+		static void rotation(V& x, V& y, V& z) {
+			B::template rotation<I>(x, y, z,
+			                        CordicConstants::Angle<FA, I>::value);
+			CordicCircular<B, FA, I + 1, N>::rotation(x, y, z);
+		}
+
+		static void vectoring(V& x, V& y, V& z) {
+			B::template vectoring<I>(x, y, z,
+			                         CordicConstants::Angle<FA, I>::value);
+			CordicCircular<B, FA, I + 1, N>::vectoring(x, y, z);
+		}
+
+	};
+
+	template<typename B, std::size_t FA, std::size_t N>
+	struct CordicCircular<B, FA, N, N> {
+		typedef typename B::value V;
+		static void rotation(V&, V&, V&) { }
+		static void vectoring(V&, V&, V&) { }
+	};
+
+	/**\internal
+	 *\brief Hyperbolic vectoring for shifts \c I to \c N, unrolled.
+	 */
+	template<typename B, std::size_t I, std::size_t N, bool DONE = (I > N)>
+	struct CordicHyperbolic {
+
+		typedef typename B::value V;
+
+		static void vectoring(V& x, V& y) {
+			B::template hyperbolic<I>(x, y);
+			if (CordicConstants::Repeated<I>::value) {
+				B::template hyperbolic<I>(x, y);
+			}
+			CordicHyperbolic<B, I + 1, N>::vectoring(x, y);
+		}
+
+	};
+
+	template<typename B, std::size_t I, std::size_t N>
+	struct CordicHyperbolic<B, I, N, true> {
+		typedef typename B::value V;
+		static void vectoring(V&, V&) { }
+	};
+
+
+	/**\internal
+	 *\brief Formats and constants of a Fi::Cordic.
+	 */
+	template<typename FixedT, std::size_t N, typename AngleT>
+	struct CordicTypes {
+
+		typedef char SignCheck[(FixedT::SIGNEDNESS == SIGNED &&
+		                        AngleT::SIGNEDNESS == SIGNED) ? 1 : -1];
+		typedef char IterationCheck[(N >= 1 && N <= 48) ? 1 : -1];
+		typedef char FractionCheck[(FixedT::FRACTION_LENGTH <= 31 &&
+		                            AngleT::FRACTION_LENGTH <= 59) ? 1 : -1];
+
+		static const std::size_t F = FixedT::FRACTION_LENGTH;
+		static const std::size_t FA = AngleT::FRACTION_LENGTH;
+
+		static const int64_t PI = CordicConstants::Pi<FA>::value;
+		static const int64_t HALF_PI = CordicConstants::HalfPi<FA>::value;
+
+		///\c 1/A rounded to \c F bits.
+		static const int64_t K =
+			CordicConstants::Round<CordicConstants::Gain<N>::value, 31, F>::value;
+
+		///Precision of \c 1/A in magnitude(), so that the product fits.
+		static const std::size_t KF = (FixedT::WORD_LENGTH > 28) ?
+			59 - FixedT::WORD_LENGTH : 31;
+		static const int64_t K_MAG =
+			CordicConstants::Gain<N>::value >> (31 - KF);
+
+		typedef CordicCircular<CordicScalar, FA, 0, N> Scalar;
+
+		static const FixedT x(int64_t n) {
+			return Requantize<FixedT, F>::apply(n);
+		}
+
+		static const AngleT z(int64_t n) {
+			return Requantize<AngleT, FA>::apply(n);
+		}
+
+		static void sincos(int64_t a, int64_t& s, int64_t& c) {
+			int64_t x = K;
+			int64_t y = 0;
+			if (a > HALF_PI) {
+				a -= PI;
+				x = -x;
+			}
+			else if (a < -HALF_PI) {
+				a += PI;
+				x = -x;
+			}
+			Scalar::rotation(x, y, a);
+			s = y;
+			c = x;
+		}
+
+		static int64_t atan2(int64_t y, int64_t x) {
+			int64_t z = 0;
+			if (x == 0 && y == 0) {
+				return 0;
+			}
+			if (x < 0) {
+				z = (y >= 0) ? PI : -PI;
+				x = -x;
+				y = -y;
+			}
+			Scalar::vectoring(x, y, z);
+			return z;
+		}
+
+		static int64_t magnitude(int64_t x, int64_t y) {
+			int64_t z = 0;
+			if (x < 0) {
+				x = -x;
+				y = -y;
+			}
+			Scalar::vectoring(x, y, z);
+			return (x*K_MAG) >> KF;
+		}
+
+	};
+
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether a Fi::Cordic can run in 32-bit lanes: the datapath,
+		 *including the growth by \c A and angles up to <tt>pi + 1.74</tt>,
+		 *fits.
+		 */
+		template<typename FixedT, typename AngleT>
+		struct CordicLanes {
+#ifdef FI_SIMD_SSE2
+			static const bool AVAILABLE = (FixedT::WORD_LENGTH <= 29) &&
+				(AngleT::FRACTION_LENGTH <= 28);
+#else
+			static const bool AVAILABLE = false;
+#endif
+		};
+
+#ifdef FI_SIMD_SSE2
+
+		/**\internal
+		 *\brief CORDIC iterations on four 32-bit lanes, with the same
+		 *results as Fi::CordicScalar.
+		 */
+		struct CordicVector {
+
+			typedef vec value;
+
+			///\c v where \c m is zero and \c -v where \c m is all ones.
+			static vec negate(vec v, vec m) {
+				return Lanes32::sub(_mm_xor_si128(v, m), m);
+			}
+
+			///\c m selects the lanes that rotate clockwise.
+			template<std::size_t I>
+			static void step(vec& x, vec& y, vec& z, vec m, int64_t a) {
+				const vec xs = Lanes32::srai(x, I);
+				const vec ys = Lanes32::srai(y, I);
+				x = Lanes32::sub(x, negate(ys, m));
+				y = Lanes32::add(y, negate(xs, m));
+				z = Lanes32::sub(z, negate(Lanes32::set1(a), m));
+			}
+
+			template<std::size_t I>
+			static void rotation(vec& x, vec& y, vec& z, int64_t a) {
+				step<I>(x, y, z, Lanes32::cmplt(z, zero()), a);
+			}
+
+			template<std::size_t I>
+			static void vectoring(vec& x, vec& y, vec& z, int64_t a) {
+				step<I>(x, y, z, Lanes32::cmpgt(y, Lanes32::set1(-1)), a);
+			}
+
+		};
+
+#endif
+
+	}
+
+
+	/**\internal
+	 *\brief Batch functions of a Fi::Cordic: scalar.
+	 */
+	template<typename FixedT, std::size_t N, typename AngleT,
+	         bool VECTOR = Simd::CordicLanes<FixedT, AngleT>::AVAILABLE>
+	struct CordicKernel {
+
+		static std::size_t sincos(const AngleT*, FixedT*, FixedT*, std::size_t) {
+			return 0;
+		}
+
+		static std::size_t atan2(const FixedT*, const FixedT*, AngleT*,
+		                         std::size_t) {
+			return 0;
+		}
+
+		static std::size_t magnitude(const FixedT*, const FixedT*, FixedT*,
+		                             std::size_t) {
+			return 0;
+		}
+
+	};
+
+#ifdef FI_SIMD_SSE2
+
+	/**\internal
+	 *\brief Batch functions of a Fi::Cordic: four CORDICs per register.
+	 *Groups whose results overflow a handler without a vector
+	 *implementation are left to the scalar code.
+	 *\return Number of elements computed.
+	 */
+	template<typename FixedT, std::size_t N, typename AngleT>
+	struct CordicKernel<FixedT, N, AngleT, true> {
+
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+		typedef Simd::vec vec;
+		typedef Simd::Lanes32 L;
+		typedef CordicCircular<Simd::CordicVector, Types::FA, 0, N> Vector;
+		typedef Simd::VecOverflow<typename FixedT::OFH> XOverflow;
+		typedef Simd::VecOverflow<typename AngleT::OFH> ZOverflow;
+
+		///Rotate <tt>(x, y)</tt> by \c pi where \c m is set.
+		static void fold(vec& x, vec& y, vec m) {
+			x = Simd::CordicVector::negate(x, m);
+			y = Simd::CordicVector::negate(y, m);
+		}
+
+		static std::size_t sincos(const AngleT* a, FixedT* s, FixedT* c,
+		                          std::size_t n) {
+
+			std::size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+
+				vec z = Simd::load4(Simd::raw(a + i));
+				const vec hi = L::cmpgt(z, L::set1(Types::HALF_PI));
+				const vec lo = L::cmplt(z, L::set1(-Types::HALF_PI));
+				z = L::sub(z, _mm_and_si128(hi, L::set1(Types::PI)));
+				z = L::add(z, _mm_and_si128(lo, L::set1(Types::PI)));
+
+				vec x = Simd::CordicVector::negate(L::set1(Types::K),
+				                                   _mm_or_si128(hi, lo));
+				vec y = Simd::zero();
+				Vector::rotation(x, y, z);
+
+				if (!XOverflow::template apply<L>(x) ||
+				    !XOverflow::template apply<L>(y)) {
+					break;
+				}
+				Simd::store4(Simd::raw(s + i), y);
+				Simd::store4(Simd::raw(c + i), x);
+
+			}
+			return i;
+
+		}
+
+		static std::size_t atan2(const FixedT* y, const FixedT* x, AngleT* out,
+		                         std::size_t n) {
+
+			std::size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+
+				vec vx = Simd::load4(Simd::raw(x + i));
+				vec vy = Simd::load4(Simd::raw(y + i));
+				const vec m = L::cmplt(vx, Simd::zero());
+				const vec origin = _mm_and_si128(L::cmpeq(vx, Simd::zero()),
+				                                 L::cmpeq(vy, Simd::zero()));
+				vec z = _mm_and_si128(m, Simd::CordicVector::negate(
+					L::set1(Types::PI), L::cmplt(vy, Simd::zero())));
+				fold(vx, vy, m);
+				Vector::vectoring(vx, vy, z);
+				z = _mm_andnot_si128(origin, z);
+
+				if (!ZOverflow::template apply<L>(z)) {
+					break;
+				}
+				Simd::store4(Simd::raw(out + i), z);
+
+			}
+			return i;
+
+		}
+
+		static std::size_t magnitude(const FixedT* x, const FixedT* y,
+		                             FixedT* out, std::size_t n) {
+
+			const vec k = L::set1(Types::K_MAG);
+			const vec low = _mm_set_epi32(0, -1, 0, -1);
+
+			std::size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+
+				vec vx = Simd::load4(Simd::raw(x + i));
+				vec vy = Simd::load4(Simd::raw(y + i));
+				vec z = Simd::zero();
+				fold(vx, vy, L::cmplt(vx, Simd::zero()));
+				Vector::vectoring(vx, vy, z);
+
+				//vx is not negative: unsigned 32 x 32 bit products
+				const vec even = _mm_srli_epi64(_mm_mul_epu32(vx, k),
+				                                static_cast<int>(Types::KF));
+				const vec odd = _mm_srli_epi64(
+					_mm_mul_epu32(_mm_srli_epi64(vx, 32), k),
+					static_cast<int>(Types::KF));
+				vec r = _mm_or_si128(_mm_and_si128(even, low),
+				                     _mm_slli_epi64(odd, 32));
+
+				if (!XOverflow::template apply<L>(r)) {
+					break;
+				}
+				Simd::store4(Simd::raw(out + i), r);
+
+			}
+			return i;
+
+		}
+
+	};
+
+#endif
+
+
+	/**\internal
+	 *\brief Copy the angles of iterations \c I to <tt>N - 1</tt> into a
+	 *table.
+	 */
+	template<std::size_t FA, std::size_t I, std::size_t N>
+	struct CordicTable {
+		static void fill(int64_t* t) {
+			t[I] = CordicConstants::Angle<FA, I>::value;
+			CordicTable<FA, I + 1, N>::fill(t);
+		}
+	};
+
+	template<std::size_t FA, std::size_t N>
+	struct CordicTable<FA, N, N> {
+		static void fill(int64_t*) { }
+	};
+
+
+	//Cordic
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	const AngleT Cordic<FixedT, N, AngleT>::angle(std::size_t i) {
+
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+
+		if (i >= N) {
+			throw std::invalid_argument("Cordic::angle: index out of range");
+		}
+
+		int64_t t[N];
+		CordicTable<Types::FA, 0, N>::fill(t);
+		return Types::z(t[i]);
+
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	const FixedT Cordic<FixedT, N, AngleT>::compensation() {
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+		return Types::x(Types::K);
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	void Cordic<FixedT, N, AngleT>::rotation(FixedT& x, FixedT& y,
+	                                         AngleT& z) {
+
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+
+		int64_t rx = rawValue(x);
+		int64_t ry = rawValue(y);
+		int64_t rz = rawValue(z);
+		Types::Scalar::rotation(rx, ry, rz);
+
+		x = Types::x(rx);
+		y = Types::x(ry);
+		z = Types::z(rz);
+
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	void Cordic<FixedT, N, AngleT>::vectoring(FixedT& x, FixedT& y,
+	                                          AngleT& z) {
+
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+
+		int64_t rx = rawValue(x);
+		int64_t ry = rawValue(y);
+		int64_t rz = rawValue(z);
+		Types::Scalar::vectoring(rx, ry, rz);
+
+		x = Types::x(rx);
+		y = Types::x(ry);
+		z = Types::z(rz);
+
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	void Cordic<FixedT, N, AngleT>::sincos(const AngleT& a, FixedT& s,
+	                                       FixedT& c) {
+
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+
+		int64_t rs;
+		int64_t rc;
+		Types::sincos(rawValue(a), rs, rc);
+
+		s = Types::x(rs);
+		c = Types::x(rc);
+
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	const FixedT Cordic<FixedT, N, AngleT>::sin(const AngleT& a) {
+		FixedT s;
+		FixedT c;
+		sincos(a, s, c);
+		return s;
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	const FixedT Cordic<FixedT, N, AngleT>::cos(const AngleT& a) {
+		FixedT s;
+		FixedT c;
+		sincos(a, s, c);
+		return c;
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	const AngleT Cordic<FixedT, N, AngleT>::atan2(const FixedT& y,
+	                                              const FixedT& x) {
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+		return Types::z(Types::atan2(rawValue(y), rawValue(x)));
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	const FixedT Cordic<FixedT, N, AngleT>::magnitude(const FixedT& x,
+	                                                  const FixedT& y) {
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+		return Types::x(Types::magnitude(rawValue(x), rawValue(y)));
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	const FixedT Cordic<FixedT, N, AngleT>::sqrt(const FixedT& v) {
+
+		typedef CordicTypes<FixedT, N, AngleT> Types;
+
+		//Fractional bits of the datapath: the even number of integer bits
+		//above F makes every normalizing right shift exact.
+		static const std::size_t SH =
+			(FixedT::WORD_LENGTH - FixedT::FRACTION_LENGTH + 1)/2*2;
+		static const std::size_t FI = Types::F + SH;
+
+		const int64_t r = rawValue(v);
+		if (r < 0) {
+			throw std::domain_error("Cordic::sqrt: negative input");
+		}
+		if (r == 0) {
+			return Types::x(0);
+		}
+
+		//m = v/4^e in [1/4, 1)
+		int64_t m = r << SH;
+		int e = 0;
+		while (m >= (int64_t(1) << FI)) {
+			m >>= 2;
+			++e;
+		}
+		while (m < (int64_t(1) << (FI - 2))) {
+			m <<= 2;
+			--e;
+		}
+
+		m = (m*CordicConstants::SqrtScale<N>::value) >> 28;
+		int64_t x = m + (int64_t(1) << (FI - 2));
+		int64_t y = m - (int64_t(1) << (FI - 2));
+		CordicHyperbolic<CordicScalar, 1, N>::vectoring(x, y);
+
+		//sqrt(v) = x*2^e with FI fractional bits
+		const int s = static_cast<int>(SH) - e;
+		return Types::x((s >= 0) ? (x >> s) : (x << -s));
+
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	void Cordic<FixedT, N, AngleT>::sincos(const AngleT* a, FixedT* s,
+	                                       FixedT* c, std::size_t n) {
+
+		std::size_t i = CordicKernel<FixedT, N, AngleT>::sincos(a, s, c, n);
+		for (; i < n; ++i) {
+			sincos(a[i], s[i], c[i]);
+		}
+
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	void Cordic<FixedT, N, AngleT>::atan2(const FixedT* y, const FixedT* x,
+	                                      AngleT* out, std::size_t n) {
+
+		std::size_t i = CordicKernel<FixedT, N, AngleT>::atan2(y, x, out, n);
+		for (; i < n; ++i) {
+			out[i] = atan2(y[i], x[i]);
+		}
+
+	}
+
+	template<typename FixedT, std::size_t N, typename AngleT>
+	void Cordic<FixedT, N, AngleT>::magnitude(const FixedT* x,
+	                                          const FixedT* y, FixedT* out,
+	                                          std::size_t n) {
+
+		std::size_t i =
+			CordicKernel<FixedT, N, AngleT>::magnitude(x, y, out, n);
+		for (; i < n; ++i) {
+			out[i] = magnitude(x[i], y[i]);
+		}
+
+	}
+
+}
+
+#endif
@@ -22,7 +22,10 @@
 #ifndef FI_PRIVATE_DOUBLE_CONVERSION_HPP
 #define FI_PRIVATE_DOUBLE_CONVERSION_HPP
 
+#include "Constexpr.hpp"
+
 #include <cmath>
+#include <cstddef>
 
 namespace Fi {
 
@@ -42,7 +45,7 @@ namespace Fi {
 		 *the result.
 		 */
 		template<typename TR>
-		double toDouble(typename TR::valtype fi);
+		FI_CONSTEXPR double toDouble(typename TR::valtype fi);
 
 		/**\internal
 		 *\brief Convert a floating-point number to a fixed-point number without
@@ -51,7 +54,7 @@ namespace Fi {
 		 *\return The fixed-point number stored in an integer type.
 		 */
 		template<typename TR>
-		typename TR::SignedType toFixedPoint(double number);
+		FI_CONSTEXPR typename TR::SignedType toFixedPoint(double number);
 
 		/**\internal
 		 *\brief Limit a floating-point number to the range [lower, upper)
@@ -61,25 +64,38 @@ namespace Fi {
 		 *\param upper Largest number in the range.
 		 *\return The number limited to the range [lower, upper)
 		 */
-		double limitToRange(double number, double lower, double upper);
+		FI_CONSTEXPR double limitToRange(double number, double lower,
+		                                 double upper);
+
+		/**\internal
+		 *\brief Exact power of two, the same as <tt>std::pow(2.0, n)</tt>.
+		 */
+		FI_CONSTEXPR double powerOfTwo(std::size_t n);
+
+		/**\internal
+		 *\brief Floating-point remainder of \c x / \c y, the same as
+		 *<tt>std::fmod(x, y)</tt> for \c y greater than zero.
+		 */
+		FI_CONSTEXPR double fmod(double x, double y);
 
 	}
 
 	template<typename TR>
-	inline double DoubleConversion::toDouble(typename TR::valtype fi) {
+	inline FI_CONSTEXPR double DoubleConversion::
+	toDouble(typename TR::valtype fi) {
 
-		return static_cast<double>(fi)/ pow(2.0, TR::FRACTION_LENGTH);
+		return static_cast<double>(fi)/ powerOfTwo(TR::FRACTION_LENGTH);
 
 	}
 
 	template<typename TR>
-	inline typename TR::SignedType DoubleConversion::
+	inline FI_CONSTEXPR typename TR::SignedType DoubleConversion::
 	toFixedPoint(double number) {
 
 		typedef typename TR::SignedType sType;
 		typedef typename TR::UnsignedType uType;
 
-		double step = 1.0/std::pow(2.0, TR::FRACTION_LENGTH);
+		double step = 1.0/powerOfTwo(TR::FRACTION_LENGTH);
 		//Safe to multiply by 2.0 since we ensure the type fits below.
 		//The multiplication is needed to handle cases where the number
 		//would overflow without rounding.
@@ -104,14 +120,14 @@ namespace Fi {
 	}
 
 
-	inline double DoubleConversion::
+	inline FI_CONSTEXPR double DoubleConversion::
 	limitToRange(double number, double lower, double upper) {
 
 		double ret = number;
 
 		if ((number < lower) || (number >= upper)) {
-			double small = std::fmod(number, upper - lower) + (upper - lower);
-			ret = std::fmod(small - lower, upper - lower);
+			double small = fmod(number, upper - lower) + (upper - lower);
+			ret = fmod(small - lower, upper - lower);
 			ret += lower;
 		}
 
@@ -119,6 +135,45 @@ namespace Fi {
 
 	}
 
+	inline FI_CONSTEXPR double DoubleConversion::powerOfTwo(std::size_t n) {
+
+		double ret = 1.0;
+
+		for (std::size_t i = 0; i < n; ++i) {
+			ret *= 2.0;
+		}
+
+		return ret;
+
+	}
+
+	inline FI_CONSTEXPR double DoubleConversion::fmod(double x, double y) {
+
+		double r = (x < 0.0) ? -x : x;
+
+		//Infinity and NaN.
+		if (r - r != 0.0) {
+			return r - r;
+		}
+
+		//Subtract the largest y*2^k not greater than r until r < y. Every
+		//subtraction is exact since r < 2*y*2^k.
+		double d = y;
+		while (d <= r/2.0) {
+			d *= 2.0;
+		}
+
+		while (r >= y) {
+			while (d > r) {
+				d /= 2.0;
+			}
+			r -= d;
+		}
+
+		return (x < 0.0) ? -r : r;
+
+	}
+
 }
 
 #endif
@@ -0,0 +1,1349 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_DYN_FIXED_PRIV_HPP
+#define PRIVATE_FI_DYN_FIXED_PRIV_HPP
+
+#include "DoubleConversion.hpp"
+#include "Parser.hpp"
+#include "StringMath.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief The Fi::OverflowMode of an overflow handler.
+	 */
+	template<template<typename> class OF>
+	struct OverflowModeOf;
+
+	template<>
+	struct OverflowModeOf<Saturate> {
+		static const OverflowMode value = SATURATE_OVERFLOW;
+	};
+
+	template<>
+	struct OverflowModeOf<Wrap> {
+		static const OverflowMode value = WRAP_OVERFLOW;
+	};
+
+	template<>
+	struct OverflowModeOf<Throw> {
+		static const OverflowMode value = THROW_OVERFLOW;
+	};
+
+	template<>
+	struct OverflowModeOf<Undefined> {
+		static const OverflowMode value = UNDEFINED_OVERFLOW;
+	};
+
+	template<>
+	struct OverflowModeOf<StickySaturate> {
+		static const OverflowMode value = STICKY_SATURATE_OVERFLOW;
+	};
+
+	template<>
+	struct OverflowModeOf<StickyWrap> {
+		static const OverflowMode value = STICKY_WRAP_OVERFLOW;
+	};
+
+	/**\internal
+	 *\brief The Fi::RoundingMode of a rounding handler.
+	 */
+	template<template<typename> class R>
+	struct RoundingModeOf;
+
+	template<>
+	struct RoundingModeOf<Ceil> {
+		static const RoundingMode value = CEIL_ROUNDING;
+	};
+
+	template<>
+	struct RoundingModeOf<Classic> {
+		static const RoundingMode value = CLASSIC_ROUNDING;
+	};
+
+	template<>
+	struct RoundingModeOf<Fix> {
+		static const RoundingMode value = FIX_ROUNDING;
+	};
+
+	template<>
+	struct RoundingModeOf<Floor> {
+		static const RoundingMode value = FLOOR_ROUNDING;
+	};
+
+	template<>
+	struct RoundingModeOf<NearEven> {
+		static const RoundingMode value = NEAR_EVEN_ROUNDING;
+	};
+
+	template<>
+	struct RoundingModeOf<NearOdd> {
+		static const RoundingMode value = NEAR_ODD_ROUNDING;
+	};
+
+	/**\internal
+	 *\brief The Fi::DynFormat of a Fi::Fixed type.
+	 */
+	template<typename FixedT>
+	struct DynFormatOf;
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	struct DynFormatOf<Fixed<W, F, S, OF, R> > {
+		static const DynFormat& format() {
+			static const DynFormat f(W, F, S, OverflowModeOf<OF>::value,
+			                         RoundingModeOf<R>::value);
+			return f;
+		}
+	};
+
+	/**\internal
+	 *\brief Sign-extend the lower \c bits bits of \c n.
+	 */
+	inline int64_t dynSignExtend(uint64_t n, std::size_t bits) {
+
+		if (bits < 64) {
+			uint64_t mask = ~(~uint64_t(0) << bits);
+			n &= mask;
+			if (((n >> (bits - 1)) & 1) != 0) {
+				n |= ~mask;
+			}
+		}
+
+		return static_cast<int64_t>(n);
+
+	}
+
+	/**\internal
+	 *\brief The type rounding operates on: the internal type of the
+	 *equivalent Fi::Fixed, widened to 64 bits.
+	 */
+	template<Signedness S>
+	struct DynValue {
+		typedef int64_t valtype;
+	};
+
+	template<>
+	struct DynValue<UNSIGNED> {
+		typedef uint64_t valtype;
+	};
+
+	/**\internal
+	 *\brief Helpers shared by the run-time rounding modes.
+	 */
+	template<Signedness S>
+	struct DynRounder {
+
+		typedef typename DynValue<S>::valtype valtype;
+
+		static valtype value(const DynFormat& format, int64_t n) {
+			return static_cast<valtype>(
+				format.internal(static_cast<uint64_t>(n)));
+		}
+
+		static std::pair<int64_t, int> result(valtype n, int direction) {
+			return std::make_pair(static_cast<int64_t>(n), direction);
+		}
+
+		static valtype fMask(const DynFormat& format) {
+			return static_cast<valtype>(format.fMask());
+		}
+
+		//Half of the least significant bit of the result. Any non-zero
+		//value is correct without fractional bits.
+		static valtype half(const DynFormat& format) {
+			std::size_t f = format.fractionLength();
+			return (f == 0) ? valtype(1) : (valtype(1) << (f - 1));
+		}
+
+		static valtype lsb(const DynFormat& format) {
+			return valtype(1) << format.fractionLength();
+		}
+
+		static int sign(valtype n) {
+			//n <= 0 instead of n < 0 to suppress a warning for unsigned types.
+			return (n == 0) ? 0 : ((n <= 0) ? -1 : 1);
+		}
+
+		static int sign(double fl) {
+			return (fl == 0.0) ? 0 : ((fl < 0.0) ? -1 : 1);
+		}
+
+		static int sign(const std::string& str) {
+			return (str == "0.0") ? 0 : (StringMath::less(str, "0.0") ? -1 : 1);
+		}
+
+		static double toDouble(const DynFormat& format, valtype n) {
+			return static_cast<double>(n)/
+				std::pow(2.0, static_cast<double>(format.fractionLength()));
+		}
+
+	};
+
+	/**\internal
+	 *\brief Run-time version of a rounding mode whose result only depends
+	 *on the sign of the exact value and its binary representation.
+
+	 *\tparam Mode The rounding mode, with an \c apply() function.
+	 */
+	template<typename Mode, Signedness S>
+	struct DynSignRounding : public DynRounder<S> {
+
+		typedef DynRounder<S> Base;
+		typedef typename Base::valtype valtype;
+
+		static std::pair<int64_t, int>
+		round(const DynFormat& format, int64_t n) {
+			valtype v = Base::value(format, n);
+			return Mode::apply(format, v, Base::sign(v));
+		}
+
+		static std::pair<int64_t, int>
+		roundDouble(const DynFormat& format, double fl, int64_t n) {
+			return Mode::apply(format, Base::value(format, n), Base::sign(fl));
+		}
+
+		static std::pair<int64_t, int>
+		roundString(const DynFormat& format, const std::string& str,
+		            int64_t n) {
+			return Mode::apply(format, Base::value(format, n), Base::sign(str));
+		}
+
+	};
+
+	/**\internal
+	 *\brief Run-time version of a rounding handler.
+	 */
+	template<RoundingMode R, Signedness S>
+	struct DynRounding;
+
+	template<Signedness S>
+	struct DynRounding<CLASSIC_ROUNDING, S>
+		: public DynSignRounding<DynRounding<CLASSIC_ROUNDING, S>, S> {
+
+		typedef DynRounder<S> Base;
+		typedef typename Base::valtype valtype;
+
+		static std::pair<int64_t, int>
+		apply(const DynFormat& format, valtype n, int sign) {
+
+			int direction = 0;
+			valtype ret = 0;
+			valtype fMask = Base::fMask(format);
+
+			if (sign != 0) {
+				ret = (n & ~fMask) >> format.fractionLength();
+				if ((S == SIGNED) && (sign < 0)) {
+					if ((n & fMask) > Base::half(format)) {
+						ret += 1;
+						direction = -1;
+					}
+				}
+				else {
+					direction = -1;
+					if ((n & fMask) >= Base::half(format)) {
+						ret += 1;
+						direction = 1;
+					}
+				}
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+	};
+
+	template<Signedness S>
+	struct DynRounding<NEAR_EVEN_ROUNDING, S>
+		: public DynSignRounding<DynRounding<NEAR_EVEN_ROUNDING, S>, S> {
+
+		typedef DynRounder<S> Base;
+		typedef typename Base::valtype valtype;
+
+		static std::pair<int64_t, int>
+		apply(const DynFormat& format, valtype n, int sign) {
+
+			int direction = 0;
+			valtype ret = 0;
+			valtype frac = n & Base::fMask(format);
+
+			if (sign != 0) {
+				ret = n >> format.fractionLength();
+				if ((frac == Base::half(format)) &&
+				    ((n & Base::lsb(format)) == 0)) {
+					direction = -1;
+				}
+				else if (frac >= Base::half(format)) {
+					ret += 1;
+					direction = 1;
+				}
+				else {
+					direction = -1;
+				}
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+	};
+
+	template<Signedness S>
+	struct DynRounding<NEAR_ODD_ROUNDING, S>
+		: public DynSignRounding<DynRounding<NEAR_ODD_ROUNDING, S>, S> {
+
+		typedef DynRounder<S> Base;
+		typedef typename Base::valtype valtype;
+
+		static std::pair<int64_t, int>
+		apply(const DynFormat& format, valtype n, int sign) {
+
+			int direction = 0;
+			valtype ret = 0;
+			valtype frac = n & Base::fMask(format);
+
+			if (sign != 0) {
+				ret = n >> format.fractionLength();
+				if ((frac == Base::half(format)) &&
+				    ((n & Base::lsb(format)) != 0)) {
+					direction = -1;
+				}
+				else if (frac >= Base::half(format)) {
+					ret += 1;
+					direction = 1;
+				}
+				else {
+					direction = -1;
+				}
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+	};
+
+	template<Signedness S>
+	struct DynRounding<FIX_ROUNDING, S>
+		: public DynSignRounding<DynRounding<FIX_ROUNDING, S>, S> {
+
+		typedef DynRounder<S> Base;
+		typedef typename Base::valtype valtype;
+
+		static std::pair<int64_t, int>
+		apply(const DynFormat& format, valtype n, int sign) {
+
+			int direction = 0;
+			valtype fMask = Base::fMask(format);
+			valtype ret = n & ~fMask;
+
+			if (sign != 0) {
+				direction = -1;
+				ret >>= format.fractionLength();
+				if ((S == SIGNED) && (sign < 0)) {
+					direction = 1;
+					if ((n & fMask) != 0) {
+						ret += 1;
+					}
+				}
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+		//Like Fi::Fix, strings round as their binary representation.
+		static std::pair<int64_t, int>
+		roundString(const DynFormat& format, const std::string& /*str*/,
+		            int64_t n) {
+			return DynRounding::round(format, n);
+		}
+
+	};
+
+	template<Signedness S>
+	struct DynRounding<CEIL_ROUNDING, S> : public DynRounder<S> {
+
+		typedef DynRounder<S> Base;
+		typedef typename Base::valtype valtype;
+
+		static std::pair<int64_t, int>
+		round(const DynFormat& format, int64_t n) {
+
+			valtype v = Base::value(format, n);
+			int direction = (v == 0) ? 0 : 1;
+			valtype ret = v >> format.fractionLength();
+
+			if ((v & Base::fMask(format)) != 0) {
+				ret += 1;
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+		static std::pair<int64_t, int>
+		roundDouble(const DynFormat& format, double fl, int64_t n) {
+
+			valtype v = Base::value(format, n);
+			int direction = (fl == 0) ? 0 : 1;
+			valtype ret = v >> format.fractionLength();
+
+			if ((v & Base::fMask(format)) != 0) {
+				ret += 1;
+			}
+
+			if ((direction == 1) && (Base::toDouble(format, ret) < fl)) {
+				ret += 1;
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+		static std::pair<int64_t, int>
+		roundString(const DynFormat& format, const std::string& str,
+		            int64_t n) {
+
+			valtype v = Base::value(format, n);
+			int direction = (str == "0.0") ? 0 : 1;
+			valtype ret = v >> format.fractionLength();
+
+			if ((direction == 1) &&
+			    StringMath::less(format.toString(static_cast<int64_t>(ret)),
+			                     str)) {
+				ret += 1;
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+	};
+
+	template<Signedness S>
+	struct DynRounding<FLOOR_ROUNDING, S> : public DynRounder<S> {
+
+		typedef DynRounder<S> Base;
+		typedef typename Base::valtype valtype;
+
+		static std::pair<int64_t, int>
+		round(const DynFormat& format, int64_t n) {
+
+			valtype v = Base::value(format, n);
+			int direction = (v == 0) ? 0 : -1;
+
+			return Base::result(v >> format.fractionLength(), direction);
+
+		}
+
+		static std::pair<int64_t, int>
+		roundDouble(const DynFormat& format, double fl, int64_t n) {
+
+			valtype v = Base::value(format, n);
+			int direction = (fl == 0.0) ? 0 : -1;
+			valtype ret = v >> format.fractionLength();
+
+			if ((direction == -1) && (Base::toDouble(format, ret) > fl)) {
+				ret -= 1;
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+		static std::pair<int64_t, int>
+		roundString(const DynFormat& format, const std::string& str,
+		            int64_t n) {
+
+			valtype v = Base::value(format, n);
+			int direction = (str == "0.0") ? 0 : -1;
+			valtype ret = v >> format.fractionLength();
+
+			if ((direction == -1) &&
+			    StringMath::greater(format.toString(static_cast<int64_t>(ret)),
+			                        str)) {
+				ret -= 1;
+			}
+
+			return Base::result(ret, direction);
+
+		}
+
+	};
+
+	/**\internal
+	 *\brief Run-time version of an overflow handler.
+	 */
+	template<OverflowMode OF>
+	struct DynOverflow;
+
+	template<>
+	struct DynOverflow<SATURATE_OVERFLOW> {
+
+		static int64_t positiveOverflow(const DynFormat& format, int64_t) {
+			return format.maxVal();
+		}
+
+		static int64_t negativeOverflow(const DynFormat& format, int64_t) {
+			return format.minVal();
+		}
+
+	};
+
+	template<>
+	struct DynOverflow<WRAP_OVERFLOW> {
+
+		static int64_t wrap(const DynFormat& format, int64_t n) {
+
+			int64_t ret = format.tMask() & n;
+
+			if ((((n & format.sMask()) >> (format.wordLength() - 1)) & 1) != 0) {
+				ret |= format.sMask();
+			}
+
+			return ret;
+
+		}
+
+		static int64_t positiveOverflow(const DynFormat& format, int64_t n) {
+			return wrap(format, n);
+		}
+
+		static int64_t negativeOverflow(const DynFormat& format, int64_t n) {
+			return wrap(format, n);
+		}
+
+	};
+
+	template<>
+	struct DynOverflow<THROW_OVERFLOW> {
+
+		static int64_t positiveOverflow(const DynFormat&, int64_t) {
+			throw PositiveOverflow("Positive overflow!");
+		}
+
+		static int64_t negativeOverflow(const DynFormat&, int64_t) {
+			throw NegativeOverflow("negative overflow!");
+		}
+
+	};
+
+	template<>
+	struct DynOverflow<UNDEFINED_OVERFLOW> {
+
+		static int64_t positiveOverflow(const DynFormat&, int64_t n) {
+			return n;
+		}
+
+		static int64_t negativeOverflow(const DynFormat&, int64_t n) {
+			return n;
+		}
+
+	};
+
+	template<>
+	struct DynOverflow<STICKY_SATURATE_OVERFLOW> {
+
+		static int64_t positiveOverflow(const DynFormat& format, int64_t n) {
+			overflowStatus() |= POSITIVE_OVERFLOW;
+			return DynOverflow<SATURATE_OVERFLOW>::positiveOverflow(format, n);
+		}
+
+		static int64_t negativeOverflow(const DynFormat& format, int64_t n) {
+			overflowStatus() |= NEGATIVE_OVERFLOW;
+			return DynOverflow<SATURATE_OVERFLOW>::negativeOverflow(format, n);
+		}
+
+	};
+
+	template<>
+	struct DynOverflow<STICKY_WRAP_OVERFLOW> {
+
+		static int64_t positiveOverflow(const DynFormat& format, int64_t n) {
+			overflowStatus() |= POSITIVE_OVERFLOW;
+			return DynOverflow<WRAP_OVERFLOW>::positiveOverflow(format, n);
+		}
+
+		static int64_t negativeOverflow(const DynFormat& format, int64_t n) {
+			overflowStatus() |= NEGATIVE_OVERFLOW;
+			return DynOverflow<WRAP_OVERFLOW>::negativeOverflow(format, n);
+		}
+
+	};
+
+	////////////////////////////////////////////////////////////////////////////////
+	//DynFormat
+
+	inline DynFormat::DynFormat(std::size_t wordLength,
+	                            std::size_t fractionLength,
+	                            Signedness signedness, OverflowMode overflow,
+	                            RoundingMode rounding)
+		: _w(wordLength), _f(fractionLength), _s(signedness),
+		  _overflow(overflow), _rounding(rounding)
+	{
+
+		if ((_w == 0) || (_w > MAX_WORD_LENGTH)) {
+			throw std::invalid_argument("DynFormat word length must be "
+			                            "between 1 and 32");
+		}
+		if (_f > _w) {
+			throw std::invalid_argument("DynFormat fraction length exceeds "
+			                            "the word length");
+		}
+
+		//Fi::Fixed stores numbers in the smallest type of at least 2W bits.
+		_internalBits = (2*_w <= 8) ? 8 : (2*_w <= 16) ? 16 :
+			(2*_w <= 32) ? 32 : 64;
+
+		_tMask = static_cast<int64_t>(~(~uint64_t(0) << _w));
+		_fMask = static_cast<int64_t>(~(~uint64_t(0) << _f));
+
+		if (_s == SIGNED) {
+			_sMask = static_cast<int64_t>(~uint64_t(0) << (_w - 1));
+			_maxVal = (int64_t(1) << (_w - 1)) - 1;
+			_minVal = -(int64_t(1) << (_w - 1));
+		}
+		else {
+			_sMask = 0;
+			_maxVal = (int64_t(1) << _w) - 1;
+			_minVal = 0;
+		}
+
+		double scale = std::pow(2.0, static_cast<double>(_f));
+		_minDouble = static_cast<double>(_minVal)/scale;
+		_maxDouble = static_cast<double>(_maxVal)/scale;
+
+		switch (_overflow) {
+		case SATURATE_OVERFLOW:
+			setOverflow<SATURATE_OVERFLOW>();
+			break;
+		case WRAP_OVERFLOW:
+			setOverflow<WRAP_OVERFLOW>();
+			break;
+		case THROW_OVERFLOW:
+			setOverflow<THROW_OVERFLOW>();
+			break;
+		case UNDEFINED_OVERFLOW:
+			setOverflow<UNDEFINED_OVERFLOW>();
+			break;
+		case STICKY_SATURATE_OVERFLOW:
+			setOverflow<STICKY_SATURATE_OVERFLOW>();
+			break;
+		case STICKY_WRAP_OVERFLOW:
+			setOverflow<STICKY_WRAP_OVERFLOW>();
+			break;
+		default:
+			throw std::invalid_argument("Unknown DynFormat overflow mode");
+		}
+
+		switch (_rounding) {
+		case CEIL_ROUNDING:
+			setRounding<CEIL_ROUNDING>();
+			break;
+		case CLASSIC_ROUNDING:
+			setRounding<CLASSIC_ROUNDING>();
+			break;
+		case FIX_ROUNDING:
+			setRounding<FIX_ROUNDING>();
+			break;
+		case FLOOR_ROUNDING:
+			setRounding<FLOOR_ROUNDING>();
+			break;
+		case NEAR_EVEN_ROUNDING:
+			setRounding<NEAR_EVEN_ROUNDING>();
+			break;
+		case NEAR_ODD_ROUNDING:
+			setRounding<NEAR_ODD_ROUNDING>();
+			break;
+		default:
+			throw std::invalid_argument("Unknown DynFormat rounding mode");
+		}
+
+	}
+
+	template<RoundingMode R>
+	inline void DynFormat::setRounding() {
+
+		if (_s == SIGNED) {
+			_round = &DynRounding<R, SIGNED>::round;
+			_roundDouble = &DynRounding<R, SIGNED>::roundDouble;
+			_roundString = &DynRounding<R, SIGNED>::roundString;
+		}
+		else {
+			_round = &DynRounding<R, UNSIGNED>::round;
+			_roundDouble = &DynRounding<R, UNSIGNED>::roundDouble;
+			_roundString = &DynRounding<R, UNSIGNED>::roundString;
+		}
+
+	}
+
+	template<OverflowMode OF>
+	inline void DynFormat::setOverflow() {
+
+		_positiveOverflow = &DynOverflow<OF>::positiveOverflow;
+		_negativeOverflow = &DynOverflow<OF>::negativeOverflow;
+
+	}
+
+	template<typename FixedT>
+	inline const DynFormat& DynFormat::of() {
+		return DynFormatOf<FixedT>::format();
+	}
+
+	inline std::size_t DynFormat::wordLength() const {
+		return _w;
+	}
+
+	inline std::size_t DynFormat::fractionLength() const {
+		return _f;
+	}
+
+	inline Signedness DynFormat::signedness() const {
+		return _s;
+	}
+
+	inline OverflowMode DynFormat::overflow() const {
+		return _overflow;
+	}
+
+	inline RoundingMode DynFormat::rounding() const {
+		return _rounding;
+	}
+
+	inline int64_t DynFormat::tMask() const {
+		return _tMask;
+	}
+
+	inline int64_t DynFormat::sMask() const {
+		return _sMask;
+	}
+
+	inline int64_t DynFormat::fMask() const {
+		return _fMask;
+	}
+
+	inline int64_t DynFormat::maxVal() const {
+		return _maxVal;
+	}
+
+	inline int64_t DynFormat::minVal() const {
+		return _minVal;
+	}
+
+	inline bool DynFormat::operator==(const DynFormat& that) const {
+		return (_w == that._w) && (_f == that._f) && (_s == that._s) &&
+			(_overflow == that._overflow) && (_rounding == that._rounding);
+	}
+
+	inline bool DynFormat::operator!=(const DynFormat& that) const {
+		return !(*this == that);
+	}
+
+	inline int64_t DynFormat::internal(uint64_t n) const {
+
+		if (_s == SIGNED) {
+			return dynSignExtend(n, _internalBits);
+		}
+		else if (_internalBits < 64) {
+			return static_cast<int64_t>(n & ~(~uint64_t(0) << _internalBits));
+		}
+
+		return static_cast<int64_t>(n);
+
+	}
+
+	inline int64_t DynFormat::fromFixedPoint(int64_t n) const {
+
+		//Compared as signed numbers to detect negative overflow as a
+		//result of subtracting two unsigned numbers.
+		int64_t s = dynSignExtend(static_cast<uint64_t>(n), _internalBits);
+
+		if (s < _minVal) {
+			return _negativeOverflow(*this, n);
+		}
+		else if (s > _maxVal) {
+			return _positiveOverflow(*this, n);
+		}
+
+		return n;
+
+	}
+
+	inline std::pair<int64_t, int> DynFormat::round(int64_t n) const {
+
+		std::pair<int64_t, int> ret = _round(*this, n);
+		ret.first = internal(static_cast<uint64_t>(ret.first));
+		return ret;
+
+	}
+
+	inline int64_t DynFormat::fromDouble(double f) const {
+
+		//Same steps as DoubleConversion::toFixedPoint() on the internal
+		//type, with 2F fractional bits.
+		double step = 1.0/std::pow(2.0, static_cast<double>(_f));
+		double lower = 2.0*_minDouble;
+		double upper = 2.0*(_maxDouble + step);
+
+		double g = DoubleConversion::limitToRange(f, lower, upper);
+
+		uint64_t s = 0;
+		if (2*_f == _internalBits) {
+			s = static_cast<uint64_t>(static_cast<int64_t>(
+				g*std::pow(2.0, static_cast<double>(2*_f - 1))));
+			s <<= 1;
+		}
+		else {
+			s = static_cast<uint64_t>(static_cast<int64_t>(
+				g*std::pow(2.0, static_cast<double>(2*_f))));
+		}
+
+		std::pair<int64_t, int> rounded = _roundDouble(*this, f, internal(s));
+		double roundAmnt = static_cast<double>(rounded.second)/
+			std::pow(2.0, static_cast<double>(_f));
+
+		int64_t ret = internal(static_cast<uint64_t>(rounded.first));
+
+		//Same as OverflowDetector::fromDouble().
+		if ((f < _minDouble) && ((_minDouble - f) >= roundAmnt)) {
+			ret = _negativeOverflow(*this, ret);
+		}
+		else if ((f > _maxDouble) && ((f - _maxDouble) >= -roundAmnt)) {
+			ret = _positiveOverflow(*this, ret);
+		}
+
+		return ret;
+
+	}
+
+	inline int64_t DynFormat::fromString(const std::string& number) const {
+
+		int64_t sign = 1;
+		std::string intS;
+		std::string targetF;
+
+		parseNumber(number, _s, sign, intS, targetF);
+
+		//Same as StringConversion::fromString() with 2F fractional bits.
+		uint64_t val = 0;
+		for (std::size_t i = 0; i < intS.size(); ++i) {
+			val *= 10;
+			val += (intS[i] - '0');
+		}
+
+		if (_f > 0) {
+			val <<= (2*_f - 1);
+			val <<= 1;
+		}
+
+		//Largest fraction not greater than the decimal one, found by
+		//doubling the decimal digits and collecting the carries.
+		std::vector<int> digits(targetF.size());
+		for (std::size_t i = 0; i < targetF.size(); ++i) {
+			digits[i] = targetF[i] - '0';
+		}
+
+		uint64_t frac = 0;
+		for (std::size_t i = 0; i < 2*_f; ++i) {
+			int carry = 0;
+			for (std::size_t j = digits.size(); j > 0; --j) {
+				int d = 2*digits[j - 1] + carry;
+				digits[j - 1] = d % 10;
+				carry = d / 10;
+			}
+			frac = (frac << 1) | static_cast<uint64_t>(carry);
+		}
+
+		val |= frac;
+		val *= static_cast<uint64_t>(sign);
+
+		std::string fStr = ((sign == 1) ? "" : "-") + intS + "." + targetF;
+
+		std::pair<int64_t, int> rounded = _roundString(*this, fStr, internal(val));
+
+		return overflowFromString(fStr,
+		                          internal(static_cast<uint64_t>(rounded.first)),
+		                          rounded.second);
+
+	}
+
+	inline int64_t DynFormat::
+	overflowFromString(const std::string& fStr, int64_t res,
+	                   int roundingDirection) const {
+
+		//Same as OverflowDetector::fromString().
+		int64_t ret = res;
+
+		std::string convRes = toString(ret);
+
+		bool negative = (fStr[0] == '-');
+		bool overflow = false;
+
+		if (negative && (convRes[0] != '-') && (convRes != "0.0")) {
+			overflow = true;
+		}
+		else if (!negative && (convRes[0] == '-') && (convRes != "0.0")) {
+			overflow = true;
+		}
+		else {
+
+			std::string minimum = toString(_minVal);
+			std::string maximum = toString(_maxVal);
+
+			if (StringMath::greater(fStr, maximum)) {
+
+				overflow = true;
+
+				if (roundingDirection == -1) {
+					std::string integer;
+					std::string fractional;
+					int64_t sign;
+					parseNumber(maximum, _s, sign, integer, fractional);
+					std::string limit = StringMath::plusOne(integer) + ".0";
+					if (StringMath::less(fStr, limit)) {
+						overflow = false;
+					}
+				}
+
+			}
+			else if (StringMath::less(fStr, minimum)) {
+
+				overflow = true;
+
+				if (roundingDirection == 1) {
+					std::string integer;
+					std::string fractional;
+					int64_t sign;
+					parseNumber(minimum, _s, sign, integer, fractional);
+					std::string limit = "-" + integer + "." + fractionalString(1);
+					if (StringMath::greater(fStr, limit)) {
+						overflow = false;
+					}
+				}
+
+			}
+
+		}
+
+		if (overflow && negative) {
+			ret = _negativeOverflow(*this, ret);
+		}
+		else if (overflow && !negative) {
+			ret = _positiveOverflow(*this, ret);
+		}
+
+		return ret;
+
+	}
+
+	inline int64_t DynFormat::fromBinary(int64_t value) const {
+
+		int64_t ret = value & _tMask;
+
+		if ((_s == SIGNED) && ((value & _sMask & _tMask) != 0)) {
+			ret |= _sMask;
+		}
+
+		return ret;
+
+	}
+
+	inline std::string DynFormat::integerString(int64_t val) const {
+
+		std::string ret;
+
+		if (_f == _w) {
+			ret = "0";
+		}
+		else {
+			uint64_t absVal = (val > 0) ? static_cast<uint64_t>(val) :
+				uint64_t(0) - static_cast<uint64_t>(val);
+
+			uint64_t i = absVal >> _f;
+
+			do {
+				ret.push_back((i % 10) + '0');
+				i /= 10;
+			} while (i != 0);
+		}
+
+		if ((val & _sMask) != 0) ret.push_back('-');
+
+		return std::string(ret.rbegin(), ret.rend());
+
+	}
+
+	inline std::string DynFormat::fractionalString(int64_t val) const {
+
+		std::string ret;
+
+		uint64_t absfrac = (val > 0) ? static_cast<uint64_t>(val) :
+			uint64_t(0) - static_cast<uint64_t>(val);
+		absfrac &= static_cast<uint64_t>(_fMask);
+
+		if (_f == 0) {
+			ret = "0";
+		}
+		else {
+			do {
+				absfrac *= 10;
+				ret.push_back((absfrac >> _f) + '0');
+				absfrac &= static_cast<uint64_t>(_fMask);
+			} while (absfrac != 0);
+		}
+
+		return ret;
+
+	}
+
+	inline std::string DynFormat::toString(int64_t val) const {
+		return integerString(val) + "." + fractionalString(val);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	//DynFixed
+
+	/**\internal
+	 *\brief Throw unless two numbers have the same format.
+	 */
+	inline void checkFormats(const DynFormat& a, const DynFormat& b) {
+
+		if ((&a != &b) && (a != b)) {
+			throw std::invalid_argument("DynFixed formats do not match");
+		}
+
+	}
+
+	inline DynFixed::DynFixed(const DynFormat& format)
+		: _format(&format), _val(0)
+	{ }
+
+	inline DynFixed::DynFixed(const DynFormat& format, double f)
+		: _format(&format), _val(format.fromDouble(f))
+	{ }
+
+	inline DynFixed::DynFixed(const DynFormat& format,
+	                          const std::string& number)
+		: _format(&format), _val(format.fromString(number))
+	{ }
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	inline DynFixed::DynFixed(const Fixed<W, F, S, OF, R>& x)
+		: _format(&DynFormat::of<Fixed<W, F, S, OF, R> >()),
+		  _val(static_cast<int64_t>(x.toBinary(true)))
+	{ }
+
+	inline DynFixed DynFixed::fromBinary(const DynFormat& format,
+	                                     int64_t value) {
+
+		DynFixed ret(format);
+		ret._val = format.fromBinary(value);
+		return ret;
+
+	}
+
+	inline DynFixed DynFixed::convert(const DynFormat& format) const {
+
+		//Same cases as FixedConversion.
+		const DynFormat& src = *_format;
+
+		bool wordFits = (format.wordLength() >= src.wordLength());
+		bool sameSign = (format.signedness() == src.signedness());
+
+		if (wordFits && sameSign &&
+		    (format.fractionLength() >= src.fractionLength())) {
+			uint64_t val = static_cast<uint64_t>(_val) <<
+				(format.fractionLength() - src.fractionLength());
+			return fromBinary(format, static_cast<int64_t>(val));
+		}
+		else if (wordFits && sameSign) {
+			std::size_t f = 2*format.fractionLength();
+			uint64_t val = static_cast<uint64_t>(_val);
+			val = (f >= src.fractionLength()) ?
+				(val << (f - src.fractionLength())) :
+				static_cast<uint64_t>(_val >> (src.fractionLength() - f));
+			int64_t rounded = format.round(format.internal(val)).first;
+			return fromBinary(format, rounded);
+		}
+
+		return DynFixed(format, toString());
+
+	}
+
+	template<typename FixedT>
+	inline FixedT DynFixed::toFixed() const {
+
+		if ((FixedT::WORD_LENGTH != _format->wordLength()) ||
+		    (FixedT::FRACTION_LENGTH != _format->fractionLength()) ||
+		    (FixedT::SIGNEDNESS != _format->signedness())) {
+			throw std::invalid_argument("DynFixed format does not match "
+			                            "the Fixed type");
+		}
+
+		return FixedT::fromBinary(static_cast<typename FixedT::valtype>(_val));
+
+	}
+
+	inline const DynFormat& DynFixed::format() const {
+		return *_format;
+	}
+
+	inline DynFixed& DynFixed::operator+=(const DynFixed& x) {
+
+		checkFormats(*_format, x.format());
+		uint64_t val = static_cast<uint64_t>(_val) + static_cast<uint64_t>(x._val);
+		_val = _format->fromFixedPoint(_format->internal(val));
+		return *this;
+
+	}
+
+	inline DynFixed& DynFixed::operator-=(const DynFixed& x) {
+
+		checkFormats(*_format, x.format());
+		uint64_t val = static_cast<uint64_t>(_val) - static_cast<uint64_t>(x._val);
+		_val = _format->fromFixedPoint(_format->internal(val));
+		return *this;
+
+	}
+
+	inline DynFixed& DynFixed::operator*=(const DynFixed& x) {
+
+		checkFormats(*_format, x.format());
+		uint64_t val = static_cast<uint64_t>(_val) * static_cast<uint64_t>(x._val);
+		_val = _format->round(_format->internal(val)).first;
+		_val = _format->fromFixedPoint(_val);
+		return *this;
+
+	}
+
+	inline DynFixed& DynFixed::operator/=(const DynFixed& x) {
+
+		checkFormats(*_format, x.format());
+
+		uint64_t val = static_cast<uint64_t>(_val) << _format->fractionLength();
+		if (_format->signedness() == SIGNED) {
+			val = static_cast<uint64_t>(static_cast<int64_t>(val) / x._val);
+		}
+		else {
+			val = _format->internal(val);
+			val /= static_cast<uint64_t>(x._val);
+		}
+
+		_val = _format->fromFixedPoint(_format->internal(val));
+		return *this;
+
+	}
+
+	inline const DynFixed DynFixed::operator~() const {
+
+		DynFixed a(*this);
+		a._val = ~a._val & _format->tMask();
+		return a;
+
+	}
+
+	inline DynFixed& DynFixed::operator|=(const DynFixed& x) {
+		checkFormats(*_format, x.format());
+		_val |= x._val;
+		return *this;
+	}
+
+	inline DynFixed& DynFixed::operator&=(const DynFixed& x) {
+		checkFormats(*_format, x.format());
+		_val &= x._val;
+		return *this;
+	}
+
+	inline DynFixed& DynFixed::operator^=(const DynFixed& x) {
+		checkFormats(*_format, x.format());
+		_val ^= x._val;
+		return *this;
+	}
+
+	inline DynFixed& DynFixed::operator>>=(std::size_t pos) {
+		_val >>= pos;
+		return *this;
+	}
+
+	inline DynFixed& DynFixed::operator<<=(std::size_t pos) {
+		uint64_t val = static_cast<uint64_t>(_val) << pos;
+		_val = _format->fromFixedPoint(_format->internal(val));
+		return *this;
+	}
+
+	inline float DynFixed::toFloat() const {
+		return static_cast<float>(_val)/
+			powf(2.0, static_cast<float>(_format->fractionLength()));
+	}
+
+	inline double DynFixed::toDouble() const {
+		return static_cast<double>(_val)/
+			pow(2.0, static_cast<double>(_format->fractionLength()));
+	}
+
+	inline std::string DynFixed::integer() const {
+		return _format->integerString(_val);
+	}
+
+	inline std::string DynFixed::fraction() const {
+		return _format->fractionalString(_val);
+	}
+
+	inline std::string DynFixed::toString() const {
+		return _format->toString(_val);
+	}
+
+	inline std::string DynFixed::toBinaryString() const {
+
+		std::string ret;
+
+		for (std::size_t i = _format->wordLength(); i > 0; --i) {
+			ret.push_back('0' + ((_val >> (i-1)) & 1));
+		}
+
+		return ret;
+
+	}
+
+	inline int64_t DynFixed::toBinary(bool extendSign) const {
+		return extendSign ? _val : (_val & _format->tMask());
+	}
+
+	inline DynFixed DynFixed::MaxVal(const DynFormat& format) {
+		DynFixed ret(format);
+		ret._val = format.maxVal();
+		return ret;
+	}
+
+	inline DynFixed DynFixed::MinVal(const DynFormat& format) {
+		DynFixed ret(format);
+		ret._val = format.minVal();
+		return ret;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	//Non-member functions
+
+	inline bool operator==(const DynFixed& x, const DynFixed& y) {
+		checkFormats(x.format(), y.format());
+		return x.toBinary(true) == y.toBinary(true);
+	}
+
+	inline bool operator!=(const DynFixed& x, const DynFixed& y) {
+		return !(x == y);
+	}
+
+	inline bool operator<(const DynFixed& x, const DynFixed& y) {
+		checkFormats(x.format(), y.format());
+		return x.toBinary(true) < y.toBinary(true);
+	}
+
+	inline bool operator<=(const DynFixed& x, const DynFixed& y) {
+		return (x < y) || (x == y);
+	}
+
+	inline bool operator>(const DynFixed& x, const DynFixed& y) {
+		return !(x <= y);
+	}
+
+	inline bool operator>=(const DynFixed& x, const DynFixed& y) {
+		return !(x < y);
+	}
+
+	inline const DynFixed operator+(const DynFixed& x, const DynFixed& y) {
+		DynFixed ret(x);
+		ret += y;
+		return ret;
+	}
+
+	inline const DynFixed operator-(const DynFixed& x, const DynFixed& y) {
+		DynFixed ret(x);
+		ret -= y;
+		return ret;
+	}
+
+	inline const DynFixed operator-(const DynFixed& a) {
+		DynFixed ret(a.format());
+		ret -= a;
+		return ret;
+	}
+
+	inline const DynFixed operator*(const DynFixed& x, const DynFixed& y) {
+		DynFixed ret(x);
+		ret *= y;
+		return ret;
+	}
+
+	inline const DynFixed operator/(const DynFixed& x, const DynFixed& y) {
+		DynFixed ret(x);
+		ret /= y;
+		return ret;
+	}
+
+	inline const DynFixed operator|(const DynFixed& x, const DynFixed& y) {
+		DynFixed ret(x);
+		ret |= y;
+		return ret;
+	}
+
+	inline const DynFixed operator&(const DynFixed& x, const DynFixed& y) {
+		DynFixed ret(x);
+		ret &= y;
+		return ret;
+	}
+
+	inline const DynFixed operator^(const DynFixed& x, const DynFixed& y) {
+		DynFixed ret(x);
+		ret ^= y;
+		return ret;
+	}
+
+	inline const DynFixed operator<<(const DynFixed& x, std::size_t pos) {
+		DynFixed ret(x);
+		ret <<= pos;
+		return ret;
+	}
+
+	inline const DynFixed operator>>(const DynFixed& x, std::size_t pos) {
+		DynFixed ret(x);
+		ret >>= pos;
+		return ret;
+	}
+
+	inline std::ostream& operator<<(std::ostream& os, const DynFixed& x) {
+		return os << x.toString();
+	}
+
+}
+
+#endif
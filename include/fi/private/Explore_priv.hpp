@@ -0,0 +1,432 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_EXPLORE_PRIV_HPP
+#define PRIVATE_FI_EXPLORE_PRIV_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#if __cplusplus >= 201103L
+#include <thread>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <unistd.h>
+#define FI_EXPLORE_PTHREAD
+#endif
+
+namespace Fi {
+
+	template <typename T> struct Saturate;
+	template <typename T> struct Wrap;
+	template <typename T> struct Throw;
+	template <typename T> struct Undefined;
+	template <typename T> struct StickySaturate;
+	template <typename T> struct StickyWrap;
+
+	template <typename T> struct Ceil;
+	template <typename T> struct Classic;
+	template <typename T> struct Fix;
+	template <typename T> struct Floor;
+	template <typename T> struct NearEven;
+	template <typename T> struct NearOdd;
+
+	//Exploration
+
+	inline std::string Exploration::format() const {
+		std::ostringstream os;
+		os << ((signedness == SIGNED) ? 's' : 'u')
+		   << wordLength << '.' << fractionLength;
+		return os.str();
+	}
+
+	template<typename Kernel>
+	struct ExplorationJob {
+
+		typedef void (*Runner)(const Kernel&, std::vector<double>&);
+
+		Exploration result;
+		Runner run;
+		///Whether the kernel produced the wrong number of outputs.
+		bool mismatch;
+
+	};
+
+	/**\internal
+	 *\brief Run the instantiation of \c kernel for \c FixedT.
+	 */
+	template<typename Kernel, typename FixedT>
+	void runKernel(const Kernel& kernel, std::vector<double>& out) {
+		kernel.template run<FixedT>(out);
+	}
+
+	/**\internal
+	 *\brief Label of the results of a grid.
+	 */
+	template<typename Tag>
+	struct GridLabel {
+		static std::string get() {
+			return Tag::name();
+		}
+	};
+
+	template<>
+	struct GridLabel<void> {
+		static std::string get() {
+			return std::string();
+		}
+	};
+
+	/**\internal
+	 *\brief Name of an overflow handler or rounding mode of the library,
+	 *as in \c tools/fixed, or empty.
+	 */
+	template<template <typename> class P>
+	struct HandlerName {
+		static const char* get() { return ""; }
+	};
+
+	template<> struct HandlerName<Saturate> {
+		static const char* get() { return "saturate"; }
+	};
+
+	template<> struct HandlerName<Wrap> {
+		static const char* get() { return "wrap"; }
+	};
+
+	template<> struct HandlerName<Throw> {
+		static const char* get() { return "throw"; }
+	};
+
+	template<> struct HandlerName<Undefined> {
+		static const char* get() { return "undefined"; }
+	};
+
+	template<> struct HandlerName<StickySaturate> {
+		static const char* get() { return "stickysaturate"; }
+	};
+
+	template<> struct HandlerName<StickyWrap> {
+		static const char* get() { return "stickywrap"; }
+	};
+
+	template<> struct HandlerName<Ceil> {
+		static const char* get() { return "ceil"; }
+	};
+
+	template<> struct HandlerName<Classic> {
+		static const char* get() { return "classic"; }
+	};
+
+	template<> struct HandlerName<Fix> {
+		static const char* get() { return "fix"; }
+	};
+
+	template<> struct HandlerName<Floor> {
+		static const char* get() { return "floor"; }
+	};
+
+	template<> struct HandlerName<NearEven> {
+		static const char* get() { return "neareven"; }
+	};
+
+	template<> struct HandlerName<NearOdd> {
+		static const char* get() { return "nearodd"; }
+	};
+
+	/**\internal
+	 *\brief The jobs of the fraction lengths from \c F to \c F_MAX of a
+	 *word length.
+	 */
+	template<typename Kernel, std::size_t W, std::size_t F,
+	         std::size_t F_MAX, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R,
+	         typename Tag, bool END = (F > F_MAX || F > W)>
+	struct GridRow {
+		static void add(std::vector< ExplorationJob<Kernel> >& jobs) {
+			ExplorationJob<Kernel> j;
+			j.result.label = GridLabel<Tag>::get();
+			j.result.signedness = S;
+			j.result.wordLength = W;
+			j.result.fractionLength = F;
+			j.result.overflow = HandlerName<OF>::get();
+			j.result.rounding = HandlerName<R>::get();
+			j.result.rmsError = 0;
+			j.result.maxError = 0;
+			j.run = &runKernel< Kernel, Fixed<W, F, S, OF, R> >;
+			j.mismatch = false;
+			jobs.push_back(j);
+			GridRow<Kernel, W, F + 1, F_MAX, S, OF, R, Tag>::add(jobs);
+		}
+	};
+
+	template<typename Kernel, std::size_t W, std::size_t F,
+	         std::size_t F_MAX, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R,
+	         typename Tag>
+	struct GridRow<Kernel, W, F, F_MAX, S, OF, R, Tag, true> {
+		static void add(std::vector< ExplorationJob<Kernel> >&)
+		{ }
+	};
+
+	/**\internal
+	 *\brief The jobs of the word lengths from \c W to \c W_MAX.
+	 */
+	template<typename Kernel, std::size_t W, std::size_t W_MAX,
+	         std::size_t F_MIN, std::size_t F_MAX, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R,
+	         typename Tag, bool END = (W > W_MAX)>
+	struct GridColumns {
+		static void add(std::vector< ExplorationJob<Kernel> >& jobs) {
+			GridRow<Kernel, W, F_MIN, F_MAX, S, OF, R, Tag>::add(jobs);
+			GridColumns<Kernel, W + 1, W_MAX, F_MIN, F_MAX, S, OF, R, Tag>::
+				add(jobs);
+		}
+	};
+
+	template<typename Kernel, std::size_t W, std::size_t W_MAX,
+	         std::size_t F_MIN, std::size_t F_MAX, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R,
+	         typename Tag>
+	struct GridColumns<Kernel, W, W_MAX, F_MIN, F_MAX, S, OF, R, Tag, true> {
+		static void add(std::vector< ExplorationJob<Kernel> >&)
+		{ }
+	};
+
+	template<std::size_t W_MIN, std::size_t W_MAX,
+	         std::size_t F_MIN, std::size_t F_MAX, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R,
+	         typename Tag>
+	template<typename Kernel>
+	void FormatGrid<W_MIN, W_MAX, F_MIN, F_MAX, S, OF, R, Tag>::
+	add(std::vector< ExplorationJob<Kernel> >& jobs) {
+		GridColumns<Kernel, W_MIN, W_MAX, F_MIN, F_MAX, S, OF, R, Tag>::
+			add(jobs);
+	}
+
+	template<typename G1, typename G2>
+	template<typename Kernel>
+	void FormatGrids<G1, G2>::
+	add(std::vector< ExplorationJob<Kernel> >& jobs) {
+		G1::template add<Kernel>(jobs);
+		G2::template add<Kernel>(jobs);
+	}
+
+	/**\internal
+	 *\brief Runs every <tt>step</tt>th job starting from \c first.
+	 */
+	template<typename Kernel>
+	struct ExplorationWorker {
+
+		const Kernel* kernel;
+		const std::vector<double>* reference;
+		std::vector< ExplorationJob<Kernel> >* jobs;
+		std::size_t first;
+		std::size_t step;
+
+		void operator()() const {
+
+			std::vector<double> out;
+			out.reserve(reference->size());
+
+			for (std::size_t i = first; i < jobs->size(); i += step) {
+
+				ExplorationJob<Kernel>& j = (*jobs)[i];
+				out.clear();
+
+				try {
+					j.run(*kernel, out);
+				}
+				catch (...) {
+					j.result.rmsError = HUGE_VAL;
+					j.result.maxError = HUGE_VAL;
+					continue;
+				}
+
+				if (out.size() != reference->size()) {
+					j.mismatch = true;
+					continue;
+				}
+
+				double squares = 0;
+				double largest = 0;
+				for (std::size_t k = 0; k < out.size(); ++k) {
+					const double e = out[k] - (*reference)[k];
+					squares += e*e;
+					largest = std::max(largest, std::fabs(e));
+				}
+				j.result.rmsError = out.empty() ? 0.0 :
+					std::sqrt(squares/out.size());
+				j.result.maxError = largest;
+
+			}
+
+		}
+
+		static void* start(void* worker) {
+			(*static_cast<const ExplorationWorker*>(worker))();
+			return 0;
+		}
+
+	};
+
+	/**\internal
+	 *\brief Number of processors, or 1 if unknown.
+	 */
+	inline std::size_t processorCount() {
+#if __cplusplus >= 201103L
+		const std::size_t n = std::thread::hardware_concurrency();
+#elif defined(FI_EXPLORE_PTHREAD)
+		const long c = sysconf(_SC_NPROCESSORS_ONLN);
+		const std::size_t n = (c > 0) ? static_cast<std::size_t>(c) : 0;
+#else
+		const std::size_t n = 1;
+#endif
+		return (n == 0) ? 1 : n;
+	}
+
+	template<typename Grid, typename Kernel>
+	std::vector<Exploration> explore(const Kernel& kernel,
+	                                 const std::vector<double>& reference,
+	                                 std::size_t threads) {
+
+		typedef ExplorationJob<Kernel> Job;
+		typedef ExplorationWorker<Kernel> Worker;
+
+		std::vector<Job> jobs;
+		Grid::template add<Kernel>(jobs);
+
+		if (threads == 0) {
+			threads = processorCount();
+		}
+		threads = std::max<std::size_t>(std::min(threads, jobs.size()), 1);
+
+		std::vector<Worker> workers(threads);
+		for (std::size_t i = 0; i < threads; ++i) {
+			workers[i].kernel = &kernel;
+			workers[i].reference = &reference;
+			workers[i].jobs = &jobs;
+			workers[i].first = i;
+			workers[i].step = threads;
+		}
+
+#if __cplusplus >= 201103L
+		std::vector<std::thread> t;
+		for (std::size_t i = 0; i < threads; ++i) {
+			t.push_back(std::thread(workers[i]));
+		}
+		for (std::size_t i = 0; i < threads; ++i) {
+			t[i].join();
+		}
+#elif defined(FI_EXPLORE_PTHREAD)
+		//A worker whose thread cannot be created runs in this thread.
+		std::vector<pthread_t> t(threads);
+		std::vector<bool> started(threads);
+		for (std::size_t i = 0; i < threads; ++i) {
+			started[i] =
+				(pthread_create(&t[i], 0, &Worker::start, &workers[i]) == 0);
+			if (!started[i]) {
+				workers[i]();
+			}
+		}
+		for (std::size_t i = 0; i < threads; ++i) {
+			if (started[i]) {
+				pthread_join(t[i], 0);
+			}
+		}
+#else
+		for (std::size_t i = 0; i < threads; ++i) {
+			workers[i]();
+		}
+#endif
+
+		std::vector<Exploration> ret;
+		ret.reserve(jobs.size());
+		for (std::size_t i = 0; i < jobs.size(); ++i) {
+			if (jobs[i].mismatch) {
+				throw std::invalid_argument(
+					"Fi::explore: number of outputs differs from reference");
+			}
+			ret.push_back(jobs[i].result);
+		}
+		return ret;
+
+	}
+
+	/**\internal
+	 *\brief Orders results by word length, then by error.
+	 */
+	inline bool paretoOrder(const Exploration& a, const Exploration& b) {
+		return (a.wordLength != b.wordLength) ?
+			(a.wordLength < b.wordLength) : (a.rmsError < b.rmsError);
+	}
+
+	inline std::vector<Exploration>
+	paretoFront(const std::vector<Exploration>& results) {
+
+		std::vector<Exploration> sorted(results);
+		std::stable_sort(sorted.begin(), sorted.end(), paretoOrder);
+
+		std::vector<Exploration> ret;
+		double best = HUGE_VAL;
+		for (std::size_t i = 0; i < sorted.size(); ++i) {
+			if (sorted[i].rmsError < best) {
+				best = sorted[i].rmsError;
+				ret.push_back(sorted[i]);
+			}
+		}
+		return ret;
+
+	}
+
+	inline void reportExploration(std::ostream& os,
+	                              const std::vector<Exploration>& results) {
+
+		os << std::left << std::setw(16) << "label" << std::right
+		   << std::setw(12) << "format" << std::setw(16) << "overflow"
+		   << std::setw(10) << "rounding" << std::setw(14) << "rms error"
+		   << std::setw(14) << "max error" << '\n';
+
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			const Exploration& r = results[i];
+			os << std::left << std::setw(16) << r.label << std::right
+			   << std::setw(12) << r.format()
+			   << std::setw(16) << r.overflow
+			   << std::setw(10) << r.rounding
+			   << std::setw(14) << r.rmsError
+			   << std::setw(14) << r.maxError << '\n';
+		}
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,883 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef PRIVATE_FI_FFT_PRIV_HPP
+#define PRIVATE_FI_FFT_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Quantize an exact butterfly output with
+	 *<tt>F + Fc + s</tt> fractional bits, where \c s is the shift of the
+	 *stage.
+	 */
+	template<typename FixedT, typename CoefT>
+	struct FFTQuantize {
+
+		static const std::size_t SRC_F =
+			FixedT::FRACTION_LENGTH + CoefT::FRACTION_LENGTH;
+
+		static FixedT apply(int64_t n, unsigned s) {
+			switch (s) {
+			case 0:
+				return Requantize<FixedT, SRC_F>::apply(n);
+			case 1:
+				return Requantize<FixedT, SRC_F + 1>::apply(n);
+			case 2:
+				return Requantize<FixedT, SRC_F + 2>::apply(n);
+			default:
+				return Requantize<FixedT, SRC_F + 3>::apply(n);
+			}
+		}
+
+	};
+
+
+	/**\internal
+	 *\brief Exact complex product of raw values.
+	 */
+	inline void fftMultiply(int64_t xr, int64_t xi, int64_t wr, int64_t wi,
+	                        int64_t& re, int64_t& im) {
+		re = xr*wr - xi*wi;
+		im = xr*wi + xi*wr;
+	}
+
+
+	/**\internal
+	 *\brief Scalar butterfly of one stage.
+
+	 *The inputs of butterfly \c k of a group starting at \c g are the
+	 *complex numbers at <tt>g + k + m*q</tt>; its twiddle factors are
+	 *<tt>w[(m - 1)*q + k]</tt> for \c m from 1 to <tt>RADIX - 1</tt>.
+	 */
+	template<typename FixedT, typename CoefT, std::size_t RADIX,
+	         FFTDecimation D>
+	struct FFTButterfly;
+
+	template<typename FixedT, typename CoefT>
+	struct FFTButterflyBase {
+
+		typedef FFTQuantize<FixedT, CoefT> Q;
+
+		static const int64_t ONE = int64_t(1) << CoefT::FRACTION_LENGTH;
+
+		static void read(const FixedT* x, std::size_t i,
+		                 int64_t& re, int64_t& im) {
+			re = rawValue(x[2*i]);
+			im = rawValue(x[2*i + 1]);
+		}
+
+		static void twiddle(const CoefT* w, std::size_t i, bool inverse,
+		                    int64_t& re, int64_t& im) {
+			re = rawValue(w[2*i]);
+			im = inverse ? -rawValue(w[2*i + 1]) : rawValue(w[2*i + 1]);
+		}
+
+		static void write(FixedT* x, std::size_t i, int64_t re, int64_t im,
+		                  unsigned s) {
+			x[2*i] = Q::apply(re, s);
+			x[2*i + 1] = Q::apply(im, s);
+		}
+
+	};
+
+	template<typename FixedT, typename CoefT>
+	struct FFTButterfly<FixedT, CoefT, 2, DECIMATION_IN_FREQUENCY>
+		: public FFTButterflyBase<FixedT, CoefT> {
+
+		typedef FFTButterflyBase<FixedT, CoefT> B;
+
+		static void apply(FixedT* x, std::size_t g, std::size_t q,
+		                  const CoefT* w, std::size_t k, bool inverse,
+		                  unsigned s) {
+
+			int64_t ar, ai, br, bi, wr, wi, pr, pi;
+
+			B::read(x, g + k, ar, ai);
+			B::read(x, g + k + q, br, bi);
+			B::twiddle(w, k, inverse, wr, wi);
+
+			fftMultiply(ar - br, ai - bi, wr, wi, pr, pi);
+
+			B::write(x, g + k, (ar + br)*B::ONE, (ai + bi)*B::ONE, s);
+			B::write(x, g + k + q, pr, pi, s);
+
+		}
+
+	};
+
+	template<typename FixedT, typename CoefT>
+	struct FFTButterfly<FixedT, CoefT, 2, DECIMATION_IN_TIME>
+		: public FFTButterflyBase<FixedT, CoefT> {
+
+		typedef FFTButterflyBase<FixedT, CoefT> B;
+
+		static void apply(FixedT* x, std::size_t g, std::size_t q,
+		                  const CoefT* w, std::size_t k, bool inverse,
+		                  unsigned s) {
+
+			int64_t ar, ai, br, bi, wr, wi, tr, ti;
+
+			B::read(x, g + k, ar, ai);
+			B::read(x, g + k + q, br, bi);
+			B::twiddle(w, k, inverse, wr, wi);
+
+			fftMultiply(br, bi, wr, wi, tr, ti);
+
+			B::write(x, g + k, ar*B::ONE + tr, ai*B::ONE + ti, s);
+			B::write(x, g + k + q, ar*B::ONE - tr, ai*B::ONE - ti, s);
+
+		}
+
+	};
+
+	/**\internal
+	 *\brief Four-point DFT of exact values, <tt>y[m] = sum x[n]*(-j)^(mn)</tt>,
+	 *or with \c j for the inverse.
+	 */
+	inline void fftRadix4(int64_t* re, int64_t* im, bool inverse) {
+
+		const int64_t ar = re[0] + re[2], ai = im[0] + im[2];
+		const int64_t br = re[0] - re[2], bi = im[0] - im[2];
+		const int64_t cr = re[1] + re[3], ci = im[1] + im[3];
+		const int64_t dr = re[1] - re[3], di = im[1] - im[3];
+
+		//-jD = di - j*dr
+		const int64_t sign = inverse ? -1 : 1;
+
+		re[0] = ar + cr;
+		im[0] = ai + ci;
+		re[2] = ar - cr;
+		im[2] = ai - ci;
+		re[1] = br + sign*di;
+		im[1] = bi - sign*dr;
+		re[3] = br - sign*di;
+		im[3] = bi + sign*dr;
+
+	}
+
+	template<typename FixedT, typename CoefT>
+	struct FFTButterfly<FixedT, CoefT, 4, DECIMATION_IN_FREQUENCY>
+		: public FFTButterflyBase<FixedT, CoefT> {
+
+		typedef FFTButterflyBase<FixedT, CoefT> B;
+
+		static void apply(FixedT* x, std::size_t g, std::size_t q,
+		                  const CoefT* w, std::size_t k, bool inverse,
+		                  unsigned s) {
+
+			int64_t re[4], im[4];
+
+			for (std::size_t m = 0; m < 4; ++m) {
+				B::read(x, g + k + m*q, re[m], im[m]);
+			}
+
+			fftRadix4(re, im, inverse);
+
+			B::write(x, g + k, re[0]*B::ONE, im[0]*B::ONE, s);
+
+			for (std::size_t m = 1; m < 4; ++m) {
+				int64_t wr, wi, pr, pi;
+				B::twiddle(w, (m - 1)*q + k, inverse, wr, wi);
+				fftMultiply(re[m], im[m], wr, wi, pr, pi);
+				B::write(x, g + k + m*q, pr, pi, s);
+			}
+
+		}
+
+	};
+
+	template<typename FixedT, typename CoefT>
+	struct FFTButterfly<FixedT, CoefT, 4, DECIMATION_IN_TIME>
+		: public FFTButterflyBase<FixedT, CoefT> {
+
+		typedef FFTButterflyBase<FixedT, CoefT> B;
+
+		static void apply(FixedT* x, std::size_t g, std::size_t q,
+		                  const CoefT* w, std::size_t k, bool inverse,
+		                  unsigned s) {
+
+			int64_t re[4], im[4];
+
+			B::read(x, g + k, re[0], im[0]);
+			re[0] *= B::ONE;
+			im[0] *= B::ONE;
+
+			for (std::size_t m = 1; m < 4; ++m) {
+				int64_t xr, xi, wr, wi;
+				B::read(x, g + k + m*q, xr, xi);
+				B::twiddle(w, (m - 1)*q + k, inverse, wr, wi);
+				fftMultiply(xr, xi, wr, wi, re[m], im[m]);
+			}
+
+			fftRadix4(re, im, inverse);
+
+			for (std::size_t m = 0; m < 4; ++m) {
+				B::write(x, g + k + m*q, re[m], im[m], s);
+			}
+
+		}
+
+	};
+
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether the butterflies of an FFT can use 16-bit
+		 *multiply-add instructions.
+
+		 *Sums of the inputs must fit 16 bits and twiddle factors must
+		 *have at most 15 bits so that they can be negated, which keeps
+		 *every exact intermediate within 31 bits.
+		 */
+		template<typename FixedT, typename CoefT, std::size_t RADIX>
+		struct FFTMadd {
+#ifdef FI_SIMD_SSE2
+			static const bool AVAILABLE =
+				(FixedT::SIGNEDNESS == SIGNED) &&
+				(FixedT::WORD_LENGTH > 4) &&
+				(FixedT::WORD_LENGTH <= ((RADIX == 4) ? 14 : 15)) &&
+				(CoefT::SIGNEDNESS == SIGNED) &&
+				(CoefT::WORD_LENGTH > 4) && (CoefT::WORD_LENGTH <= 15) &&
+				VecRound<typename FixedT::RH>::AVAILABLE;
+#else
+			static const bool AVAILABLE = false;
+#endif
+		};
+
+
+		/**\internal
+		 *\brief Vector butterflies of one group of a stage, four at a
+		 *time. Returns the number of butterflies computed; a set of four
+		 *whose outputs overflow without a vector overflow handler is
+		 *computed with the scalar code.
+		 */
+		template<typename FixedT, typename CoefT, std::size_t RADIX,
+		         FFTDecimation D,
+		         bool ENABLE = FFTMadd<FixedT, CoefT, RADIX>::AVAILABLE>
+		struct FFTKernel {
+			static std::size_t apply(FixedT*, std::size_t, std::size_t,
+			                         const CoefT*, bool, unsigned) {
+				return 0;
+			}
+		};
+
+#ifdef FI_SIMD_SSE2
+		///\internal \brief A twiddle factor prepared for multiply-add.
+		struct FFTTwiddle {
+
+			vec re;
+			vec im;
+
+			template<typename CoefT>
+			FFTTwiddle(const CoefT* w, bool inverse) {
+
+				vec t = load16(raw(w));
+				vec swap = swapPairs16(t);
+
+				if (inverse) {
+					re = t;
+					im = select(Lanes16::odd(), swap, Lanes16::sub(zero(), swap));
+				}
+				else {
+					re = select(Lanes16::odd(), Lanes16::sub(zero(), t), t);
+					im = swap;
+				}
+
+			}
+
+			///\internal \brief Exact products of four complex numbers.
+			void multiply(vec x, vec& lo, vec& hi) const {
+				vec r = _mm_madd_epi16(x, re);
+				vec i = _mm_madd_epi16(x, im);
+				lo = _mm_unpacklo_epi32(r, i);
+				hi = _mm_unpackhi_epi32(r, i);
+			}
+
+		};
+
+		///\internal \brief Rounding and overflow handling of FFT outputs.
+		template<typename FixedT>
+		struct FFTOutput {
+
+			typedef VecRound<typename FixedT::RH> VR;
+			typedef VecOverflow<typename FixedT::OFH> VO;
+
+			static bool apply(vec& v, int k) {
+				if (k > 0) {
+					v = VR::template apply<Lanes32>(v, k);
+				}
+				return VO::template apply<Lanes32>(v);
+			}
+
+		};
+
+		///\internal \brief Multiply four complex numbers by \c j.
+		inline vec timesJ16(vec v) {
+			vec swap = swapPairs16(v);
+			return select(Lanes16::odd(), swap, Lanes16::sub(zero(), swap));
+		}
+
+		inline vec timesJ32(vec v) {
+			vec swap = swapPairs32(v);
+			return select(Lanes32::odd(), swap, Lanes32::sub(zero(), swap));
+		}
+
+		template<typename FixedT, typename CoefT>
+		struct FFTKernel<FixedT, CoefT, 2, DECIMATION_IN_FREQUENCY, true> {
+
+			typedef FFTOutput<FixedT> O;
+			typedef FFTButterfly<FixedT, CoefT, 2,
+			                     DECIMATION_IN_FREQUENCY> Scalar;
+
+			static std::size_t apply(FixedT* x, std::size_t g, std::size_t q,
+			                         const CoefT* w, bool inverse, unsigned s) {
+
+				const int ks = static_cast<int>(s);
+				const int kp = static_cast<int>(CoefT::FRACTION_LENGTH + s);
+
+				std::size_t k = 0;
+
+				for (; k + 4 <= q; k += 4) {
+
+					FixedT* pa = x + 2*(g + k);
+					FixedT* pb = x + 2*(g + k + q);
+
+					vec a = load16(raw(pa));
+					vec b = load16(raw(pb));
+					vec sum = Lanes16::add(a, b);
+
+					vec o[4];
+					o[0] = widenLo16(sum);
+					o[1] = widenHi16(sum);
+					FFTTwiddle(w + 2*k, inverse).
+						multiply(Lanes16::sub(a, b), o[2], o[3]);
+
+					bool ok = O::apply(o[0], ks);
+					ok = O::apply(o[1], ks) && ok;
+					ok = O::apply(o[2], kp) && ok;
+					ok = O::apply(o[3], kp) && ok;
+
+					if (ok) {
+						store32(raw(pa), o[0], o[1]);
+						store32(raw(pb), o[2], o[3]);
+					}
+					else {
+						for (std::size_t j = k; j < k + 4; ++j) {
+							Scalar::apply(x, g, q, w, j, inverse, s);
+						}
+					}
+
+				}
+
+				return k;
+
+			}
+
+		};
+
+		template<typename FixedT, typename CoefT>
+		struct FFTKernel<FixedT, CoefT, 2, DECIMATION_IN_TIME, true> {
+
+			typedef FFTOutput<FixedT> O;
+			typedef FFTButterfly<FixedT, CoefT, 2, DECIMATION_IN_TIME> Scalar;
+
+			static std::size_t apply(FixedT* x, std::size_t g, std::size_t q,
+			                         const CoefT* w, bool inverse, unsigned s) {
+
+				const int fc = static_cast<int>(CoefT::FRACTION_LENGTH);
+				const int kp = static_cast<int>(CoefT::FRACTION_LENGTH + s);
+
+				std::size_t k = 0;
+
+				for (; k + 4 <= q; k += 4) {
+
+					FixedT* pa = x + 2*(g + k);
+					FixedT* pb = x + 2*(g + k + q);
+
+					vec a = load16(raw(pa));
+					vec a0 = Lanes32::slli(widenLo16(a), fc);
+					vec a1 = Lanes32::slli(widenHi16(a), fc);
+
+					vec t0, t1;
+					FFTTwiddle(w + 2*k, inverse).multiply(load16(raw(pb)), t0, t1);
+
+					vec o[4];
+					o[0] = Lanes32::add(a0, t0);
+					o[1] = Lanes32::add(a1, t1);
+					o[2] = Lanes32::sub(a0, t0);
+					o[3] = Lanes32::sub(a1, t1);
+
+					bool ok = true;
+					for (int m = 0; m < 4; ++m) {
+						ok = O::apply(o[m], kp) && ok;
+					}
+
+					if (ok) {
+						store32(raw(pa), o[0], o[1]);
+						store32(raw(pb), o[2], o[3]);
+					}
+					else {
+						for (std::size_t j = k; j < k + 4; ++j) {
+							Scalar::apply(x, g, q, w, j, inverse, s);
+						}
+					}
+
+				}
+
+				return k;
+
+			}
+
+		};
+
+		template<typename FixedT, typename CoefT>
+		struct FFTKernel<FixedT, CoefT, 4, DECIMATION_IN_FREQUENCY, true> {
+
+			typedef FFTOutput<FixedT> O;
+			typedef FFTButterfly<FixedT, CoefT, 4,
+			                     DECIMATION_IN_FREQUENCY> Scalar;
+
+			static std::size_t apply(FixedT* x, std::size_t g, std::size_t q,
+			                         const CoefT* w, bool inverse, unsigned s) {
+
+				const int ks = static_cast<int>(s);
+				const int kp = static_cast<int>(CoefT::FRACTION_LENGTH + s);
+
+				std::size_t k = 0;
+
+				for (; k + 4 <= q; k += 4) {
+
+					FixedT* p[4];
+					vec v[4];
+
+					for (std::size_t m = 0; m < 4; ++m) {
+						p[m] = x + 2*(g + k + m*q);
+						v[m] = load16(raw(p[m]));
+					}
+
+					//All sums fit 16 bits
+					vec a = Lanes16::add(v[0], v[2]);
+					vec b = Lanes16::sub(v[0], v[2]);
+					vec c = Lanes16::add(v[1], v[3]);
+					vec jd = timesJ16(Lanes16::sub(v[1], v[3]));
+
+					vec y[4];
+					y[0] = Lanes16::add(a, c);
+					y[2] = Lanes16::sub(a, c);
+					y[1] = inverse ? Lanes16::add(b, jd) : Lanes16::sub(b, jd);
+					y[3] = inverse ? Lanes16::sub(b, jd) : Lanes16::add(b, jd);
+
+					vec o[8];
+					o[0] = widenLo16(y[0]);
+					o[1] = widenHi16(y[0]);
+
+					bool ok = O::apply(o[0], ks);
+					ok = O::apply(o[1], ks) && ok;
+
+					for (std::size_t m = 1; m < 4; ++m) {
+						FFTTwiddle(w + 2*((m - 1)*q + k), inverse).
+							multiply(y[m], o[2*m], o[2*m + 1]);
+						ok = O::apply(o[2*m], kp) && ok;
+						ok = O::apply(o[2*m + 1], kp) && ok;
+					}
+
+					if (ok) {
+						for (std::size_t m = 0; m < 4; ++m) {
+							store32(raw(p[m]), o[2*m], o[2*m + 1]);
+						}
+					}
+					else {
+						for (std::size_t j = k; j < k + 4; ++j) {
+							Scalar::apply(x, g, q, w, j, inverse, s);
+						}
+					}
+
+				}
+
+				return k;
+
+			}
+
+		};
+
+		template<typename FixedT, typename CoefT>
+		struct FFTKernel<FixedT, CoefT, 4, DECIMATION_IN_TIME, true> {
+
+			typedef FFTOutput<FixedT> O;
+			typedef FFTButterfly<FixedT, CoefT, 4, DECIMATION_IN_TIME> Scalar;
+
+			static std::size_t apply(FixedT* x, std::size_t g, std::size_t q,
+			                         const CoefT* w, bool inverse, unsigned s) {
+
+				const int fc = static_cast<int>(CoefT::FRACTION_LENGTH);
+				const int kp = static_cast<int>(CoefT::FRACTION_LENGTH + s);
+
+				std::size_t k = 0;
+
+				for (; k + 4 <= q; k += 4) {
+
+					FixedT* p[4];
+					vec t[8];
+
+					p[0] = x + 2*(g + k);
+					vec x0 = load16(raw(p[0]));
+					t[0] = Lanes32::slli(widenLo16(x0), fc);
+					t[1] = Lanes32::slli(widenHi16(x0), fc);
+
+					for (std::size_t m = 1; m < 4; ++m) {
+						p[m] = x + 2*(g + k + m*q);
+						FFTTwiddle(w + 2*((m - 1)*q + k), inverse).
+							multiply(load16(raw(p[m])), t[2*m], t[2*m + 1]);
+					}
+
+					vec o[8];
+					bool ok = true;
+
+					//Low and high halves of the four complex numbers
+					for (std::size_t h = 0; h < 2; ++h) {
+
+						vec a = Lanes32::add(t[h], t[4 + h]);
+						vec b = Lanes32::sub(t[h], t[4 + h]);
+						vec c = Lanes32::add(t[2 + h], t[6 + h]);
+						vec jd = timesJ32(Lanes32::sub(t[2 + h], t[6 + h]));
+
+						o[h] = Lanes32::add(a, c);
+						o[4 + h] = Lanes32::sub(a, c);
+						o[2 + h] = inverse ? Lanes32::add(b, jd) :
+							Lanes32::sub(b, jd);
+						o[6 + h] = inverse ? Lanes32::sub(b, jd) :
+							Lanes32::add(b, jd);
+
+					}
+
+					for (std::size_t i = 0; i < 8; ++i) {
+						ok = O::apply(o[i], kp) && ok;
+					}
+
+					if (ok) {
+						for (std::size_t m = 0; m < 4; ++m) {
+							store32(raw(p[m]), o[2*m], o[2*m + 1]);
+						}
+					}
+					else {
+						for (std::size_t j = k; j < k + 4; ++j) {
+							Scalar::apply(x, g, q, w, j, inverse, s);
+						}
+					}
+
+				}
+
+				return k;
+
+			}
+
+		};
+#endif
+
+	}
+
+
+	//FFT
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	FFT<FixedT, N, CoefT, RADIX, D>::FFT(FFTScaling scaling)
+		: _scaling(scaling),
+		  _exponent(0),
+		  _reversed(N)
+	{
+
+		std::size_t entries = 0;
+
+		for (std::size_t st = 0; st < STAGES; ++st) {
+
+			_shift[st] = (RADIX == 4) ? 2 : 1;
+
+			std::size_t q = span(st);
+			std::size_t stride = N/(RADIX*q);
+
+			_offset[st] = entries;
+			entries += (RADIX - 1)*q;
+			_twiddles.resize(entries);
+
+			for (std::size_t m = 1; m < RADIX; ++m) {
+				for (std::size_t k = 0; k < q; ++k) {
+					_twiddles.set(_offset[st] + (m - 1)*q + k,
+					              twiddle((m*k*stride) % N));
+				}
+			}
+
+		}
+
+		for (std::size_t i = 0; i < N; ++i) {
+
+			std::size_t r = 0;
+			std::size_t n = i;
+
+			for (std::size_t st = 0; st < STAGES; ++st) {
+				r = r*RADIX + n % RADIX;
+				n /= RADIX;
+			}
+
+			_reversed[i] = r;
+
+		}
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	FFTScaling FFT<FixedT, N, CoefT, RADIX, D>::scaling() const {
+		return _scaling;
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	void FFT<FixedT, N, CoefT, RADIX, D>::
+	setShift(std::size_t stage, unsigned bits) {
+
+		if (stage >= STAGES) {
+			throw std::invalid_argument("FFT stage out of range");
+		}
+
+		if (bits > MAX_SHIFT) {
+			throw std::invalid_argument("FFT stage shift too large");
+		}
+
+		_shift[stage] = bits;
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	unsigned FFT<FixedT, N, CoefT, RADIX, D>::shift(std::size_t stage) const {
+		return _shift[stage];
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	int FFT<FixedT, N, CoefT, RADIX, D>::exponent() const {
+		return _exponent;
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	void FFT<FixedT, N, CoefT, RADIX, D>::forward(FixedT* data) {
+		transform(data, false);
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	void FFT<FixedT, N, CoefT, RADIX, D>::inverse(FixedT* data) {
+		transform(data, true);
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	template<typename Alloc>
+	void FFT<FixedT, N, CoefT, RADIX, D>::
+	forward(ComplexVector<FixedT, Alloc>& x) {
+
+		if (x.size() != N) {
+			throw std::invalid_argument("FFT input has the wrong size");
+		}
+
+		transform(x.data(), false);
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	template<typename Alloc>
+	void FFT<FixedT, N, CoefT, RADIX, D>::
+	inverse(ComplexVector<FixedT, Alloc>& x) {
+
+		if (x.size() != N) {
+			throw std::invalid_argument("FFT input has the wrong size");
+		}
+
+		transform(x.data(), true);
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	const Complex<CoefT> FFT<FixedT, N, CoefT, RADIX, D>::
+	twiddle(std::size_t i) {
+
+		i %= N;
+
+		double c;
+		double s;
+
+		//Multiples of pi/2 are exact
+		if ((4*i) % N == 0) {
+			const double table[4][2] = {{1.0, 0.0}, {0.0, 1.0},
+			                            {-1.0, 0.0}, {0.0, -1.0}};
+			c = table[4*i/N][0];
+			s = table[4*i/N][1];
+		}
+		else {
+			const double angle = 8.0*std::atan(1.0)*static_cast<double>(i)/
+				static_cast<double>(N);
+			c = std::cos(angle);
+			s = std::sin(angle);
+		}
+
+		return Complex<CoefT>(CoefT(c), CoefT(-s));
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	std::size_t FFT<FixedT, N, CoefT, RADIX, D>::span(std::size_t stage) {
+
+		std::size_t q = 1;
+
+		for (std::size_t st = 0; st < stage; ++st) {
+			q *= RADIX;
+		}
+
+		return (D == DECIMATION_IN_TIME) ? q : N/(RADIX*q);
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	void FFT<FixedT, N, CoefT, RADIX, D>::
+	transform(FixedT* data, bool inverse) {
+
+		_exponent = 0;
+
+		if (D == DECIMATION_IN_TIME) {
+			permute(data);
+		}
+
+		for (std::size_t st = 0; st < STAGES; ++st) {
+			unsigned s = stageShift(st, data);
+			stage(data, st, inverse, s);
+			_exponent += s;
+		}
+
+		if (D == DECIMATION_IN_FREQUENCY) {
+			permute(data);
+		}
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	void FFT<FixedT, N, CoefT, RADIX, D>::permute(FixedT* data) const {
+
+		for (std::size_t i = 0; i < N; ++i) {
+			std::size_t j = _reversed[i];
+			if (i < j) {
+				std::swap(data[2*i], data[2*j]);
+				std::swap(data[2*i + 1], data[2*j + 1]);
+			}
+		}
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	unsigned FFT<FixedT, N, CoefT, RADIX, D>::
+	stageShift(std::size_t stage, const FixedT* data) const {
+
+		if (_scaling == NO_SCALING) {
+			return 0;
+		}
+
+		if (_scaling == SHIFT_SCALING) {
+			return _shift[stage];
+		}
+
+		//A stage grows a component by less than 2^MAX_SHIFT
+		int64_t largest = 0;
+
+		for (std::size_t i = 0; i < 2*N; ++i) {
+			int64_t v = rawValue(data[i]);
+			largest = std::max(largest, (v < 0) ? -v : v);
+		}
+
+		int bits = 0;
+		while ((int64_t(1) << bits) <= largest) {
+			++bits;
+		}
+
+		int s = bits + static_cast<int>(MAX_SHIFT) -
+			static_cast<int>(FixedT::WORD_LENGTH - 1);
+
+		s = std::min(s, static_cast<int>(MAX_SHIFT));
+
+		return (s > 0) ? static_cast<unsigned>(s) : 0;
+
+	}
+
+
+	template<typename FixedT, std::size_t N, typename CoefT,
+	         std::size_t RADIX, FFTDecimation D>
+	void FFT<FixedT, N, CoefT, RADIX, D>::
+	stage(FixedT* data, std::size_t stage, bool inverse, unsigned s) {
+
+		typedef Simd::FFTKernel<FixedT, CoefT, RADIX, D> Kernel;
+		typedef FFTButterfly<FixedT, CoefT, RADIX, D> Butterfly;
+
+		const std::size_t q = span(stage);
+		const CoefT* w = _twiddles.data() + 2*_offset[stage];
+
+		for (std::size_t g = 0; g < N; g += RADIX*q) {
+
+			std::size_t k = Kernel::apply(data, g, q, w, inverse, s);
+
+			for (; k < q; ++k) {
+				Butterfly::apply(data, g, q, w, k, inverse, s);
+			}
+
+		}
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,297 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#ifndef PRIVATE_FI_FIR_PRIV_HPP
+#define PRIVATE_FI_FIR_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Fi {
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether the dot products of an FIR filter can use 16-bit
+		 *multiply-add instructions.
+		 */
+		template<typename InT, typename CoefT>
+		struct FIRMadd {
+#ifdef FI_SIMD_SSE2
+			static const bool AVAILABLE =
+				(InT::SIGNEDNESS == SIGNED) && (InT::WORD_LENGTH <= 16) &&
+				(CoefT::SIGNEDNESS == SIGNED) && (CoefT::WORD_LENGTH <= 16);
+#else
+			static const bool AVAILABLE = false;
+#endif
+		};
+
+	}
+
+
+	/**\internal
+	 *\brief Exact dot product of raw inputs and taps. Taps are padded
+	 *with zeros to a multiple of \c BLOCK.
+	 */
+	template<typename InT, typename CoefT, bool MADD>
+	struct FIRDot {
+
+		typedef int64_t raw_type;
+
+		static const std::size_t BLOCK = 1;
+
+		static int64_t apply(const raw_type* h, const raw_type* x,
+		                     std::size_t n) {
+
+			int64_t sum = 0;
+
+			for (std::size_t j = 0; j < n; ++j) {
+				sum += h[j]*x[j];
+			}
+
+			return sum;
+
+		}
+
+	};
+
+#ifdef FI_SIMD_SSE2
+	template<typename InT, typename CoefT>
+	struct FIRDot<InT, CoefT, true> {
+
+		typedef int16_t raw_type;
+
+		static const std::size_t BLOCK = Simd::DOT16_BLOCK;
+
+		static int64_t apply(const raw_type* h, const raw_type* x,
+		                     std::size_t n) {
+			return Simd::dot16(h, x, n);
+		}
+
+	};
+#endif
+
+	/**\internal
+	 *\brief Storage and dot product used by Fi::FIR.
+	 */
+	template<typename InT, typename CoefT>
+	struct FIRKernel
+		: public FIRDot<InT, CoefT, Simd::FIRMadd<InT, CoefT>::AVAILABLE> {
+
+		///\internal \brief Fractional bits of a product.
+		static const std::size_t PRODUCT_F =
+			InT::FRACTION_LENGTH + CoefT::FRACTION_LENGTH;
+
+	};
+
+
+	//FIR
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	FIR<InT, CoefT, AccT, OutT>::
+	FIR(const std::vector<CoefT>& taps, std::size_t interpolation,
+	    std::size_t decimation)
+		: _size(taps.size()),
+		  _interpolation(interpolation),
+		  _decimation(decimation)
+	{
+		init(taps.empty() ? 0 : &taps[0], taps.size());
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	FIR<InT, CoefT, AccT, OutT>::
+	FIR(const CoefT* taps, std::size_t count, std::size_t interpolation,
+	    std::size_t decimation)
+		: _size(count),
+		  _interpolation(interpolation),
+		  _decimation(decimation)
+	{
+		init(taps, count);
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	void FIR<InT, CoefT, AccT, OutT>::
+	init(const CoefT* taps, std::size_t count) {
+
+		if (count == 0) {
+			throw std::invalid_argument("FIR filter has no taps");
+		}
+
+		if (_interpolation == 0 || _decimation == 0) {
+			throw std::invalid_argument("FIR rate change factor is zero");
+		}
+
+		const std::size_t L = _interpolation;
+
+		//Taps of phase p are h[p], h[p + L], ..., stored from the oldest
+		//input to the newest, with leading zeros.
+		_length = (count + L - 1)/L;
+		_length = (_length + Kernel::BLOCK - 1)/Kernel::BLOCK*Kernel::BLOCK;
+		_phases.assign(L*_length, 0);
+
+		double largest = 0.0;
+
+		for (std::size_t p = 0; p < L; ++p) {
+
+			double sum = 0.0;
+
+			for (std::size_t j = 0; j < _length; ++j) {
+				std::size_t k = p + (_length - 1 - j)*L;
+				if (k < count) {
+					int64_t h = rawValue(taps[k]);
+					_phases[p*_length + j] = static_cast<Raw>(h);
+					sum += std::fabs(static_cast<double>(h));
+				}
+			}
+
+			largest = std::max(largest, sum);
+
+		}
+
+		_overflowFree =
+			(AccT::SIGNEDNESS == SIGNED) &&
+			(AccT::FRACTION_LENGTH == Kernel::PRODUCT_F) &&
+			(largest*rawMagnitude<InT>() <=
+			 static_cast<double>(AccT::TR::MAX_VAL));
+
+		reset();
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	std::size_t FIR<InT, CoefT, AccT, OutT>::size() const {
+		return _size;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	std::size_t FIR<InT, CoefT, AccT, OutT>::interpolation() const {
+		return _interpolation;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	std::size_t FIR<InT, CoefT, AccT, OutT>::decimation() const {
+		return _decimation;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	bool FIR<InT, CoefT, AccT, OutT>::overflowFree() const {
+		return _overflowFree;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	std::size_t FIR<InT, CoefT, AccT, OutT>::
+	maxOutputs(std::size_t n) const {
+		return (n*_interpolation + _decimation - 1)/_decimation;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	std::size_t FIR<InT, CoefT, AccT, OutT>::
+	process(const InT* in, std::size_t n, OutT* out) {
+
+		const std::size_t history = _length - 1;
+		const std::size_t L = _interpolation;
+
+		_buffer.resize(history + n);
+
+		for (std::size_t i = 0; i < n; ++i) {
+			_buffer[history + i] = static_cast<Raw>(rawValue(in[i]));
+		}
+
+		//Output at upsampled time t uses input t/L and phase t%L.
+		std::size_t count = 0;
+
+		for (; _time < n*L; _time += _decimation) {
+			out[count++] = output(&_buffer[_time/L], _time % L);
+		}
+
+		_time -= n*L;
+
+		std::copy(_buffer.begin() + n, _buffer.end(), _buffer.begin());
+		_buffer.resize(history);
+
+		return count;
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	template<typename InAlloc, typename OutAlloc>
+	void FIR<InT, CoefT, AccT, OutT>::
+	process(const std::vector<InT, InAlloc>& in,
+	        std::vector<OutT, OutAlloc>& out) {
+
+		out.resize(maxOutputs(in.size()));
+
+		if (!in.empty()) {
+			out.resize(process(&in[0], in.size(), out.empty() ? 0 : &out[0]));
+		}
+		else {
+			out.clear();
+		}
+
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	void FIR<InT, CoefT, AccT, OutT>::reset() {
+		_buffer.assign(_length - 1, 0);
+		_time = 0;
+	}
+
+
+	template<typename InT, typename CoefT, typename AccT, typename OutT>
+	const OutT FIR<InT, CoefT, AccT, OutT>::
+	output(const Raw* x, std::size_t phase) const {
+
+		const Raw* h = &_phases[phase*_length];
+
+		if (_overflowFree) {
+			return Requantize<OutT, AccT::FRACTION_LENGTH>::apply(
+				Kernel::apply(h, x, _length));
+		}
+
+		AccT acc;
+
+		for (std::size_t j = 0; j < _length; ++j) {
+			int64_t p = static_cast<int64_t>(h[j])*x[j];
+			acc += Requantize<AccT, Kernel::PRODUCT_F>::apply(p);
+		}
+
+		return Requantize<OutT, AccT::FRACTION_LENGTH>::apply(rawValue(acc));
+
+	}
+
+}
+
+#endif
@@ -23,6 +23,7 @@
 #ifndef PRIVATE_FI_FIXED_PRIV_HPP
 #define PRIVATE_FI_FIXED_PRIV_HPP
 
+#include "Bits.hpp"
 #include "StringConversion.hpp"
 #include "DoubleConversion.hpp"
 #include "FixedConversion.hpp"
@@ -35,7 +36,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>::Fixed()
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>::Fixed()
 		: _val(0)
 	{ }
 
@@ -43,7 +44,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>::Fixed(const Fixed<W, F, S, OF, R>& a)
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>::Fixed(const Fixed<W, F, S, OF, R>& a)
 		: _val(a._val)
 	{ }
 
@@ -51,7 +52,8 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>::Fixed(double f)
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>::Fixed(double f)
+		: _val(0)
 	{
 
 		typename TR::SignedType s = DoubleConversion::toFixedPoint<TR>(f);
@@ -59,7 +61,8 @@ namespace Fi {
 		std::pair<valtype, int> rounded =
 			RH::round(f, static_cast<valtype>(s));
 		double roundAmnt =
-			static_cast<double>(rounded.second)/std::pow(2.0, FRACTION_LENGTH);
+			static_cast<double>(rounded.second)/
+			DoubleConversion::powerOfTwo(FRACTION_LENGTH);
 
 		_val = OFH::fromDouble(f, rounded.first, roundAmnt);
 
@@ -107,7 +110,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R> Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R> Fixed<W, F, S, OF, R>::
 	fromBinary(Fixed<W, F, S, OF, R>::valtype value) {
 
 		Fixed ret;
@@ -124,7 +127,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator=(const Fixed<W, F, S, OF, R>& that) {
 		this->_val = that._val;
 		return *this;
@@ -134,7 +137,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	bool Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR bool Fixed<W, F, S, OF, R>::
 	operator<(const Fixed<W, F, S, OF, R>& x) const {
 		return _val < x._val;
 	}
@@ -143,7 +146,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	bool Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR bool Fixed<W, F, S, OF, R>::
 	operator==(const Fixed<W, F, S, OF, R>& x) const {
 		return _val == x._val;
 	}
@@ -152,7 +155,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator+=(const Fixed<W, F, S, OF, R>& x) {
 		_val += x._val;
 		_val = OFH::fromFixedPoint(_val);
@@ -163,7 +166,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator-=(const Fixed<W, F, S, OF, R>& x) {
 		_val -= x._val;
 		_val = OFH::fromFixedPoint(_val);
@@ -174,7 +177,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator*=(const Fixed<W, F, S, OF, R>& x) {
 
 		//Since overflow behavior is undefined for OverflowImpossible
@@ -191,7 +194,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator/=(const Fixed<W, F, S, OF, R>& x) {
 
 		//Since overflow behavior is undefined for OverflowImpossible and
@@ -207,7 +210,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R> Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R> Fixed<W, F, S, OF, R>::
 	operator~() const {
 
 		Fixed a(*this);
@@ -221,7 +224,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator|=(const Fixed<W, F, S, OF, R>& x) {
 		_val |= x._val;
 		return *this;
@@ -231,7 +234,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator&=(const Fixed<W, F, S, OF, R>& x) {
 		_val &= x._val;
 		return *this;
@@ -241,7 +244,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator^=(const Fixed<W, F, S, OF, R>& x) {
 		_val ^= x._val;
 		return *this;
@@ -251,7 +254,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator>>=(std::size_t pos) {
 		_val >>= pos;
 		return *this;
@@ -261,7 +264,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R>& Fixed<W, F, S, OF, R>::
 	operator<<=(std::size_t pos) {
 		_val <<= pos;
 		_val = OFH::fromFixedPoint(_val);
@@ -272,22 +275,24 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	float Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR float Fixed<W, F, S, OF, R>::
 	toFloat() const {
-		//Using powf instead of shifting to avoid overflow and the need
-		//to know the next largest type.
-		return static_cast<float>(_val)/ powf(2.0, FRACTION_LENGTH);
+		//Dividing by a power of two instead of shifting to avoid overflow
+		//and the need to know the next largest type.
+		return static_cast<float>(_val)/
+			static_cast<float>(DoubleConversion::powerOfTwo(FRACTION_LENGTH));
 	}
 
 
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	double Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR double Fixed<W, F, S, OF, R>::
 	toDouble() const {
-		//Using pow instead of shifting to avoid overflow and the need
-		//to know the next largest type.
-		return static_cast<double>(_val)/ pow(2.0, FRACTION_LENGTH);
+		//Dividing by a power of two instead of shifting to avoid overflow
+		//and the need to know the next largest type.
+		return static_cast<double>(_val)/
+			DoubleConversion::powerOfTwo(FRACTION_LENGTH);
 	}
 
 
@@ -323,6 +328,16 @@ namespace Fi {
 
 	}
 
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	std::size_t Fixed<W, F, S, OF, R>::
+	toString(char* buffer, std::size_t size) const {
+
+		return StringConversion::toString<TR>(_val, buffer, size);
+
+	}
+
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
@@ -342,7 +357,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	typename Fixed<W, F, S, OF, R>::valtype Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR typename Fixed<W, F, S, OF, R>::valtype Fixed<W, F, S, OF, R>::
 	toBinary(bool extendSign) const {
 
 		return extendSign ? _val : (_val & TR::T_MASK);
@@ -353,7 +368,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R> Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R> Fixed<W, F, S, OF, R>::
 	MaxVal() {
 		Fixed ret;
 		ret._val = TR::MAX_VAL;
@@ -364,7 +379,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	Fixed<W, F, S, OF, R> Fixed<W, F, S, OF, R>::
+	FI_CONSTEXPR Fixed<W, F, S, OF, R> Fixed<W, F, S, OF, R>::
 	MinVal() {
 		Fixed ret;
 		ret._val = TR::MIN_VAL;
@@ -380,7 +395,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator==(const Fixed<W, F, S, OF, R>& x,
+	inline FI_CONSTEXPR bool operator==(const Fixed<W, F, S, OF, R>& x,
 	                       const Fixed<W, F, S, OF, R>& y)
 	{
 
@@ -392,7 +407,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator!=(const Fixed<W, F, S, OF, R>& x,
+	inline FI_CONSTEXPR bool operator!=(const Fixed<W, F, S, OF, R>& x,
 	                       const Fixed<W, F, S, OF, R>& y)
 	{
 
@@ -404,7 +419,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator<(const Fixed<W, F, S, OF, R>& x,
+	inline FI_CONSTEXPR bool operator<(const Fixed<W, F, S, OF, R>& x,
 	                      const Fixed<W, F, S, OF, R>& y)
 	{
 
@@ -416,7 +431,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator<=(const Fixed<W, F, S, OF, R>& x,
+	inline FI_CONSTEXPR bool operator<=(const Fixed<W, F, S, OF, R>& x,
 	                       const Fixed<W, F, S, OF, R>& y)
 	{
 
@@ -428,7 +443,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	inline bool operator>(const Fixed<W, F, S, OF, R>& x,
+	inline FI_CONSTEXPR bool operator>(const Fixed<W, F, S, OF, R>& x,
 	                      const Fixed<W, F, S, OF, R>& y)
 	{
 
@@ -441,7 +456,7 @@ namespace Fi {
 	         template <typename> class OF,
 	         template <typename> class R>
 
-	inline bool operator>=(const Fixed<W, F, S, OF, R>& x,
+	inline FI_CONSTEXPR bool operator>=(const Fixed<W, F, S, OF, R>& x,
 	                       const Fixed<W, F, S, OF, R>& y)
 	{
 
@@ -455,7 +470,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator+(const Fixed<W, F, S, OF, R>& x,
 	          const Fixed<W, F, S, OF, R>& y)
 	{
@@ -470,7 +485,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator-(const Fixed<W, F, S, OF, R>& x,
 	          const Fixed<W, F, S, OF, R>& y)
 	{
@@ -485,18 +500,20 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator-(const Fixed<W, F, S, OF, R>& a)
 	{
 		//TODO #60: figure out what to do for unsigned types...
-		return Fixed<W, F, S, OF, R>(0.0) - a;
+		Fixed<W, F, S, OF, R> ret;
+		ret -= a;
+		return ret;
 	}
 
 
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator*(const Fixed<W, F, S, OF, R>& x,
 	          const Fixed<W, F, S, OF, R>& y)
 	{
@@ -511,7 +528,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator/(const Fixed<W, F, S, OF, R>& x,
 	          const Fixed<W, F, S, OF, R>& y)
 	{
@@ -525,7 +542,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	min(const Fixed<W, F, S, OF, R>& x,
 	    const Fixed<W, F, S, OF, R>& y)
 	{
@@ -537,7 +554,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Fi::Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	max(const Fixed<W, F, S, OF, R>& x,
 	    const Fixed<W, F, S, OF, R>& y)
 	{
@@ -551,7 +568,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator~(const Fixed<W, F, S, OF, R>& x)
 	{
 
@@ -562,7 +579,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator|(const Fixed<W, F, S, OF, R>& x,
 	          const Fixed<W, F, S, OF, R>& y)
 	{
@@ -576,7 +593,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator&(const Fixed<W, F, S, OF, R>& x,
 	          const Fixed<W, F, S, OF, R>& y)
 	{
@@ -590,7 +607,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator^(const Fixed<W, F, S, OF, R>& x,
 	          const Fixed<W, F, S, OF, R>& y)
 	{
@@ -604,7 +621,7 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R>
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
 	operator<<(const Fixed<W, F, S, OF, R>& x, std::size_t pos)
 	{
 
@@ -617,8 +634,8 @@ namespace Fi {
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
-	const Fixed<W, F, S, OF, R> operator>>(const Fixed<W, F, S, OF, R>& x,
-	                                       std::size_t pos)
+	FI_CONSTEXPR const Fixed<W, F, S, OF, R>
+	operator>>(const Fixed<W, F, S, OF, R>& x, std::size_t pos)
 	{
 
 		Fixed<W, F, S, OF, R> ret(x);
@@ -627,6 +644,152 @@ namespace Fi {
 
 	}
 
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	std::size_t clz(const Fixed<W, F, S, OF, R>& x)
+	{
+
+		const uint64_t u = static_cast<uint64_t>(x.toBinary());
+		if (u == 0) {
+			return W;
+		}
+		return W - 1 - static_cast<std::size_t>(leadingOne(u));
+
+	}
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	std::size_t cls(const Fixed<W, F, S, OF, R>& x)
+	{
+
+		if (S == UNSIGNED) {
+			return clz(x);
+		}
+
+		//Complementing negative values turns sign bits into zeros.
+		const int64_t v = static_cast<int64_t>(x.toBinary(true));
+		const uint64_t m = static_cast<uint64_t>(v ^ (v >> 63));
+		if (m == 0) {
+			return W - 1;
+		}
+		return W - 2 - static_cast<std::size_t>(leadingOne(m));
+
+	}
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	std::size_t normalize(Fixed<W, F, S, OF, R>& x)
+	{
+
+		typedef typename Fixed<W, F, S, OF, R>::valtype valtype;
+
+		const std::size_t s = cls(x);
+		const uint64_t u = static_cast<uint64_t>(x.toBinary()) << s;
+		x = Fixed<W, F, S, OF, R>::fromBinary(
+			static_cast<valtype>(u & Fixed<W, F, S, OF, R>::T_MASK));
+		return s;
+
+	}
+
+	template<std::size_t HI, std::size_t LO,
+	         std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	const Fixed<HI - LO + 1, 0, UNSIGNED, OF, R>
+	slice(const Fixed<W, F, S, OF, R>& x)
+	{
+
+		typedef char RangeCheck[(LO <= HI && HI < W) ? 1 : -1];
+		(void)sizeof(RangeCheck);
+
+		typedef Fixed<HI - LO + 1, 0, UNSIGNED, OF, R> Ret;
+
+		const uint64_t u = static_cast<uint64_t>(x.toBinary()) >> LO;
+		return Ret::fromBinary(static_cast<typename Ret::valtype>(
+			u & ((uint64_t(1) << (HI - LO + 1)) - 1)));
+
+	}
+
+	template<std::size_t W1, std::size_t F1, Signedness S1,
+	         template <typename> class OF1,
+	         template <typename> class R1,
+	         std::size_t W2, std::size_t F2, Signedness S2,
+	         template <typename> class OF2,
+	         template <typename> class R2>
+	const Fixed<W1 + W2, F2, S1, OF1, R1>
+	concat(const Fixed<W1, F1, S1, OF1, R1>& a,
+	       const Fixed<W2, F2, S2, OF2, R2>& b)
+	{
+
+		typedef Fixed<W1 + W2, F2, S1, OF1, R1> Ret;
+
+		const uint64_t u = (static_cast<uint64_t>(a.toBinary()) << W2)
+			| static_cast<uint64_t>(b.toBinary());
+		return Ret::fromBinary(static_cast<typename Ret::valtype>(u));
+
+	}
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	void clz(const Fixed<W, F, S, OF, R>* x, std::size_t* out, std::size_t n)
+	{
+		for (std::size_t i = 0; i < n; ++i) {
+			out[i] = clz(x[i]);
+		}
+	}
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	void cls(const Fixed<W, F, S, OF, R>* x, std::size_t* out, std::size_t n)
+	{
+		for (std::size_t i = 0; i < n; ++i) {
+			out[i] = cls(x[i]);
+		}
+	}
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	void normalize(Fixed<W, F, S, OF, R>* x, std::size_t* shifts,
+	               std::size_t n)
+	{
+		for (std::size_t i = 0; i < n; ++i) {
+			shifts[i] = normalize(x[i]);
+		}
+	}
+
+	template<std::size_t HI, std::size_t LO,
+	         std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	void slice(const Fixed<W, F, S, OF, R>* x,
+	           Fixed<HI - LO + 1, 0, UNSIGNED, OF, R>* out, std::size_t n)
+	{
+		for (std::size_t i = 0; i < n; ++i) {
+			out[i] = slice<HI, LO>(x[i]);
+		}
+	}
+
+	template<std::size_t W1, std::size_t F1, Signedness S1,
+	         template <typename> class OF1,
+	         template <typename> class R1,
+	         std::size_t W2, std::size_t F2, Signedness S2,
+	         template <typename> class OF2,
+	         template <typename> class R2>
+	void concat(const Fixed<W1, F1, S1, OF1, R1>* a,
+	            const Fixed<W2, F2, S2, OF2, R2>* b,
+	            Fixed<W1 + W2, F2, S1, OF1, R1>* out, std::size_t n)
+	{
+		for (std::size_t i = 0; i < n; ++i) {
+			out[i] = concat(a[i], b[i]);
+		}
+	}
+
 	template<std::size_t W, std::size_t F, Signedness S,
 	         template <typename> class OF,
 	         template <typename> class R>
@@ -637,12 +800,46 @@ namespace Fi {
 		return os;
 	}
 
+#if __cplusplus >= 201402L
+	constexpr FixedLiteral::FixedLiteral(double value)
+		: _value(value)
+	{ }
+
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R>
+	constexpr FixedLiteral::operator Fixed<W, F, S, OF, R>() const {
+		return Fixed<W, F, S, OF, R>(_value);
+	}
+
+
+	constexpr double FixedLiteral::value() const {
+		return _value;
+	}
+
+
+	namespace literals {
+
+		constexpr FixedLiteral operator"" _fx(long double value) {
+			return FixedLiteral(static_cast<double>(value));
+		}
+
+
+		constexpr FixedLiteral operator"" _fx(unsigned long long value) {
+			return FixedLiteral(static_cast<double>(value));
+		}
+
+	}
+#endif
+
 }
 
 template<std::size_t W, std::size_t F, Fi::Signedness S,
          template <typename> class OF,
          template <typename> class R>
-Fi::Fixed<W, F, S, OF, R> std::abs(const Fi::Fixed<W, F, S, OF, R>& x)
+FI_CONSTEXPR Fi::Fixed<W, F, S, OF, R>
+std::abs(const Fi::Fixed<W, F, S, OF, R>& x)
 {
 
 	if (x < Fi::Fixed<W, F, S, OF, R>::fromBinary(0)) {
@@ -26,6 +26,7 @@
 #include "Fi.hpp"
 
 #include <cstddef>
+#include <stdint.h>
 
 namespace Fi {
 	/**\internal
@@ -49,7 +50,7 @@ namespace Fi {
 	};
 
 	template<typename T, std::size_t W> struct MinVal<T, W, SIGNED> {
-		static const T value = (T(1) << (W-1)) | (T(-1) << (W-1));
+		static const T value = static_cast<T>(~uint64_t(0) << (W-1));
 	};
 
 
@@ -69,12 +70,13 @@ namespace Fi {
 
 	template<typename T, std::size_t W>
 	struct MaxVal<T, W, UNSIGNED> {
-		static const T value = (T(1) << W) - 1;
+		static const T value = static_cast<T>(
+			(W >= 64) ? ~uint64_t(0) : ~(~uint64_t(0) << (W % 64)));
 	};
 
 	template<typename T, std::size_t W>
 	struct MaxVal<T, W, SIGNED> {
-		static const T value = (T(1) << (W-1)) - 1;
+		static const T value = static_cast<T>(~(~uint64_t(0) << (W-1)));
 	};
 
 	template<typename T, Signedness S>
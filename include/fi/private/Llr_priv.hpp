@@ -0,0 +1,430 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_LLR_PRIV_HPP
+#define PRIVATE_FI_LLR_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Fi {
+
+	namespace llr {
+
+		/**\internal
+		 *\brief Raw limits of an LLR type. Only defined for signed
+		 *Fi::Saturate types.
+		 */
+		template<typename T>
+		struct Format;
+
+		template<std::size_t W, std::size_t F, template <typename> class R>
+		struct Format< Fixed<W, F, SIGNED, Saturate, R> > {
+			static const int64_t MAX = (int64_t(1) << (W - 1)) - 1;
+			static const int64_t MIN = -(int64_t(1) << (W - 1));
+		};
+
+		/**\internal
+		 *\brief Saturating scalar operations on raw LLRs.
+		 */
+		template<typename T>
+		struct Scalar {
+
+			static int64_t saturate(int64_t v) {
+				if (v > Format<T>::MAX) {
+					return Format<T>::MAX;
+				}
+				return (v < Format<T>::MIN) ? Format<T>::MIN : v;
+			}
+
+			static int64_t magnitude(int64_t x) {
+				return (x < 0) ? saturate(-x) : x;
+			}
+
+			///\internal \brief Correction term of box-plus.
+			static int64_t correction(int64_t x, int64_t c) {
+				return std::max(c - (magnitude(x) >> 2), int64_t(0));
+			}
+
+		};
+
+		/**\internal
+		 *\brief Magnitude transforms of the min-sum variants. Each has a
+		 *scalar and, when \c VECTOR, a vector implementation on 16-bit
+		 *lanes.
+		 */
+		template<typename T>
+		struct Identity {
+
+			static const bool VECTOR = true;
+
+			int64_t operator()(int64_t m) const {
+				return m;
+			}
+
+#ifdef FI_SIMD_SSE2
+			Simd::vec operator()(Simd::vec m) const {
+				return m;
+			}
+#endif
+
+		};
+
+		template<typename T>
+		struct Offset {
+
+			static const bool VECTOR = true;
+
+			explicit Offset(const T& offset) : _offset(rawValue(offset)) { }
+
+			int64_t operator()(int64_t m) const {
+				return std::max(m - _offset, int64_t(0));
+			}
+
+#ifdef FI_SIMD_SSE2
+			Simd::vec operator()(Simd::vec m) const {
+				typedef Simd::Lanes16 L;
+				return L::max(L::sub(m, L::set1(_offset)), Simd::zero());
+			}
+#endif
+
+			int64_t _offset;
+
+		};
+
+		template<typename T>
+		struct Scale {
+
+			static const std::size_t F = T::FRACTION_LENGTH;
+
+#ifdef FI_SIMD_SSE2
+			typedef Simd::VecRound<typename T::RH> VR;
+			static const bool VECTOR = (F == 0) || VR::AVAILABLE;
+#else
+			static const bool VECTOR = false;
+#endif
+
+			explicit Scale(const T& scale) : _scale(rawValue(scale)) { }
+
+			int64_t operator()(int64_t m) const {
+				return Requantize<T, 2*F>::raw(m*_scale);
+			}
+
+#ifdef FI_SIMD_SSE2
+			Simd::vec operator()(Simd::vec m) const {
+				return _mm_packs_epi32(product(Simd::widenLo16(m)),
+				                       product(Simd::widenHi16(m)));
+			}
+
+			Simd::vec product(Simd::vec m) const {
+				typedef Simd::Lanes32 L;
+				Simd::vec p = L::mullo(m, L::set1(_scale));
+				if (F > 0) {
+					p = VR::template apply<L>(p, static_cast<int>(F));
+				}
+				return L::min(p, L::set1(Format<T>::MAX));
+			}
+#endif
+
+			int64_t _scale;
+
+		};
+
+
+		/**\internal
+		 *\brief Scalar check-node update of nodes \c first to <tt>n - 1</tt>.
+		 */
+		template<typename T, typename Fn>
+		void checkNodeScalar(const T* in, T* out, std::size_t degree,
+		                     std::size_t n, std::size_t first, const Fn& fn) {
+
+			typedef typename T::valtype V;
+
+			for (std::size_t k = first; k < n; ++k) {
+
+				int64_t min1 = Format<T>::MAX;
+				int64_t min2 = Format<T>::MAX;
+				std::size_t index = 0;
+				bool sign = false;
+
+				for (std::size_t j = 0; j < degree; ++j) {
+					const int64_t x = rawValue(in[j*n + k]);
+					const int64_t m = Scalar<T>::magnitude(x);
+					sign ^= (x < 0);
+					if (m < min1) {
+						min2 = min1;
+						min1 = m;
+						index = j;
+					}
+					else if (m < min2) {
+						min2 = m;
+					}
+				}
+
+				const int64_t m1 = fn(min1);
+				const int64_t m2 = fn(min2);
+
+				for (std::size_t j = 0; j < degree; ++j) {
+					const int64_t m = (j == index) ? m2 : m1;
+					const bool negative = sign ^ (rawValue(in[j*n + k]) < 0);
+					out[j*n + k] = T::fromBinary(static_cast<V>(
+						negative ? -m : m));
+				}
+
+			}
+
+		}
+
+		template<typename T>
+		void boxplusScalar(const T* a, const T* b, T* out, std::size_t n,
+		                   std::size_t first) {
+
+			typedef Scalar<T> S;
+			typedef typename T::valtype V;
+			const int64_t c = rawValue(T(0.625));
+
+			for (std::size_t i = first; i < n; ++i) {
+				const int64_t x = rawValue(a[i]);
+				const int64_t y = rawValue(b[i]);
+				const int64_t m = std::min(S::magnitude(x), S::magnitude(y));
+				const int64_t v = ((x < 0) != (y < 0)) ? -m : m;
+				const int64_t r = S::saturate(
+					S::saturate(v + S::correction(S::saturate(x + y), c)) -
+					S::correction(S::saturate(x - y), c));
+				out[i] = T::fromBinary(static_cast<V>(r));
+			}
+
+		}
+
+	}
+
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether the LLR kernels can use 16-bit lanes.
+		 */
+		template<typename T>
+		struct LlrLanes {
+#ifdef FI_SIMD_SSE2
+			static const bool AVAILABLE = (T::WORD_LENGTH <= 16);
+#else
+			static const bool AVAILABLE = false;
+#endif
+		};
+
+#ifdef FI_SIMD_SSE2
+
+		/**\internal
+		 *\brief Saturating LLR operations on eight 16-bit lanes.
+		 */
+		template<typename T>
+		struct LlrVector {
+
+			typedef Lanes16 L;
+
+			static vec saturate(vec v) {
+				return L::min(L::max(v, L::set1(llr::Format<T>::MIN)),
+				              L::set1(llr::Format<T>::MAX));
+			}
+
+			static vec add(vec a, vec b) {
+				return saturate(L::adds(a, b));
+			}
+
+			static vec sub(vec a, vec b) {
+				return saturate(L::subs(a, b));
+			}
+
+			static vec magnitude(vec x) {
+				return L::max(x, sub(zero(), x));
+			}
+
+			static vec correction(vec x, vec c) {
+				return L::max(L::sub(c, L::srai(magnitude(x), 2)), zero());
+			}
+
+			template<typename Fn>
+			static std::size_t checkNode(const T* in, T* out,
+			                             std::size_t degree, std::size_t n,
+			                             const Fn& fn) {
+
+				std::size_t k = 0;
+
+				for (; k + L::COUNT <= n; k += L::COUNT) {
+
+					vec min1 = L::set1(llr::Format<T>::MAX);
+					vec min2 = min1;
+					vec index = zero();
+					vec sign = zero();
+
+					for (std::size_t j = 0; j < degree; ++j) {
+						const vec x = load16(raw(in + j*n + k));
+						const vec m = magnitude(x);
+						const vec less = L::cmplt(m, min1);
+						sign = _mm_xor_si128(sign, L::cmplt(x, zero()));
+						min2 = select(less, min1, L::min(min2, m));
+						min1 = select(less, m, min1);
+						index = select(less, L::set1(static_cast<int64_t>(j)),
+						               index);
+					}
+
+					const vec m1 = fn(min1);
+					const vec m2 = fn(min2);
+
+					for (std::size_t j = 0; j < degree; ++j) {
+						const vec x = load16(raw(in + j*n + k));
+						const vec m = select(
+							L::cmpeq(index, L::set1(static_cast<int64_t>(j))),
+							m2, m1);
+						const vec negative = _mm_xor_si128(
+							sign, L::cmplt(x, zero()));
+						store16(raw(out + j*n + k),
+						        select(negative, L::sub(zero(), m), m));
+					}
+
+				}
+
+				return k;
+
+			}
+
+			static std::size_t boxplus(const T* a, const T* b, T* out,
+			                           std::size_t n) {
+
+				const vec c = L::set1(rawValue(T(0.625)));
+				std::size_t i = 0;
+
+				for (; i + L::COUNT <= n; i += L::COUNT) {
+					const vec x = load16(raw(a + i));
+					const vec y = load16(raw(b + i));
+					const vec m = L::min(magnitude(x), magnitude(y));
+					const vec negative = L::cmplt(_mm_xor_si128(x, y), zero());
+					vec r = select(negative, L::sub(zero(), m), m);
+					r = add(r, correction(add(x, y), c));
+					r = sub(r, correction(sub(x, y), c));
+					store16(raw(out + i), r);
+				}
+
+				return i;
+
+			}
+
+		};
+
+#endif
+
+	}
+
+
+	namespace llr {
+
+		/**\internal
+		 *\brief Check-node update using the vector kernel when the type
+		 *and the transform allow it.
+		 */
+		template<typename T, typename Fn,
+		         bool VECTOR = Simd::LlrLanes<T>::AVAILABLE && Fn::VECTOR>
+		struct Kernel {
+
+			static void checkNode(const T* in, T* out, std::size_t degree,
+			                      std::size_t n, const Fn& fn) {
+				checkNodeScalar(in, out, degree, n, 0, fn);
+			}
+
+			static void boxplus(const T* a, const T* b, T* out,
+			                    std::size_t n) {
+				boxplusScalar(a, b, out, n, 0);
+			}
+
+		};
+
+#ifdef FI_SIMD_SSE2
+		template<typename T, typename Fn>
+		struct Kernel<T, Fn, true> {
+
+			static void checkNode(const T* in, T* out, std::size_t degree,
+			                      std::size_t n, const Fn& fn) {
+				const std::size_t k = Simd::LlrVector<T>::checkNode(
+					in, out, degree, n, fn);
+				checkNodeScalar(in, out, degree, n, k, fn);
+			}
+
+			static void boxplus(const T* a, const T* b, T* out,
+			                    std::size_t n) {
+				const std::size_t i = Simd::LlrVector<T>::boxplus(a, b, out, n);
+				boxplusScalar(a, b, out, n, i);
+			}
+
+		};
+#endif
+
+		inline void checkDegree(std::size_t degree, const char* message) {
+			if (degree < 2) {
+				throw std::invalid_argument(message);
+			}
+		}
+
+		template<typename T>
+		void minSum(const T* in, T* out, std::size_t degree, std::size_t n) {
+			checkDegree(degree, "llr::minSum: degree less than 2");
+			Kernel<T, Identity<T> >::checkNode(in, out, degree, n,
+			                                   Identity<T>());
+		}
+
+		template<typename T>
+		void offsetMinSum(const T* in, T* out, std::size_t degree,
+		                  std::size_t n, const T& offset) {
+			checkDegree(degree, "llr::offsetMinSum: degree less than 2");
+			if (rawValue(offset) < 0) {
+				throw std::invalid_argument("llr::offsetMinSum: negative offset");
+			}
+			Kernel<T, Offset<T> >::checkNode(in, out, degree, n,
+			                                 Offset<T>(offset));
+		}
+
+		template<typename T>
+		void normalizedMinSum(const T* in, T* out, std::size_t degree,
+		                      std::size_t n, const T& scale) {
+			checkDegree(degree, "llr::normalizedMinSum: degree less than 2");
+			if (rawValue(scale) < 0) {
+				throw std::invalid_argument(
+					"llr::normalizedMinSum: negative scale");
+			}
+			Kernel<T, Scale<T> >::checkNode(in, out, degree, n,
+			                                Scale<T>(scale));
+		}
+
+		template<typename T>
+		void boxplus(const T* a, const T* b, T* out, std::size_t n) {
+			Kernel<T, Identity<T> >::boxplus(a, b, out, n);
+		}
+
+	}
+
+}
+
+#endif
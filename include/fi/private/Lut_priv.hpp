@@ -0,0 +1,272 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_LUT_PRIV_HPP
+#define PRIVATE_FI_LUT_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace Fi {
+
+	namespace lut {
+
+		///\internal \brief Fractional bits of table entries and of \c t.
+		const std::size_t TABLE_F = 30;
+
+		///\internal \brief Fractional bits of a normalized position.
+		const std::size_t POSITION_F = 62;
+
+		/**\internal
+		 *\brief Position of the leading one of \c u: the bits below it, as
+		 *a fraction with \c POSITION_F bits.
+		 */
+		inline uint64_t mantissa(uint64_t u, int p) {
+			const uint64_t one = uint64_t(1) << POSITION_F;
+			return (u << (static_cast<int>(POSITION_F) - p)) - one;
+		}
+
+		///\internal \brief \c 1/m for \c m in <tt>[1, 2)</tt>.
+		struct ReciprocalFunction {
+			static const std::size_t RANGES = 1;
+			static double at(std::size_t, double u) {
+				return 1.0/(1.0 + u);
+			}
+		};
+
+		///\internal \brief \c 1/sqrt(m) for \c m in <tt>[1, 2)</tt> and <tt>[2, 4)</tt>.
+		struct RsqrtFunction {
+			static const std::size_t RANGES = 2;
+			static double at(std::size_t range, double u) {
+				return 1.0/std::sqrt((1.0 + u)*(range + 1));
+			}
+		};
+
+		///\internal \brief \c log2(m) for \c m in <tt>[1, 2)</tt>.
+		struct Log2Function {
+			static const std::size_t RANGES = 1;
+			static double at(std::size_t, double u) {
+				return std::log(1.0 + u)/std::log(2.0);
+			}
+		};
+
+		///\internal \brief \c 2^f for \c f in <tt>[0, 1)</tt>.
+		struct Exp2Function {
+			static const std::size_t RANGES = 1;
+			static double at(std::size_t, double u) {
+				return std::pow(2.0, u);
+			}
+		};
+
+		/**\internal
+		 *\brief Segment coefficients of a function, with \c TABLE_F
+		 *fractional bits, and their evaluation.
+		 *\tparam Fn Function over \c Fn::RANGES ranges of positions in
+		 *<tt>[0, 1)</tt>.
+		 */
+		template<typename Fn, std::size_t TB, Interpolation I>
+		class Table {
+
+			typedef char BitsCheck[(TB >= 1 && TB <= 16) ? 1 : -1];
+
+		public:
+
+			static const std::size_t SEGMENTS = std::size_t(1) << TB;
+
+			///\internal \brief The table of the instantiation.
+			static const Table& instance() {
+				static const Table t;
+				return t;
+			}
+
+			/**\internal
+			 *\brief Value at a position with \c POSITION_F fractional bits
+			 *in a range.
+			 */
+			int64_t evaluate(std::size_t range, uint64_t position) const {
+
+				const std::size_t s = (range << TB) |
+					static_cast<std::size_t>(position >> (POSITION_F - TB));
+				const int64_t t = static_cast<int64_t>(
+					(position >> (POSITION_F - TB - TABLE_F)) & (ONE - 1));
+
+				if (I == NEAREST) {
+					return _c0[s];
+				}
+				int64_t v = _c0[s] + ((_c1[s]*t) >> TABLE_F);
+				if (I == QUADRATIC) {
+					const int64_t q = (t*(t - ONE)) >> TABLE_F;
+					v += (_c2[s]*q) >> TABLE_F;
+				}
+				return v;
+
+			}
+
+		private:
+
+			static const int64_t ONE = int64_t(1) << TABLE_F;
+
+			static int64_t quantize(double v) {
+				return static_cast<int64_t>(std::floor(
+					std::ldexp(v, static_cast<int>(TABLE_F)) + 0.5));
+			}
+
+			Table() :
+				_c0(Fn::RANGES*SEGMENTS),
+				_c1(Fn::RANGES*SEGMENTS),
+				_c2(Fn::RANGES*SEGMENTS) {
+
+				const double w = 1.0/SEGMENTS;
+				for (std::size_t r = 0; r < Fn::RANGES; ++r) {
+					for (std::size_t i = 0; i < SEGMENTS; ++i) {
+
+						const double f0 = Fn::at(r, i*w);
+						const double fm = Fn::at(r, (i + 0.5)*w);
+						const double f1 = Fn::at(r, (i + 1)*w);
+						const std::size_t s = r*SEGMENTS + i;
+
+						if (I == NEAREST) {
+							_c0[s] = quantize(fm);
+						}
+						else {
+							_c0[s] = quantize(f0);
+							_c1[s] = quantize(f1) - _c0[s];
+							_c2[s] = quantize(2.0*(f0 + f1) - 4.0*fm);
+						}
+
+					}
+				}
+
+			}
+
+			std::vector<int64_t> _c0;
+			std::vector<int64_t> _c1;
+			std::vector<int64_t> _c2;
+
+		};
+
+
+		template<typename InT, typename OutT, std::size_t TB, Interpolation I>
+		const OutT reciprocal(const InT& x) {
+
+			const int64_t r = rawValue(x);
+			if (r == 0) {
+				throw std::domain_error("lut::reciprocal: zero input");
+			}
+
+			//|x| = m*2^(p - F), 1/|x| = (1/m)*2^(F - p)
+			const uint64_t u = static_cast<uint64_t>((r < 0) ? -r : r);
+			const int p = leadingOne(u);
+			const int64_t v = Table<ReciprocalFunction, TB, I>::instance()
+				.evaluate(0, mantissa(u, p));
+
+			return requantizeScaled<OutT, TABLE_F>((r < 0) ? -v : v,
+				static_cast<int>(InT::FRACTION_LENGTH) - p);
+
+		}
+
+		template<typename InT, typename OutT, std::size_t TB>
+		const OutT reciprocal(const InT& x) {
+			return reciprocal<InT, OutT, TB, LINEAR>(x);
+		}
+
+		template<typename InT, typename OutT, std::size_t TB, Interpolation I>
+		const OutT rsqrt(const InT& x) {
+
+			const int64_t r = rawValue(x);
+			if (r <= 0) {
+				throw std::domain_error("lut::rsqrt: input not positive");
+			}
+
+			//x = m*2^e with e even and m in [1, 4)
+			const uint64_t u = static_cast<uint64_t>(r);
+			const int p = leadingOne(u);
+			const int e = p - static_cast<int>(InT::FRACTION_LENGTH);
+			const std::size_t odd = static_cast<std::size_t>(e & 1);
+			const int64_t v = Table<RsqrtFunction, TB, I>::instance()
+				.evaluate(odd, mantissa(u, p));
+
+			return requantizeScaled<OutT, TABLE_F>(v,
+				-(e - static_cast<int>(odd))/2);
+
+		}
+
+		template<typename InT, typename OutT, std::size_t TB>
+		const OutT rsqrt(const InT& x) {
+			return rsqrt<InT, OutT, TB, LINEAR>(x);
+		}
+
+		template<typename InT, typename OutT, std::size_t TB, Interpolation I>
+		const OutT log2(const InT& x) {
+
+			const int64_t r = rawValue(x);
+			if (r <= 0) {
+				throw std::domain_error("lut::log2: input not positive");
+			}
+
+			const uint64_t u = static_cast<uint64_t>(r);
+			const int p = leadingOne(u);
+			const int64_t e = p - static_cast<int>(InT::FRACTION_LENGTH);
+			const int64_t v = Table<Log2Function, TB, I>::instance()
+				.evaluate(0, mantissa(u, p));
+
+			return requantizeScaled<OutT, TABLE_F>(
+				e*(int64_t(1) << TABLE_F) + v, 0);
+
+		}
+
+		template<typename InT, typename OutT, std::size_t TB>
+		const OutT log2(const InT& x) {
+			return log2<InT, OutT, TB, LINEAR>(x);
+		}
+
+		template<typename InT, typename OutT, std::size_t TB, Interpolation I>
+		const OutT exp2(const InT& x) {
+
+			static const int F = static_cast<int>(InT::FRACTION_LENGTH);
+
+			//x = n + f with f in [0, 1)
+			const int64_t r = rawValue(x);
+			const int64_t n = r >> F;
+			const uint64_t f = static_cast<uint64_t>(r - n*(int64_t(1) << F));
+			const int64_t v = Table<Exp2Function, TB, I>::instance()
+				.evaluate(0, f << (static_cast<int>(POSITION_F) - F));
+
+			return requantizeScaled<OutT, TABLE_F>(v, static_cast<int>(
+				(n < -64) ? -64 : ((n > 64) ? 64 : n)));
+
+		}
+
+		template<typename InT, typename OutT, std::size_t TB>
+		const OutT exp2(const InT& x) {
+			return exp2<InT, OutT, TB, LINEAR>(x);
+		}
+
+	}
+
+}
+
+#endif
@@ -26,6 +26,7 @@
 #include "Fi.hpp"
 
 #include <cstddef>
+#include <stdint.h>
 
 namespace Fi {
 	/**\internal
@@ -39,7 +40,8 @@ namespace Fi {
 	 */
 	template<typename T, std::size_t W>
 	struct TMask {
-		static const T value = ~( (~T(0)) << W );
+		static const T value = static_cast<T>(
+			(W >= 64) ? ~uint64_t(0) : ~(~uint64_t(0) << (W % 64)));
 	};
 
 
@@ -56,7 +58,7 @@ namespace Fi {
 
 	template<typename T, std::size_t W>
 	struct SMask<T, W, SIGNED> {
-		static const T value = (~T(0)) << (W-1);
+		static const T value = static_cast<T>(~uint64_t(0) << (W-1));
 	};
 
 	template<typename T, std::size_t W>
@@ -74,7 +76,8 @@ namespace Fi {
 	 */
 	template<typename T, std::size_t W, std::size_t F>
 	struct FMask {
-		static const T value = (F == 8*sizeof(T)) ? ~T(0) : ~(~T(0) << F);
+		static const T value = static_cast<T>(
+			(F >= 64) ? ~uint64_t(0) : ~(~uint64_t(0) << (F % 64)));
 	};
 
 }
@@ -0,0 +1,396 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_MATRIX_PRIV_HPP
+#define PRIVATE_FI_MATRIX_PRIV_HPP
+
+#include "fi/NN.hpp"
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(_OPENMP) && __cplusplus >= 201103L
+#include <exception>
+#endif
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Exact products of a matrix with a matrix or vector, quantized
+	 *once per element.
+	 */
+	template<typename T1, typename T2, typename ProdT>
+	struct MatrixProduct {
+
+		///\internal \brief Fractional bits of a product.
+		static const std::size_t PRODUCT_F =
+			T1::FRACTION_LENGTH + T2::FRACTION_LENGTH;
+
+		///\internal \brief Rows of \c x computed by a task.
+		static const std::size_t TILE_ROWS = 16;
+
+		///\internal \brief Columns of \c y kept in the cache.
+		static const std::size_t TILE_COLS = 64;
+
+		/**\internal
+		 *\brief Product of \c x with the matrix of \c n columns whose
+		 *element <tt>(k, j)</tt> is at <tt>y[k*ys + j]</tt>. Row \c i of
+		 *the product is stored at <tt>out + i*os</tt>.
+		 */
+		static void apply(const Matrix<T1>& x, const T2* y, std::size_t ys,
+		                  std::size_t n, ProdT* out, std::size_t os) {
+
+			const std::size_t m = x.rows();
+			const std::size_t K = x.cols();
+
+			//Bound the sums using the largest magnitudes and the largest
+			//sums of magnitudes of the rows of x and columns of y.
+			double maxX = 0.0, maxY = 0.0, rowSum = 0.0, colSum = 0.0;
+
+			for (std::size_t i = 0; i < m; ++i) {
+				double sum = 0.0;
+				for (std::size_t k = 0; k < K; ++k) {
+					double v = std::fabs(static_cast<double>(rawValue(x(i, k))));
+					maxX = std::max(maxX, v);
+					sum += v;
+				}
+				rowSum = std::max(rowSum, sum);
+			}
+
+			for (std::size_t j = 0; j < n; ++j) {
+				double sum = 0.0;
+				for (std::size_t k = 0; k < K; ++k) {
+					double v = std::fabs(static_cast<double>(rawValue(y[k*ys + j])));
+					maxY = std::max(maxY, v);
+					sum += v;
+				}
+				colSum = std::max(colSum, sum);
+			}
+
+			const double bound = std::min(maxX*colSum, maxY*rowSum);
+
+			if (bound > std::ldexp(1.0, 62)) {
+				throw std::overflow_error("Matrix product does not fit 64 bits");
+			}
+
+#ifdef FI_SIMD_SSE2
+			if (Simd::NNMadd<T1, T2>::AVAILABLE && bound <= 2147483647.0) {
+				run< nn::Dot<true> >(x, y, ys, n, out, os);
+				return;
+			}
+#endif
+
+			run< nn::Dot<false> >(x, y, ys, n, out, os);
+
+		}
+
+		template<typename D>
+		static void run(const Matrix<T1>& x, const T2* y, std::size_t ys,
+		                std::size_t n, ProdT* out, std::size_t os) {
+
+			typedef typename D::raw_type Raw;
+
+			const std::size_t m = x.rows();
+			const std::size_t K = x.cols();
+			const std::size_t stride =
+				(std::max<std::size_t>(K, 1) + D::BLOCK - 1)/D::BLOCK*D::BLOCK;
+
+			//Rows of x and columns of y, padded with zeros.
+			std::vector<Raw> a(m*stride, 0), b(n*stride, 0);
+
+			for (std::size_t i = 0; i < m; ++i) {
+				nn::pack(x.row(i), &a[i*stride], K);
+			}
+
+			for (std::size_t j = 0; j < n; ++j) {
+				for (std::size_t k = 0; k < K; ++k) {
+					b[j*stride + k] = static_cast<Raw>(rawValue(y[k*ys + j]));
+				}
+			}
+
+			const std::size_t tiles = (m + TILE_ROWS - 1)/TILE_ROWS;
+
+#if defined(_OPENMP) && __cplusplus >= 201103L
+			//An exception cannot leave the parallel region, so the first
+			//one of each tile is kept and that of the first tile is
+			//rethrown, as the serial loop would.
+			std::vector<std::exception_ptr> errors(tiles);
+
+#pragma omp parallel for schedule(static)
+			for (long t = 0; t < static_cast<long>(tiles); ++t) {
+				try {
+					tile<D>(a, b, stride, static_cast<std::size_t>(t), m, n,
+					        out, os);
+				}
+				catch (...) {
+					errors[static_cast<std::size_t>(t)] =
+						std::current_exception();
+				}
+			}
+
+			for (std::size_t t = 0; t < tiles; ++t) {
+				if (errors[t]) {
+					std::rethrow_exception(errors[t]);
+				}
+			}
+#else
+			for (std::size_t t = 0; t < tiles; ++t) {
+				tile<D>(a, b, stride, t, m, n, out, os);
+			}
+#endif
+
+		}
+
+		///\internal \brief Rows of tile \c t of the product.
+		template<typename D>
+		static void tile(const std::vector<typename D::raw_type>& a,
+		                 const std::vector<typename D::raw_type>& b,
+		                 std::size_t stride, std::size_t t, std::size_t m,
+		                 std::size_t n, ProdT* out, std::size_t os) {
+
+			const std::size_t rowTile = TILE_ROWS;
+			const std::size_t colTile = TILE_COLS;
+			const std::size_t first = t*rowTile;
+			const std::size_t last = std::min(first + rowTile, m);
+			int64_t sums[TILE_COLS];
+
+			for (std::size_t jt = 0; jt < n; jt += colTile) {
+
+				const std::size_t count = std::min(n - jt, colTile);
+
+				for (std::size_t i = first; i < last; ++i) {
+
+					D::apply(&a[i*stride], &b[jt*stride], stride, count,
+					         sums);
+
+					for (std::size_t c = 0; c < count; ++c) {
+						out[i*os + jt + c] =
+							Requantize<ProdT, PRODUCT_F>::apply(sums[c]);
+					}
+
+				}
+
+			}
+
+		}
+
+	};
+
+
+	//Matrix
+
+	template<typename T>
+	Matrix<T>::Matrix()
+		: _rows(0),
+		  _cols(0)
+	{
+		allocate();
+	}
+
+
+	template<typename T>
+	Matrix<T>::Matrix(std::size_t rows, std::size_t cols)
+		: _rows(rows),
+		  _cols(cols)
+	{
+		allocate();
+	}
+
+
+	template<typename T>
+	Matrix<T>::Matrix(const Matrix& that)
+		: _rows(that._rows),
+		  _cols(that._cols)
+	{
+		allocate();
+		std::copy(that._data, that._data + _rows*_stride, _data);
+	}
+
+
+	template<typename T>
+	Matrix<T>& Matrix<T>::operator=(const Matrix& that) {
+
+		if (this != &that) {
+			_rows = that._rows;
+			_cols = that._cols;
+			allocate();
+			std::copy(that._data, that._data + _rows*_stride, _data);
+		}
+
+		return *this;
+
+	}
+
+
+	template<typename T>
+	void Matrix<T>::allocate() {
+
+		const std::size_t A = ALIGNMENT/sizeof(T);
+		typedef char SizeCheck[(ALIGNMENT % sizeof(T) == 0) ? 1 : -1];
+		(void)sizeof(SizeCheck);
+
+		_stride = (_cols + A - 1)/A*A;
+		_storage.assign(_rows*_stride + A, T());
+
+		//Skip elements up to the first aligned address.
+		std::size_t addr = reinterpret_cast<std::size_t>(&_storage[0]);
+		std::size_t skip = (ALIGNMENT - addr % ALIGNMENT) % ALIGNMENT;
+		_data = &_storage[0] + skip/sizeof(T);
+
+	}
+
+
+	template<typename T>
+	std::size_t Matrix<T>::rows() const {
+		return _rows;
+	}
+
+
+	template<typename T>
+	std::size_t Matrix<T>::cols() const {
+		return _cols;
+	}
+
+
+	template<typename T>
+	std::size_t Matrix<T>::stride() const {
+		return _stride;
+	}
+
+
+	template<typename T>
+	void Matrix<T>::resize(std::size_t rows, std::size_t cols) {
+		_rows = rows;
+		_cols = cols;
+		allocate();
+	}
+
+
+	template<typename T>
+	T& Matrix<T>::operator()(std::size_t i, std::size_t j) {
+		return _data[i*_stride + j];
+	}
+
+
+	template<typename T>
+	const T& Matrix<T>::operator()(std::size_t i, std::size_t j) const {
+		return _data[i*_stride + j];
+	}
+
+
+	template<typename T>
+	T* Matrix<T>::row(std::size_t i) {
+		return _data + i*_stride;
+	}
+
+
+	template<typename T>
+	const T* Matrix<T>::row(std::size_t i) const {
+		return _data + i*_stride;
+	}
+
+
+	//Operations
+
+	template<typename ProdT, typename T1, typename T2>
+	void multiply(const Matrix<T1>& x, const Matrix<T2>& y,
+	              Matrix<ProdT>& out) {
+
+		if (x.cols() != y.rows()) {
+			throw std::invalid_argument("Matrix sizes do not match");
+		}
+
+		Matrix<ProdT> p(x.rows(), y.cols());
+
+		MatrixProduct<T1, T2, ProdT>::apply(x, y.row(0), y.stride(), y.cols(),
+		                                    p.row(0), p.stride());
+
+		out = p;
+
+	}
+
+
+	template<typename ProdT, typename T1, typename T2>
+	const Matrix<ProdT> multiply(const Matrix<T1>& x, const Matrix<T2>& y) {
+		Matrix<ProdT> out;
+		multiply(x, y, out);
+		return out;
+	}
+
+
+	template<typename ProdT, typename T1, typename T2>
+	void multiply(const Matrix<T1>& x, const std::vector<T2>& y,
+	              std::vector<ProdT>& out) {
+
+		if (x.cols() != y.size()) {
+			throw std::invalid_argument("Matrix and vector sizes do not match");
+		}
+
+		std::vector<ProdT> p(x.rows());
+
+		MatrixProduct<T1, T2, ProdT>::apply(x, y.empty() ? 0 : &y[0], 1, 1,
+		                                    p.empty() ? 0 : &p[0], 1);
+
+		out.swap(p);
+
+	}
+
+
+	template<typename T>
+	void transpose(const Matrix<T>& x, Matrix<T>& out) {
+
+		static const std::size_t TILE = 32;
+
+		out.resize(x.cols(), x.rows());
+
+		for (std::size_t it = 0; it < x.rows(); it += TILE) {
+			for (std::size_t jt = 0; jt < x.cols(); jt += TILE) {
+
+				const std::size_t lastI = std::min(it + TILE, x.rows());
+				const std::size_t lastJ = std::min(jt + TILE, x.cols());
+
+				for (std::size_t i = it; i < lastI; ++i) {
+					for (std::size_t j = jt; j < lastJ; ++j) {
+						out(j, i) = x(i, j);
+					}
+				}
+
+			}
+		}
+
+	}
+
+
+	template<typename T>
+	const Matrix<T> transpose(const Matrix<T>& x) {
+		Matrix<T> out;
+		transpose(x, out);
+		return out;
+	}
+
+}
+
+#endif
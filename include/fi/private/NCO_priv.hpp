@@ -0,0 +1,304 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_NCO_PRIV_HPP
+#define PRIVATE_FI_NCO_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <cmath>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Phase arithmetic of a Fi::NCO.
+	 */
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	struct NCOTypes {
+
+		typedef char FormatCheck[(PhaseT::FRACTION_LENGTH ==
+		                          PhaseT::WORD_LENGTH) ? 1 : -1];
+		typedef char TableCheck[(TB >= 2 && TB <= 16 &&
+		                         TB <= PhaseT::WORD_LENGTH) ? 1 : -1];
+		typedef char OutputCheck[(OutT::SIGNEDNESS == SIGNED) ? 1 : -1];
+
+		static const std::size_t W = PhaseT::WORD_LENGTH;
+
+		///Number of phase bits discarded by truncation.
+		static const std::size_t SHIFT = W - TB;
+
+		static const uint32_t MASK = (W == 32) ? 0xFFFFFFFFu :
+			static_cast<uint32_t>((uint64_t(1) << W) - 1);
+
+		static const uint32_t QUARTER = uint32_t(1) << (TB - 2);
+		static const uint32_t INDEX_MASK = (uint32_t(1) << TB) - 1;
+
+		static uint32_t fromPhase(const PhaseT& p) {
+			return static_cast<uint32_t>(rawValue(p)) & MASK;
+		}
+
+		static const PhaseT toPhase(uint32_t p) {
+			int64_t v = p;
+			if (PhaseT::SIGNEDNESS == SIGNED && v > (int64_t(MASK) >> 1)) {
+				v -= int64_t(MASK) + 1;
+			}
+			return PhaseT::fromBinary(static_cast<typename PhaseT::valtype>(v));
+		}
+
+		///Integer hash of the dither sequence.
+		static uint32_t hash(uint32_t x) {
+			x ^= x >> 16;
+			x *= 0x7FEB352Du;
+			x ^= x >> 15;
+			x *= 0x846CA68Bu;
+			x ^= x >> 16;
+			return x;
+		}
+
+		static uint32_t dither(uint32_t key) {
+			return (SHIFT == 0) ? 0 : (hash(key) >> ((32 - SHIFT) % 32));
+		}
+
+		static uint32_t index(uint32_t phase, uint32_t d) {
+			return ((phase + d) & MASK) >> SHIFT;
+		}
+
+	};
+
+
+	namespace Simd {
+
+#ifdef FI_SIMD_SSE2
+
+		/**\internal
+		 *\brief Phases, dither and table lookups of a Fi::NCO on four
+		 *samples at a time.
+		 */
+		template<typename PhaseT, typename OutT, std::size_t TB>
+		struct NCOVector {
+
+			typedef NCOTypes<PhaseT, OutT, TB> Types;
+			typedef Lanes32 L;
+
+			static vec hash(vec x) {
+				x = _mm_xor_si128(x, L::srli(x, 16));
+				x = L::mullo(x, L::set1(static_cast<int32_t>(0x7FEB352Du)));
+				x = _mm_xor_si128(x, L::srli(x, 15));
+				x = L::mullo(x, L::set1(static_cast<int32_t>(0x846CA68Bu)));
+				return _mm_xor_si128(x, L::srli(x, 16));
+			}
+
+			static vec lookup(const int32_t* table, vec index) {
+#ifdef FI_SIMD_AVX2
+				return _mm_i32gather_epi32(table, index, 4);
+#else
+				int32_t i[4];
+				store4(i, index);
+				return _mm_set_epi32(table[i[3]], table[i[2]], table[i[1]],
+				                     table[i[0]]);
+#endif
+			}
+
+			/**\internal
+			 *\brief Generate samples in groups of four.
+			 *\param key Dither key of the first sample.
+			 *\return Number of samples generated.
+			 */
+			template<bool SIN, bool COS>
+			static std::size_t generate(const int32_t* table, uint32_t phase,
+			                            uint32_t increment, bool dither,
+			                            uint32_t key, OutT* s, OutT* c,
+			                            std::size_t n) {
+
+				vec p = L::add(L::set1(static_cast<int32_t>(phase)),
+				               _mm_set_epi32(static_cast<int32_t>(3*increment),
+				                             static_cast<int32_t>(2*increment),
+				                             static_cast<int32_t>(increment),
+				                             0));
+				const vec step = L::set1(static_cast<int32_t>(4*increment));
+				vec k = L::add(L::set1(static_cast<int32_t>(key)),
+				               _mm_set_epi32(3, 2, 1, 0));
+				const vec four = L::set1(4);
+				const vec mask = L::set1(static_cast<int32_t>(Types::MASK));
+				const vec quarter = L::set1(Types::QUARTER);
+				const vec indexMask = L::set1(Types::INDEX_MASK);
+
+				std::size_t i = 0;
+				for (; i + 4 <= n; i += 4) {
+
+					vec q = p;
+					if (dither && Types::SHIFT != 0) {
+						q = L::add(q, L::srli(hash(k),
+						                      32 - static_cast<int>(Types::SHIFT)));
+					}
+					const vec index = L::srli(_mm_and_si128(q, mask),
+					                          static_cast<int>(Types::SHIFT));
+
+					if (SIN) {
+						store4(raw(s + i), lookup(table, index));
+					}
+					if (COS) {
+						store4(raw(c + i), lookup(table, _mm_and_si128(
+							L::add(index, quarter), indexMask)));
+					}
+
+					p = L::add(p, step);
+					k = L::add(k, four);
+
+				}
+				return i;
+
+			}
+
+		};
+
+#endif
+
+	}
+
+
+	//NCO
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	NCO<PhaseT, OutT, TB>::NCO(const PhaseT& increment, bool dither,
+	                          uint32_t seed)
+		: _increment(NCOTypes<PhaseT, OutT, TB>::fromPhase(increment)),
+		  _phase(0),
+		  _dither(dither),
+		  _seed(seed),
+		  _count(0),
+		  _table(TABLE_SIZE)
+	{
+
+		const double pi = 3.14159265358979323846;
+
+		for (std::size_t i = 0; i < TABLE_SIZE; ++i) {
+			const OutT v(std::sin(2*pi*static_cast<double>(i)/TABLE_SIZE));
+			_table[i] = static_cast<int32_t>(rawValue(v));
+		}
+
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	const PhaseT NCO<PhaseT, OutT, TB>::increment() const {
+		return NCOTypes<PhaseT, OutT, TB>::toPhase(_increment);
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	void NCO<PhaseT, OutT, TB>::setIncrement(const PhaseT& increment) {
+		_increment = NCOTypes<PhaseT, OutT, TB>::fromPhase(increment);
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	const PhaseT NCO<PhaseT, OutT, TB>::phase() const {
+		return NCOTypes<PhaseT, OutT, TB>::toPhase(_phase);
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	void NCO<PhaseT, OutT, TB>::setPhase(const PhaseT& phase) {
+		_phase = NCOTypes<PhaseT, OutT, TB>::fromPhase(phase);
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	bool NCO<PhaseT, OutT, TB>::dither() const {
+		return _dither;
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	void NCO<PhaseT, OutT, TB>::reset() {
+		_phase = 0;
+		_count = 0;
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	const OutT NCO<PhaseT, OutT, TB>::table(std::size_t i) const {
+		return OutT::fromBinary(
+			static_cast<typename OutT::valtype>(_table.at(i)));
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	void NCO<PhaseT, OutT, TB>::sin(OutT* out, std::size_t n) {
+		generate<true, false>(out, 0, n);
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	void NCO<PhaseT, OutT, TB>::cos(OutT* out, std::size_t n) {
+		generate<false, true>(0, out, n);
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	void NCO<PhaseT, OutT, TB>::sincos(OutT* s, OutT* c, std::size_t n) {
+		generate<true, true>(s, c, n);
+	}
+
+
+	template<typename PhaseT, typename OutT, std::size_t TB>
+	template<bool SIN, bool COS>
+	void NCO<PhaseT, OutT, TB>::generate(OutT* s, OutT* c, std::size_t n) {
+
+		typedef NCOTypes<PhaseT, OutT, TB> Types;
+		typedef typename OutT::valtype V;
+
+		std::size_t i = 0;
+
+#ifdef FI_SIMD_SSE2
+		i = Simd::NCOVector<PhaseT, OutT, TB>::template generate<SIN, COS>(
+			&_table[0], _phase, _increment, _dither, _seed + _count, s, c, n);
+		_phase = (_phase + static_cast<uint32_t>(i)*_increment) & Types::MASK;
+		_count += static_cast<uint32_t>(i);
+#endif
+
+		for (; i < n; ++i) {
+
+			const uint32_t d = _dither ? Types::dither(_seed + _count) : 0;
+			const uint32_t index = Types::index(_phase, d);
+
+			if (SIN) {
+				s[i] = OutT::fromBinary(static_cast<V>(_table[index]));
+			}
+			if (COS) {
+				c[i] = OutT::fromBinary(static_cast<V>(
+					_table[(index + Types::QUARTER) & Types::INDEX_MASK]));
+			}
+
+			_phase = (_phase + _increment) & Types::MASK;
+			++_count;
+
+		}
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,432 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_NN_PRIV_HPP
+#define PRIVATE_FI_NN_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace Fi {
+
+	namespace nn {
+
+		/**\internal
+		 *\brief Whether every raw value of a type fits a 16-bit signed
+		 *integer.
+		 */
+		template<typename FixedT>
+		struct Fits16 {
+			static const bool value = FixedT::WORD_LENGTH <=
+				((FixedT::SIGNEDNESS == SIGNED) ? 16u : 15u);
+		};
+
+	}
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether the dot products of a layer can use 16-bit
+		 *multiply-add instructions.
+		 */
+		template<typename InT, typename WT>
+		struct NNMadd {
+#ifdef FI_SIMD_SSE2
+			static const bool AVAILABLE =
+				nn::Fits16<InT>::value && nn::Fits16<WT>::value;
+#else
+			static const bool AVAILABLE = false;
+#endif
+		};
+
+	}
+
+	namespace nn {
+
+		/**\internal
+		 *\brief Exact dot products of a row of raw inputs with \c count
+		 *rows of raw weights, \c stride apart. Rows are padded with zeros
+		 *to a multiple of \c BLOCK.
+		 */
+		template<bool MADD>
+		struct Dot {
+
+			typedef int64_t raw_type;
+
+			static const std::size_t BLOCK = 1;
+
+			static void apply(const raw_type* x, const raw_type* w,
+			                  std::size_t stride, std::size_t count,
+			                  int64_t* sums) {
+
+				for (std::size_t j = 0; j < count; ++j) {
+
+					const raw_type* h = w + j*stride;
+					int64_t sum = 0;
+
+					for (std::size_t i = 0; i < stride; ++i) {
+						sum += x[i]*h[i];
+					}
+
+					sums[j] = sum;
+
+				}
+
+			}
+
+		};
+
+#ifdef FI_SIMD_SSE2
+		template<>
+		struct Dot<true> {
+
+			typedef int16_t raw_type;
+
+			static const std::size_t BLOCK = Simd::DOT16_BLOCK;
+
+			static void apply(const raw_type* x, const raw_type* w,
+			                  std::size_t stride, std::size_t count,
+			                  int64_t* sums) {
+
+				std::size_t j = 0;
+
+				//Four rows of weights share each load of the inputs.
+				for (; j + 4 <= count; j += 4) {
+					int32_t s[4];
+					Simd::dot16x4(x, w + j*stride, stride, stride, s);
+					std::copy(s, s + 4, sums + j);
+				}
+
+				for (; j < count; ++j) {
+					sums[j] = Simd::dot16(x, w + j*stride, stride);
+				}
+
+			}
+
+		};
+#endif
+
+		/**\internal
+		 *\brief Weights, biases and input buffer of a layer with
+		 *\c outputs outputs of \c length products each, and the
+		 *computation of the outputs from one row of inputs.
+		 */
+		template<typename InT, typename WT, typename AccT, typename OutT>
+		class Layer {
+
+		public:
+
+			typedef Dot<Simd::NNMadd<InT, WT>::AVAILABLE> Kernel;
+			typedef typename Kernel::raw_type Raw;
+
+			///\internal \brief Fractional bits of a product.
+			static const std::size_t PRODUCT_F =
+				InT::FRACTION_LENGTH + WT::FRACTION_LENGTH;
+
+			Layer(std::size_t outputs, std::size_t length)
+				: _outputs(outputs),
+				  _length(length),
+				  _stride((std::max<std::size_t>(length, 1) + Kernel::BLOCK - 1)/
+				          Kernel::BLOCK*Kernel::BLOCK),
+				  _weights(outputs*_stride, 0),
+				  _bias(outputs),
+				  _row(_stride, 0),
+				  _sums(outputs),
+				  _overflowFree(false)
+			{ }
+
+			///\internal \brief Raw weights of output \c j.
+			Raw* weights(std::size_t j) {
+				return &_weights[j*_stride];
+			}
+
+			///\internal \brief Convert the biases to the accumulator.
+			template<typename BiasT>
+			void bias(const BiasT* b) {
+				for (std::size_t j = 0; j < _outputs; ++j) {
+					_bias[j] = Requantize<AccT, BiasT::FRACTION_LENGTH>::apply(
+						rawValue(b[j]));
+				}
+			}
+
+			///\internal \brief Decide how the outputs are computed, once
+			///the weights and biases are set.
+			void finish() {
+
+				double largest = 0.0;
+
+				for (std::size_t j = 0; j < _outputs; ++j) {
+
+					double sum = 0.0;
+
+					for (std::size_t i = 0; i < _length; ++i) {
+						sum += std::fabs(static_cast<double>(_weights[j*_stride + i]));
+					}
+
+					sum = sum*rawMagnitude<InT>() +
+						std::fabs(static_cast<double>(rawValue(_bias[j])));
+					largest = std::max(largest, sum);
+
+				}
+
+				_overflowFree =
+					(AccT::SIGNEDNESS == SIGNED) &&
+					(AccT::FRACTION_LENGTH == PRODUCT_F) &&
+					(largest <= static_cast<double>(AccT::TR::MAX_VAL));
+
+			}
+
+			///\internal \brief Input buffer, padded with zeros.
+			Raw* row() {
+				return &_row[0];
+			}
+
+			///\internal \brief Outputs of the inputs in the buffer.
+			void apply(OutT* out) {
+
+				typedef Requantize<OutT, AccT::FRACTION_LENGTH> Output;
+
+				if (_outputs == 0) {
+					return;
+				}
+
+				if (_overflowFree) {
+
+					Kernel::apply(&_row[0], &_weights[0], _stride, _outputs,
+					              &_sums[0]);
+
+					for (std::size_t j = 0; j < _outputs; ++j) {
+						out[j] = Output::apply(rawValue(_bias[j]) + _sums[j]);
+					}
+
+					return;
+
+				}
+
+				for (std::size_t j = 0; j < _outputs; ++j) {
+
+					const Raw* h = &_weights[j*_stride];
+					AccT acc = _bias[j];
+
+					for (std::size_t i = 0; i < _length; ++i) {
+						int64_t p = static_cast<int64_t>(h[i])*_row[i];
+						acc += Requantize<AccT, PRODUCT_F>::apply(p);
+					}
+
+					out[j] = Output::apply(rawValue(acc));
+
+				}
+
+			}
+
+		private:
+
+			std::size_t _outputs;
+			std::size_t _length;
+			std::size_t _stride;
+
+			std::vector<Raw> _weights;
+			std::vector<AccT> _bias;
+			std::vector<Raw> _row;
+			std::vector<int64_t> _sums;
+			bool _overflowFree;
+
+		};
+
+		///\internal \brief Copy the raw values of \c n numbers.
+		template<typename FixedT, typename Raw>
+		inline void pack(const FixedT* x, Raw* out, std::size_t n) {
+			for (std::size_t i = 0; i < n; ++i) {
+				out[i] = static_cast<Raw>(rawValue(x[i]));
+			}
+		}
+
+
+		//Conv2D
+
+		inline Conv2D::Conv2D(std::size_t height, std::size_t width,
+		                      std::size_t channels, std::size_t filters,
+		                      std::size_t kernelHeight,
+		                      std::size_t kernelWidth,
+		                      std::size_t stride, std::size_t padding)
+			: height(height),
+			  width(width),
+			  channels(channels),
+			  filters(filters),
+			  kernelHeight(kernelHeight),
+			  kernelWidth(kernelWidth),
+			  stride(stride),
+			  padding(padding)
+		{
+
+			if (height == 0 || width == 0 || channels == 0 || filters == 0 ||
+			    kernelHeight == 0 || kernelWidth == 0 || stride == 0) {
+				throw std::invalid_argument("Convolution size is zero");
+			}
+
+			if (kernelHeight > height + 2*padding ||
+			    kernelWidth > width + 2*padding) {
+				throw std::invalid_argument(
+					"Convolution kernel is larger than its input");
+			}
+
+		}
+
+
+		inline std::size_t Conv2D::outputHeight() const {
+			return (height + 2*padding - kernelHeight)/stride + 1;
+		}
+
+
+		inline std::size_t Conv2D::outputWidth() const {
+			return (width + 2*padding - kernelWidth)/stride + 1;
+		}
+
+
+		inline std::size_t Conv2D::filterSize() const {
+			return kernelHeight*kernelWidth*channels;
+		}
+
+
+		//Layers
+
+		template<typename AccT, typename InT, typename WT, typename OutT>
+		void gemm(const InT* a, const WT* b, OutT* out,
+		          std::size_t m, std::size_t n, std::size_t k) {
+
+			typedef Layer<InT, WT, AccT, OutT> L;
+
+			L layer(n, k);
+
+			for (std::size_t j = 0; j < n; ++j) {
+				typename L::Raw* h = layer.weights(j);
+				for (std::size_t i = 0; i < k; ++i) {
+					h[i] = static_cast<typename L::Raw>(rawValue(b[i*n + j]));
+				}
+			}
+
+			layer.finish();
+
+			for (std::size_t i = 0; i < m; ++i) {
+				pack(a + i*k, layer.row(), k);
+				layer.apply(out + i*n);
+			}
+
+		}
+
+
+		template<typename AccT, typename InT, typename WT, typename BiasT,
+		         typename OutT>
+		void dense(const InT* x, const WT* w, const BiasT* bias, OutT* out,
+		           std::size_t batch, std::size_t inputs,
+		           std::size_t outputs) {
+
+			Layer<InT, WT, AccT, OutT> layer(outputs, inputs);
+
+			for (std::size_t j = 0; j < outputs; ++j) {
+				pack(w + j*inputs, layer.weights(j), inputs);
+			}
+
+			layer.bias(bias);
+			layer.finish();
+
+			for (std::size_t i = 0; i < batch; ++i) {
+				pack(x + i*inputs, layer.row(), inputs);
+				layer.apply(out + i*outputs);
+			}
+
+		}
+
+
+		template<typename AccT, typename InT, typename WT, typename BiasT,
+		         typename OutT>
+		void conv2d(const Conv2D& shape, const InT* in, const WT* w,
+		            const BiasT* bias, OutT* out) {
+
+			typedef Layer<InT, WT, AccT, OutT> L;
+
+			const std::size_t size = shape.filterSize();
+			const std::size_t C = shape.channels;
+
+			L layer(shape.filters, size);
+
+			for (std::size_t j = 0; j < shape.filters; ++j) {
+				pack(w + j*size, layer.weights(j), size);
+			}
+
+			layer.bias(bias);
+			layer.finish();
+
+			const std::size_t H = shape.outputHeight();
+			const std::size_t W = shape.outputWidth();
+
+			//Each output pixel is the product of the filters with the
+			//patch of the padded input under them, gathered in the buffer.
+			for (std::size_t y = 0; y < H; ++y) {
+				for (std::size_t x = 0; x < W; ++x) {
+
+					typename L::Raw* patch = layer.row();
+
+					for (std::size_t r = 0; r < shape.kernelHeight; ++r) {
+
+						const std::size_t py = y*shape.stride + r;
+
+						for (std::size_t s = 0; s < shape.kernelWidth; ++s) {
+
+							const std::size_t px = x*shape.stride + s;
+
+							if (py < shape.padding || px < shape.padding ||
+							    py - shape.padding >= shape.height ||
+							    px - shape.padding >= shape.width) {
+								std::fill(patch, patch + C, 0);
+							}
+							else {
+								const std::size_t p =
+									(py - shape.padding)*shape.width +
+									(px - shape.padding);
+								pack(in + p*C, patch, C);
+							}
+
+							patch += C;
+
+						}
+
+					}
+
+					layer.apply(out + (y*W + x)*shape.filters);
+
+				}
+			}
+
+		}
+
+	}
+
+}
+
+#endif
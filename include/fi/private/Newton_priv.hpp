@@ -0,0 +1,393 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_NEWTON_PRIV_HPP
+#define PRIVATE_FI_NEWTON_PRIV_HPP
+
+#include "fi/Lut.hpp"
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <stdexcept>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Normalization, seeds and scalar iterations shared by the
+	 *Newton-Raphson kernels.
+	 */
+	template<typename T>
+	struct NewtonBase {
+
+		typedef typename NewtonFormat<T>::type U;
+
+		static const std::size_t F = U::FRACTION_LENGTH;
+		static const std::size_t SEED_BITS = 4;
+
+		///\c u with its leading one at bit \c p moved to bit \c q.
+		static int64_t align(uint64_t u, int p, int q) {
+			return static_cast<int64_t>((q >= p) ? (u << (q - p)) : (u >> (p - q)));
+		}
+
+		///Seed from a table of values at the middle of each segment.
+		template<typename Fn>
+		static int64_t seed(std::size_t range, uint64_t u, int p) {
+			typedef lut::Table<Fn, SEED_BITS, lut::NEAREST> Seeds;
+			const int64_t v = Seeds::instance().evaluate(range,
+			                                             lut::mantissa(u, p));
+			const std::size_t s = lut::TABLE_F - F;
+			return (v + (int64_t(1) << (s - 1))) >> s;
+		}
+
+		static int64_t product(int64_t a, int64_t b) {
+			return Requantize<U, 2*F>::raw(a*b);
+		}
+
+		static int64_t handle(int64_t a) {
+			return Requantize<U, F>::raw(a);
+		}
+
+	};
+
+	/**\internal
+	 *\brief Newton-Raphson reciprocal: <tt>y = y*(2 - m*y)</tt>.
+	 */
+	template<typename T>
+	struct NewtonReciprocalStep : public NewtonBase<T> {
+
+		typedef NewtonBase<T> B;
+
+		/**\internal
+		 *\brief Normalize \c x to \c m, the seed \c y and the scale
+		 *<tt>2^k</tt> of the result.
+		 */
+		static void normalize(const T& x, int64_t& m, int64_t& y, int& k,
+		                      bool& negative) {
+
+			const int64_t r = rawValue(x);
+			if (r == 0) {
+				throw std::domain_error("newtonReciprocal: zero input");
+			}
+
+			negative = (r < 0);
+			const uint64_t u = static_cast<uint64_t>(negative ? -r : r);
+			const int p = leadingOne(u);
+			m = B::align(u, p, static_cast<int>(B::F));
+			y = B::template seed<lut::ReciprocalFunction>(0, u, p);
+			k = static_cast<int>(T::FRACTION_LENGTH) - p;
+
+		}
+
+		static int64_t apply(int64_t m, int64_t y) {
+			const int64_t t = B::product(m, y);
+			const int64_t e = B::handle((int64_t(2) << B::F) - t);
+			return B::product(y, e);
+		}
+
+	};
+
+	/**\internal
+	 *\brief Newton-Raphson reciprocal square root:
+	 *<tt>y = y*(3 - m*y*y)/2</tt>.
+	 */
+	template<typename T>
+	struct NewtonRsqrtStep : public NewtonBase<T> {
+
+		typedef NewtonBase<T> B;
+		typedef typename B::U U;
+
+		static void normalize(const T& x, int64_t& m, int64_t& y, int& k,
+		                      bool& negative) {
+
+			const int64_t r = rawValue(x);
+			if (r <= 0) {
+				throw std::domain_error("newtonRsqrt: input not positive");
+			}
+
+			negative = false;
+			const uint64_t u = static_cast<uint64_t>(r);
+			const int p = leadingOne(u);
+			const int e = p - static_cast<int>(T::FRACTION_LENGTH);
+			const int odd = e & 1;
+			m = B::align(u, p, static_cast<int>(B::F) + odd);
+			y = B::template seed<lut::RsqrtFunction>(odd, u, p);
+			k = -(e - odd)/2;
+
+		}
+
+		static int64_t apply(int64_t m, int64_t y) {
+			int64_t t = B::product(y, y);
+			t = B::product(m, t);
+			const int64_t e = B::handle((int64_t(3) << B::F) - t);
+			return Requantize<U, 2*B::F + 1>::raw(y*e);
+		}
+
+	};
+
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether the iterations of Newton-Raphson kernels for \c T
+		 *can run in 32-bit lanes.
+		 */
+		template<typename T>
+		struct NewtonLanes {
+#ifdef FI_SIMD_SSE2
+			typedef typename NewtonFormat<T>::type U;
+			static const bool AVAILABLE = (U::FRACTION_LENGTH <= 23) &&
+				VecRound<typename U::RH>::AVAILABLE;
+#else
+			static const bool AVAILABLE = false;
+#endif
+		};
+
+#ifdef FI_SIMD_SSE2
+
+		/**\internal
+		 *\brief Products of non-negative lanes below <tt>2^(F + 3)</tt>,
+		 *with \c SHIFT bits removed using the rounding mode of \c U.
+
+		 *The 64-bit products are reduced to their integer part, the first
+		 *removed bit, and a sticky bit for the rest, which round the same
+		 *way in 32-bit lanes.
+		 */
+		template<typename U, std::size_t SHIFT>
+		inline vec newtonProduct(vec a, vec b) {
+
+			const vec low = _mm_set_epi32(0, -1, 0, -1);
+			const int mask = (1 << (SHIFT - 2)) - 1;
+			const vec sticky = _mm_set_epi32(0, mask, 0, mask);
+
+			const vec even = _mm_mul_epu32(a, b);
+			const vec odd = _mm_mul_epu32(_mm_srli_epi64(a, 32),
+			                              _mm_srli_epi64(b, 32));
+
+			const vec top = _mm_or_si128(
+				_mm_and_si128(_mm_srli_epi64(even, SHIFT - 2), low),
+				_mm_slli_epi64(_mm_srli_epi64(odd, SHIFT - 2), 32));
+			const vec rest = _mm_or_si128(
+				_mm_and_si128(even, sticky),
+				_mm_slli_epi64(_mm_and_si128(odd, sticky), 32));
+
+			const vec n = _mm_or_si128(top, _mm_andnot_si128(
+				Lanes32::cmpeq(rest, zero()), Lanes32::set1(1)));
+			return VecRound<typename U::RH>::template apply<Lanes32>(n, 2);
+
+		}
+
+		///\internal \brief Whether any lane of \c a or \c b is negative.
+		inline bool negative(vec a, vec b) {
+			return _mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(a, b))) != 0;
+		}
+
+		/**\internal
+		 *\brief Newton-Raphson iterations on four lanes.
+		 *\return \c false if an operand was negative or a result overflowed
+		 *a handler without a vector implementation.
+		 */
+		template<typename T>
+		struct NewtonVector {
+
+			typedef typename NewtonFormat<T>::type U;
+			typedef VecOverflow<typename U::OFH> VO;
+
+			static const std::size_t F = U::FRACTION_LENGTH;
+
+			static bool product(vec a, vec b, vec& p) {
+				if (negative(a, b)) {
+					return false;
+				}
+				p = newtonProduct<U, F>(a, b);
+				return VO::template apply<Lanes32>(p);
+			}
+
+			static bool reciprocal(vec m, vec& y) {
+				vec t;
+				vec e;
+				if (!product(m, y, t)) {
+					return false;
+				}
+				e = Lanes32::sub(Lanes32::set1(int64_t(2) << F), t);
+				return VO::template apply<Lanes32>(e) && product(y, e, y);
+			}
+
+			static bool rsqrt(vec m, vec& y) {
+				vec t;
+				vec e;
+				if (!product(y, y, t) || !product(m, t, t)) {
+					return false;
+				}
+				e = Lanes32::sub(Lanes32::set1(int64_t(3) << F), t);
+				if (!VO::template apply<Lanes32>(e) || negative(y, e)) {
+					return false;
+				}
+				y = newtonProduct<U, F + 1>(y, e);
+				return VO::template apply<Lanes32>(y);
+			}
+
+		};
+
+#endif
+
+	}
+
+
+	/**\internal
+	 *\brief Iterations of a block of Newton-Raphson kernels: scalar.
+	 */
+	template<typename T, std::size_t N, typename Step,
+	         bool VECTOR = Simd::NewtonLanes<T>::AVAILABLE>
+	struct NewtonKernel {
+		static void apply(const int64_t* m, int64_t* y, std::size_t n) {
+			for (std::size_t i = 0; i < n; ++i) {
+				for (std::size_t j = 0; j < N; ++j) {
+					y[i] = Step::apply(m[i], y[i]);
+				}
+			}
+		}
+	};
+
+#ifdef FI_SIMD_SSE2
+
+	/**\internal
+	 *\brief Iterations of a block of Newton-Raphson kernels: four per
+	 *register, with groups that cannot be computed in vectors left to the
+	 *scalar code.
+	 */
+	template<typename T, std::size_t N, typename Step>
+	struct NewtonKernel<T, N, Step, true> {
+
+		typedef Simd::NewtonVector<T> V;
+
+		static bool iterate(Simd::vec m, Simd::vec& y,
+		                    const NewtonReciprocalStep<T>*) {
+			for (std::size_t j = 0; j < N; ++j) {
+				if (!V::reciprocal(m, y)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static bool iterate(Simd::vec m, Simd::vec& y,
+		                    const NewtonRsqrtStep<T>*) {
+			for (std::size_t j = 0; j < N; ++j) {
+				if (!V::rsqrt(m, y)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static void apply(const int64_t* m, int64_t* y, std::size_t n) {
+
+			std::size_t i = 0;
+			for (; i + 4 <= n; i += 4) {
+				Simd::vec v = Simd::load4(y + i);
+				if (iterate(Simd::load4(m + i), v, static_cast<Step*>(0))) {
+					Simd::store4(y + i, v);
+				}
+				else {
+					NewtonKernel<T, N, Step, false>::apply(m + i, y + i, 4);
+				}
+			}
+			NewtonKernel<T, N, Step, false>::apply(m + i, y + i, n - i);
+
+		}
+
+	};
+
+#endif
+
+	/**\internal
+	 *\brief Element-wise Newton-Raphson kernels, normalized and scaled
+	 *in blocks around the iterations.
+	 */
+	template<typename T, std::size_t N, typename Step>
+	void newtonBatch(const T* x, T* out, std::size_t n) {
+
+		static const std::size_t BLOCK = 64;
+
+		int64_t m[BLOCK];
+		int64_t y[BLOCK];
+		int k[BLOCK];
+		bool negative[BLOCK];
+
+		for (std::size_t b = 0; b < n; b += BLOCK) {
+
+			const std::size_t count = (n - b < BLOCK) ? n - b : BLOCK;
+			for (std::size_t i = 0; i < count; ++i) {
+				Step::normalize(x[b + i], m[i], y[i], k[i], negative[i]);
+			}
+
+			NewtonKernel<T, N, Step>::apply(m, y, count);
+
+			for (std::size_t i = 0; i < count; ++i) {
+				out[b + i] = requantizeScaled<T, Step::F>(
+					negative[i] ? -y[i] : y[i], k[i]);
+			}
+
+		}
+
+	}
+
+	template<typename T, typename Step, std::size_t N>
+	const T newtonScalar(const T& x) {
+
+		int64_t m;
+		int64_t y;
+		int k;
+		bool negative;
+		Step::normalize(x, m, y, k, negative);
+		for (std::size_t j = 0; j < N; ++j) {
+			y = Step::apply(m, y);
+		}
+		return requantizeScaled<T, Step::F>(negative ? -y : y, k);
+
+	}
+
+
+	template<typename T, std::size_t N>
+	const T newtonReciprocal(const T& x) {
+		return newtonScalar<T, NewtonReciprocalStep<T>, N>(x);
+	}
+
+	template<typename T, std::size_t N>
+	const T newtonRsqrt(const T& x) {
+		return newtonScalar<T, NewtonRsqrtStep<T>, N>(x);
+	}
+
+	template<typename T, std::size_t N>
+	void newtonReciprocal(const T* x, T* out, std::size_t n) {
+		newtonBatch<T, N, NewtonReciprocalStep<T> >(x, out, n);
+	}
+
+	template<typename T, std::size_t N>
+	void newtonRsqrt(const T* x, T* out, std::size_t n) {
+		newtonBatch<T, N, NewtonRsqrtStep<T> >(x, out, n);
+	}
+
+}
+
+#endif
@@ -22,6 +22,7 @@
 #ifndef FI_PRIVATE_OVERFLOW_DETECTOR_HPP
 #define FI_PRIVATE_OVERFLOW_DETECTOR_HPP
 
+#include "Constexpr.hpp"
 #include "Parser.hpp"
 #include "StringConversion.hpp"
 #include "StringMath.hpp"
@@ -54,7 +55,8 @@ namespace Fi {
 		 *\return An integer representing the fixed-point number after
 		 *overflow has been handled.
 		 */
-		static typename T::valtype fromFixedPoint(const typename T::valtype& n);
+		static FI_CONSTEXPR typename T::valtype
+		fromFixedPoint(const typename T::valtype& n);
 
 		/**
 		 *\internal
@@ -66,9 +68,9 @@ namespace Fi {
 		 *\return An integer representing the fixed-point number after
 		 *overflow has been handled.
 		 */
-		static typename T::valtype fromDouble(double f,
-		                                      const typename T::valtype& n,
-		                                      double maxRoundChange);
+		static FI_CONSTEXPR typename T::valtype
+		fromDouble(double f, const typename T::valtype& n,
+		           double maxRoundChange);
 
 		/**
 		 *\internal
@@ -88,7 +90,7 @@ namespace Fi {
 	};
 
 	template<typename T,  template <typename> class OFH>
-	inline typename T::valtype OverflowDetector<T, OFH>::
+	inline FI_CONSTEXPR typename T::valtype OverflowDetector<T, OFH>::
 	fromFixedPoint(const typename T::valtype& n) {
 
 		//Cannot use ternary operator due to n being const.
@@ -96,11 +98,15 @@ namespace Fi {
 		typename T::valtype ret(n);
 
 		//Casting to signed to detect negative overflow as a result of
-		//subtracting two unsigned numbers.
-		if (static_cast<typename T::SignedType>(n) < T::MIN_VAL) {
+		//subtracting two unsigned numbers. The limits are cast as well, or
+		//an unsigned type of 32 bits or more makes the comparison
+		//unsigned.
+		typedef typename T::SignedType st;
+
+		if (static_cast<st>(n) < static_cast<st>(T::MIN_VAL)) {
 			ret = OFH<T>::negativeOverflow(n);
 		}
-		else if (static_cast<typename T::SignedType>(n) > T::MAX_VAL) {
+		else if (static_cast<st>(n) > static_cast<st>(T::MAX_VAL)) {
 			ret = OFH<T>::positiveOverflow(n);
 		}
 
@@ -109,7 +115,7 @@ namespace Fi {
 	}
 
 	template<typename T, template <typename> class OFH>
-	inline typename T::valtype OverflowDetector<T, OFH>::
+	inline FI_CONSTEXPR typename T::valtype OverflowDetector<T, OFH>::
 	fromDouble(double f, const typename T::valtype& n, double maxRoundChange) {
 
 		typename T::valtype ret = n;
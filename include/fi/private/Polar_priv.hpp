@@ -0,0 +1,210 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_POLAR_PRIV_HPP
+#define PRIVATE_FI_POLAR_PRIV_HPP
+
+#include "fi/private/Llr_priv.hpp"
+
+namespace Fi {
+
+	namespace polar {
+
+		/**\internal
+		 *\brief Node operations on elements \c first to <tt>n - 1</tt>.
+		 */
+		template<typename T>
+		struct Scalar {
+
+			typedef llr::Scalar<T> S;
+			typedef typename T::valtype V;
+
+			static void f(const T* a, const T* b, T* out, std::size_t n,
+			              std::size_t first) {
+				for (std::size_t i = first; i < n; ++i) {
+					const int64_t x = rawValue(a[i]);
+					const int64_t y = rawValue(b[i]);
+					const int64_t m = std::min(S::magnitude(x), S::magnitude(y));
+					out[i] = T::fromBinary(static_cast<V>(
+						((x < 0) != (y < 0)) ? -m : m));
+				}
+			}
+
+			static void g(const T* a, const T* b, const uint8_t* u, T* out,
+			              std::size_t n, std::size_t first) {
+				for (std::size_t i = first; i < n; ++i) {
+					const int64_t x = rawValue(a[i]);
+					const int64_t y = rawValue(b[i]);
+					out[i] = T::fromBinary(static_cast<V>(
+						S::saturate(u[i] ? y - x : y + x)));
+				}
+			}
+
+		};
+
+	}
+
+
+	namespace Simd {
+
+#ifdef FI_SIMD_SSE2
+
+		/**\internal
+		 *\brief Node operations on eight 16-bit lanes.
+		 */
+		template<typename T>
+		struct PolarVector {
+
+			typedef Lanes16 L;
+			typedef LlrVector<T> LV;
+
+			static std::size_t f(const T* a, const T* b, T* out,
+			                     std::size_t n) {
+				std::size_t i = 0;
+				for (; i + L::COUNT <= n; i += L::COUNT) {
+					const vec x = load16(raw(a + i));
+					const vec y = load16(raw(b + i));
+					const vec m = L::min(LV::magnitude(x), LV::magnitude(y));
+					const vec negative = L::cmplt(_mm_xor_si128(x, y), zero());
+					store16(raw(out + i), select(negative, L::sub(zero(), m), m));
+				}
+				return i;
+			}
+
+			static std::size_t g(const T* a, const T* b, const uint8_t* u,
+			                     T* out, std::size_t n) {
+				std::size_t i = 0;
+				for (; i + L::COUNT <= n; i += L::COUNT) {
+					const vec x = load16(raw(a + i));
+					const vec y = load16(raw(b + i));
+					const vec bits = _mm_unpacklo_epi8(
+						_mm_loadl_epi64(reinterpret_cast<const vec*>(u + i)),
+						zero());
+					const vec keep = L::cmpeq(bits, zero());
+					store16(raw(out + i),
+					        select(keep, LV::add(y, x), LV::sub(y, x)));
+				}
+				return i;
+			}
+
+		};
+
+#endif
+
+	}
+
+
+	namespace polar {
+
+		template<typename T, bool VECTOR = Simd::LlrLanes<T>::AVAILABLE>
+		struct Kernel {
+
+			static void f(const T* a, const T* b, T* out, std::size_t n) {
+				Scalar<T>::f(a, b, out, n, 0);
+			}
+
+			static void g(const T* a, const T* b, const uint8_t* u, T* out,
+			              std::size_t n) {
+				Scalar<T>::g(a, b, u, out, n, 0);
+			}
+
+		};
+
+#ifdef FI_SIMD_SSE2
+		template<typename T>
+		struct Kernel<T, true> {
+
+			static void f(const T* a, const T* b, T* out, std::size_t n) {
+				const std::size_t i = Simd::PolarVector<T>::f(a, b, out, n);
+				Scalar<T>::f(a, b, out, n, i);
+			}
+
+			static void g(const T* a, const T* b, const uint8_t* u, T* out,
+			              std::size_t n) {
+				const std::size_t i = Simd::PolarVector<T>::g(a, b, u, out, n);
+				Scalar<T>::g(a, b, u, out, n, i);
+			}
+
+		};
+#endif
+
+		template<typename T>
+		inline void f(const T* a, const T* b, T* out, std::size_t n) {
+			Kernel<T>::f(a, b, out, n);
+		}
+
+		template<std::size_t N, typename T>
+		inline void f(const T* a, const T* b, T* out) {
+			Kernel<T>::f(a, b, out, N);
+		}
+
+		template<typename T>
+		inline void g(const T* a, const T* b, const uint8_t* u, T* out,
+		              std::size_t n) {
+			Kernel<T>::g(a, b, u, out, n);
+		}
+
+		template<std::size_t N, typename T>
+		inline void g(const T* a, const T* b, const uint8_t* u, T* out) {
+			Kernel<T>::g(a, b, u, out, N);
+		}
+
+		inline void combine(const uint8_t* u, const uint8_t* v, uint8_t* out,
+		                    std::size_t n) {
+
+			std::size_t i = 0;
+
+#ifdef FI_SIMD_SSE2
+			for (; i + 16 <= n; i += 16) {
+				const Simd::vec x = Simd::load(u + i);
+				const Simd::vec y = Simd::load(v + i);
+				Simd::store(out + i, _mm_xor_si128(x, y));
+				Simd::store(out + n + i, y);
+			}
+#endif
+
+			for (; i < n; ++i) {
+				const uint8_t y = v[i];
+				out[i] = static_cast<uint8_t>(u[i] ^ y);
+				out[n + i] = y;
+			}
+
+		}
+
+		template<std::size_t N>
+		inline void combine(const uint8_t* u, const uint8_t* v, uint8_t* out) {
+			combine(u, v, out, N);
+		}
+
+		template<typename T>
+		void decide(const T* x, uint8_t* u, std::size_t n) {
+			for (std::size_t i = 0; i < n; ++i) {
+				u[i] = (rawValue(x[i]) < 0) ? 1 : 0;
+			}
+		}
+
+	}
+
+}
+
+#endif
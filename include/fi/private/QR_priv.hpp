@@ -0,0 +1,481 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_QR_PRIV_HPP
+#define PRIVATE_FI_QR_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Cells of a Fi::QR on 64-bit raw values.
+	 */
+	template<typename BoundaryT, typename InternalT, std::size_t N>
+	struct QRScalar {
+
+		typedef CordicTypes<BoundaryT, N, BoundaryT> BoundaryTypes;
+		typedef CordicTypes<InternalT, N, InternalT> InternalTypes;
+
+		///\internal \brief Input \c j of a row, converted to a raw value
+		///of the cell of the first row that receives it.
+		template<typename InT>
+		static int64_t input(const InT& v, std::size_t j) {
+			static const std::size_t F = InT::FRACTION_LENGTH;
+			return (j == 0) ?
+				static_cast<int64_t>(
+					Requantize<BoundaryT, F>::raw(rawValue(v))) :
+				static_cast<int64_t>(
+					Requantize<InternalT, F>::raw(rawValue(v)));
+		}
+
+		///\internal \brief Gain compensation and overflow handling of a
+		///cell output.
+		template<typename CellT>
+		static int64_t output(int64_t v) {
+			typedef CordicTypes<CellT, N, CellT> Types;
+			return static_cast<int64_t>(Requantize<CellT, Types::F>::raw(
+				(v*Types::K_MAG) >> Types::KF));
+		}
+
+		///\internal \brief A diagonal cell converted to InternalT.
+		static InternalT diagonal(int64_t v) {
+			return InternalT::fromBinary(Requantize<InternalT,
+				BoundaryT::FRACTION_LENGTH>::raw(v));
+		}
+
+		/**\internal
+		 *\brief Feed a row \c x of \c cols values into an array of \c n
+		 *rows, whose cells \c r are stored row by row. \c x is
+		 *overwritten. Each value is in the format of the cell it enters
+		 *next: \c x[0] and the diagonal in BoundaryT, the others in
+		 *InternalT.
+		 */
+		static void update(int64_t* r, int64_t* x, std::size_t n,
+		                   std::size_t cols) {
+
+			for (std::size_t i = 0; i < n; ++i) {
+
+				int64_t* ri = r + i*cols;
+
+				//Boundary cell: vectoring, recording the directions.
+				uint64_t d = 0;
+				int64_t u = ri[i];
+				int64_t v = x[i];
+
+				for (std::size_t k = 0; k < N; ++k) {
+					const int64_t us = u >> k;
+					const int64_t vs = v >> k;
+					if (v < 0) {
+						u -= vs;
+						v += us;
+						d |= uint64_t(1) << k;
+					}
+					else {
+						u += vs;
+						v -= us;
+					}
+				}
+
+				ri[i] = output<BoundaryT>(u);
+
+				//Internal cells: the same rotation.
+				for (std::size_t j = i + 1; j < cols; ++j) {
+
+					u = ri[j];
+					v = x[j];
+
+					for (std::size_t k = 0; k < N; ++k) {
+						const int64_t us = u >> k;
+						const int64_t vs = v >> k;
+						if ((d >> k) & 1) {
+							u -= vs;
+							v += us;
+						}
+						else {
+							u += vs;
+							v -= us;
+						}
+					}
+
+					ri[j] = output<InternalT>(u);
+					x[j] = output<InternalT>(v);
+
+				}
+
+				//The next boundary cell receives x[i + 1].
+				if (i + 1 < n) {
+					x[i + 1] = static_cast<int64_t>(Requantize<BoundaryT,
+						InternalT::FRACTION_LENGTH>::raw(x[i + 1]));
+				}
+
+			}
+
+		}
+
+	};
+
+
+	namespace Simd {
+
+#ifdef FI_SIMD_SSE2
+
+		/**\internal
+		 *\brief Cells of a Fi::QR of a single type on four 32-bit lanes,
+		 *with the same results as Fi::QRScalar.
+		 */
+		template<typename CellT, std::size_t N>
+		struct QRVector {
+
+			typedef CordicTypes<CellT, N, CellT> Types;
+			typedef VecOverflow<typename CellT::OFH> Overflow;
+
+			/**\internal
+			 *\brief Gain compensation: the products are formed on the
+			 *magnitudes, and rounded up for negative lanes so that the
+			 *result is truncated towards minus infinity.
+			 *\return \c false if the overflow handler has to be applied by
+			 *the scalar code.
+			 */
+			static bool output(vec& v) {
+
+				static const int KF = static_cast<int>(Types::KF);
+				const int up = static_cast<int>((int64_t(1) << KF) - 1);
+
+				const vec k = Lanes32::set1(Types::K_MAG);
+				const vec low = _mm_set_epi32(0, -1, 0, -1);
+				const vec round = _mm_set_epi32(0, up, 0, up);
+
+				const vec neg = Lanes32::cmplt(v, zero());
+				const vec a = CordicVector::negate(v, neg);
+
+				vec even = _mm_mul_epu32(a, k);
+				vec odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), k);
+				even = _mm_add_epi64(even, _mm_and_si128(round,
+					_mm_shuffle_epi32(neg, _MM_SHUFFLE(2, 2, 0, 0))));
+				odd = _mm_add_epi64(odd, _mm_and_si128(round,
+					_mm_shuffle_epi32(neg, _MM_SHUFFLE(3, 3, 1, 1))));
+
+				vec r = _mm_or_si128(
+					_mm_and_si128(_mm_srli_epi64(even, KF), low),
+					_mm_slli_epi64(_mm_srli_epi64(odd, KF), 32));
+				r = CordicVector::negate(r, neg);
+
+				if (!Overflow::template apply<Lanes32>(r)) {
+					return false;
+				}
+				v = r;
+				return true;
+
+			}
+
+			///\internal \sa Fi::QRScalar::update()
+			static bool update(vec* r, vec* x, std::size_t n,
+			                   std::size_t cols) {
+
+				bool ok = true;
+
+				for (std::size_t i = 0; i < n; ++i) {
+
+					vec* ri = r + i*cols;
+
+					//d[k] is set in the lanes that rotate clockwise.
+					vec d[N];
+					vec u = ri[i];
+					vec v = x[i];
+
+					for (std::size_t k = 0; k < N; ++k) {
+						const int s = static_cast<int>(k);
+						const vec us = Lanes32::srai(u, s);
+						const vec vs = Lanes32::srai(v, s);
+						d[k] = Lanes32::cmplt(v, zero());
+						u = Lanes32::add(u, CordicVector::negate(vs, d[k]));
+						v = Lanes32::sub(v, CordicVector::negate(us, d[k]));
+					}
+
+					ok = output(u) && ok;
+					ri[i] = u;
+
+					for (std::size_t j = i + 1; j < cols; ++j) {
+
+						u = ri[j];
+						v = x[j];
+
+						for (std::size_t k = 0; k < N; ++k) {
+							const int s = static_cast<int>(k);
+							const vec us = Lanes32::srai(u, s);
+							const vec vs = Lanes32::srai(v, s);
+							u = Lanes32::add(u, CordicVector::negate(vs, d[k]));
+							v = Lanes32::sub(v, CordicVector::negate(us, d[k]));
+						}
+
+						ok = output(u) && ok;
+						ok = output(v) && ok;
+						ri[j] = u;
+						x[j] = v;
+
+					}
+
+				}
+
+				return ok;
+
+			}
+
+		};
+
+#endif
+
+	}
+
+
+	/**\internal
+	 *\brief Whether the boundary and internal cells of a Fi::QR have the
+	 *same type, as the vector cells require.
+	 */
+	template<typename BoundaryT, typename InternalT>
+	struct QRSameCells {
+		static const bool value = false;
+	};
+
+	template<typename CellT>
+	struct QRSameCells<CellT, CellT> {
+		static const bool value = true;
+	};
+
+
+	/**\internal
+	 *\brief Batch decomposition of a Fi::QR: scalar.
+	 */
+	template<typename BoundaryT, typename InternalT, std::size_t N,
+	         bool VECTOR = QRSameCells<BoundaryT, InternalT>::value &&
+	                       Simd::CordicLanes<BoundaryT, BoundaryT>::AVAILABLE>
+	struct QRKernel {
+		template<std::size_t M, std::size_t R, std::size_t C, typename InT>
+		static std::size_t batch(const InT*, InternalT*, std::size_t) {
+			return 0;
+		}
+	};
+
+#ifdef FI_SIMD_SSE2
+
+	/**\internal
+	 *\brief Batch decomposition of a Fi::QR: four matrices per register.
+	 *Groups whose cells overflow a handler without a vector
+	 *implementation are left to the scalar code.
+	 *\return Number of matrices decomposed.
+	 */
+	template<typename CellT, std::size_t N>
+	struct QRKernel<CellT, CellT, N, true> {
+
+		template<std::size_t M, std::size_t R, std::size_t C, typename InT>
+		static std::size_t batch(const InT* a, CellT* r, std::size_t count) {
+
+			typedef QRScalar<CellT, CellT, N> Scalar;
+			typedef Simd::QRVector<CellT, N> Vector;
+
+			const std::size_t IN = M*C;
+			const std::size_t OUT = R*C;
+
+			std::size_t g = 0;
+			for (; g + 4 <= count; g += 4) {
+
+				const InT* in = a + g*IN;
+
+				Simd::vec cells[R*C];
+				Simd::vec x[C];
+				bool ok = true;
+
+				for (std::size_t e = 0; e < R*C; ++e) {
+					cells[e] = Simd::zero();
+				}
+
+				for (std::size_t i = 0; i < M && ok; ++i) {
+					for (std::size_t j = 0; j < C; ++j) {
+						const std::size_t e = i*C + j;
+						x[j] = _mm_set_epi32(
+							static_cast<int>(Scalar::input(in[3*IN + e], j)),
+							static_cast<int>(Scalar::input(in[2*IN + e], j)),
+							static_cast<int>(Scalar::input(in[IN + e], j)),
+							static_cast<int>(Scalar::input(in[e], j)));
+					}
+					ok = Vector::update(cells, x, R, C);
+				}
+
+				if (!ok) {
+					break;
+				}
+
+				for (std::size_t e = 0; e < R*C; ++e) {
+					int32_t t[4];
+					Simd::store(t, cells[e]);
+					for (std::size_t l = 0; l < 4; ++l) {
+						r[(g + l)*OUT + e] = CellT::fromBinary(t[l]);
+					}
+				}
+
+			}
+			return g;
+
+		}
+	};
+
+#endif
+
+
+	//QR
+
+	template<typename BoundaryT, std::size_t N, typename InternalT>
+	template<typename InT>
+	void QR<BoundaryT, N, InternalT>::decompose(const Matrix<InT>& a,
+	                                            Matrix<InternalT>& r) {
+
+		typedef QRScalar<BoundaryT, InternalT, N> Scalar;
+
+		const std::size_t n = a.cols();
+
+		std::vector<int64_t> cells(n*n, 0);
+		std::vector<int64_t> x(n);
+
+		for (std::size_t i = 0; i < a.rows() && n > 0; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				x[j] = Scalar::input(a(i, j), j);
+			}
+			Scalar::update(&cells[0], &x[0], n, n);
+		}
+
+		r.resize(n, n);
+
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				r(i, j) = (i == j) ? Scalar::diagonal(cells[i*n + j]) :
+					InternalT::fromBinary(cells[i*n + j]);
+			}
+		}
+
+	}
+
+	template<typename BoundaryT, std::size_t N, typename InternalT>
+	template<typename InT>
+	void QR<BoundaryT, N, InternalT>::decompose(const Matrix<InT>& a,
+	                                            const Matrix<InT>& b,
+	                                            Matrix<InternalT>& r,
+	                                            Matrix<InternalT>& qtb) {
+
+		typedef QRScalar<BoundaryT, InternalT, N> Scalar;
+
+		if (a.rows() != b.rows()) {
+			throw std::invalid_argument("QR: matrices do not have the same "
+			                            "number of rows");
+		}
+
+		const std::size_t n = a.cols();
+		const std::size_t p = b.cols();
+		const std::size_t cols = n + p;
+
+		std::vector<int64_t> cells(n*cols, 0);
+		std::vector<int64_t> x(cols);
+
+		for (std::size_t i = 0; i < a.rows() && n > 0; ++i) {
+			for (std::size_t j = 0; j < n; ++j) {
+				x[j] = Scalar::input(a(i, j), j);
+			}
+			for (std::size_t j = 0; j < p; ++j) {
+				x[n + j] = Scalar::input(b(i, j), n + j);
+			}
+			Scalar::update(&cells[0], &x[0], n, cols);
+		}
+
+		r.resize(n, n);
+		qtb.resize(n, p);
+
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = 0; j < cols; ++j) {
+				const InternalT v = (i == j) ?
+					Scalar::diagonal(cells[i*cols + j]) :
+					InternalT::fromBinary(cells[i*cols + j]);
+				if (j < n) {
+					r(i, j) = v;
+				}
+				else {
+					qtb(i, j - n) = v;
+				}
+			}
+		}
+
+	}
+
+	template<typename BoundaryT, std::size_t N, typename InternalT>
+	template<std::size_t M, std::size_t R, std::size_t C, typename InT>
+	void QR<BoundaryT, N, InternalT>::batch(const InT* a, InternalT* r,
+	                                        std::size_t count) {
+
+		typedef QRScalar<BoundaryT, InternalT, N> Scalar;
+		typedef char SizeCheck[(R >= 1 && R <= C) ? 1 : -1];
+		(void)sizeof(SizeCheck);
+
+		std::size_t g =
+			QRKernel<BoundaryT, InternalT, N>::template batch<M, R, C>(a, r,
+			                                                           count);
+
+		int64_t cells[R*C];
+		int64_t x[C];
+
+		for (; g < count; ++g) {
+
+			const InT* in = a + g*M*C;
+
+			for (std::size_t e = 0; e < R*C; ++e) {
+				cells[e] = 0;
+			}
+
+			for (std::size_t i = 0; i < M; ++i) {
+				for (std::size_t j = 0; j < C; ++j) {
+					x[j] = Scalar::input(in[i*C + j], j);
+				}
+				Scalar::update(cells, x, R, C);
+			}
+
+			for (std::size_t e = 0; e < R*C; ++e) {
+				r[g*R*C + e] = (e % C == e / C) ? Scalar::diagonal(cells[e]) :
+					InternalT::fromBinary(cells[e]);
+			}
+
+		}
+
+	}
+
+	template<typename BoundaryT, std::size_t N, typename InternalT>
+	template<std::size_t M, std::size_t R, typename InT>
+	void QR<BoundaryT, N, InternalT>::batch(const InT* a, InternalT* r,
+	                                        std::size_t count) {
+		batch<M, R, R>(a, r, count);
+	}
+
+}
+
+#endif
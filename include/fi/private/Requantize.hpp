@@ -0,0 +1,211 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_PRIVATE_REQUANTIZE_HPP
+#define FI_PRIVATE_REQUANTIZE_HPP
+
+#include "fi/Fixed.hpp"
+#include "fi/private/Bits.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <stdint.h>
+
+namespace Fi {
+
+	/**\internal
+	 *\brief Round away the \c SHIFT least significant bits of a 64-bit
+	 *signed intermediate result using rounding mode \c R.
+
+	 *The result is the same as that of rounding a product in
+	 *Fi::Fixed::operator*=() when \c SHIFT equals the number of fractional
+	 *bits of the type.
+
+	 *\tparam R Rounding mode.
+	 *\tparam SHIFT Number of bits to remove. Must be less than 63.
+	 */
+	template<template <typename> class R, std::size_t SHIFT>
+	struct RoundBits {
+		typedef char ShiftCheck[(SHIFT < 63) ? 1 : -1];
+		typedef Traits<63, 64, SHIFT, SIGNED> TR;
+
+		static int64_t apply(int64_t n) {
+			return R<TR>::round(n).first;
+		}
+	};
+
+	template<template <typename> class R>
+	struct RoundBits<R, 0> {
+		static int64_t apply(int64_t n) {
+			return n;
+		}
+	};
+
+
+	/**\internal
+	 *\brief Quantize a full-precision intermediate result to a
+	 *fixed-point type.
+
+	 *The intermediate is a 64-bit signed integer with \c SRC_F fractional
+	 *bits, e.g. the exact sum of several products. Excess fractional bits
+	 *are removed once using the rounding mode of the destination, then the
+	 *overflow handler of the destination is applied. When \c SRC_F is less
+	 *than the fractional length of the destination, the value is shifted
+	 *without rounding.
+
+	 *\tparam DstT Destination Fi::Fixed type.
+	 *\tparam SRC_F Number of fractional bits in the intermediate.
+	 */
+	template<typename DstT, std::size_t SRC_F,
+	         bool DOWN = (SRC_F >= DstT::FRACTION_LENGTH)>
+	struct Requantize;
+
+	/**\internal
+	 *\brief The overflow handler \c OF applied to a value just outside
+	 *the range of \c TR, above it if \c positive and below it otherwise.
+	 */
+	template<typename TR, template <typename> class OF>
+	inline typename TR::valtype outOfRange(bool positive) {
+		typedef typename TR::valtype vt;
+		return positive ? OF<TR>::positiveOverflow(vt(TR::MAX_VAL + 1)) :
+			OF<TR>::negativeOverflow(vt(TR::MIN_VAL - 1));
+	}
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R,
+	         std::size_t SRC_F>
+	struct Requantize<Fixed<W, F, S, OF, R>, SRC_F, true> {
+
+		typedef Fixed<W, F, S, OF, R> DstT;
+		typedef Traits<W, 64, F, S> TR;
+
+		///\internal \brief Quantize and return the raw sign-extended value.
+		static typename DstT::valtype raw(int64_t n) {
+
+			typedef typename TR::valtype vt;
+
+			vt r = static_cast<vt>(RoundBits<R, SRC_F - F>::apply(n));
+			r = OverflowDetector<TR, OF>::fromFixedPoint(r);
+
+			return static_cast<typename DstT::valtype>(r);
+
+		}
+
+		///\internal \brief Quantize to the destination type.
+		static DstT apply(int64_t n) {
+			return DstT::fromBinary(raw(n));
+		}
+
+		/**\internal
+		 *\brief Apply the overflow handler of the destination to a value
+		 *too large to be represented in 64 bits.
+		 */
+		static DstT overflow(bool positive) {
+			return DstT::fromBinary(outOfRange<TR, OF>(positive));
+		}
+
+	};
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class OF,
+	         template <typename> class R,
+	         std::size_t SRC_F>
+	struct Requantize<Fixed<W, F, S, OF, R>, SRC_F, false> {
+
+		typedef Fixed<W, F, S, OF, R> DstT;
+		typedef Traits<W, 64, F, S> TR;
+
+		static typename DstT::valtype raw(int64_t n) {
+
+			typedef typename TR::valtype vt;
+
+			vt r = static_cast<vt>(n * (int64_t(1) << (F - SRC_F)));
+			r = OverflowDetector<TR, OF>::fromFixedPoint(r);
+
+			return static_cast<typename DstT::valtype>(r);
+
+		}
+
+		static DstT apply(int64_t n) {
+			return DstT::fromBinary(raw(n));
+		}
+
+		static DstT overflow(bool positive) {
+			return DstT::fromBinary(outOfRange<TR, OF>(positive));
+		}
+
+	};
+
+
+	/**\internal
+	 *\brief The raw value of a fixed-point number, sign-extended to
+	 *64 bits.
+	 */
+	template<typename FixedT>
+	inline int64_t rawValue(const FixedT& x) {
+		return static_cast<int64_t>(x.toBinary(true));
+	}
+
+	/**\internal
+	 *\brief The largest magnitude of the raw value of a fixed-point type.
+	 */
+	template<typename FixedT>
+	inline double rawMagnitude() {
+		const int w = static_cast<int>(FixedT::WORD_LENGTH);
+		return (FixedT::SIGNEDNESS == SIGNED)
+			? std::ldexp(1.0, w - 1)
+			: std::ldexp(1.0, w) - 1;
+	}
+
+	/**\internal
+	 *\brief Quantize <tt>n*2^k</tt>, where \c n has \c SRC_F fractional
+	 *bits, to a fixed-point type.
+
+	 *Bits shifted out to the right are folded into the least significant
+	 *bit, so that the destination rounds the exact value as long as
+	 *\c SRC_F exceeds its fractional length by at least two. When
+	 *<tt>n*2^k</tt> does not fit in 64 bits, the overflow handler of the
+	 *destination is applied instead.
+	 */
+	template<typename DstT, std::size_t SRC_F>
+	DstT requantizeScaled(int64_t n, int k) {
+
+		if (k >= 0) {
+			const int s = (k < 63) ? k : 63;
+			const int64_t max = static_cast<int64_t>((~uint64_t(0) >> 1) >> s);
+			if (n > max || n < -max - 1 || (k > 63 && n != 0)) {
+				return Requantize<DstT, SRC_F>::overflow(n > 0);
+			}
+			n = static_cast<int64_t>(static_cast<uint64_t>(n) << s);
+		}
+		else {
+			const int s = (k > -62) ? -k : 62;
+			const int64_t lost = n & ((int64_t(1) << s) - 1);
+			n = (n >> s) | ((lost != 0) ? 1 : 0);
+		}
+		return Requantize<DstT, SRC_F>::apply(n);
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,752 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_PRIVATE_SIMD_HPP
+#define FI_PRIVATE_SIMD_HPP
+
+#include "fi/Fixed.hpp"
+#include "fi/overflow/Sticky.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+
+//Vector code is enabled by the instruction sets the compiler targets,
+//e.g. -msse4.1 or -mavx2. Define FI_NO_SIMD to use scalar code only.
+#if !defined(FI_NO_SIMD) && defined(__SSE2__)
+#define FI_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(FI_SIMD_SSE2) && defined(__SSE4_1__)
+#define FI_SIMD_SSE41
+#include <smmintrin.h>
+#endif
+
+#if defined(FI_SIMD_SSE41) && defined(__AVX2__)
+#define FI_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+namespace Fi {
+
+	template <typename T> struct Saturate;
+	template <typename T> struct Wrap;
+	template <typename T> struct Undefined;
+
+	template <typename T> struct Fix;
+	template <typename T> struct Floor;
+	template <typename T> struct Ceil;
+	template <typename T> struct Classic;
+	template <typename T> struct NearEven;
+	template <typename T> struct NearOdd;
+
+	/**\internal
+	 *\brief Vector kernels operating on arrays of fixed-point numbers.
+
+	 *A Fi::Fixed object holds nothing but its raw value, so an array of
+	 *them can be processed as an array of its underlying type. Vector
+	 *code produces the same bits as the scalar operators: overflow
+	 *handlers and rounding modes without a vector implementation fall
+	 *back to the scalar operators for the affected elements.
+	 */
+	namespace Simd {
+
+		/**\internal
+		 *\brief The raw values of an array of fixed-point numbers.
+		 */
+		template<typename FixedT>
+		inline typename FixedT::valtype* raw(FixedT* p) {
+			typedef char SizeCheck[(sizeof(FixedT) ==
+			                        sizeof(typename FixedT::valtype)) ? 1 : -1];
+			(void)sizeof(SizeCheck);
+			return reinterpret_cast<typename FixedT::valtype*>(p);
+		}
+
+		template<typename FixedT>
+		inline const typename FixedT::valtype* raw(const FixedT* p) {
+			return raw(const_cast<FixedT*>(p));
+		}
+
+		/**\internal
+		 *\brief Vector operations on lanes of type \c V.
+
+		 *\c COUNT is the number of lanes in a register, or 1 if there is
+		 *no vector implementation for \c V.
+		 */
+		template<typename V>
+		struct Lanes {
+			static const std::size_t COUNT = 1;
+		};
+
+#ifdef FI_SIMD_SSE2
+
+		typedef __m128i vec;
+
+		inline vec load(const void* p) {
+			return _mm_loadu_si128(static_cast<const vec*>(p));
+		}
+
+		inline void store(void* p, vec v) {
+			_mm_storeu_si128(static_cast<vec*>(p), v);
+		}
+
+		inline vec zero() {
+			return _mm_setzero_si128();
+		}
+
+		///\internal \brief Lanes of \c a where \c mask is set, \c b elsewhere.
+		inline vec select(vec mask, vec a, vec b) {
+			return _mm_or_si128(_mm_and_si128(mask, a),
+			                    _mm_andnot_si128(mask, b));
+		}
+
+		///\internal \brief \c true if any bit of \c mask is set.
+		inline bool any(vec mask) {
+			return _mm_movemask_epi8(mask) != 0;
+		}
+
+		struct Lanes16 {
+
+			static const std::size_t COUNT = 8;
+			static const int BITS = 16;
+
+			static vec set1(int64_t x) {
+				return _mm_set1_epi16(static_cast<short>(x));
+			}
+			static vec add(vec a, vec b) { return _mm_add_epi16(a, b); }
+			static vec sub(vec a, vec b) { return _mm_sub_epi16(a, b); }
+			static vec mullo(vec a, vec b) { return _mm_mullo_epi16(a, b); }
+			static vec cmpgt(vec a, vec b) { return _mm_cmpgt_epi16(a, b); }
+			static vec cmplt(vec a, vec b) { return _mm_cmplt_epi16(a, b); }
+			static vec cmpeq(vec a, vec b) { return _mm_cmpeq_epi16(a, b); }
+			static vec srai(vec a, int n) { return _mm_srai_epi16(a, n); }
+			static vec srli(vec a, int n) { return _mm_srli_epi16(a, n); }
+			static vec slli(vec a, int n) { return _mm_slli_epi16(a, n); }
+			static vec min(vec a, vec b) { return _mm_min_epi16(a, b); }
+			static vec max(vec a, vec b) { return _mm_max_epi16(a, b); }
+			static vec adds(vec a, vec b) { return _mm_adds_epi16(a, b); }
+			static vec subs(vec a, vec b) { return _mm_subs_epi16(a, b); }
+
+			///\internal \brief All bits set in odd lanes.
+			static vec odd() { return _mm_set1_epi32(~0xFFFF); }
+
+		};
+
+		struct Lanes32 {
+
+			static const std::size_t COUNT = 4;
+			static const int BITS = 32;
+
+			static vec set1(int64_t x) {
+				return _mm_set1_epi32(static_cast<int>(x));
+			}
+			static vec add(vec a, vec b) { return _mm_add_epi32(a, b); }
+			static vec sub(vec a, vec b) { return _mm_sub_epi32(a, b); }
+			static vec cmpgt(vec a, vec b) { return _mm_cmpgt_epi32(a, b); }
+			static vec cmplt(vec a, vec b) { return _mm_cmplt_epi32(a, b); }
+			static vec cmpeq(vec a, vec b) { return _mm_cmpeq_epi32(a, b); }
+			static vec srai(vec a, int n) { return _mm_srai_epi32(a, n); }
+			static vec srli(vec a, int n) { return _mm_srli_epi32(a, n); }
+			static vec slli(vec a, int n) { return _mm_slli_epi32(a, n); }
+
+#ifdef FI_SIMD_SSE41
+			static vec mullo(vec a, vec b) { return _mm_mullo_epi32(a, b); }
+			static vec min(vec a, vec b) { return _mm_min_epi32(a, b); }
+			static vec max(vec a, vec b) { return _mm_max_epi32(a, b); }
+#else
+			//The low 32 bits of a product do not depend on signedness.
+			static vec mullo(vec a, vec b) {
+				vec even = _mm_mul_epu32(a, b);
+				vec odd = _mm_mul_epu32(_mm_srli_si128(a, 4),
+				                        _mm_srli_si128(b, 4));
+				return _mm_unpacklo_epi32(
+					_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+					_mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+			}
+			static vec min(vec a, vec b) { return select(cmplt(a, b), a, b); }
+			static vec max(vec a, vec b) { return select(cmpgt(a, b), a, b); }
+#endif
+
+			static vec odd() { return _mm_set_epi32(-1, 0, -1, 0); }
+
+		};
+
+		/**\internal
+		 *\brief Load eight signed values of at most 16 bits into 16-bit
+		 *lanes.
+		 */
+		inline vec load16(const int16_t* p) {
+			return load(p);
+		}
+
+		inline vec load16(const int32_t* p) {
+			return _mm_packs_epi32(load(p), load(p + 4));
+		}
+
+		/**\internal
+		 *\brief Store eight 16-bit lanes holding values that fit the
+		 *destination type.
+		 */
+		inline void store16(int16_t* p, vec v) {
+			store(p, v);
+		}
+
+		inline void store16(int32_t* p, vec v) {
+			store(p, _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+			store(p + 4, _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+		}
+
+		/**\internal
+		 *\brief Store two registers of 32-bit lanes holding values that fit
+		 *the destination type.
+		 */
+		inline void store32(int16_t* p, vec lo, vec hi) {
+			store(p, _mm_packs_epi32(lo, hi));
+		}
+
+		inline void store32(int32_t* p, vec lo, vec hi) {
+			store(p, lo);
+			store(p + 4, hi);
+		}
+
+		/**\internal
+		 *\brief Load four signed values of at most 32 bits into 32-bit
+		 *lanes.
+		 */
+		inline vec load4(const int8_t* p) {
+			return _mm_set_epi32(p[3], p[2], p[1], p[0]);
+		}
+
+		inline vec load4(const int16_t* p) {
+			vec v = _mm_loadl_epi64(reinterpret_cast<const vec*>(p));
+			return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+		}
+
+		inline vec load4(const int32_t* p) {
+			return load(p);
+		}
+
+		inline vec load4(const int64_t* p) {
+			return _mm_set_epi32(static_cast<int>(p[3]), static_cast<int>(p[2]),
+			                     static_cast<int>(p[1]), static_cast<int>(p[0]));
+		}
+
+		/**\internal
+		 *\brief Store four 32-bit lanes holding values that fit the
+		 *destination type.
+		 */
+		inline void store4(int8_t* p, vec v) {
+			int32_t t[4];
+			store(t, v);
+			for (std::size_t i = 0; i < 4; ++i) {
+				p[i] = static_cast<int8_t>(t[i]);
+			}
+		}
+
+		inline void store4(int16_t* p, vec v) {
+			_mm_storel_epi64(reinterpret_cast<vec*>(p), _mm_packs_epi32(v, v));
+		}
+
+		inline void store4(int32_t* p, vec v) {
+			store(p, v);
+		}
+
+		inline void store4(int64_t* p, vec v) {
+			int32_t t[4];
+			store(t, v);
+			for (std::size_t i = 0; i < 4; ++i) {
+				p[i] = t[i];
+			}
+		}
+
+		///\internal \brief Swap adjacent 16-bit lanes.
+		inline vec swapPairs16(vec v) {
+			v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+			return _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+		}
+
+		///\internal \brief Swap adjacent 32-bit lanes.
+		inline vec swapPairs32(vec v) {
+			return _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+		}
+
+		///\internal \brief Sign-extend the low four 16-bit lanes to 32 bits.
+		inline vec widenLo16(vec v) {
+			return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+		}
+
+		///\internal \brief Sign-extend the high four 16-bit lanes to 32 bits.
+		inline vec widenHi16(vec v) {
+			return _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+		}
+
+		///\internal \brief Number of 16-bit values handled by dot16() at once.
+#ifdef FI_SIMD_AVX2
+		static const std::size_t DOT16_BLOCK = 16;
+#else
+		static const std::size_t DOT16_BLOCK = 8;
+#endif
+
+		/**\internal
+		 *\brief Sum of the products of two arrays of 16-bit values.
+
+		 *\c n must be a multiple of \c DOT16_BLOCK, and the sum of the
+		 *magnitudes of the products must fit 31 bits so that no partial
+		 *sum overflows.
+		 */
+		inline int64_t dot16(const int16_t* a, const int16_t* b,
+		                     std::size_t n) {
+
+#ifdef FI_SIMD_AVX2
+			__m256i acc = _mm256_setzero_si256();
+
+			for (std::size_t i = 0; i < n; i += DOT16_BLOCK) {
+				__m256i x = _mm256_loadu_si256(
+					reinterpret_cast<const __m256i*>(a + i));
+				__m256i y = _mm256_loadu_si256(
+					reinterpret_cast<const __m256i*>(b + i));
+				acc = _mm256_add_epi32(acc, _mm256_madd_epi16(x, y));
+			}
+
+			vec sum = _mm_add_epi32(_mm256_castsi256_si128(acc),
+			                        _mm256_extracti128_si256(acc, 1));
+#else
+			vec sum = zero();
+
+			for (std::size_t i = 0; i < n; i += DOT16_BLOCK) {
+				sum = _mm_add_epi32(sum, _mm_madd_epi16(load(a + i), load(b + i)));
+			}
+#endif
+
+			sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+			sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+
+			return _mm_cvtsi128_si32(sum);
+
+		}
+
+		/**\internal
+		 *\brief Sums of the products of one array of 16-bit values with
+		 *four others, <tt>b</tt>, <tt>b + stride</tt>, ..., stored in
+		 *\c sums. Same requirements as dot16().
+		 */
+		inline void dot16x4(const int16_t* a, const int16_t* b,
+		                    std::size_t stride, std::size_t n,
+		                    int32_t* sums) {
+
+			const int16_t* b0 = b;
+			const int16_t* b1 = b + stride;
+			const int16_t* b2 = b + 2*stride;
+			const int16_t* b3 = b + 3*stride;
+
+#ifdef FI_SIMD_AVX2
+			__m256i acc0 = _mm256_setzero_si256();
+			__m256i acc1 = _mm256_setzero_si256();
+			__m256i acc2 = _mm256_setzero_si256();
+			__m256i acc3 = _mm256_setzero_si256();
+
+			for (std::size_t i = 0; i < n; i += DOT16_BLOCK) {
+				__m256i x = _mm256_loadu_si256(
+					reinterpret_cast<const __m256i*>(a + i));
+				acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(x,
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b0 + i))));
+				acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(x,
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b1 + i))));
+				acc2 = _mm256_add_epi32(acc2, _mm256_madd_epi16(x,
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b2 + i))));
+				acc3 = _mm256_add_epi32(acc3, _mm256_madd_epi16(x,
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(b3 + i))));
+			}
+
+			vec s0 = _mm_add_epi32(_mm256_castsi256_si128(acc0),
+			                       _mm256_extracti128_si256(acc0, 1));
+			vec s1 = _mm_add_epi32(_mm256_castsi256_si128(acc1),
+			                       _mm256_extracti128_si256(acc1, 1));
+			vec s2 = _mm_add_epi32(_mm256_castsi256_si128(acc2),
+			                       _mm256_extracti128_si256(acc2, 1));
+			vec s3 = _mm_add_epi32(_mm256_castsi256_si128(acc3),
+			                       _mm256_extracti128_si256(acc3, 1));
+#else
+			vec s0 = zero(), s1 = zero(), s2 = zero(), s3 = zero();
+
+			for (std::size_t i = 0; i < n; i += DOT16_BLOCK) {
+				vec x = load(a + i);
+				s0 = _mm_add_epi32(s0, _mm_madd_epi16(x, load(b0 + i)));
+				s1 = _mm_add_epi32(s1, _mm_madd_epi16(x, load(b1 + i)));
+				s2 = _mm_add_epi32(s2, _mm_madd_epi16(x, load(b2 + i)));
+				s3 = _mm_add_epi32(s3, _mm_madd_epi16(x, load(b3 + i)));
+			}
+#endif
+
+			//Transpose and add: lane j of the result is the sum of sj.
+			vec s01 = _mm_add_epi32(_mm_unpacklo_epi32(s0, s1),
+			                        _mm_unpackhi_epi32(s0, s1));
+			vec s23 = _mm_add_epi32(_mm_unpacklo_epi32(s2, s3),
+			                        _mm_unpackhi_epi32(s2, s3));
+
+			store(sums, _mm_add_epi32(_mm_unpacklo_epi64(s01, s23),
+			                          _mm_unpackhi_epi64(s01, s23)));
+
+		}
+
+		template<> struct Lanes<int16_t> : public Lanes16 { };
+		template<> struct Lanes<uint16_t> : public Lanes16 { };
+		template<> struct Lanes<int32_t> : public Lanes32 { };
+		template<> struct Lanes<uint32_t> : public Lanes32 { };
+
+
+		/**\internal
+		 *\brief Apply an overflow handler to a register of raw values.
+
+		 *\tparam OFH Overflow detector, Fi::Fixed::OFH.
+		 *\tparam L Lane type of the register, which may be wider than the
+		 *underlying type of the fixed-point number.
+		 *\return \c false if the handler has no vector implementation and a
+		 *lane overflowed; the register is then left unchanged and the
+		 *caller must use the scalar operators.
+		 */
+		template<typename OFH>
+		struct VecOverflow;
+
+		template<typename TR, template <typename> class OF>
+		struct VecOverflow< OverflowDetector<TR, OF> > {
+			template<typename L>
+			static bool apply(vec& v) {
+				vec out = _mm_or_si128(L::cmpgt(v, L::set1(TR::MAX_VAL)),
+				                       L::cmplt(v, L::set1(TR::MIN_VAL)));
+				return !any(out);
+			}
+		};
+
+		template<typename TR>
+		struct VecOverflow< OverflowDetector<TR, Saturate> > {
+			template<typename L>
+			static bool apply(vec& v) {
+				v = L::min(L::max(v, L::set1(TR::MIN_VAL)), L::set1(TR::MAX_VAL));
+				return true;
+			}
+		};
+
+		template<typename TR>
+		struct VecOverflow< OverflowDetector<TR, Wrap> > {
+			template<typename L>
+			static bool apply(vec& v) {
+				const int s = L::BITS - static_cast<int>(TR::WORD_LENGTH);
+				if (TR::SIGNEDNESS == SIGNED) {
+					v = L::srai(L::slli(v, s), s);
+				}
+				else {
+					v = _mm_and_si128(v, L::set1(TR::T_MASK));
+				}
+				return true;
+			}
+		};
+
+		template<typename TR>
+		struct VecOverflow< OverflowDetector<TR, Undefined> > {
+			template<typename L>
+			static bool apply(vec& /*v*/) {
+				return true;
+			}
+		};
+
+		///\internal \brief Overflow flags raised by the lanes of \c v.
+		template<typename TR, typename L>
+		inline unsigned laneOverflow(vec v) {
+			return (any(L::cmpgt(v, L::set1(TR::MAX_VAL))) ? POSITIVE_OVERFLOW : 0)
+				| (any(L::cmplt(v, L::set1(TR::MIN_VAL))) ? NEGATIVE_OVERFLOW : 0);
+		}
+
+		template<typename TR>
+		struct VecOverflow< OverflowDetector<TR, StickySaturate> > {
+			template<typename L>
+			static bool apply(vec& v) {
+				overflowStatus() |= laneOverflow<TR, L>(v);
+				return VecOverflow< OverflowDetector<TR, Saturate> >::
+					template apply<L>(v);
+			}
+		};
+
+		template<typename TR>
+		struct VecOverflow< OverflowDetector<TR, StickyWrap> > {
+			template<typename L>
+			static bool apply(vec& v) {
+				overflowStatus() |= laneOverflow<TR, L>(v);
+				return VecOverflow< OverflowDetector<TR, Wrap> >::
+					template apply<L>(v);
+			}
+		};
+
+
+		/**\internal
+		 *\brief Remove the \c k least significant bits of each lane using
+		 *the rounding mode of a rounding handler.
+
+		 *Lanes are signed and \c k must be between 1 and the lane width
+		 *minus 2. \c AVAILABLE is \c false for rounding handlers without
+		 *a vector implementation.
+
+		 *\tparam RH Rounding handler, Fi::Fixed::RH.
+		 */
+		template<typename RH>
+		struct VecRound {
+			static const bool AVAILABLE = false;
+		};
+
+		///\internal \brief Fractional bits and the value of one half.
+		template<typename L>
+		struct RoundParts {
+			vec floor;
+			vec frac;
+			vec half;
+
+			RoundParts(vec n, int k)
+				: floor(L::srai(n, k)),
+				  frac(_mm_and_si128(n, L::set1((int64_t(1) << k) - 1))),
+				  half(L::set1(int64_t(1) << (k - 1)))
+			{ }
+
+			///\internal \brief Add one where \c mask is set.
+			vec increment(vec mask) const {
+				return L::sub(floor, mask);
+			}
+		};
+
+		template<typename TR>
+		struct VecRound< Floor<TR> > {
+			static const bool AVAILABLE = true;
+			template<typename L>
+			static vec apply(vec n, int k) {
+				return L::srai(n, k);
+			}
+		};
+
+		template<typename TR>
+		struct VecRound< Ceil<TR> > {
+			static const bool AVAILABLE = true;
+			template<typename L>
+			static vec apply(vec n, int k) {
+				RoundParts<L> p(n, k);
+				return p.increment(L::cmpgt(p.frac, zero()));
+			}
+		};
+
+		template<typename TR>
+		struct VecRound< Fix<TR> > {
+			static const bool AVAILABLE = true;
+			template<typename L>
+			static vec apply(vec n, int k) {
+				RoundParts<L> p(n, k);
+				return p.increment(_mm_and_si128(L::cmplt(n, zero()),
+				                                 L::cmpgt(p.frac, zero())));
+			}
+		};
+
+		template<typename TR>
+		struct VecRound< Classic<TR> > {
+			static const bool AVAILABLE = true;
+			template<typename L>
+			static vec apply(vec n, int k) {
+				RoundParts<L> p(n, k);
+				vec tie = _mm_and_si128(L::cmpeq(p.frac, p.half),
+				                        L::cmpgt(n, zero()));
+				return p.increment(_mm_or_si128(L::cmpgt(p.frac, p.half), tie));
+			}
+		};
+
+		template<typename TR>
+		struct VecRound< NearEven<TR> > {
+			static const bool AVAILABLE = true;
+			template<typename L>
+			static vec apply(vec n, int k) {
+				RoundParts<L> p(n, k);
+				vec odd = L::cmpeq(_mm_and_si128(p.floor, L::set1(1)), L::set1(1));
+				vec tie = _mm_and_si128(L::cmpeq(p.frac, p.half), odd);
+				return p.increment(_mm_or_si128(L::cmpgt(p.frac, p.half), tie));
+			}
+		};
+
+		template<typename TR>
+		struct VecRound< NearOdd<TR> > {
+			static const bool AVAILABLE = true;
+			template<typename L>
+			static vec apply(vec n, int k) {
+				RoundParts<L> p(n, k);
+				vec even = L::cmpeq(_mm_and_si128(p.floor, L::set1(1)), zero());
+				vec tie = _mm_and_si128(L::cmpeq(p.frac, p.half), even);
+				return p.increment(_mm_or_si128(L::cmpgt(p.frac, p.half), tie));
+			}
+		};
+
+#endif
+
+
+		/**\internal
+		 *\brief Element-wise kernels. The vector path processes whole
+		 *registers and returns the number of elements it handled; the
+		 *caller finishes the remainder with the scalar operators.
+		 */
+		template<typename FixedT,
+		         std::size_t LANES = Lanes<typename FixedT::valtype>::COUNT>
+		struct Elementwise {
+
+#ifdef FI_SIMD_SSE2
+			typedef typename FixedT::valtype V;
+			typedef Lanes<V> L;
+			typedef VecOverflow<typename FixedT::OFH> VO;
+
+			static std::size_t add(const FixedT* a, const FixedT* b,
+			                       FixedT* out, std::size_t n) {
+
+				std::size_t i = 0;
+
+				for (; i + LANES <= n; i += LANES) {
+					vec v = L::add(load(raw(a + i)), load(raw(b + i)));
+					if (VO::template apply<L>(v)) {
+						store(raw(out + i), v);
+					}
+					else {
+						for (std::size_t j = i; j < i + LANES; ++j) {
+							out[j] = a[j] + b[j];
+						}
+					}
+				}
+
+				return i;
+
+			}
+
+			static std::size_t subtract(const FixedT* a, const FixedT* b,
+			                            FixedT* out, std::size_t n) {
+
+				std::size_t i = 0;
+
+				for (; i + LANES <= n; i += LANES) {
+					vec v = L::sub(load(raw(a + i)), load(raw(b + i)));
+					if (VO::template apply<L>(v)) {
+						store(raw(out + i), v);
+					}
+					else {
+						for (std::size_t j = i; j < i + LANES; ++j) {
+							out[j] = a[j] - b[j];
+						}
+					}
+				}
+
+				return i;
+
+			}
+
+			static std::size_t negate(const FixedT* a, FixedT* out,
+			                          std::size_t n) {
+
+				std::size_t i = 0;
+
+				for (; i + LANES <= n; i += LANES) {
+					vec v = L::sub(zero(), load(raw(a + i)));
+					if (VO::template apply<L>(v)) {
+						store(raw(out + i), v);
+					}
+					else {
+						for (std::size_t j = i; j < i + LANES; ++j) {
+							out[j] = -a[j];
+						}
+					}
+				}
+
+				return i;
+
+			}
+#endif
+
+		};
+
+		template<typename FixedT>
+		struct Elementwise<FixedT, 1> {
+
+			static std::size_t add(const FixedT*, const FixedT*,
+			                       FixedT*, std::size_t) {
+				return 0;
+			}
+
+			static std::size_t subtract(const FixedT*, const FixedT*,
+			                            FixedT*, std::size_t) {
+				return 0;
+			}
+
+			static std::size_t negate(const FixedT*, FixedT*, std::size_t) {
+				return 0;
+			}
+
+		};
+
+
+		/**\internal
+		 *\brief Element-wise sum of two arrays, identical to
+		 *<tt>out[i] = a[i] + b[i]</tt>.
+		 */
+		template<typename FixedT>
+		inline void add(const FixedT* a, const FixedT* b, FixedT* out,
+		                std::size_t n) {
+
+			std::size_t i = Elementwise<FixedT>::add(a, b, out, n);
+
+			for (; i < n; ++i) {
+				out[i] = a[i] + b[i];
+			}
+
+		}
+
+		/**\internal
+		 *\brief Element-wise difference of two arrays, identical to
+		 *<tt>out[i] = a[i] - b[i]</tt>.
+		 */
+		template<typename FixedT>
+		inline void subtract(const FixedT* a, const FixedT* b, FixedT* out,
+		                     std::size_t n) {
+
+			std::size_t i = Elementwise<FixedT>::subtract(a, b, out, n);
+
+			for (; i < n; ++i) {
+				out[i] = a[i] - b[i];
+			}
+
+		}
+
+		/**\internal
+		 *\brief Element-wise negation, identical to <tt>out[i] = -a[i]</tt>.
+		 */
+		template<typename FixedT>
+		inline void negate(const FixedT* a, FixedT* out, std::size_t n) {
+
+			std::size_t i = Elementwise<FixedT>::negate(a, out, n);
+
+			for (; i < n; ++i) {
+				out[i] = -a[i];
+			}
+
+		}
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,351 @@
+/*
+
+ *Copyright © 2011-2012 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_STATISTICS_PRIV_HPP
+#define PRIVATE_FI_STATISTICS_PRIV_HPP
+
+#include "fi/private/ThreadLocal.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <list>
+#include <map>
+#include <sstream>
+#include <utility>
+
+//The registry of the buffers is shared by all threads and must be locked.
+#if __cplusplus >= 201103L
+#include <mutex>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#define FI_STATISTICS_PTHREAD
+#elif defined(_WIN32)
+//Without the min and max macros, which break std::min and std::max.
+#ifndef NOMINMAX
+#define NOMINMAX
+#define FI_STATISTICS_NOMINMAX
+#endif
+#include <windows.h>
+#ifdef FI_STATISTICS_NOMINMAX
+#undef NOMINMAX
+#undef FI_STATISTICS_NOMINMAX
+#endif
+#define FI_STATISTICS_WIN32
+#else
+#error "fi/Statistics.hpp requires C++11, POSIX threads or Windows"
+#endif
+
+namespace Fi {
+
+	//Statistics
+
+	inline Statistics::Statistics()
+		: positiveOverflows(0), negativeOverflows(0), maxExcess(0),
+		  roundings(0), errorSum(0), squaredErrorSum(0), maxError(0)
+	{ }
+
+	inline double Statistics::meanError() const {
+		return (roundings == 0) ? 0.0 : errorSum/roundings;
+	}
+
+	inline double Statistics::rmsError() const {
+		return (roundings == 0) ? 0.0 : std::sqrt(squaredErrorSum/roundings);
+	}
+
+	inline void Statistics::merge(const Statistics& s) {
+		positiveOverflows += s.positiveOverflows;
+		negativeOverflows += s.negativeOverflows;
+		maxExcess = std::max(maxExcess, s.maxExcess);
+		roundings += s.roundings;
+		errorSum += s.errorSum;
+		squaredErrorSum += s.squaredErrorSum;
+		maxError = std::max(maxError, s.maxError);
+	}
+
+#ifdef FI_STATISTICS_PTHREAD
+	///\internal \brief A mutex defined in a header.
+	template<typename T>
+	struct StatisticsMutex {
+		static pthread_mutex_t value;
+	};
+
+	template<typename T>
+	pthread_mutex_t StatisticsMutex<T>::value = PTHREAD_MUTEX_INITIALIZER;
+#elif defined(FI_STATISTICS_WIN32)
+	///\internal \brief A lock defined in a header.
+	template<typename T>
+	struct StatisticsMutex {
+		static SRWLOCK value;
+	};
+
+	template<typename T>
+	SRWLOCK StatisticsMutex<T>::value = SRWLOCK_INIT;
+#endif
+
+	/**\internal
+	 *\brief The buffers of all threads, each a name and the records of
+	 *type \c Record counted under it by one thread. Buffers outlive their
+	 *threads, and a list keeps their addresses stable.
+	 */
+	template<typename Record>
+	class StatisticsRegistry {
+
+	public:
+
+		typedef std::list< std::pair<std::string, Record> > Buffers;
+
+		///\internal \brief Holds the lock of the registry.
+		class Lock {
+		public:
+#if __cplusplus >= 201103L
+			Lock() { mutex().lock(); }
+			~Lock() { mutex().unlock(); }
+		private:
+			static std::mutex& mutex() {
+				static std::mutex m;
+				return m;
+			}
+#elif defined(FI_STATISTICS_PTHREAD)
+			Lock() { pthread_mutex_lock(&StatisticsMutex<Record>::value); }
+			~Lock() { pthread_mutex_unlock(&StatisticsMutex<Record>::value); }
+#elif defined(FI_STATISTICS_WIN32)
+			Lock() {
+				AcquireSRWLockExclusive(&StatisticsMutex<Record>::value);
+			}
+			~Lock() {
+				ReleaseSRWLockExclusive(&StatisticsMutex<Record>::value);
+			}
+#endif
+		};
+
+		static Buffers& buffers() {
+			static Buffers b;
+			return b;
+		}
+
+		///\internal \brief A new buffer for the calling thread.
+		static Record* add(const std::string& name) {
+			Lock lock;
+			buffers().push_back(std::make_pair(name, Record()));
+			return &buffers().back().second;
+		}
+
+		///\internal \brief The buffers of all threads merged by name.
+		static std::map<std::string, Record> merged() {
+			Lock lock;
+			const Buffers& b = buffers();
+			std::map<std::string, Record> ret;
+			for (typename Buffers::const_iterator it = b.begin();
+			     it != b.end(); ++it) {
+				ret[it->first].merge(it->second);
+			}
+			return ret;
+		}
+
+		///\internal \brief Clear the buffers of all threads.
+		static void reset() {
+			Lock lock;
+			Buffers& b = buffers();
+			for (typename Buffers::iterator it = b.begin(); it != b.end(); ++it) {
+				it->second = Record();
+			}
+		}
+
+	};
+
+	/**\internal
+	 *\brief Name of the statistics of a tag, or of the format given by
+	 *the traits \c T for the \c void tag.
+	 */
+	template<typename Tag, typename T>
+	struct StatisticsName {
+		static std::string get() {
+			return Tag::name();
+		}
+	};
+
+	template<typename T>
+	struct StatisticsName<void, T> {
+		static std::string get() {
+			std::ostringstream os;
+			os << ((T::SIGNEDNESS == SIGNED) ? 's' : 'u')
+			   << T::WORD_LENGTH << '.' << T::FRACTION_LENGTH;
+			return os.str();
+		}
+	};
+
+	/**\internal
+	 *\brief The buffer of the calling thread for a tag and format.
+	 */
+	template<typename Tag, typename T, typename Record = Statistics>
+	struct StatisticsBuffer {
+		static Record& get() {
+			static FI_THREAD_LOCAL Record* s = 0;
+			if (s == 0) {
+				s = StatisticsRegistry<Record>::add(
+					StatisticsName<Tag, T>::get());
+			}
+			return *s;
+		}
+	};
+
+	template<typename Tag, template <typename> class OF>
+	template<typename T>
+	struct OverflowStatistics<Tag, OF>::Handler {
+
+		static const std::size_t WIDTH_MULT = OF<Info>::WIDTH_MULT;
+
+		/**\internal
+		 *\brief Record a positive overflow, then apply \c OF.
+		 */
+		template<typename V>
+		static V positiveOverflow(const V& n) {
+#ifndef FI_NO_STATISTICS
+			typedef typename T::SignedType st;
+			Statistics& s = StatisticsBuffer<Tag, T>::get();
+			++s.positiveOverflows;
+			s.maxExcess = std::max(s.maxExcess,
+				static_cast<double>(static_cast<st>(n))
+				- static_cast<double>(T::MAX_VAL));
+#endif
+			return OF<T>::positiveOverflow(n);
+		}
+
+		/**\internal
+		 *\brief Record a negative overflow, then apply \c OF.
+		 */
+		template<typename V>
+		static V negativeOverflow(const V& n) {
+#ifndef FI_NO_STATISTICS
+			typedef typename T::SignedType st;
+			Statistics& s = StatisticsBuffer<Tag, T>::get();
+			++s.negativeOverflows;
+			s.maxExcess = std::max(s.maxExcess,
+				static_cast<double>(T::MIN_VAL)
+				- static_cast<double>(static_cast<st>(n)));
+#endif
+			return OF<T>::negativeOverflow(n);
+		}
+
+	};
+
+	template<typename Tag, template <typename> class R>
+	template<typename T>
+	struct RoundingStatistics<Tag, R>::Handler {
+
+		/**\internal
+		 *\brief Record the error of the rounded value \c r of \c exact,
+		 *both in units of the least significant bit of the result.
+		 */
+		template<typename V>
+		static std::pair<V, int> record(double exact,
+		                                const std::pair<V, int>& r) {
+#ifndef FI_NO_STATISTICS
+			typedef typename T::SignedType st;
+			const double e =
+				static_cast<double>(static_cast<st>(r.first)) - exact;
+			Statistics& s = StatisticsBuffer<Tag, T>::get();
+			++s.roundings;
+			s.errorSum += e;
+			s.squaredErrorSum += e*e;
+			s.maxError = std::max(s.maxError, std::fabs(e));
+#else
+			(void)exact;
+#endif
+			return r;
+		}
+
+		/**\internal
+		 *\brief Apply \c R to \c n, which has <tt>T::FRACTION_LENGTH</tt>
+		 *bits more than the result, and record the error.
+		 */
+		template<typename V>
+		static std::pair<V, int> round(const V& n) {
+			typedef typename T::SignedType st;
+			const int f = static_cast<int>(T::FRACTION_LENGTH);
+			return record(std::ldexp(static_cast<double>(static_cast<st>(n)),
+			                         -f),
+			              R<T>::round(n));
+		}
+
+		/**\internal
+		 *\brief Apply \c R to the conversion of \c fl, and record the
+		 *error against \c fl.
+		 */
+		template<typename V>
+		static std::pair<V, int> round(double fl, const V& n) {
+			const int f = static_cast<int>(T::FRACTION_LENGTH);
+			return record(std::ldexp(fl, f), R<T>::round(fl, n));
+		}
+
+		/**\internal
+		 *\brief Apply \c R to the conversion of \c str, and record the
+		 *error against the nearest \c double to \c str.
+		 */
+		template<typename V>
+		static std::pair<V, int> round(const std::string& str, const V& n) {
+			const int f = static_cast<int>(T::FRACTION_LENGTH);
+			return record(std::ldexp(std::strtod(str.c_str(), 0), f),
+			              R<T>::round(str, n));
+		}
+
+	};
+
+	inline std::map<std::string, Statistics> statistics() {
+		return StatisticsRegistry<Statistics>::merged();
+	}
+
+	inline void resetStatistics() {
+		StatisticsRegistry<Statistics>::reset();
+	}
+
+	inline void reportStatistics(std::ostream& os) {
+
+		const std::map<std::string, Statistics> s = statistics();
+
+		os << std::left << std::setw(16) << "name" << std::right
+		   << std::setw(12) << "+overflow" << std::setw(12) << "-overflow"
+		   << std::setw(12) << "max excess" << std::setw(12) << "roundings"
+		   << std::setw(12) << "mean error" << std::setw(12) << "rms error"
+		   << std::setw(12) << "max error" << '\n';
+
+		for (std::map<std::string, Statistics>::const_iterator it = s.begin();
+		     it != s.end(); ++it) {
+			const Statistics& t = it->second;
+			os << std::left << std::setw(16) << it->first << std::right
+			   << std::setw(12) << t.positiveOverflows
+			   << std::setw(12) << t.negativeOverflows
+			   << std::setw(12) << t.maxExcess
+			   << std::setw(12) << t.roundings
+			   << std::setw(12) << t.meanError()
+			   << std::setw(12) << t.rmsError()
+			   << std::setw(12) << t.maxError << '\n';
+		}
+
+	}
+
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <string>
 #include <algorithm>
 #include <iostream>
+#include <cstddef>
 
 namespace Fi {
 
@@ -83,6 +84,74 @@ namespace Fi {
 		template<typename T>
 		std::string toString(const typename T::valtype& val);
 
+		/**
+		 *\internal
+		 *\brief Size of a character buffer large enough to hold the string
+		 *representation of any fixed-point number, including the terminating
+		 *null character.
+
+		 *\tparam T Traits of target fixed-point type.
+		 */
+		template<typename T>
+		struct BufferLength {
+			///\internal \brief Integer digits and sign.
+			static const std::size_t INTEGER =
+				(8*sizeof(typename T::valtype)*3)/10 + 3;
+			///\internal \brief Fractional digits.
+			static const std::size_t FRACTION =
+				(T::FRACTION_LENGTH > 0) ? T::FRACTION_LENGTH : 1;
+			///\internal \brief Total length, including the point and null.
+			static const std::size_t value = INTEGER + 1 + FRACTION + 1;
+		};
+
+		/**
+		 *\internal
+		 *\brief Write the integer part of a fixed-point number to a buffer.
+
+		 *\tparam T Traits of target fixed-point type.
+		 *\param val An integer representing a fixed-point number.
+		 *\param buffer Destination, must hold at least
+		 *BufferLength<T>::INTEGER characters.
+
+		 *\return Number of characters written. No null character is written.
+		 */
+		template<typename T>
+		std::size_t integerChars(const typename T::valtype& val, char* buffer);
+
+		/**
+		 *\internal
+		 *\brief Write the fractional part of a fixed-point number to a buffer.
+
+		 *\tparam T Traits of target fixed-point type.
+		 *\param val An integer representing a fixed-point number.
+		 *\param buffer Destination, must hold at least
+		 *BufferLength<T>::FRACTION characters.
+
+		 *\return Number of characters written. No null character is written.
+		 */
+		template<typename T>
+		std::size_t fractionalChars(const typename T::valtype& val, char* buffer);
+
+		/**
+		 *\internal
+		 *\brief Convert a fixed-point number to a null-terminated string
+		 *stored in a caller-provided buffer.
+
+		 *No memory is allocated. If the buffer is too small, the output is
+		 *truncated, but always null-terminated when \c size is not zero.
+
+		 *\tparam T Traits of target fixed-point type.
+		 *\param val An integer representing a fixed-point number.
+		 *\param buffer Destination buffer.
+		 *\param size Size of \c buffer in characters.
+
+		 *\return Length of the full string representation, excluding the
+		 *null character.
+		 */
+		template<typename T>
+		std::size_t toString(const typename T::valtype& val,
+		                     char* buffer, std::size_t size);
+
 		/**
 		 *\internal
 		 *\brief Convert a string to fixed-point number.
@@ -103,13 +172,13 @@ namespace Fi {
 
 
 	template<typename T>
-	inline std::string StringConversion::
-	integerString(const typename T::valtype& val) {
+	inline std::size_t StringConversion::
+	integerChars(const typename T::valtype& val, char* buffer) {
 
-		std::string ret;
+		std::size_t n = 0;
 
 		if (T::FRACTION_LENGTH == T::WORD_LENGTH) {
-			ret = "0";
+			buffer[n++] = '0';
 		}
 		else {
 			typename T::valtype absVal = (val > 0) ? val : -val;
@@ -117,32 +186,42 @@ namespace Fi {
 			typename T::valtype i = absVal >> T::FRACTION_LENGTH;
 
 			do {
-				ret.push_back((i % 10) + '0');
+				buffer[n++] = (i % 10) + '0';
 				i /= 10;
 			} while (i != 0);
 		}
-		//if (val < 0) ret.push_back('-');
+		//if (val < 0) buffer[n++] = '-';
 		//get rid of compiler errors for unsigned types
-		if ((val & T::S_MASK) != 0) ret.push_back('-');
+		if ((val & T::S_MASK) != 0) buffer[n++] = '-';
 
-		std::reverse(ret.begin(), ret.end());
+		std::reverse(buffer, buffer + n);
 
-		return ret;
+		return n;
 
 	}
 
 	template<typename T>
 	inline std::string StringConversion::
-	fractionalString(const typename T::valtype& val) {
+	integerString(const typename T::valtype& val) {
 
-		std::string ret;
+		char buffer[BufferLength<T>::INTEGER];
+
+		return std::string(buffer, integerChars<T>(val, buffer));
+
+	}
+
+	template<typename T>
+	inline std::size_t StringConversion::
+	fractionalChars(const typename T::valtype& val, char* buffer) {
+
+		std::size_t n = 0;
 		typedef typename T::UnsignedType utype;
 
 		utype absfrac = (val > 0) ? val : -val;
 		absfrac &= T::F_MASK;
 
 		if (T::FRACTION_LENGTH == 0) {
-			ret = "0";
+			buffer[n++] = '0';
 		}
 		else if (T::FRACTION_LENGTH == 8*sizeof(typename T::valtype)) {
 			const utype LSB_MASK = static_cast<utype>(T::F_MASK) >> (T::FRACTION_LENGTH/2);
@@ -155,7 +234,7 @@ namespace Fi {
 				msb *= 10;
 				msb += (lsb >> (T::FRACTION_LENGTH/2));
 				utype digit = msb >> (T::FRACTION_LENGTH/2);
-				ret.push_back(digit + '0');
+				buffer[n++] = digit + '0';
 				lsb &= LSB_MASK;
 				msb &= LSB_MASK;
 			} while ((msb != 0) || (lsb != 0));
@@ -165,12 +244,22 @@ namespace Fi {
 				absfrac *= 10;
 				utype digit = absfrac >> T::FRACTION_LENGTH;
 
-				ret.push_back(digit + '0');
+				buffer[n++] = digit + '0';
 				absfrac &= T::F_MASK;
 			} while (absfrac != 0);
 		}
 
-		return ret;
+		return n;
+
+	}
+
+	template<typename T>
+	inline std::string StringConversion::
+	fractionalString(const typename T::valtype& val) {
+
+		char buffer[BufferLength<T>::FRACTION];
+
+		return std::string(buffer, fractionalChars<T>(val, buffer));
 
 	}
 
@@ -283,7 +372,29 @@ namespace Fi {
 	inline std::string StringConversion::
 	toString(const typename T::valtype& val) {
 
-		return integerString<T>(val) + "." + fractionalString<T>(val);
+		char buffer[BufferLength<T>::value];
+
+		return std::string(buffer, toString<T>(val, buffer, sizeof(buffer)));
+
+	}
+
+	template<typename T>
+	inline std::size_t StringConversion::
+	toString(const typename T::valtype& val, char* buffer, std::size_t size) {
+
+		char full[BufferLength<T>::value];
+
+		std::size_t n = integerChars<T>(val, full);
+		full[n++] = '.';
+		n += fractionalChars<T>(val, full + n);
+
+		if (size > 0) {
+			std::size_t count = std::min(n, size - 1);
+			std::copy(full, full + count, buffer);
+			buffer[count] = '\0';
+		}
+
+		return n;
 
 	}
 
@@ -311,17 +422,19 @@ namespace Fi {
 			val <<= 1;
 		}
 
-		typename T::valtype f;
+		typedef typename T::valtype vt;
+
+		vt f;
 		std::string sf;
 		f = 0;
 		unsigned int i = 0;
 		std::string fullTargetF = "0." + targetF;
 		while ((i < T::FRACTION_LENGTH) && (sf != fullTargetF)) {
-			f |= 1 << (T::FRACTION_LENGTH - i - 1);
+			f |= vt(1) << (T::FRACTION_LENGTH - i - 1);
 			sf = "0." + unsignedFractionalString<T>(f);
 
 			if (StringMath::less(fullTargetF, sf)) {
-				f &= ~(1 << (T::FRACTION_LENGTH - i - 1));
+				f &= ~(vt(1) << (T::FRACTION_LENGTH - i - 1));
 			}
 
 			++i;
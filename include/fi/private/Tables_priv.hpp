@@ -0,0 +1,212 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_TABLES_PRIV_HPP
+#define PRIVATE_FI_TABLES_PRIV_HPP
+
+#include <utility>
+
+namespace Fi {
+
+	namespace table {
+
+		///\internal \brief pi/4, rounded to the nearest \c double.
+		constexpr double QUARTER_PI = 0.78539816339744830962;
+
+		/**\internal
+		 *\brief Sine and cosine of \c x in <tt>[0, pi/4]</tt>, by their
+		 *Taylor series.
+		 */
+		constexpr std::pair<double, double> sinCosOctant(double x) {
+
+			const double x2 = x*x;
+			double s = x;
+			double c = 1.0;
+			double ts = x;
+			double tc = 1.0;
+
+			//The terms are below 2^-60 after 11 of them for x <= pi/4.
+			for (int k = 1; k <= 11; ++k) {
+				ts *= -x2/((2*k)*(2*k + 1));
+				tc *= -x2/((2*k - 1)*(2*k));
+				s += ts;
+				c += tc;
+			}
+
+			return std::pair<double, double>(s, c);
+
+		}
+
+		/**\internal
+		 *\brief <tt>(sin, cos)</tt> of <tt>2*pi*i/n</tt>.
+
+		 *The angle is <tt>(pi/4)*(o + m/n)</tt> with integers \c o and
+		 *\c m, which reduces it to one octant without rounding.
+		 */
+		constexpr std::pair<double, double> sinCos(std::size_t i,
+		                                           std::size_t n) {
+
+			const std::size_t e = 8*(i % n);
+			const std::size_t o = e/n;
+			const std::size_t m = e - o*n;
+
+			//Angle in [0, pi/4] from the nearest multiple of pi/2.
+			const std::pair<double, double> v = sinCosOctant(
+				QUARTER_PI*static_cast<double>((o % 2 == 0) ? m : n - m)/
+				static_cast<double>(n));
+			const double s = v.first;
+			const double c = v.second;
+
+			switch (o) {
+			case 0: return std::pair<double, double>(s, c);
+			case 1: return std::pair<double, double>(c, s);
+			case 2: return std::pair<double, double>(c, -s);
+			case 3: return std::pair<double, double>(s, -c);
+			case 4: return std::pair<double, double>(-s, -c);
+			case 5: return std::pair<double, double>(-c, -s);
+			case 6: return std::pair<double, double>(-c, s);
+			default: return std::pair<double, double>(-s, c);
+			}
+
+		}
+
+		constexpr double sinCycle(std::size_t i, std::size_t n) {
+			return sinCos(i, n).first;
+		}
+
+		constexpr double cosCycle(std::size_t i, std::size_t n) {
+			return sinCos(i, n).second;
+		}
+
+		///\internal \brief Entries of a table, one per index in \c I.
+		template<typename T, typename G, std::size_t... I>
+		constexpr std::array<T, sizeof...(I)>
+		generate(const G& gen, std::index_sequence<I...>) {
+			return std::array<T, sizeof...(I)>{{ T(gen(I))... }};
+		}
+
+		template<typename T, std::size_t N, typename G>
+		constexpr std::array<T, N> generate(const G& gen) {
+			return generate<T>(gen, std::make_index_sequence<N>());
+		}
+
+		///\internal \brief <tt>sin(2*pi*i/N)</tt>.
+		template<std::size_t N>
+		struct SineGenerator {
+			constexpr double operator()(std::size_t i) const {
+				return sinCycle(i, N);
+			}
+		};
+
+		///\internal \brief <tt>cos(2*pi*i/N)</tt>.
+		template<std::size_t N>
+		struct CosineGenerator {
+			constexpr double operator()(std::size_t i) const {
+				return cosCycle(i, N);
+			}
+		};
+
+		/**\internal
+		 *\brief Interleaved real and imaginary parts of
+		 *<tt>exp(-2*pi*j*k/N)</tt>, <tt>k = i/2</tt>.
+		 */
+		template<std::size_t N>
+		struct TwiddleGenerator {
+			constexpr double operator()(std::size_t i) const {
+				return (i % 2 == 0) ? cosCycle(i/2, N) : -sinCycle(i/2, N);
+			}
+		};
+
+		/**\internal
+		 *\brief Symmetric generalized cosine window of length \c N,
+		 *<tt>a0 - a1*cos(2*pi*i/(N - 1)) + a2*cos(4*pi*i/(N - 1))</tt>.
+		 */
+		template<std::size_t N>
+		struct CosineWindowGenerator {
+
+			double a0;
+			double a1;
+			double a2;
+
+			constexpr double operator()(std::size_t i) const {
+				return (N == 1) ? 1.0 :
+					a0 - a1*cosCycle(i, N - 1) + a2*cosCycle(2*i, N - 1);
+			}
+
+		};
+
+		/**\internal
+		 *\brief <tt>1/m</tt> at the middle of segment \c i of
+		 *<tt>[1, 2)</tt>, as Fi::lut::ReciprocalFunction for the
+		 *Fi::lut::NEAREST tables.
+		 */
+		template<std::size_t TB>
+		struct ReciprocalSeedGenerator {
+			constexpr double operator()(std::size_t i) const {
+				return 1.0/(1.0 + (i + 0.5)*(1.0/(std::size_t(1) << TB)));
+			}
+		};
+
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> sine() {
+			return generate<T, N>(SineGenerator<N>());
+		}
+
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> cosine() {
+			return generate<T, N>(CosineGenerator<N>());
+		}
+
+		template<typename T, std::size_t N>
+		constexpr std::array<T, 2*N> twiddles() {
+			return generate<T, 2*N>(TwiddleGenerator<N>());
+		}
+
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> hann() {
+			return generate<T, N>(CosineWindowGenerator<N>{0.5, 0.5, 0.0});
+		}
+
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> hamming() {
+			return generate<T, N>(CosineWindowGenerator<N>{0.54, 0.46, 0.0});
+		}
+
+		template<typename T, std::size_t N>
+		constexpr std::array<T, N> blackman() {
+			return generate<T, N>(CosineWindowGenerator<N>{0.42, 0.5, 0.08});
+		}
+
+		template<typename T, std::size_t TB>
+		constexpr std::array<T, std::size_t(1) << TB> reciprocalSeeds() {
+			static_assert(TB >= 1 && TB <= 16,
+			              "reciprocalSeeds: TableBits must be in [1, 16]");
+			return generate<T, std::size_t(1) << TB>(
+				ReciprocalSeedGenerator<TB>());
+		}
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,34 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_PRIVATE_THREAD_LOCAL_HPP
+#define FI_PRIVATE_THREAD_LOCAL_HPP
+
+//Thread storage duration for variables of trivial types.
+#if __cplusplus >= 201103L
+#define FI_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define FI_THREAD_LOCAL __declspec(thread)
+#else
+#define FI_THREAD_LOCAL __thread
+#endif
+
+#endif
@@ -0,0 +1,453 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_TRACKED_PRIV_HPP
+#define PRIVATE_FI_TRACKED_PRIV_HPP
+
+#include "fi/private/Bits.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace Fi {
+
+	//ValueRange
+
+	inline ValueRange::ValueRange()
+		: samples(0), minimum(0), maximum(0), precision(INT_MIN),
+		  errorSum(0), squaredErrorSum(0), maxError(0)
+	{ }
+
+	inline double ValueRange::meanError() const {
+		return (samples == 0) ? 0.0 : errorSum/samples;
+	}
+
+	inline double ValueRange::rmsError() const {
+		return (samples == 0) ? 0.0 : std::sqrt(squaredErrorSum/samples);
+	}
+
+	inline Signedness ValueRange::signedness() const {
+		return (minimum < 0) ? SIGNED : UNSIGNED;
+	}
+
+	inline int ValueRange::integerLength() const {
+
+		const int s = (signedness() == SIGNED) ? 1 : 0;
+
+		int i = s;
+		while (std::ldexp(1.0, i - s) <= maximum ||
+		       -std::ldexp(1.0, i - s) > minimum) {
+			++i;
+		}
+		return i;
+
+	}
+
+	inline int ValueRange::fractionLength(int guard) const {
+
+		int f = std::max(precision, 0);
+
+		const double e = rmsError();
+		if (e > 0) {
+			const double bits = std::floor(-std::log(e)/std::log(2.0));
+			f = std::min(f, std::max(static_cast<int>(bits) + guard, 0));
+		}
+		return f;
+
+	}
+
+	inline int ValueRange::wordLength(int guard) const {
+		return integerLength() + fractionLength(guard);
+	}
+
+	inline void ValueRange::merge(const ValueRange& r) {
+		if (r.samples == 0) {
+			return;
+		}
+		minimum = (samples == 0) ? r.minimum : std::min(minimum, r.minimum);
+		maximum = (samples == 0) ? r.maximum : std::max(maximum, r.maximum);
+		samples += r.samples;
+		precision = std::max(precision, r.precision);
+		errorSum += r.errorSum;
+		squaredErrorSum += r.squaredErrorSum;
+		maxError = std::max(maxError, r.maxError);
+	}
+
+	template<>
+	struct TrackedShadow<true> {
+
+		explicit TrackedShadow(double v = 0)
+			: _v(v)
+		{ }
+
+		double get() const {
+			return _v;
+		}
+
+		void set(double v) {
+			_v = v;
+		}
+
+	private:
+
+		double _v;
+
+	};
+
+	template<>
+	struct TrackedShadow<false> {
+
+		explicit TrackedShadow(double = 0)
+		{ }
+
+		double get() const {
+			return 0;
+		}
+
+		void set(double)
+		{ }
+
+	};
+
+	/**\internal
+	 *\brief Records the values of the variables of a tag in the buffer of
+	 *the calling thread.
+	 */
+	template<typename Tag, typename FixedT, bool SHADOW>
+	struct RangeRecorder {
+
+		static void record(const FixedT& x, double shadow) {
+
+			ValueRange& r = StatisticsBuffer<Tag, FixedT, ValueRange>::get();
+			const double v = x.toDouble();
+
+			if (r.samples == 0) {
+				r.minimum = v;
+				r.maximum = v;
+			}
+			else {
+				r.minimum = std::min(r.minimum, v);
+				r.maximum = std::max(r.maximum, v);
+			}
+			++r.samples;
+
+			//The lowest set bit of the value gives its precision.
+			const uint64_t b = static_cast<uint64_t>(
+				static_cast<int64_t>(x.toBinary(true)));
+			if (b != 0) {
+				const int f = static_cast<int>(FixedT::FRACTION_LENGTH);
+				r.precision =
+					std::max(r.precision, f - leadingOne(b & (~b + 1)));
+			}
+
+			if (SHADOW) {
+				const double e = v - shadow;
+				r.errorSum += e;
+				r.squaredErrorSum += e*e;
+				r.maxError = std::max(r.maxError, std::fabs(e));
+			}
+
+		}
+
+	};
+
+	template<typename FixedT, bool SHADOW>
+	struct RangeRecorder<void, FixedT, SHADOW> {
+		static void record(const FixedT&, double)
+		{ }
+	};
+
+	//Tracked
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	Tracked<FixedT, Tag, SHADOW>::Tracked()
+		: _value(), _shadow()
+	{ }
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	Tracked<FixedT, Tag, SHADOW>::Tracked(const FixedT& x)
+		: _value(x), _shadow(SHADOW ? x.toDouble() : 0.0)
+	{
+		record();
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	Tracked<FixedT, Tag, SHADOW>::Tracked(const FixedT& x, double shadow)
+		: _value(x), _shadow(shadow)
+	{
+		record();
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	Tracked<FixedT, Tag, SHADOW>::Tracked(double x)
+		: _value(x), _shadow(x)
+	{
+		record();
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	Tracked<FixedT, Tag, SHADOW>::Tracked(const Tracked& x)
+		: _value(x._value), _shadow(x._shadow)
+	{ }
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	template<typename Tag2>
+	Tracked<FixedT, Tag, SHADOW>::
+	Tracked(const Tracked<FixedT, Tag2, SHADOW>& x)
+		: _value(x.value()), _shadow(SHADOW ? x.shadow() : 0.0)
+	{
+		record();
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	Tracked<FixedT, Tag, SHADOW>&
+	Tracked<FixedT, Tag, SHADOW>::operator=(const Tracked& x) {
+		_value = x._value;
+		_shadow = x._shadow;
+		return *this;
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	template<typename Tag2>
+	Tracked<FixedT, Tag, SHADOW>&
+	Tracked<FixedT, Tag, SHADOW>::
+	operator=(const Tracked<FixedT, Tag2, SHADOW>& x) {
+		_value = x.value();
+		if (SHADOW) {
+			_shadow.set(x.shadow());
+		}
+		record();
+		return *this;
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	template<typename Tag2>
+	Tracked<FixedT, Tag, SHADOW>&
+	Tracked<FixedT, Tag, SHADOW>::
+	operator+=(const Tracked<FixedT, Tag2, SHADOW>& x) {
+		_value += x.value();
+		if (SHADOW) {
+			_shadow.set(_shadow.get() + x.shadow());
+		}
+		record();
+		return *this;
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	template<typename Tag2>
+	Tracked<FixedT, Tag, SHADOW>&
+	Tracked<FixedT, Tag, SHADOW>::
+	operator-=(const Tracked<FixedT, Tag2, SHADOW>& x) {
+		_value -= x.value();
+		if (SHADOW) {
+			_shadow.set(_shadow.get() - x.shadow());
+		}
+		record();
+		return *this;
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	template<typename Tag2>
+	Tracked<FixedT, Tag, SHADOW>&
+	Tracked<FixedT, Tag, SHADOW>::
+	operator*=(const Tracked<FixedT, Tag2, SHADOW>& x) {
+		_value *= x.value();
+		if (SHADOW) {
+			_shadow.set(_shadow.get()*x.shadow());
+		}
+		record();
+		return *this;
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	template<typename Tag2>
+	Tracked<FixedT, Tag, SHADOW>&
+	Tracked<FixedT, Tag, SHADOW>::
+	operator/=(const Tracked<FixedT, Tag2, SHADOW>& x) {
+		_value /= x.value();
+		if (SHADOW) {
+			_shadow.set(_shadow.get()/x.shadow());
+		}
+		record();
+		return *this;
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	const FixedT& Tracked<FixedT, Tag, SHADOW>::value() const {
+		return _value;
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	double Tracked<FixedT, Tag, SHADOW>::shadow() const {
+		return SHADOW ? _shadow.get() : _value.toDouble();
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	void Tracked<FixedT, Tag, SHADOW>::record() const {
+		RangeRecorder<Tag, FixedT, SHADOW>::record(_value, _shadow.get());
+	}
+
+
+	//Operators
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline const Tracked<FixedT, void, SHADOW>
+	operator+(const Tracked<FixedT, Tag1, SHADOW>& x,
+	          const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return Tracked<FixedT, void, SHADOW>(x.value() + y.value(),
+			SHADOW ? x.shadow() + y.shadow() : 0.0);
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline const Tracked<FixedT, void, SHADOW>
+	operator-(const Tracked<FixedT, Tag1, SHADOW>& x,
+	          const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return Tracked<FixedT, void, SHADOW>(x.value() - y.value(),
+			SHADOW ? x.shadow() - y.shadow() : 0.0);
+	}
+
+
+	template<typename FixedT, typename Tag, bool SHADOW>
+	inline const Tracked<FixedT, void, SHADOW>
+	operator-(const Tracked<FixedT, Tag, SHADOW>& x) {
+		return Tracked<FixedT, void, SHADOW>(-x.value(),
+			SHADOW ? -x.shadow() : 0.0);
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline const Tracked<FixedT, void, SHADOW>
+	operator*(const Tracked<FixedT, Tag1, SHADOW>& x,
+	          const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return Tracked<FixedT, void, SHADOW>(x.value()*y.value(),
+			SHADOW ? x.shadow()*y.shadow() : 0.0);
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline const Tracked<FixedT, void, SHADOW>
+	operator/(const Tracked<FixedT, Tag1, SHADOW>& x,
+	          const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return Tracked<FixedT, void, SHADOW>(x.value()/y.value(),
+			SHADOW ? x.shadow()/y.shadow() : 0.0);
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline bool operator==(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                       const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return x.value() == y.value();
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline bool operator!=(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                       const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return x.value() != y.value();
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline bool operator<(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                      const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return x.value() < y.value();
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline bool operator<=(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                       const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return x.value() <= y.value();
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline bool operator>(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                      const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return x.value() > y.value();
+	}
+
+
+	template<typename FixedT, typename Tag1, typename Tag2, bool SHADOW>
+	inline bool operator>=(const Tracked<FixedT, Tag1, SHADOW>& x,
+	                       const Tracked<FixedT, Tag2, SHADOW>& y) {
+		return x.value() >= y.value();
+	}
+
+
+	inline std::map<std::string, ValueRange> ranges() {
+		return StatisticsRegistry<ValueRange>::merged();
+	}
+
+	inline void resetRanges() {
+		StatisticsRegistry<ValueRange>::reset();
+	}
+
+	inline void reportRanges(std::ostream& os) {
+
+		const std::map<std::string, ValueRange> r = ranges();
+
+		os << std::left << std::setw(16) << "name" << std::right
+		   << std::setw(12) << "samples" << std::setw(12) << "minimum"
+		   << std::setw(12) << "maximum" << std::setw(12) << "rms error"
+		   << std::setw(12) << "max error" << std::setw(12) << "format"
+		   << '\n';
+
+		for (std::map<std::string, ValueRange>::const_iterator it = r.begin();
+		     it != r.end(); ++it) {
+			const ValueRange& t = it->second;
+			std::ostringstream format;
+			format << ((t.signedness() == SIGNED) ? 's' : 'u')
+			       << t.wordLength() << '.' << t.fractionLength();
+			os << std::left << std::setw(16) << it->first << std::right
+			   << std::setw(12) << t.samples
+			   << std::setw(12) << t.minimum
+			   << std::setw(12) << t.maximum
+			   << std::setw(12) << t.rmsError()
+			   << std::setw(12) << t.maxError
+			   << std::setw(12) << format.str() << '\n';
+		}
+
+	}
+
+}
+
+#endif
@@ -27,6 +27,8 @@
 #include "TypeFromRange.hpp"
 #include "Limits.hpp"
 #include "Masks.hpp"
+#include "Constexpr.hpp"
+#include "DoubleConversion.hpp"
 
 #include <cstddef>
 #include <cmath>
@@ -96,6 +98,11 @@ namespace Fi {
 		static const valtype F_MASK = FMask<valtype, W, F>::value;
 		///\internal \brief A mask to select the integer bits.
 		static const valtype I_MASK = T_MASK & ~S_MASK & ~F_MASK;
+		/**\internal \brief Half of the weight of the lowest integer bit, or
+		 *one without fractional bits so that nothing is rounded up.
+		 */
+		static const valtype F_HALF = (F == 0) ? valtype(1) :
+			static_cast<valtype>((uint64_t(1) << (F % 64)) >> 1);
 
 		///\internal \brief The maximum value that can be represented.
 		static const valtype MAX_VAL = MaxVal<valtype, WORD_LENGTH, S>::value;
@@ -103,12 +110,14 @@ namespace Fi {
 		static const valtype MIN_VAL = MinVal<valtype, WORD_LENGTH, S>::value;
 
 		///\internal \brief The maximum double value that can be represented.
-		static double minDoubleValue() {
-			return static_cast<double>(MIN_VAL)/std::pow(2.0, FRACTION_LENGTH);
+		static FI_CONSTEXPR double minDoubleValue() {
+			return static_cast<double>(MIN_VAL)/
+				DoubleConversion::powerOfTwo(FRACTION_LENGTH);
 		}
 		///\internal \brief The minimum double value that can be represented.
-		static double maxDoubleValue() {
-			return static_cast<double>(MAX_VAL)/std::pow(2.0, FRACTION_LENGTH);
+		static FI_CONSTEXPR double maxDoubleValue() {
+			return static_cast<double>(MAX_VAL)/
+				DoubleConversion::powerOfTwo(FRACTION_LENGTH);
 		}
 
 	};
@@ -0,0 +1,449 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef PRIVATE_FI_VITERBI_PRIV_HPP
+#define PRIVATE_FI_VITERBI_PRIV_HPP
+
+#include "fi/private/Requantize.hpp"
+#include "fi/private/Simd.hpp"
+
+#include <stdexcept>
+
+namespace Fi {
+
+	template<std::size_t W, std::size_t F, Signedness S,
+	         template <typename> class R>
+	bool modularLess(const Fixed<W, F, S, Wrap, R>& a,
+	                 const Fixed<W, F, S, Wrap, R>& b) {
+		const uint64_t d = static_cast<uint64_t>(rawValue(a) - rawValue(b));
+		return ((d >> (W - 1)) & 1) != 0;
+	}
+
+
+	//Trellis
+
+	/**\internal
+	 *\brief Parity of the bits of \c v.
+	 */
+	inline unsigned parity(uint32_t v) {
+		v ^= v >> 16;
+		v ^= v >> 8;
+		v ^= v >> 4;
+		v ^= v >> 2;
+		v ^= v >> 1;
+		return v & 1;
+	}
+
+	template<std::size_t K, uint32_t G0, uint32_t G1, uint32_t G2>
+	std::size_t Trellis<K, G0, G1, G2>::next(std::size_t state, unsigned bit) {
+		return ((state << 1) | bit) & (STATES - 1);
+	}
+
+	template<std::size_t K, uint32_t G0, uint32_t G1, uint32_t G2>
+	unsigned Trellis<K, G0, G1, G2>::output(std::size_t state, unsigned bit) {
+		const uint32_t r = static_cast<uint32_t>((state << 1) | bit);
+		return parity(r & G0) | (parity(r & G1) << 1) |
+			(parity(r & G2) << 2);
+	}
+
+	template<std::size_t K, uint32_t G0, uint32_t G1, uint32_t G2>
+	void Trellis<K, G0, G1, G2>::
+	encode(const uint8_t* bits, std::size_t n, uint8_t* out) {
+		std::size_t state = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			const unsigned c = output(state, bits[i]);
+			for (std::size_t r = 0; r < RATE; ++r) {
+				out[i*RATE + r] = static_cast<uint8_t>((c >> r) & 1);
+			}
+			state = next(state, bits[i]);
+		}
+	}
+
+
+	/**\internal
+	 *\brief Integer type holding path metrics of \c W bits.
+	 */
+	template<bool NARROW>
+	struct ViterbiMetric {
+		typedef int32_t type;
+	};
+
+	template<>
+	struct ViterbiMetric<true> {
+		typedef int16_t type;
+	};
+
+	/**\internal
+	 *\brief Path metrics of a Fi::Viterbi decoder. They are held as their
+	 *raw values shifted so that their sign bit is that of
+	 *\c metric_type, so that the native wrap-around of the integers
+	 *implements Fi::Wrap. Only defined for Fi::Wrap path metrics.
+	 */
+	template<typename TrellisT, typename SymT, typename PathT>
+	struct ViterbiTypes;
+
+	template<typename TrellisT, typename SymT, std::size_t W, std::size_t F,
+	         Signedness S, template <typename> class R>
+	struct ViterbiTypes<TrellisT, SymT, Fixed<W, F, S, Wrap, R> > {
+
+		typedef Fixed<W, F, S, Wrap, R> PathT;
+
+		static const std::size_t K = TrellisT::CONSTRAINT_LENGTH;
+		static const std::size_t RATE = TrellisT::RATE;
+		static const std::size_t STATES = TrellisT::STATES;
+
+		typedef char SymbolCheck[(SymT::SIGNEDNESS == SIGNED) ? 1 : -1];
+		typedef char FractionCheck[(SymT::FRACTION_LENGTH == F) ? 1 : -1];
+		typedef char RangeCheck[((uint64_t(2*K*RATE) << SymT::WORD_LENGTH) <=
+		                         (uint64_t(1) << W)) ? 1 : -1];
+
+		typedef typename ViterbiMetric<(W <= 16)>::type metric_type;
+		typedef metric_type M;
+
+		static const int SHIFT = 8*static_cast<int>(sizeof(M)) -
+			static_cast<int>(W);
+
+		static M scale(int64_t raw) {
+			return static_cast<M>(static_cast<uint32_t>(raw) << SHIFT);
+		}
+
+		static M add(M a, M b) {
+			return static_cast<M>(static_cast<uint32_t>(a) +
+			                      static_cast<uint32_t>(b));
+		}
+
+		static bool less(M a, M b) {
+			return static_cast<M>(static_cast<uint32_t>(a) -
+			                      static_cast<uint32_t>(b)) < 0;
+		}
+
+		static const PathT toPath(M m) {
+			int64_t v = m >> SHIFT;
+			if (S == UNSIGNED) {
+				v &= (int64_t(1) << W) - 1;
+			}
+			return PathT::fromBinary(static_cast<typename PathT::valtype>(v));
+		}
+
+		/**\internal
+		 *\brief Output bits of the transitions into each state, from
+		 *the predecessor in the lower half of the states (\c first) and
+		 *in the upper half (\c second).
+		 */
+		class Codes {
+
+		public:
+
+			static const Codes& instance() {
+				static const Codes c;
+				return c;
+			}
+
+			std::vector<uint8_t> first;
+			std::vector<uint8_t> second;
+
+			/**\internal
+			 *\brief Masks of output bits for the vector code: bit \c r of
+			 *the transition from state <tt>j + h*STATES/2</tt> with input
+			 *\c b is at <tt>((b*2 + h)*RATE + r)*STATES/2 + j</tt>.
+			 */
+			std::vector<int16_t> masks;
+
+		private:
+
+			Codes() : first(STATES), second(STATES),
+			          masks(2*2*RATE*(STATES/2)) {
+
+				const std::size_t H = STATES/2;
+
+				for (std::size_t t = 0; t < STATES; ++t) {
+					const unsigned b = static_cast<unsigned>(t & 1);
+					const std::size_t j = t >> 1;
+					first[t] = static_cast<uint8_t>(TrellisT::output(j, b));
+					second[t] = static_cast<uint8_t>(TrellisT::output(j + H, b));
+				}
+
+				for (std::size_t b = 0; b < 2; ++b) {
+					for (std::size_t h = 0; h < 2; ++h) {
+						for (std::size_t r = 0; r < RATE; ++r) {
+							for (std::size_t j = 0; j < H; ++j) {
+								const unsigned c = TrellisT::output(
+									j + h*H, static_cast<unsigned>(b));
+								masks[((b*2 + h)*RATE + r)*H + j] =
+									((c >> r) & 1) ? -1 : 0;
+							}
+						}
+					}
+				}
+
+			}
+
+		};
+
+	};
+
+
+	namespace Simd {
+
+		/**\internal
+		 *\brief Whether add-compare-select can use 16-bit lanes.
+		 */
+		template<typename Types>
+		struct ViterbiLanes {
+#ifdef FI_SIMD_SSE2
+			static const bool AVAILABLE =
+				(sizeof(typename Types::M) == 2) && (Types::STATES >= 16);
+#else
+			static const bool AVAILABLE = false;
+#endif
+		};
+
+#ifdef FI_SIMD_SSE2
+
+		/**\internal
+		 *\brief Add-compare-select of sixteen states at a time: the
+		 *butterflies of predecessors \c j to <tt>j + 7</tt> and
+		 *<tt>j + STATES/2</tt> to <tt>j + STATES/2 + 7</tt>, whose
+		 *successors are <tt>2j</tt> to <tt>2j + 15</tt>.
+		 */
+		template<typename Types>
+		struct ViterbiVector {
+
+			typedef Lanes16 L;
+			typedef typename Types::M M;
+
+			static const std::size_t RATE = Types::RATE;
+			static const std::size_t H = Types::STATES/2;
+
+			static vec branch(const int16_t* masks, std::size_t j,
+			                  const vec* y) {
+				vec bm = zero();
+				for (std::size_t r = 0; r < RATE; ++r) {
+					const vec m = load(masks + r*H + j);
+					bm = L::add(bm, select(m, y[r], L::sub(zero(), y[r])));
+				}
+				return bm;
+			}
+
+			static void step(const M* pm, M* next, uint8_t* decisions,
+			                 const M* symbols) {
+
+				const std::vector<int16_t>& masks =
+					Types::Codes::instance().masks;
+
+				vec y[3];
+				for (std::size_t r = 0; r < RATE; ++r) {
+					y[r] = L::set1(symbols[r]);
+				}
+
+				for (std::size_t j = 0; j < H; j += L::COUNT) {
+
+					const vec p0 = load(pm + j);
+					const vec p1 = load(pm + H + j);
+					vec n[2];
+					vec d[2];
+
+					for (std::size_t b = 0; b < 2; ++b) {
+						const int16_t* m = &masks[2*b*RATE*H];
+						const vec m0 = L::add(p0, branch(m, j, y));
+						const vec m1 = L::add(p1, branch(m + RATE*H, j, y));
+						d[b] = L::cmplt(L::sub(m1, m0), zero());
+						n[b] = select(d[b], m1, m0);
+					}
+
+					store(next + 2*j, _mm_unpacklo_epi16(n[0], n[1]));
+					store(next + 2*j + L::COUNT, _mm_unpackhi_epi16(n[0], n[1]));
+
+					const int bits = _mm_movemask_epi8(_mm_packs_epi16(
+						_mm_unpacklo_epi16(d[0], d[1]),
+						_mm_unpackhi_epi16(d[0], d[1])));
+					decisions[j/4] = static_cast<uint8_t>(bits);
+					decisions[j/4 + 1] = static_cast<uint8_t>(bits >> 8);
+
+				}
+
+			}
+
+		};
+
+#endif
+
+	}
+
+
+	/**\internal
+	 *\brief One step of add-compare-select.
+	 */
+	template<typename Types, bool VECTOR = Simd::ViterbiLanes<Types>::AVAILABLE>
+	struct ViterbiKernel {
+
+		typedef typename Types::M M;
+
+		static void step(const M* pm, M* next, uint8_t* decisions,
+		                 const M* symbols) {
+
+			const std::size_t RATE = Types::RATE;
+			const std::size_t H = Types::STATES/2;
+			const typename Types::Codes& codes = Types::Codes::instance();
+
+			M bm[8];
+			for (unsigned c = 0; c < (1u << RATE); ++c) {
+				bm[c] = 0;
+				for (std::size_t r = 0; r < RATE; ++r) {
+					const M y = ((c >> r) & 1) ? symbols[r] :
+						static_cast<M>(-static_cast<uint32_t>(symbols[r]));
+					bm[c] = Types::add(bm[c], y);
+				}
+			}
+
+			for (std::size_t t = 0; t < Types::STATES; ++t) {
+				const M m0 = Types::add(pm[t >> 1], bm[codes.first[t]]);
+				const M m1 = Types::add(pm[(t >> 1) + H], bm[codes.second[t]]);
+				const bool d = Types::less(m1, m0);
+				next[t] = d ? m1 : m0;
+				if ((t & 7) == 0) {
+					decisions[t >> 3] = 0;
+				}
+				decisions[t >> 3] |= static_cast<uint8_t>(d << (t & 7));
+			}
+
+		}
+
+	};
+
+#ifdef FI_SIMD_SSE2
+	template<typename Types>
+	struct ViterbiKernel<Types, true> : public Simd::ViterbiVector<Types> {
+	};
+#endif
+
+
+	//Viterbi
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	Viterbi<TrellisT, SymT, PathT>::Viterbi(std::size_t state) {
+		reset(state);
+	}
+
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	void Viterbi<TrellisT, SymT, PathT>::reset(std::size_t state) {
+
+		if (state >= STATES) {
+			throw std::invalid_argument("Viterbi::reset: no such state");
+		}
+
+		//Other states start one largest branch metric behind.
+		const int64_t penalty =
+			int64_t(TrellisT::RATE) << SymT::WORD_LENGTH;
+
+		_metrics.assign(STATES, Types::scale(penalty));
+		_metrics[state] = 0;
+		_next.assign(STATES, 0);
+		_decisions.clear();
+		_steps = 0;
+
+	}
+
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	void Viterbi<TrellisT, SymT, PathT>::
+	update(const SymT* symbols, std::size_t steps) {
+
+		const std::size_t RATE = TrellisT::RATE;
+		const std::size_t bytes = (STATES + 7)/8;
+
+		_decisions.resize((_steps + steps)*bytes);
+
+		for (std::size_t i = 0; i < steps; ++i) {
+
+			M y[3];
+			for (std::size_t r = 0; r < RATE; ++r) {
+				y[r] = Types::scale(rawValue(symbols[i*RATE + r]));
+			}
+
+			ViterbiKernel<Types>::step(&_metrics[0], &_next[0],
+			                           &_decisions[(_steps + i)*bytes], y);
+			_metrics.swap(_next);
+
+		}
+
+		_steps += steps;
+
+	}
+
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	std::size_t Viterbi<TrellisT, SymT, PathT>::steps() const {
+		return _steps;
+	}
+
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	const PathT Viterbi<TrellisT, SymT, PathT>::
+	metric(std::size_t state) const {
+		return Types::toPath(_metrics.at(state));
+	}
+
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	std::size_t Viterbi<TrellisT, SymT, PathT>::best() const {
+		std::size_t b = 0;
+		for (std::size_t s = 1; s < STATES; ++s) {
+			if (Types::less(_metrics[s], _metrics[b])) {
+				b = s;
+			}
+		}
+		return b;
+	}
+
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	void Viterbi<TrellisT, SymT, PathT>::
+	traceback(std::size_t state, uint8_t* bits) const {
+
+		if (state >= STATES) {
+			throw std::invalid_argument("Viterbi::traceback: no such state");
+		}
+
+		const std::size_t bytes = (STATES + 7)/8;
+		const std::size_t top = TrellisT::CONSTRAINT_LENGTH - 2;
+
+		for (std::size_t i = _steps; i > 0; --i) {
+			const uint8_t* d = &_decisions[(i - 1)*bytes];
+			const std::size_t upper = (d[state >> 3] >> (state & 7)) & 1;
+			bits[i - 1] = static_cast<uint8_t>(state & 1);
+			state = (state >> 1) | (upper << top);
+		}
+
+	}
+
+
+	template<typename TrellisT, typename SymT, typename PathT>
+	void Viterbi<TrellisT, SymT, PathT>::decode(uint8_t* bits) const {
+		traceback(best(), bits);
+	}
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "fi/private/Fi.hpp"
 #include "fi/private/Info.hpp"
+#include "fi/private/Constexpr.hpp"
 
 #include <string>
 
@@ -49,7 +50,8 @@ namespace Fi {
 		 *\param n Integer representing a fixed-point number.
 		 *\return The number after saturation is applied.
 		 */
-		static typename T::valtype positiveOverflow(const typename T::valtype& n);
+		static FI_CONSTEXPR typename T::valtype
+		positiveOverflow(const typename T::valtype& n);
 
 		/**
 		 *\internal
@@ -59,7 +61,8 @@ namespace Fi {
 		 *\param n Integer representing a fixed-point number.
 		 *\return The number after saturation is applied.
 		 */
-		static typename T::valtype negativeOverflow(const typename T::valtype& n);
+		static FI_CONSTEXPR typename T::valtype
+		negativeOverflow(const typename T::valtype& n);
 
 	};
 
@@ -73,7 +76,7 @@ namespace Fi {
 	};
 
 	template<typename T>
-	inline typename T::valtype Saturate<T>::
+	inline FI_CONSTEXPR typename T::valtype Saturate<T>::
 	positiveOverflow(const typename T::valtype& /*n*/) {
 
 		return T::MAX_VAL;
@@ -81,7 +84,7 @@ namespace Fi {
 	}
 
 	template<typename T>
-	inline typename T::valtype Saturate<T>::
+	inline FI_CONSTEXPR typename T::valtype Saturate<T>::
 	negativeOverflow(const typename T::valtype& /*n*/) {
 
 		return T::MIN_VAL;
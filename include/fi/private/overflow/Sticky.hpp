@@ -0,0 +1,158 @@
+/*
+
+ *Copyright © 2011-2012 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#ifndef FI_PRIVATE_OVERFLOW_STICKY_HPP
+#define FI_PRIVATE_OVERFLOW_STICKY_HPP
+
+#include "fi/private/Fi.hpp"
+#include "fi/private/Info.hpp"
+#include "fi/private/ThreadLocal.hpp"
+#include "fi/private/overflow/Wrap.hpp"
+
+namespace Fi {
+
+	/**\internal
+	 *\brief The overflow status word of the calling thread.
+	 */
+	inline unsigned& overflowStatus() {
+		static FI_THREAD_LOCAL unsigned status = 0;
+		return status;
+	}
+
+	inline unsigned overflowFlags() {
+		return overflowStatus();
+	}
+
+	inline void clearOverflowFlags(unsigned flags) {
+		overflowStatus() &= ~flags;
+	}
+
+	/**
+	 *\ingroup overflow
+	 *\brief A saturating overflow handler that records overflow.
+	 *\tparam T Fi::Traits of the fixed-point type.
+	 */
+	template <typename T>
+	struct StickySaturate {
+
+		/**
+		 *\internal
+		 *\brief Raise Fi::POSITIVE_OVERFLOW and saturate.
+		 *
+		 *\param n Integer representing a fixed-point number.
+		 *\return The largest representable value.
+		 */
+		static typename T::valtype positiveOverflow(const typename T::valtype& n);
+
+		/**
+		 *\internal
+		 *\brief Raise Fi::NEGATIVE_OVERFLOW and saturate.
+		 *
+		 *\param n Integer representing a fixed-point number.
+		 *\return The smallest representable value.
+		 */
+		static typename T::valtype negativeOverflow(const typename T::valtype& n);
+
+	};
+
+	/**
+	 *\ingroup overflow
+	 *\brief A wrap-around overflow handler that records overflow.
+	 *\tparam T Fi::Traits of the fixed-point type.
+	 */
+	template <typename T>
+	struct StickyWrap {
+
+		/**
+		 *\internal
+		 *\brief Raise Fi::POSITIVE_OVERFLOW and wrap.
+		 *
+		 *\param n Integer representing a fixed-point number.
+		 *\return The number after wrapping is applied.
+		 */
+		static typename T::valtype positiveOverflow(const typename T::valtype& n);
+
+		/**
+		 *\internal
+		 *\brief Raise Fi::NEGATIVE_OVERFLOW and wrap.
+		 *
+		 *\param n Integer representing a fixed-point number.
+		 *\return The number after wrapping is applied.
+		 */
+		static typename T::valtype negativeOverflow(const typename T::valtype& n);
+
+	};
+
+	/**\internal
+	 *\brief A specialization to retrieve information about the overflow handler.
+	 */
+	template<>
+	struct StickySaturate<Fi::Info> {
+		static const std::size_t WIDTH_MULT = 2;
+	};
+
+	/**\internal
+	 *\brief A specialization to retrieve information about the overflow handler.
+	 */
+	template<>
+	struct StickyWrap<Fi::Info> {
+		static const std::size_t WIDTH_MULT = 2;
+	};
+
+	template<typename T>
+	inline typename T::valtype StickySaturate<T>::
+	positiveOverflow(const typename T::valtype& /*n*/) {
+
+		overflowStatus() |= POSITIVE_OVERFLOW;
+		return T::MAX_VAL;
+
+	}
+
+	template<typename T>
+	inline typename T::valtype StickySaturate<T>::
+	negativeOverflow(const typename T::valtype& /*n*/) {
+
+		overflowStatus() |= NEGATIVE_OVERFLOW;
+		return T::MIN_VAL;
+
+	}
+
+	template<typename T>
+	inline typename T::valtype StickyWrap<T>::
+	positiveOverflow(const typename T::valtype& n) {
+
+		overflowStatus() |= POSITIVE_OVERFLOW;
+		return Wrap<T>::positiveOverflow(n);
+
+	}
+
+	template<typename T>
+	inline typename T::valtype StickyWrap<T>::
+	negativeOverflow(const typename T::valtype& n) {
+
+		overflowStatus() |= NEGATIVE_OVERFLOW;
+		return Wrap<T>::negativeOverflow(n);
+
+	}
+
+}
+
+#endif
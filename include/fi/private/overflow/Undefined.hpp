@@ -24,6 +24,7 @@
 
 #include "fi/private/Fi.hpp"
 #include "fi/private/Info.hpp"
+#include "fi/private/Constexpr.hpp"
 
 #include <string>
 #include <cmath>
@@ -56,7 +57,8 @@ namespace Fi {
 		 *\warning The programmer is willing to accept undefined behavior
 		 *in the event of an overflow.
 		 */
-		static typename T::valtype positiveOverflow(const typename T::valtype& n);
+		static FI_CONSTEXPR typename T::valtype
+		positiveOverflow(const typename T::valtype& n);
 
 		/**
 		 *\internal
@@ -68,7 +70,8 @@ namespace Fi {
 		 *\warning The programmer is willing to accept undefined behavior
 		 *in the event of an overflow.
 		 */
-		static typename T::valtype negativeOverflow(const typename T::valtype& n);
+		static FI_CONSTEXPR typename T::valtype
+		negativeOverflow(const typename T::valtype& n);
 
 	};
 
@@ -81,7 +84,7 @@ namespace Fi {
 	};
 
 	template<typename T>
-	inline typename T::valtype Undefined<T>::
+	inline FI_CONSTEXPR typename T::valtype Undefined<T>::
 	positiveOverflow(const typename T::valtype& n) {
 
 		return n;
@@ -89,7 +92,7 @@ namespace Fi {
 	}
 
 	template<typename T>
-	inline typename T::valtype Undefined<T>::
+	inline FI_CONSTEXPR typename T::valtype Undefined<T>::
 	negativeOverflow(const typename T::valtype& n) {
 
 		return n;
@@ -24,6 +24,7 @@
 
 #include "fi/private/Fi.hpp"
 #include "fi/private/Info.hpp"
+#include "fi/private/Constexpr.hpp"
 #include "fi/private/Arithmetic.hpp"
 
 #include <string>
@@ -50,7 +51,8 @@ namespace Fi {
 		 *\param n Integer representing a fixed-point number.
 		 *\return The number after wrapping is applied.
 		 */
-		static typename T::valtype positiveOverflow(const typename T::valtype& n);
+		static FI_CONSTEXPR typename T::valtype
+		positiveOverflow(const typename T::valtype& n);
 
 		/**
 		 *\internal
@@ -60,7 +62,8 @@ namespace Fi {
 		 *\param n Integer representing a fixed-point number.
 		 *\return The number after wrapping is applied.
 		 */
-		static typename T::valtype negativeOverflow(const typename T::valtype& n);
+		static FI_CONSTEXPR typename T::valtype
+		negativeOverflow(const typename T::valtype& n);
 
 	};
 
@@ -73,7 +76,7 @@ namespace Fi {
 	};
 
 	template<typename T>
-	inline typename T::valtype Wrap<T>::
+	inline FI_CONSTEXPR typename T::valtype Wrap<T>::
 	positiveOverflow(const typename T::valtype& n) {
 
 		typename T::valtype ret = static_cast<typename T::valtype>(n);
@@ -90,7 +93,7 @@ namespace Fi {
 	}
 
 	template<typename T>
-	inline typename T::valtype Wrap<T>::
+	inline FI_CONSTEXPR typename T::valtype Wrap<T>::
 	negativeOverflow(const typename T::valtype& n) {
 
 		typename T::valtype ret = static_cast<typename T::valtype>(n);
@@ -23,6 +23,7 @@
 #define FI_PRIVATE_ROUNDING_CEIL_HPP
 
 #include "fi/private/Fi.hpp"
+#include "fi/private/Constexpr.hpp"
 #include "fi/private/DoubleConversion.hpp"
 
 #include <string>
@@ -51,7 +52,7 @@ namespace Fi {
 		 *that numbers can increase in value as a result of rounding,
 		 *or 0 if the input is 0.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(const typename T::valtype& n);
 
 		/**\internal
@@ -62,7 +63,7 @@ namespace Fi {
 		 *that numbers can increase in value as a result of rounding,
 		 *or 0 if the input is 0.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(double fl, const typename T::valtype& n);
 
 		/**\internal
@@ -81,7 +82,7 @@ namespace Fi {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::Ceil<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::Ceil<T>::
 round(const typename T::valtype& n) {
 
 	int direction = (n == 0) ? 0 : 1;
@@ -97,7 +98,7 @@ round(const typename T::valtype& n) {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::Ceil<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::Ceil<T>::
 round(double fl, const typename T::valtype& n) {
 
 	int direction = (fl == 0) ? 0 : 1;
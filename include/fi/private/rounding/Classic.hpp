@@ -23,6 +23,7 @@
 #define FI_PRIVATE_ROUNDING_CLASSIC_HPP
 
 #include "fi/private/Fi.hpp"
+#include "fi/private/Constexpr.hpp"
 #include "fi/private/DoubleConversion.hpp"
 
 #include <string>
@@ -51,7 +52,7 @@ namespace Fi {
 		 *positive (negative) numbers can decrease (increase) in value
 		 *as a result of rounding, or 0 if the input \c n is zero.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(const typename T::valtype& n);
 
 		/**\internal
@@ -62,7 +63,7 @@ namespace Fi {
 		 *positive (negative) numbers can decrease (increase) in value
 		 *as a result of rounding, or 0 if the input \c fl is zero.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(double fl, const typename T::valtype& n);
 
 		/**\internal
@@ -81,7 +82,7 @@ namespace Fi {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::Classic<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::Classic<T>::
 round(const typename T::valtype& n) {
 
 	int direction = 0;
@@ -93,14 +94,14 @@ round(const typename T::valtype& n) {
 
 		if ((T::SIGNEDNESS == SIGNED) && (n <= 0)) {
 			direction = 0;
-			if ((n & T::F_MASK) > (1 << (T::FRACTION_LENGTH-1))) {
+			if ((n & T::F_MASK) > T::F_HALF) {
 				ret += 1;
 				direction = -1;
 			}
 		}
 		else {
 			direction = -1;
-			if ((n & T::F_MASK) >= (1 << (T::FRACTION_LENGTH-1))) {
+			if ((n & T::F_MASK) >= T::F_HALF) {
 				ret += 1;
 				direction = 1;
 			}
@@ -113,7 +114,7 @@ round(const typename T::valtype& n) {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::Classic<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::Classic<T>::
 round(double fl, const typename T::valtype& n) {
 
 	int direction = 0;
@@ -126,14 +127,14 @@ round(double fl, const typename T::valtype& n) {
 
 		if ((T::SIGNEDNESS == SIGNED) && (fl < 0.0)) {
 			direction = 0;
-			if ((n & T::F_MASK) > (1 << (T::FRACTION_LENGTH-1))) {
+			if ((n & T::F_MASK) > T::F_HALF) {
 				ret += 1;
 				direction = -1;
 			}
 		}
 		else {
 			direction = -1;
-			if ((n & T::F_MASK) >= (1 << (T::FRACTION_LENGTH-1))) {
+			if ((n & T::F_MASK) >= T::F_HALF) {
 				ret += 1;
 				direction = 1;
 			}
@@ -159,14 +160,14 @@ round(const std::string& str, const typename T::valtype& n) {
 
 		if ((T::SIGNEDNESS == SIGNED) && StringMath::less(str, "0.0")) {
 			direction = 0;
-			if ((n & T::F_MASK) > (1 << (T::FRACTION_LENGTH-1))) {
+			if ((n & T::F_MASK) > T::F_HALF) {
 				ret += 1;
 				direction = -1;
 			}
 		}
 		else {
 			direction = -1;
-			if ((n & T::F_MASK) >= (1 << (T::FRACTION_LENGTH-1))) {
+			if ((n & T::F_MASK) >= T::F_HALF) {
 				ret += 1;
 				direction = 1;
 			}
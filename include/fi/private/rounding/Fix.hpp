@@ -23,6 +23,7 @@
 #define FI_PRIVATE_ROUNDING_FIX_HPP
 
 #include "fi/private/Fi.hpp"
+#include "fi/private/Constexpr.hpp"
 #include "fi/private/DoubleConversion.hpp"
 
 #include <string>
@@ -51,7 +52,7 @@ namespace Fi {
 		 *positive (negative) numbers can decrease (increase) in value
 		 *as a result of rounding, or 0 if the input \c n is zero.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(const typename T::valtype& n);
 
 		/**\internal
@@ -62,7 +63,7 @@ namespace Fi {
 		 *positive (negative) numbers can decrease (increase) in value
 		 *as a result of rounding, or 0 if the input \c fl is zero.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(double fl, const typename T::valtype& n);
 
 		/**\internal
@@ -81,7 +82,7 @@ namespace Fi {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::Fix<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::Fix<T>::
 round(const typename T::valtype& n) {
 
 	int direction = 0;
@@ -106,7 +107,7 @@ round(const typename T::valtype& n) {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::Fix<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::Fix<T>::
 round(double fl, const typename T::valtype& n) {
 
 	int direction = 0;
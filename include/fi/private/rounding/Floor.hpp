@@ -23,6 +23,7 @@
 #define FI_PRIVATE_ROUNDING_FLOOR_HPP
 
 #include "fi/private/Fi.hpp"
+#include "fi/private/Constexpr.hpp"
 #include "fi/private/DoubleConversion.hpp"
 #include "fi/private/StringConversion.hpp"
 #include "fi/private/StringMath.hpp"
@@ -53,7 +54,7 @@ namespace Fi {
 		 *that numbers can increase in value as a result of rounding,
 		 *or 0 if the input is 0.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(const typename T::valtype& n);
 
 		/**\internal
@@ -64,7 +65,7 @@ namespace Fi {
 		 *that numbers can increase in value as a result of rounding,
 		 *or 0 if the input is 0.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(double fl, const typename T::valtype& n);
 
 		/**\internal
@@ -83,7 +84,7 @@ namespace Fi {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::Floor<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::Floor<T>::
 round(const typename T::valtype& n) {
 
 	int direction = 0;
@@ -105,7 +106,7 @@ round(const typename T::valtype& n) {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::Floor<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::Floor<T>::
 round(double fl, const typename T::valtype& n) {
 
 	int direction = (fl == 0.0) ? 0 : -1;
@@ -24,6 +24,7 @@
 #define FI_PRIVATE_ROUNDING_NEAREVEN_HPP
 
 #include "fi/private/Fi.hpp"
+#include "fi/private/Constexpr.hpp"
 #include "fi/private/DoubleConversion.hpp"
 
 #include <string>
@@ -54,7 +55,7 @@ namespace Fi {
 		 *positive (negative) numbers can decrease (increase) in value
 		 *as a result of rounding, or 0 if the input \c n is zero.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(const typename T::valtype& n);
 
 		/**\internal
@@ -65,7 +66,7 @@ namespace Fi {
 		 *positive (negative) numbers can decrease (increase) in value
 		 *as a result of rounding, or 0 if the input \c fl is zero.
 		 */
-		static std::pair<typename T::valtype, int>
+		static FI_CONSTEXPR std::pair<typename T::valtype, int>
 		round(double fl, const typename T::valtype& n);
 
 		/**\internal
@@ -84,7 +85,7 @@ namespace Fi {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::NearEven<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::NearEven<T>::
 round(const typename T::valtype& n) {
 
 	int direction = 0;
@@ -94,8 +95,8 @@ round(const typename T::valtype& n) {
 
 		ret = n >> T::FRACTION_LENGTH;
 
-		if ((n & T::F_MASK) == (1 << (T::FRACTION_LENGTH-1))) {
-			if ((n & (1 << T::FRACTION_LENGTH)) == 0) {
+		if ((n & T::F_MASK) == T::F_HALF) {
+			if ((n & (typename T::valtype(1) << T::FRACTION_LENGTH)) == 0) {
 				direction = -1;
 			}
 			else {
@@ -103,11 +104,11 @@ round(const typename T::valtype& n) {
 				direction = 1;
 			}
 		}
-		else if ((n & T::F_MASK) > (1 << (T::FRACTION_LENGTH-1))) {
+		else if ((n & T::F_MASK) > T::F_HALF) {
 			ret += 1;
 			direction = 1;
 		}
-		else { //if ((n & T::F_MASK) < (1 << (T::FRACTION_LENGTH-1))) {
+		else { //if ((n & T::F_MASK) < T::F_HALF) {
 			direction = -1;
 		}
 
@@ -118,7 +119,7 @@ round(const typename T::valtype& n) {
 }
 
 template <typename T>
-inline std::pair<typename T::valtype, int> Fi::NearEven<T>::
+inline FI_CONSTEXPR std::pair<typename T::valtype, int> Fi::NearEven<T>::
 round(double fl, const typename T::valtype& n) {
 
 	int direction = 0;
@@ -127,8 +128,8 @@ round(double fl, const typename T::valtype& n) {
 	if (fl != 0.0) {
 		ret = n >> T::FRACTION_LENGTH;
 
-		if ((n & T::F_MASK) == (1 << (T::FRACTION_LENGTH-1))) {
-			if ((n & (1 << T::FRACTION_LENGTH)) == 0) {
+		if ((n & T::F_MASK) == T::F_HALF) {
+			if ((n & (typename T::valtype(1) << T::FRACTION_LENGTH)) == 0) {
 				direction = -1;
 			}
 			else {
@@ -136,11 +137,11 @@ round(double fl, const typename T::valtype& n) {
 				direction = 1;
 			}
 		}
-		else if ((n & T::F_MASK) > (1 << (T::FRACTION_LENGTH-1))) {
+		else if ((n & T::F_MASK) > T::F_HALF) {
 			ret += 1;
 			direction = 1;
 		}
-		else { //if ((n & T::F_MASK) < (1 << (T::FRACTION_LENGTH-1))) {
+		else { //if ((n & T::F_MASK) < T::F_HALF) {
 			direction = -1;
 		}
 
@@ -161,8 +162,8 @@ round(const std::string& str, const typename T::valtype& n) {
 
 		ret = n >> T::FRACTION_LENGTH;
 
-		if ((n & T::F_MASK) == (1 << (T::FRACTION_LENGTH-1))) {
-			if ((n & (1 << T::FRACTION_LENGTH)) == 0) {
+		if ((n & T::F_MASK) == T::F_HALF) {
+			if ((n & (typename T::valtype(1) << T::FRACTION_LENGTH)) == 0) {
 				direction = -1;
 			}
 			else {
@@ -170,11 +171,11 @@ round(const std::string& str, const typename T::valtype& n) {
 				direction = 1;
 			}
 		}
-		else if ((n & T::F_MASK) > (1 << (T::FRACTION_LENGTH-1))) {
+		else if ((n & T::F_MASK) > T::F_HALF) {
 			ret += 1;
 			direction = 1;
 		}
-		else { //if ((n & T::F_MASK) < (1 << (T::FRACTION_LENGTH-1))) {
+		else { //if ((n & T::F_MASK) < T::F_HALF) {
 			direction = -1;
 		}
 
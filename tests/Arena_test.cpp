@@ -0,0 +1,233 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#include "fi/Fixed.hpp"
+#include "fi/Arena.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+
+#include <cstring>
+#include <limits>
+#include <new>
+#include <string>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE arena
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<16, 8, Fi::SIGNED, Fi::Saturate> fi16_8s;
+typedef Fi::Fixed<8, 8, Fi::UNSIGNED, Fi::Wrap> fi8_8u;
+typedef Fi::Fixed<32, 0, Fi::SIGNED, Fi::Saturate> fi32_0s;
+typedef Fi::Fixed<32, 31, Fi::SIGNED, Fi::Wrap> fi32_31s;
+typedef Fi::Fixed<16, 16, Fi::SIGNED, Fi::Saturate> fi16_16s;
+
+BOOST_AUTO_TEST_SUITE( arena )
+
+BOOST_AUTO_TEST_CASE( alignment )
+{
+
+	Fi::Arena arena(256);
+
+	for (std::size_t i = 1; i < 100; ++i) {
+		void* p = arena.allocate(i, 32);
+		BOOST_CHECK_EQUAL(reinterpret_cast<std::size_t>(p) % 32, 0u);
+	}
+
+	char* c = arena.allocateArray<char>(1);
+	BOOST_CHECK_EQUAL(reinterpret_cast<std::size_t>(c) % 16, 0u);
+
+}
+
+BOOST_AUTO_TEST_CASE( large_allocation )
+{
+
+	Fi::Arena arena(64);
+
+	char* p = static_cast<char*>(arena.allocate(1000));
+	std::memset(p, 1, 1000);
+
+	BOOST_CHECK(arena.capacity() >= 1000);
+	BOOST_CHECK(arena.used() >= 1000);
+
+}
+
+BOOST_AUTO_TEST_CASE( oversized_allocation )
+{
+
+	const std::size_t max = std::numeric_limits<std::size_t>::max();
+
+	Fi::Arena arena(64);
+	arena.allocate(1);
+
+	BOOST_CHECK_THROW(arena.allocate(max), std::bad_alloc);
+	BOOST_CHECK_THROW(arena.allocate(max - 8, 32), std::bad_alloc);
+	BOOST_CHECK_THROW(arena.allocate(16, max/2 + 1), std::bad_alloc);
+	BOOST_CHECK_THROW(arena.allocateArray<double>(max/4), std::bad_alloc);
+
+	BOOST_CHECK_EQUAL(arena.blockCount(), 1u);
+	BOOST_CHECK(arena.allocate(16) != 0);
+
+}
+
+BOOST_AUTO_TEST_CASE( reset_reuses_blocks )
+{
+
+	Fi::Arena arena(1024);
+
+	void* first = 0;
+	std::size_t blocks = 0;
+
+	for (int frame = 0; frame < 10; ++frame) {
+
+		void* p = arena.allocate(100);
+
+		for (int i = 0; i < 50; ++i) {
+			arena.allocate(100);
+		}
+
+		if (frame == 0) {
+			first = p;
+			blocks = arena.blockCount();
+		}
+
+		BOOST_CHECK_EQUAL(p, first);
+		BOOST_CHECK_EQUAL(arena.blockCount(), blocks);
+
+		arena.reset();
+		BOOST_CHECK_EQUAL(arena.used(), 0u);
+
+	}
+
+	arena.release();
+	BOOST_CHECK_EQUAL(arena.blockCount(), 0u);
+	BOOST_CHECK_EQUAL(arena.capacity(), 0u);
+
+}
+
+BOOST_AUTO_TEST_CASE( vector_of_fixed )
+{
+
+	Fi::Arena arena;
+	std::size_t blocks = 0;
+
+	for (int frame = 0; frame < 5; ++frame) {
+
+		Fi::ArenaAllocator<fi16_8s> alloc(arena);
+		Fi::ArenaVector<fi16_8s>::type v(alloc);
+
+		for (int i = 0; i < 1000; ++i) {
+			v.push_back(fi16_8s::fromBinary(i));
+		}
+
+		fi16_8s sum;
+		for (std::size_t i = 0; i < v.size(); ++i) {
+			sum += v[i];
+		}
+
+		BOOST_CHECK_EQUAL(sum.toString(), "127.99609375");
+
+		if (frame == 0) {
+			blocks = arena.blockCount();
+		}
+		BOOST_CHECK_EQUAL(arena.blockCount(), blocks);
+
+		arena.reset();
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE( allocator_comparison )
+{
+
+	Fi::Arena a;
+	Fi::Arena b;
+
+	Fi::ArenaAllocator<int> x(a);
+	Fi::ArenaAllocator<char> y(x);
+	Fi::ArenaAllocator<int> z(b);
+
+	BOOST_CHECK(x == y);
+	BOOST_CHECK(x != z);
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE( string_buffer )
+
+template<typename T>
+void checkBuffer(const T& x) {
+
+	char buffer[T::STRING_LENGTH];
+	std::size_t n = x.toString(buffer, sizeof(buffer));
+
+	BOOST_CHECK_EQUAL(std::string(buffer), x.toString());
+	BOOST_CHECK_EQUAL(n, x.toString().size());
+
+}
+
+BOOST_AUTO_TEST_CASE( matches_string )
+{
+
+	checkBuffer(fi16_8s(-128.0));
+	checkBuffer(fi16_8s(127.99609375));
+	checkBuffer(fi16_8s(-0.00390625));
+	checkBuffer(fi16_8s(0.0));
+	checkBuffer(fi8_8u(0.99609375));
+	checkBuffer(fi32_0s::MinVal());
+	checkBuffer(fi32_0s::MaxVal());
+	checkBuffer(fi32_31s::MinVal());
+	checkBuffer(fi32_31s::fromBinary(1));
+	checkBuffer(fi16_16s::fromBinary(1));
+	checkBuffer(fi16_16s::MinVal());
+
+}
+
+BOOST_AUTO_TEST_CASE( truncation )
+{
+
+	char buffer[4];
+	std::size_t n = fi16_8s(-1.5).toString(buffer, sizeof(buffer));
+
+	BOOST_CHECK_EQUAL(n, 4u);
+	BOOST_CHECK_EQUAL(std::string(buffer), "-1.");
+
+	BOOST_CHECK_EQUAL(fi16_8s(-1.5).toString(buffer, 0), 4u);
+
+}
+
+BOOST_AUTO_TEST_CASE( arena_string )
+{
+
+	Fi::Arena arena;
+
+	const char* a = Fi::toString(fi16_8s(3.25), arena);
+	const char* b = Fi::toString(fi16_8s(-3.25), arena);
+
+	BOOST_CHECK_EQUAL(std::string(a), "3.25");
+	BOOST_CHECK_EQUAL(std::string(b), "-3.25");
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,302 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/Biquad.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Throw.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+#include "Narrow.hpp"
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE biquad
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<12, 11, Fi::SIGNED, Fi::Saturate, Fi::Classic> s12_11;
+typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> c12_10;
+typedef Fi::Fixed<16, 12, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s16_12;
+typedef Fi::Fixed<14, 12, Fi::SIGNED, Fi::Saturate, Fi::Floor> o14_12;
+typedef Fi::Fixed<32, 22, Fi::SIGNED, Fi::Wrap> a32_22;
+typedef Fi::Fixed<24, 18, Fi::SIGNED, Fi::Saturate, Fi::Floor> f24_18;
+typedef Fi::Fixed<12, 11, Fi::SIGNED, Fi::Throw, Fi::Classic> t12_11;
+
+/**
+ *Reference section written with Fi::Fixed operators for one channel.
+ */
+template<typename InT, typename CoefT, typename AccT, typename StateT,
+         typename OutT, Fi::BiquadStructure S>
+struct Reference {
+
+	explicit Reference(const Fi::BiquadCoefficients<CoefT>& c) : c(c) { }
+
+	template<typename X>
+	static void add(AccT& acc, const CoefT& k, const X& x, bool negate) {
+		static const std::size_t PRODUCT_F =
+			CoefT::FRACTION_LENGTH + X::FRACTION_LENGTH;
+		int64_t p = static_cast<int64_t>(k.toBinary(true))*x.toBinary(true);
+		acc += narrow<AccT, PRODUCT_F>(negate ? -p : p);
+	}
+
+	template<typename X>
+	static void add(AccT& acc, const X& x) {
+		acc += narrow<AccT>(x);
+	}
+
+	OutT step(const InT& x) {
+
+		AccT y;
+		OutT out;
+
+		if (S == Fi::DIRECT_FORM_I) {
+			add(y, c.b0, x, false);
+			add(y, c.b1, x1, false);
+			add(y, c.b2, x2, false);
+			add(y, c.a1, y1, true);
+			add(y, c.a2, y2, true);
+			out = narrow<OutT>(y);
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = out;
+		}
+		else if (S == Fi::DIRECT_FORM_II) {
+			AccT w;
+			add(w, x);
+			add(w, c.a1, s1, true);
+			add(w, c.a2, s2, true);
+			StateT state = narrow<StateT>(w);
+			add(y, c.b0, state, false);
+			add(y, c.b1, s1, false);
+			add(y, c.b2, s2, false);
+			out = narrow<OutT>(y);
+			s2 = s1;
+			s1 = state;
+		}
+		else {
+			add(y, c.b0, x, false);
+			add(y, s1);
+			out = narrow<OutT>(y);
+			AccT n1, n2;
+			add(n1, c.b1, x, false);
+			add(n1, c.a1, out, true);
+			add(n1, s2);
+			add(n2, c.b2, x, false);
+			add(n2, c.a2, out, true);
+			s1 = narrow<StateT>(n1);
+			s2 = narrow<StateT>(n2);
+		}
+
+		return out;
+
+	}
+
+	Fi::BiquadCoefficients<CoefT> c;
+	InT x1, x2;
+	OutT y1, y2;
+	StateT s1, s2;
+
+};
+
+double uniform(double lo, double hi) {
+	return lo + (hi - lo)*std::rand()/RAND_MAX;
+}
+
+///A stable section with random poles and zeros.
+template<typename CoefT>
+Fi::BiquadCoefficients<CoefT> randomSection() {
+	double r = uniform(0.5, 0.95);
+	double theta = uniform(0.1, 3.0);
+	return Fi::BiquadCoefficients<CoefT>(
+		CoefT(uniform(-0.5, 0.5)), CoefT(uniform(-0.5, 0.5)),
+		CoefT(uniform(-0.5, 0.5)), CoefT(-2*r*std::cos(theta)), CoefT(r*r));
+}
+
+template<typename FixedT>
+std::vector<FixedT> randomVector(std::size_t n) {
+	const int range = 1 << (FixedT::WORD_LENGTH - 1);
+	std::vector<FixedT> x(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		x[i] = FixedT::fromBinary(std::rand() % (2*range) - range);
+	}
+	return x;
+}
+
+/**
+ *Filter random interleaved data in random block sizes and compare each
+ *channel with the reference.
+ */
+template<typename InT, typename CoefT, typename AccT, typename StateT,
+         typename OutT, Fi::BiquadStructure S>
+void checkBitExact(std::size_t channels, bool overflowFree) {
+
+	typedef Fi::Biquad<InT, CoefT, AccT, StateT, OutT, S> Engine;
+	typedef Reference<InT, CoefT, AccT, StateT, OutT, S> Ref;
+
+	Fi::BiquadCoefficients<CoefT> c = randomSection<CoefT>();
+	Engine biquad(c, channels);
+	BOOST_CHECK_EQUAL(biquad.overflowFree(), overflowFree);
+
+	const std::size_t frames = 120;
+	std::vector<InT> x = randomVector<InT>(frames*channels);
+	std::vector<OutT> y;
+
+	for (std::size_t t = 0; t < frames; ) {
+		std::size_t n = std::min<std::size_t>(std::rand() % 30, frames - t);
+		std::vector<InT> in(x.begin() + t*channels,
+		                    x.begin() + (t + n)*channels);
+		std::vector<OutT> out;
+		biquad.process(in, out);
+		y.insert(y.end(), out.begin(), out.end());
+		t += n;
+	}
+
+	BOOST_REQUIRE_EQUAL(y.size(), x.size());
+
+	std::size_t mismatches = 0;
+
+	for (std::size_t ch = 0; ch < channels; ++ch) {
+		Ref ref(c);
+		for (std::size_t t = 0; t < frames; ++t) {
+			if (!(ref.step(x[t*channels + ch]) == y[t*channels + ch])) {
+				++mismatches;
+			}
+		}
+	}
+
+	BOOST_CHECK_MESSAGE(mismatches == 0, "structure " << S << " channels " <<
+	                    channels << ": " << mismatches << " mismatches");
+
+}
+
+template<typename InT, typename CoefT, typename AccT, typename StateT,
+         typename OutT, Fi::BiquadStructure S>
+void checkChannels(bool overflowFree) {
+	const std::size_t channels[] = {1, 3, 4, 5, 8, 13};
+	for (std::size_t i = 0; i < sizeof(channels)/sizeof(channels[0]); ++i) {
+		for (int j = 0; j < 2; ++j) {
+			checkBitExact<InT, CoefT, AccT, StateT, OutT, S>(channels[i],
+			                                                 overflowFree);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(bit_exact_integer_adders) {
+	std::srand(1);
+	checkChannels<s12_11, c12_10, a32_22, s16_12, o14_12,
+	              Fi::DIRECT_FORM_I>(true);
+	checkChannels<s12_11, c12_10, a32_22, s16_12, o14_12,
+	              Fi::DIRECT_FORM_II>(true);
+	checkChannels<s12_11, c12_10, a32_22, s16_12, o14_12,
+	              Fi::TRANSPOSED_DIRECT_FORM_II>(true);
+}
+
+BOOST_AUTO_TEST_CASE(bit_exact_rounding_adders) {
+	std::srand(2);
+	checkChannels<s12_11, c12_10, f24_18, s16_12, o14_12,
+	              Fi::DIRECT_FORM_I>(false);
+	checkChannels<s12_11, c12_10, f24_18, s16_12, o14_12,
+	              Fi::DIRECT_FORM_II>(false);
+	checkChannels<s12_11, c12_10, f24_18, s16_12, o14_12,
+	              Fi::TRANSPOSED_DIRECT_FORM_II>(false);
+}
+
+BOOST_AUTO_TEST_CASE(cascade) {
+
+	std::srand(3);
+
+	typedef Fi::BiquadCascade<s12_11, c12_10, a32_22, s16_12, o14_12,
+	                          Fi::TRANSPOSED_DIRECT_FORM_II> Cascade;
+	typedef Reference<s12_11, c12_10, a32_22, s16_12, o14_12,
+	                  Fi::TRANSPOSED_DIRECT_FORM_II> First;
+	typedef Reference<o14_12, c12_10, a32_22, s16_12, o14_12,
+	                  Fi::TRANSPOSED_DIRECT_FORM_II> Other;
+
+	std::vector< Fi::BiquadCoefficients<c12_10> > sections;
+	for (int i = 0; i < 3; ++i) {
+		sections.push_back(randomSection<c12_10>());
+	}
+
+	const std::size_t channels = 6;
+	Cascade cascade(sections, channels);
+	BOOST_CHECK_EQUAL(cascade.size(), 3u);
+	BOOST_CHECK_EQUAL(cascade.channels(), channels);
+
+	std::vector<s12_11> x = randomVector<s12_11>(100*channels);
+	std::vector<o14_12> y;
+	cascade.process(x, y);
+
+	std::size_t mismatches = 0;
+
+	for (std::size_t ch = 0; ch < channels; ++ch) {
+		First first(sections[0]);
+		Other second(sections[1]);
+		Other third(sections[2]);
+		for (std::size_t t = 0; t < 100; ++t) {
+			o14_12 r = third.step(second.step(first.step(x[t*channels + ch])));
+			if (!(r == y[t*channels + ch])) {
+				++mismatches;
+			}
+		}
+	}
+
+	BOOST_CHECK_EQUAL(mismatches, 0u);
+
+	//A reset cascade starts over.
+	std::vector<o14_12> z;
+	cascade.reset();
+	cascade.process(x, z);
+	BOOST_CHECK(y == z);
+
+}
+
+BOOST_AUTO_TEST_CASE(overflow) {
+
+	Fi::BiquadCoefficients<c12_10> c(c12_10(1.5), c12_10(1.5), c12_10(0.0),
+	                                 c12_10(0.0), c12_10(0.0));
+	std::vector<s12_11> x(8, s12_11(0.75));
+	std::vector<t12_11> y;
+
+	Fi::Biquad<s12_11, c12_10, a32_22, s16_12, t12_11> biquad(c, 4);
+	BOOST_CHECK(biquad.overflowFree());
+	BOOST_CHECK_THROW(biquad.process(x, y), std::overflow_error);
+
+	BOOST_CHECK_THROW((Fi::Biquad<s12_11, c12_10, a32_22>(c, 0)),
+	                  std::invalid_argument);
+
+	Fi::Biquad<s12_11, c12_10, a32_22> two(c, 2);
+	std::vector<s12_11> odd(3), out;
+	BOOST_CHECK_THROW(two.process(odd, out), std::invalid_argument);
+
+	std::vector< Fi::BiquadCoefficients<c12_10> > none;
+	BOOST_CHECK_THROW((Fi::BiquadCascade<s12_11, c12_10, a32_22>(none)),
+	                  std::invalid_argument);
+
+}
@@ -0,0 +1,215 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/Fixed.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+
+#include <cstdlib>
+#include <string>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE bits
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Wrap> s8_4;
+typedef Fi::Fixed<8, 8, Fi::UNSIGNED, Fi::Wrap> u8_8;
+typedef Fi::Fixed<13, 5, Fi::SIGNED, Fi::Saturate, Fi::Classic> s13_5;
+typedef Fi::Fixed<16, 0, Fi::UNSIGNED, Fi::Wrap> u16_0;
+typedef Fi::Fixed<24, 12, Fi::SIGNED, Fi::Wrap> s24_12;
+typedef Fi::Fixed<32, 16, Fi::SIGNED, Fi::Wrap> s32_16;
+typedef Fi::Fixed<32, 0, Fi::UNSIGNED, Fi::Wrap> u32_0;
+
+template<typename T>
+T randomFixed() {
+	const std::size_t w = T::WORD_LENGTH;
+	uint64_t u = (static_cast<uint64_t>(std::rand()) << 16) ^ std::rand();
+	u &= (uint64_t(1) << w) - 1;
+	//Short runs of leading sign bits as often as long ones.
+	u >>= std::rand() % w;
+	if (std::rand() % 2) {
+		u = ~u & ((uint64_t(1) << w) - 1);
+	}
+	return T::fromBinary(static_cast<typename T::valtype>(u));
+}
+
+std::size_t leading(const std::string& b, char c, std::size_t from) {
+	std::size_t n = 0;
+	while (from + n < b.size() && b[from + n] == c) {
+		++n;
+	}
+	return n;
+}
+
+template<typename T>
+void counts() {
+
+	for (int t = 0; t < 2000; ++t) {
+
+		const std::size_t w = T::WORD_LENGTH;
+		T x = randomFixed<T>();
+		const std::string b = x.toBinaryString();
+		BOOST_REQUIRE_EQUAL(b.size(), w);
+
+		BOOST_CHECK_EQUAL(Fi::clz(x), leading(b, '0', 0));
+
+		const std::size_t s = (T::SIGNEDNESS == Fi::SIGNED)
+			? leading(b, b[0], 1) : leading(b, '0', 0);
+		BOOST_CHECK_EQUAL(Fi::cls(x), s);
+
+		T y = x;
+		BOOST_CHECK_EQUAL(Fi::normalize(y), s);
+		BOOST_CHECK_EQUAL(y.toBinaryString(),
+		                  (b.substr(s) + std::string(s, '0')).substr(0, b.size()));
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(count_test) {
+
+	counts<s8_4>();
+	counts<u8_8>();
+	counts<s13_5>();
+	counts<u16_0>();
+	counts<s24_12>();
+	counts<s32_16>();
+	counts<u32_0>();
+
+	BOOST_CHECK_EQUAL(Fi::clz(s8_4(0.0)), 8u);
+	BOOST_CHECK_EQUAL(Fi::cls(s8_4(0.0)), 7u);
+	BOOST_CHECK_EQUAL(Fi::cls(s8_4::fromBinary(-1)), 7u);
+	BOOST_CHECK_EQUAL(Fi::clz(s8_4::fromBinary(-1)), 0u);
+	BOOST_CHECK_EQUAL(Fi::cls(s8_4::MinVal()), 0u);
+	BOOST_CHECK_EQUAL(Fi::cls(s8_4::MaxVal()), 0u);
+	BOOST_CHECK_EQUAL(Fi::clz(u32_0::fromBinary(1)), 31u);
+
+}
+
+template<std::size_t HI, std::size_t LO, typename T>
+void slices() {
+
+	typedef Fi::Fixed<HI - LO + 1, 0, Fi::UNSIGNED, Fi::Wrap> part;
+
+	T x[37];
+	part p[37];
+	for (std::size_t i = 0; i < 37; ++i) {
+		x[i] = randomFixed<T>();
+	}
+
+	Fi::slice<HI, LO>(x, p, 37);
+
+	for (std::size_t i = 0; i < 37; ++i) {
+		const std::string b = x[i].toBinaryString();
+		const std::string expected =
+			b.substr(T::WORD_LENGTH - 1 - HI, HI - LO + 1);
+		BOOST_CHECK_EQUAL((Fi::slice<HI, LO>(x[i]).toBinaryString()), expected);
+		BOOST_CHECK_EQUAL(p[i].toBinaryString(), expected);
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(slice_test) {
+
+	slices<7, 0, s8_4>();
+	slices<7, 7, s8_4>();
+	slices<5, 2, u8_8>();
+	slices<23, 12, s24_12>();
+	slices<31, 0, s32_16>();
+	slices<31, 16, u32_0>();
+	slices<0, 0, u32_0>();
+
+	s8_4 x = s8_4::fromBinary(0x5A);
+	BOOST_CHECK_EQUAL((Fi::slice<6, 3>(x).toBinary()), 0xB);
+
+}
+
+template<typename A, typename B>
+void concatenation() {
+
+	typedef Fi::Fixed<A::WORD_LENGTH + B::WORD_LENGTH, B::FRACTION_LENGTH,
+	                  A::SIGNEDNESS, Fi::Wrap> wide;
+
+	A a[19];
+	B b[19];
+	wide c[19];
+	for (std::size_t i = 0; i < 19; ++i) {
+		a[i] = randomFixed<A>();
+		b[i] = randomFixed<B>();
+	}
+
+	Fi::concat(a, b, c, 19);
+
+	for (std::size_t i = 0; i < 19; ++i) {
+		const std::string expected = a[i].toBinaryString()
+			+ b[i].toBinaryString();
+		BOOST_CHECK_EQUAL(Fi::concat(a[i], b[i]).toBinaryString(), expected);
+		BOOST_CHECK_EQUAL(c[i].toBinaryString(), expected);
+		BOOST_CHECK((Fi::slice<A::WORD_LENGTH + B::WORD_LENGTH - 1,
+		                       B::WORD_LENGTH>(c[i]).toBinary()
+		             == a[i].toBinary()));
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(concat_test) {
+
+	concatenation<s8_4, u8_8>();
+	concatenation<u8_8, s8_4>();
+	concatenation<s8_4, s24_12>();
+	concatenation<u16_0, u16_0>();
+
+	//An integer part and a fractional part.
+	Fi::Fixed<16, 8, Fi::SIGNED, Fi::Wrap> x =
+		Fi::concat(Fi::Fixed<8, 0, Fi::SIGNED, Fi::Wrap>(-3.0), u8_8(0.25));
+	BOOST_CHECK_EQUAL(x.toDouble(), -2.75);
+
+}
+
+BOOST_AUTO_TEST_CASE(array_test) {
+
+	s13_5 x[21];
+	for (std::size_t i = 0; i < 21; ++i) {
+		x[i] = randomFixed<s13_5>();
+	}
+
+	std::size_t z[21];
+	std::size_t s[21];
+	Fi::clz(x, z, 21);
+	Fi::cls(x, s, 21);
+
+	s13_5 y[21];
+	std::copy(x, x + 21, y);
+	std::size_t shifts[21];
+	Fi::normalize(y, shifts, 21);
+
+	for (std::size_t i = 0; i < 21; ++i) {
+		BOOST_CHECK_EQUAL(z[i], Fi::clz(x[i]));
+		BOOST_CHECK_EQUAL(s[i], Fi::cls(x[i]));
+		BOOST_CHECK_EQUAL(shifts[i], s[i]);
+		s13_5 n = x[i];
+		Fi::normalize(n);
+		BOOST_CHECK(y[i] == n);
+	}
+
+}
@@ -0,0 +1,386 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/BlockFloat.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Ceil.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <stdint.h>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE block_float
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<8, 7, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s8_7;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s16_15;
+typedef Fi::Fixed<12, 4, Fi::SIGNED, Fi::Saturate, Fi::Classic> s12_4;
+typedef Fi::Fixed<24, 20, Fi::SIGNED, Fi::Saturate, Fi::Classic> s24_20;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Ceil> c16_15;
+typedef Fi::Fixed<16, 8, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_8;
+typedef Fi::Fixed<10, 6, Fi::SIGNED, Fi::Wrap, Fi::Classic> w10_6;
+
+double uniform() {
+	return 2.0*std::rand()/(RAND_MAX + 1.0) - 1.0;
+}
+
+///Block of random values whose largest magnitude is 0.7*2^k.
+template<typename BlockT>
+BlockT randomBlock(int k, double* x = 0) {
+
+	double v[BlockT::SIZE];
+	for (std::size_t i = 0; i < BlockT::SIZE; ++i) {
+		v[i] = std::ldexp(0.7*uniform(), k);
+	}
+	v[std::rand() % BlockT::SIZE] = std::ldexp((std::rand() % 2) ? 0.7 : -0.7, k);
+
+	if (x) {
+		std::copy(v, v + BlockT::SIZE, x);
+	}
+
+	return BlockT::fromDouble(v);
+
+}
+
+template<typename BlockT>
+void checkEqual(const BlockT& a, const BlockT& b) {
+	BOOST_CHECK_EQUAL(a.exponent(), b.exponent());
+	for (std::size_t i = 0; i < BlockT::SIZE; ++i) {
+		BOOST_CHECK_EQUAL(a.mantissa(i).toBinary(true),
+		                  b.mantissa(i).toBinary(true));
+	}
+}
+
+///Nearest integer, with ties to even or away from zero.
+double nearest(double y, bool even) {
+	const double f = std::floor(y);
+	const double d = y - f;
+	if (d != 0.5) {
+		return (d < 0.5) ? f : f + 1;
+	}
+	if (even) {
+		return (std::fmod(f, 2.0) == 0) ? f : f + 1;
+	}
+	return (y < 0) ? f : f + 1;
+}
+
+///Results rounded once from the values of the block.
+template<typename BlockT>
+void checkRounded(const BlockT& b, const double* x, bool even) {
+
+	typedef typename BlockT::mantissa_type M;
+
+	int emax;
+	double largest = 0;
+	for (std::size_t i = 0; i < BlockT::SIZE; ++i) {
+		largest = std::max(largest, std::fabs(x[i]));
+	}
+	std::frexp(largest, &emax);
+
+	const int e = emax - static_cast<int>(M::WORD_LENGTH) + 1
+		+ static_cast<int>(M::FRACTION_LENGTH);
+
+	BOOST_CHECK_EQUAL(b.exponent(), e);
+	for (std::size_t i = 0; i < BlockT::SIZE; ++i) {
+		const double m = std::ldexp(x[i],
+			static_cast<int>(M::FRACTION_LENGTH) - e);
+		BOOST_CHECK_EQUAL(b.mantissa(i).toBinary(true), nearest(m, even));
+	}
+
+}
+
+template<typename M, std::size_t N>
+void conversion(bool even) {
+
+	typedef Fi::BlockFloat<M, N, 8> block;
+
+	for (int t = 0; t < 50; ++t) {
+
+		double x[N];
+		const int k = std::rand() % 41 - 20;
+		block b = randomBlock<block>(k, x);
+		checkRounded(b, x, even);
+
+		double y[N];
+		b.toDouble(y);
+		for (std::size_t i = 0; i < N; ++i) {
+			BOOST_CHECK_EQUAL(y[i], b.value(i));
+			BOOST_CHECK_SMALL(y[i] - x[i], std::ldexp(1.0,
+				b.exponent() - static_cast<int>(M::FRACTION_LENGTH) - 1));
+		}
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(conversion_test) {
+
+	conversion<s8_7, 1>(true);
+	conversion<s8_7, 19>(true);
+	conversion<s16_15, 16>(true);
+	conversion<s12_4, 9>(false);
+	conversion<s24_20, 32>(false);
+
+	//Zeros.
+	double z[4] = {0.0, 0.0, 0.0, 0.0};
+	Fi::BlockFloat<s8_7, 4, 6> b = Fi::BlockFloat<s8_7, 4, 6>::fromDouble(z);
+	BOOST_CHECK_EQUAL(b.exponent(), -32);
+	BOOST_CHECK_EQUAL(b.headroom(), 7);
+
+	//Rounding carries out of the word.
+	double c[2] = {0.999, 0.1};
+	Fi::BlockFloat<s8_7, 2, 6> r = Fi::BlockFloat<s8_7, 2, 6>::fromDouble(c);
+	BOOST_CHECK_EQUAL(r.exponent(), 1);
+	BOOST_CHECK_EQUAL(r.value(0), 1.0);
+	BOOST_CHECK_EQUAL(r.value(1), 0.09375);
+
+}
+
+BOOST_AUTO_TEST_CASE(fixed_test) {
+
+	typedef Fi::BlockFloat<s8_7, 13, 8> block;
+
+	s16_15 x[13];
+	double d[13];
+	for (std::size_t i = 0; i < 13; ++i) {
+		x[i] = s16_15(0.03*uniform());
+		d[i] = x[i].toDouble();
+	}
+
+	checkEqual(block::fromFixed(x), block::fromDouble(d));
+
+	for (int k = -30; k < 40; k += 3) {
+
+		double v[13];
+		block b = randomBlock<block>(k, v);
+
+		s16_8 out[13];
+		b.toFixed(out);
+
+		for (std::size_t i = 0; i < 13; ++i) {
+			BOOST_CHECK_EQUAL(out[i].toBinary(true),
+			                  s16_8(b.value(i)).toBinary(true));
+		}
+
+	}
+
+}
+
+template<typename M, std::size_t N>
+void arithmetic(int spread) {
+
+	typedef Fi::BlockFloat<M, N, 8> block;
+
+	for (int t = 0; t < 100; ++t) {
+
+		block a = randomBlock<block>(std::rand() % 21 - 10);
+		block b = randomBlock<block>(std::rand() % (2*spread + 1) - spread);
+
+		double sum[N];
+		double difference[N];
+		double product[N];
+		for (std::size_t i = 0; i < N; ++i) {
+			sum[i] = a.value(i) + b.value(i);
+			difference[i] = a.value(i) - b.value(i);
+			product[i] = a.value(i)*b.value(i);
+		}
+
+		//The values are exact, so both are rounded once.
+		checkEqual(a + b, block::fromDouble(sum));
+		checkEqual(a - b, block::fromDouble(difference));
+		checkEqual(a*b, block::fromDouble(product));
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_test) {
+
+	arithmetic<s8_7, 1>(40);
+	arithmetic<s8_7, 17>(40);
+	arithmetic<s16_15, 8>(30);
+	arithmetic<s12_4, 5>(30);
+	arithmetic<s24_20, 12>(20);
+
+	//Bits of the smaller operand beyond the alignment limit still round.
+	typedef Fi::BlockFloat<c16_15, 2, 8> block;
+	double x[2] = {0.5, -0.25};
+	double y[2] = {std::ldexp(1.0, -100), std::ldexp(1.0, -100)};
+	block s = block::fromDouble(x) + block::fromDouble(y);
+	BOOST_CHECK_EQUAL(s.exponent(), 0);
+	BOOST_CHECK_EQUAL(s.mantissa(0).toBinary(true), 16385);
+	BOOST_CHECK_EQUAL(s.mantissa(1).toBinary(true), -8191);
+
+}
+
+template<typename M, std::size_t N>
+void normalization() {
+
+	typedef Fi::BlockFloat<M, N, 8> block;
+
+	const int w = static_cast<int>(M::WORD_LENGTH);
+	const typename M::valtype limit = M::MaxVal().toBinary(true) >> 5;
+
+	for (int t = 0; t < 50; ++t) {
+
+		M m[N];
+		for (std::size_t i = 0; i < N; ++i) {
+			m[i] = M::fromBinary(std::rand() % (2*limit + 1) - limit);
+		}
+
+		int headroom = w - 1;
+		for (std::size_t i = 0; i < N; ++i) {
+			const int64_t v = m[i].toBinary(true);
+			int h = 0;
+			while (h < w - 1
+			       && v*(int64_t(1) << (h + 1)) >= M::MinVal().toBinary(true)
+			       && v*(int64_t(1) << (h + 1)) <= M::MaxVal().toBinary(true)) {
+				++h;
+			}
+			headroom = std::min(headroom, h);
+		}
+
+		block b(m, 3);
+		BOOST_CHECK_EQUAL(b.headroom(), headroom);
+
+		double before[N];
+		b.toDouble(before);
+		b.normalize();
+
+		double after[N];
+		b.toDouble(after);
+
+		for (std::size_t i = 0; i < N; ++i) {
+			BOOST_CHECK_EQUAL(before[i], after[i]);
+		}
+		bool zero = true;
+		for (std::size_t i = 0; i < N; ++i) {
+			zero = zero && (m[i].toBinary(true) == 0);
+		}
+
+		if (zero) {
+			BOOST_CHECK(b.exponent() == block::MIN_EXPONENT);
+		}
+		else {
+			BOOST_CHECK_EQUAL(b.exponent(), 3 - headroom);
+			BOOST_CHECK_EQUAL(b.headroom(), 0);
+		}
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(normalization_test) {
+
+	normalization<s8_7, 1>();
+	normalization<s8_7, 8>();
+	normalization<s8_7, 21>();
+	normalization<s16_15, 4>();
+	normalization<s16_15, 35>();
+	normalization<s12_4, 16>();
+	normalization<w10_6, 11>();
+	normalization<s24_20, 9>();
+
+	//The exponent does not go below its minimum.
+	typedef Fi::BlockFloat<s8_7, 2, 4> block;
+	s8_7 m[2] = {s8_7::fromBinary(3), s8_7::fromBinary(-1)};
+	block b(m, -6);
+	b.normalize();
+	BOOST_CHECK_EQUAL(b.exponent(), -8);
+	BOOST_CHECK_EQUAL(b.mantissa(0).toBinary(true), 12);
+	BOOST_CHECK_EQUAL(b.mantissa(1).toBinary(true), -4);
+
+}
+
+BOOST_AUTO_TEST_CASE(range_test) {
+
+	typedef Fi::BlockFloat<s8_7, 3, 4> block;
+
+	BOOST_CHECK(block::MIN_EXPONENT == -8);
+	BOOST_CHECK(block::MAX_EXPONENT == 7);
+
+	//The overflow handler is applied at the largest exponent.
+	double large[3] = {1000.0, -1000.0, 64.0};
+	block b = block::fromDouble(large);
+	BOOST_CHECK_EQUAL(b.exponent(), 7);
+	BOOST_CHECK_EQUAL(b.mantissa(0).toBinary(true), 127);
+	BOOST_CHECK_EQUAL(b.mantissa(1).toBinary(true), -128);
+	BOOST_CHECK_EQUAL(b.mantissa(2).toBinary(true), 64);
+
+	b = b*b;
+	BOOST_CHECK_EQUAL(b.exponent(), 7);
+	BOOST_CHECK_EQUAL(b.mantissa(2).toBinary(true), 127);
+
+	//Small values next to a saturated one are rounded at the largest
+	//exponent, not scaled up from the inexact bit of a huge one.
+	double mixed[3] = {1e30, 1.0, -0.7};
+	b = block::fromDouble(mixed);
+	BOOST_CHECK_EQUAL(b.exponent(), 7);
+	BOOST_CHECK_EQUAL(b.mantissa(0).toBinary(true), 127);
+	BOOST_CHECK_EQUAL(b.mantissa(1).toBinary(true), 1);
+	BOOST_CHECK_EQUAL(b.mantissa(2).toBinary(true), -1);
+
+	double tiny[3] = {-1e30, 0.3, 1e-20};
+	b = block::fromDouble(tiny);
+	BOOST_CHECK_EQUAL(b.exponent(), 7);
+	BOOST_CHECK_EQUAL(b.mantissa(0).toBinary(true), -128);
+	BOOST_CHECK_EQUAL(b.mantissa(1).toBinary(true), 0);
+	BOOST_CHECK_EQUAL(b.mantissa(2).toBinary(true), 0);
+
+	typedef Fi::BlockFloat<s16_15, 4, 6> wide;
+	double huge[4] = {1e30, 1.0, 0.0, -3e9};
+	wide h = wide::fromDouble(huge);
+	BOOST_CHECK_EQUAL(h.exponent(), 31);
+	BOOST_CHECK_EQUAL(h.mantissa(0).toBinary(true), 32767);
+	BOOST_CHECK_EQUAL(h.mantissa(1).toBinary(true), 0);
+	BOOST_CHECK_EQUAL(h.mantissa(2).toBinary(true), 0);
+	BOOST_CHECK_EQUAL(h.mantissa(3).toBinary(true), -32768);
+
+	//Small values are not normalized at the smallest exponent.
+	double small[3] = {1e-4, -2e-9, 0.0};
+	b = block::fromDouble(small);
+	BOOST_CHECK_EQUAL(b.exponent(), -8);
+	BOOST_CHECK_EQUAL(b.mantissa(0).toBinary(true), 3);
+	BOOST_CHECK_EQUAL(b.mantissa(1).toBinary(true), 0);
+	BOOST_CHECK_EQUAL(b.mantissa(2).toBinary(true), 0);
+
+}
+
+BOOST_AUTO_TEST_CASE(arguments_test) {
+
+	typedef Fi::BlockFloat<s8_7, 2, 4> block;
+
+	s8_7 m[2];
+	BOOST_CHECK_THROW(block(m, 8), std::invalid_argument);
+	BOOST_CHECK_THROW(block(m, -9), std::invalid_argument);
+	BOOST_CHECK_NO_THROW(block(m, -8));
+
+	block b;
+	BOOST_CHECK_EQUAL(b.exponent(), -8);
+	BOOST_CHECK_EQUAL(b.value(1), 0.0);
+
+}
@@ -0,0 +1,228 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/CIC.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE cic
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<10, 8, Fi::SIGNED, Fi::Saturate, Fi::Classic> s10_8;
+typedef Fi::Fixed<16, 0, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_0;
+typedef Fi::Fixed<16, 0, Fi::SIGNED, Fi::Wrap, Fi::Floor> f16_0;
+
+template<typename T>
+std::vector<T> randomSignal(std::size_t n) {
+	std::vector<T> x(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		const int64_t range = int64_t(1) << T::WORD_LENGTH;
+		x[i] = T::fromBinary(static_cast<typename T::valtype>(
+			std::rand() % range - range/2));
+	}
+	return x;
+}
+
+///Impulse response ((1 - z^-RM)/(1 - z^-1))^N.
+std::vector<int64_t> response(std::size_t N, std::size_t RM) {
+	std::vector<int64_t> h(1, 1);
+	for (std::size_t i = 0; i < N; ++i) {
+		std::vector<int64_t> g(h.size() + RM - 1, 0);
+		for (std::size_t k = 0; k < h.size(); ++k) {
+			for (std::size_t d = 0; d < RM; ++d) {
+				g[k + d] += h[k];
+			}
+		}
+		h.swap(g);
+	}
+	return h;
+}
+
+///Exact output at high-rate time t of the zero-stuffed input.
+int64_t convolve(const std::vector<int64_t>& h, const std::vector<int64_t>& x,
+                 std::size_t t) {
+	int64_t sum = 0;
+	for (std::size_t k = 0; k < h.size() && k <= t; ++k) {
+		sum += h[k]*x[t - k];
+	}
+	return sum;
+}
+
+template<typename T>
+std::vector<int64_t> raw(const std::vector<T>& x) {
+	std::vector<int64_t> r(x.size());
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		r[i] = x[i].toBinary(true);
+	}
+	return r;
+}
+
+BOOST_AUTO_TEST_CASE(design) {
+	//Example of Hogenauer (1981): N = 4, R = 25, 16-bit input and output.
+	typedef Fi::CIC<s16_0, 4, 25, 1, Fi::CIC_DECIMATOR, f16_0> Cic;
+	const std::size_t pruned[] = {1, 6, 9, 13, 14, 15, 16, 17};
+
+	BOOST_CHECK(Cic::GROWTH == 19);
+	BOOST_CHECK(Cic::WORD_LENGTH == 35);
+	BOOST_CHECK(Cic::FRACTION_LENGTH == 19);
+	for (std::size_t j = 0; j < 8; ++j) {
+		BOOST_CHECK_EQUAL(Cic::pruned(j), pruned[j]);
+		BOOST_CHECK_EQUAL(Cic::registerWidth(j), 35 - pruned[j]);
+	}
+	BOOST_CHECK_THROW(Cic::pruned(8), std::invalid_argument);
+
+	typedef Fi::CIC<s16_0, 4, 8, 1, Fi::CIC_INTERPOLATOR> Interpolator;
+	const std::size_t width[] = {17, 18, 19, 20, 19, 21, 23, 25};
+
+	BOOST_CHECK(Interpolator::GROWTH == 9);
+	for (std::size_t j = 0; j < 8; ++j) {
+		BOOST_CHECK_EQUAL(Interpolator::pruned(j), 0u);
+		BOOST_CHECK_EQUAL(Interpolator::registerWidth(j), width[j]);
+	}
+	BOOST_CHECK_THROW(Interpolator::registerWidth(8), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(decimator) {
+	typedef Fi::CIC<s10_8, 3, 4, 2> Cic;
+	BOOST_CHECK(Cic::WORD_LENGTH == 19);
+	BOOST_CHECK(Cic::FRACTION_LENGTH == 17);
+
+	const std::vector<s10_8> x = randomSignal<s10_8>(1001);
+	std::vector<Fi::Fixed<19, 17, Fi::SIGNED, Fi::Wrap, Fi::Floor> > y;
+	Cic cic;
+	cic.process(x, y);
+
+	const std::vector<int64_t> h = response(3, 8);
+	const std::vector<int64_t> r = raw(x);
+	BOOST_REQUIRE_EQUAL(y.size(), 251u);
+	for (std::size_t i = 0; i < y.size(); ++i) {
+		BOOST_CHECK_EQUAL(y[i].toBinary(true), convolve(h, r, 4*i));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(interpolator) {
+	typedef Fi::CIC<s10_8, 3, 4, 1, Fi::CIC_INTERPOLATOR> Cic;
+	BOOST_CHECK(Cic::GROWTH == 4);
+
+	const std::vector<s10_8> x = randomSignal<s10_8>(300);
+	std::vector<int64_t> stuffed(4*x.size(), 0);
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		stuffed[4*i] = x[i].toBinary(true);
+	}
+
+	std::vector<Fi::Fixed<14, 12, Fi::SIGNED, Fi::Wrap, Fi::Floor> > y;
+	Cic cic;
+	cic.process(x, y);
+
+	const std::vector<int64_t> h = response(3, 4);
+	BOOST_REQUIRE_EQUAL(y.size(), stuffed.size());
+	for (std::size_t t = 0; t < y.size(); ++t) {
+		BOOST_CHECK_EQUAL(y[t].toBinary(true), convolve(h, stuffed, t));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(channels) {
+	typedef Fi::CIC<s10_8, 4, 5, 1> Cic;
+	const std::size_t C = 3;
+	const std::size_t N = 997;
+
+	const std::vector<s10_8> x = randomSignal<s10_8>(C*N);
+	std::vector<std::vector<s10_8> > single(C);
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		single[i % C].push_back(x[i]);
+	}
+
+	Cic cic(C);
+	BOOST_CHECK_EQUAL(cic.channels(), C);
+	typedef std::vector<Fi::CICFormat<s10_8, 4, 5, 1,
+	                                  Fi::CIC_DECIMATOR>::type> Out;
+	Out y;
+	std::size_t i = 0;
+	std::size_t size = 1;
+	while (i < N) {
+		const std::size_t n = std::min(size, N - i);
+		const std::size_t first = y.size();
+		y.resize(first + cic.maxOutputs(n)*C);
+		const std::size_t count = cic.process(&x[i*C], n, &y[first]);
+		BOOST_CHECK_EQUAL(count*C, y.size() - first);
+		i += n;
+		size = size % 13 + 1;
+	}
+
+	BOOST_REQUIRE_EQUAL(y.size(), C*((N + 4)/5));
+	for (std::size_t c = 0; c < C; ++c) {
+		Cic one;
+		Out z;
+		one.process(single[c], z);
+		for (std::size_t k = 0; k < z.size(); ++k) {
+			BOOST_CHECK(y[k*C + c] == z[k]);
+		}
+	}
+
+	cic.reset();
+	Out w;
+	cic.process(x, w);
+	BOOST_CHECK(w == y);
+
+	BOOST_CHECK_THROW(Cic(0), std::invalid_argument);
+	std::vector<s10_8> partial(C + 1);
+	BOOST_CHECK_THROW(cic.process(partial, w), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(pruning) {
+	typedef Fi::CIC<s16_0, 4, 25, 1, Fi::CIC_DECIMATOR, f16_0> Cic;
+	const std::vector<s16_0> x = randomSignal<s16_0>(25*400);
+	std::vector<f16_0> y;
+	Cic cic;
+	cic.process(x, y);
+
+	//The pruned filter is within a few LSBs of the truncated exact output.
+	const std::vector<int64_t> h = response(4, 25);
+	const std::vector<int64_t> r = raw(x);
+	int64_t largest = 0;
+	for (std::size_t i = 0; i < y.size(); ++i) {
+		const int64_t exact = convolve(h, r, 25*i) >> 19;
+		largest = std::max(largest, std::abs(y[i].toBinary(true) - exact));
+	}
+	BOOST_CHECK(largest <= 2);
+}
+
+BOOST_AUTO_TEST_CASE(wrap) {
+	//A full-scale DC input overflows the integrators but not the output.
+	typedef Fi::CIC<s16_0, 5, 8, 2> Cic;
+	const std::vector<s16_0> x(200, s16_0::fromBinary(-32768));
+	std::vector<Fi::Fixed<32, 16, Fi::SIGNED, Fi::Wrap, Fi::Floor> > y;
+	Cic cic;
+	cic.process(x, y);
+
+	BOOST_CHECK(Cic::WORD_LENGTH == 36);
+	for (std::size_t i = 10; i < y.size(); ++i) {
+		BOOST_CHECK_EQUAL(y[i].toBinary(true), -(int64_t(1) << 31));
+	}
+}
@@ -0,0 +1,407 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#include "fi/Complex.hpp"
+#include "fi/Arena.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Throw.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Ceil.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+#include "fi/rounding/NearOdd.hpp"
+
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+#include "Narrow.hpp"
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE complex
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> s12_10;
+typedef Fi::Fixed<16, 12, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_12;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Saturate, Fi::Fix> s8_4;
+typedef Fi::Fixed<8, 7, Fi::SIGNED, Fi::Wrap, Fi::NearEven> s8_7w;
+typedef Fi::Fixed<8, 6, Fi::SIGNED, Fi::Wrap, Fi::NearEven> s8_6w;
+typedef Fi::Fixed<15, 14, Fi::SIGNED, Fi::Saturate, Fi::NearOdd> s15_14;
+typedef Fi::Fixed<16, 14, Fi::SIGNED, Fi::Saturate, Fi::Ceil> s16_14c;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Floor> s16_15;
+typedef Fi::Fixed<10, 9, Fi::SIGNED, Fi::Throw, Fi::Floor> s10_9t;
+typedef Fi::Fixed<10, 8, Fi::SIGNED, Fi::Throw, Fi::Floor> s10_8t;
+typedef Fi::Fixed<8, 8, Fi::UNSIGNED, Fi::Saturate, Fi::Classic> u8_8;
+typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Wrap, Fi::Classic> s12_10w;
+typedef Fi::Fixed<13, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> s13_10;
+typedef Fi::Fixed<11, 8, Fi::SIGNED, Fi::Saturate, Fi::Floor> s11_8;
+typedef Fi::Fixed<9, 7, Fi::SIGNED, Fi::Wrap, Fi::Fix> s9_7w;
+
+///Exact product rounded once by the double constructor of ProdT
+template<typename ProdT, typename T1, typename T2>
+Fi::Complex<ProdT> reference(const Fi::Complex<T1>& x,
+                             const Fi::Complex<T2>& y)
+{
+
+	double re = x.real().toDouble()*y.real().toDouble() -
+		x.imag().toDouble()*y.imag().toDouble();
+	double im = x.real().toDouble()*y.imag().toDouble() +
+		x.imag().toDouble()*y.real().toDouble();
+
+	return Fi::Complex<ProdT>(ProdT(re), ProdT(im));
+
+}
+
+template<typename T>
+T randomFixed() {
+	return T::fromBinary(static_cast<typename T::valtype>(std::rand()));
+}
+
+template<typename T, typename A>
+void fill(Fi::ComplexVector<T, A>& v) {
+	for (std::size_t i = 0; i < v.size(); ++i) {
+		v.set(i, Fi::Complex<T>(randomFixed<T>(), randomFixed<T>()));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE( scalar )
+
+BOOST_AUTO_TEST_CASE( arithmetic )
+{
+
+	Fi::Complex<s12_10> a(s12_10(0.5), s12_10(-0.25));
+	Fi::Complex<s12_10> b(s12_10(0.75), s12_10(0.125));
+
+	BOOST_CHECK(a + b == Fi::Complex<s12_10>(s12_10(1.25), s12_10(-0.125)));
+	BOOST_CHECK(a - b == Fi::Complex<s12_10>(s12_10(-0.25), s12_10(-0.375)));
+	BOOST_CHECK(-a == Fi::Complex<s12_10>(s12_10(-0.5), s12_10(0.25)));
+	BOOST_CHECK(Fi::conj(a) == Fi::Complex<s12_10>(s12_10(0.5), s12_10(0.25)));
+	BOOST_CHECK(a != b);
+
+	Fi::Complex<s16_12> p = Fi::multiply<s16_12>(a, b);
+	BOOST_CHECK_EQUAL(p.real().toString(), "0.40625");
+	BOOST_CHECK_EQUAL(p.imag().toString(), "-0.125");
+
+	std::ostringstream os;
+	os << a;
+	BOOST_CHECK_EQUAL(os.str(), "(0.5,-0.25)");
+
+}
+
+BOOST_AUTO_TEST_CASE( single_quantization )
+{
+
+	//Rounding each partial product toward zero loses 2^-4 in the real part
+	Fi::Complex<s8_4> a(s8_4(0.0625), s8_4(-0.0625));
+	Fi::Complex<s8_4> b(s8_4(1.5), s8_4(0.5));
+
+	s8_4 composed = a.real()*b.real() - a.imag()*b.imag();
+	BOOST_CHECK_EQUAL(composed.toString(), "0.0625");
+
+	Fi::Complex<s8_4> p = a*b;
+	BOOST_CHECK_EQUAL(p.real().toString(), "0.125");
+	BOOST_CHECK(p == (reference<s8_4>(a, b)));
+
+	for (int i = 0; i < 2000; ++i) {
+
+		Fi::Complex<s12_10> x(randomFixed<s12_10>(), randomFixed<s12_10>());
+		Fi::Complex<s15_14> y(randomFixed<s15_14>(), randomFixed<s15_14>());
+
+		BOOST_CHECK(Fi::multiply<s16_12>(x, y) == (reference<s16_12>(x, y)));
+		BOOST_CHECK(Fi::multiply<s8_4>(x, y) == (reference<s8_4>(x, y)));
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE( three_multipliers )
+{
+
+	for (int i = 0; i < 2000; ++i) {
+
+		Fi::Complex<s16_12> x(s16_12::fromBinary(std::rand() % 30000 - 15000),
+		                      s16_12::fromBinary(std::rand() % 30000 - 15000));
+		Fi::Complex<s16_12> y(s16_12::fromBinary(std::rand() % 30000 - 15000),
+		                      s16_12::fromBinary(std::rand() % 30000 - 15000));
+
+		BOOST_CHECK(Fi::multiply<s16_14c>(x, y) ==
+		            (Fi::multiply<s16_14c, Fi::ThreeMultipliers<> >(x, y)));
+
+	}
+
+	//The pre-adder ar + ai does not fit s12_10 but is not saturated
+	Fi::Complex<s12_10> a(s12_10(1.5), s12_10(1.5));
+	Fi::Complex<s12_10> b(s12_10(1.0), s12_10(0.0));
+
+	Fi::Complex<s16_12> three =
+		Fi::multiply<s16_12, Fi::ThreeMultipliers<> >(a, b);
+
+	BOOST_CHECK_EQUAL(three.imag().toString(), "1.5");
+	BOOST_CHECK_EQUAL(three.real().toString(), "1.5");
+
+	Fi::Complex<s10_9t> c(s10_9t(0.75), s10_9t(0.75));
+	Fi::Complex<s10_9t> d(s10_9t(0.5), s10_9t(0.0));
+	BOOST_CHECK_NO_THROW((Fi::multiply<s10_8t, Fi::ThreeMultipliers<> >(c, d)));
+
+	//Operands of 30 and 31 bits with the largest magnitudes
+	typedef Fi::Fixed<30, 29, Fi::SIGNED, Fi::Saturate, Fi::Classic> s30_29;
+	typedef Fi::Fixed<31, 30, Fi::SIGNED, Fi::Saturate, Fi::Classic> s31_30;
+	Fi::Complex<s30_29> e(s30_29::MinVal(), s30_29::MinVal());
+	Fi::Complex<s31_30> f(s31_30::MinVal(), s31_30::MaxVal());
+	BOOST_CHECK((Fi::multiply<s16_12>(e, f)) ==
+	            (Fi::multiply<s16_12, Fi::ThreeMultipliers<> >(e, f)));
+	BOOST_CHECK((Fi::multiply<s16_12>(e, f)) == (reference<s16_12>(e, f)));
+
+}
+
+/*
+ *Gauss product with the pre-adders quantized to PreT, from the sums
+ *rounded by PreT and the exact products.
+ */
+template<typename ProdT, typename PreT, typename T>
+Fi::Complex<ProdT> gauss(const Fi::Complex<T>& x, const Fi::Complex<T>& y) {
+
+	const std::size_t F = T::FRACTION_LENGTH;
+
+	const int64_t xr = x.real().toBinary(true);
+	const int64_t xi = x.imag().toBinary(true);
+	const int64_t yr = y.real().toBinary(true);
+	const int64_t yi = y.imag().toBinary(true);
+
+	const int64_t k1 = yr*narrow<PreT, F>(xr + xi).toBinary(true);
+	const int64_t k2 = xr*narrow<PreT, F>(yi - yr).toBinary(true);
+	const int64_t k3 = xi*narrow<PreT, F>(yr + yi).toBinary(true);
+
+	const std::size_t FP = F + PreT::FRACTION_LENGTH;
+	return Fi::Complex<ProdT>(narrow<ProdT, FP>(k1 - k3),
+	                          narrow<ProdT, FP>(k1 + k2));
+
+}
+
+BOOST_AUTO_TEST_CASE( pre_adder_format )
+{
+
+	//ar + ai = 3.0 does not fit the pre-adders
+	Fi::Complex<s12_10> a(s12_10(1.5), s12_10(1.5));
+	Fi::Complex<s12_10> b(s12_10(1.0), s12_10(0.0));
+
+	Fi::Complex<s16_12> saturated =
+		Fi::multiply<s16_12, Fi::ThreeMultipliers<s12_10> >(a, b);
+	BOOST_CHECK_EQUAL(saturated.real().toString(), "0.4990234375");
+	BOOST_CHECK_EQUAL(saturated.imag().toString(), "0.4990234375");
+
+	Fi::Complex<s16_12> wrapped =
+		Fi::multiply<s16_12, Fi::ThreeMultipliers<s12_10w> >(a, b);
+	BOOST_CHECK_EQUAL(wrapped.real().toString(), "-2.5");
+	BOOST_CHECK_EQUAL(wrapped.imag().toString(), "-2.5");
+
+	Fi::Complex<s16_12> exact =
+		Fi::multiply<s16_12, Fi::ThreeMultipliers<s13_10> >(a, b);
+	BOOST_CHECK_EQUAL(exact.real().toString(), "1.5");
+	BOOST_CHECK_EQUAL(exact.imag().toString(), "1.5");
+
+	for (int i = 0; i < 2000; ++i) {
+
+		Fi::Complex<s12_10> x(randomFixed<s12_10>(), randomFixed<s12_10>());
+		Fi::Complex<s12_10> y(randomFixed<s12_10>(), randomFixed<s12_10>());
+
+		BOOST_CHECK((Fi::multiply<s16_12, Fi::ThreeMultipliers<s13_10> >(x, y))
+		            == Fi::multiply<s16_12>(x, y));
+		BOOST_CHECK((Fi::multiply<s16_12, Fi::ThreeMultipliers<s12_10> >(x, y))
+		            == (gauss<s16_12, s12_10>(x, y)));
+		BOOST_CHECK((Fi::multiply<s16_12, Fi::ThreeMultipliers<s11_8> >(x, y))
+		            == (gauss<s16_12, s11_8>(x, y)));
+		BOOST_CHECK((Fi::multiply<s8_6w, Fi::ThreeMultipliers<s9_7w> >(x, y))
+		            == (gauss<s8_6w, s9_7w>(x, y)));
+
+	}
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+////////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE( vector )
+
+template<typename ProdT, typename M, typename T1, typename T2>
+void checkMultiply(std::size_t n) {
+
+	Fi::ComplexVector<T1> x(n);
+	Fi::ComplexVector<T2> y(n);
+	Fi::ComplexVector<ProdT> out;
+
+	fill(x);
+	fill(y);
+
+	Fi::multiply<ProdT, M>(x, y, out);
+	BOOST_REQUIRE_EQUAL(out.size(), n);
+
+	for (std::size_t i = 0; i < n; ++i) {
+		BOOST_CHECK(out[i] == (Fi::multiply<ProdT, M>(x[i], y[i])));
+	}
+
+}
+
+template<typename T>
+void checkElementwise(std::size_t n) {
+
+	Fi::ComplexVector<T> x(n);
+	Fi::ComplexVector<T> y(n);
+	Fi::ComplexVector<T> out;
+
+	fill(x);
+	fill(y);
+
+	Fi::add(x, y, out);
+	for (std::size_t i = 0; i < n; ++i) {
+		BOOST_CHECK(out[i] == x[i] + y[i]);
+	}
+
+	Fi::subtract(x, y, out);
+	for (std::size_t i = 0; i < n; ++i) {
+		BOOST_CHECK(out[i] == x[i] - y[i]);
+	}
+
+	Fi::conjugate(x, out);
+	for (std::size_t i = 0; i < n; ++i) {
+		BOOST_CHECK(out[i] == Fi::conj(x[i]));
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE( multiply_matches_scalar )
+{
+
+	const std::size_t sizes[] = {0, 1, 3, 4, 37, 256};
+
+	for (std::size_t k = 0; k < sizeof(sizes)/sizeof(sizes[0]); ++k) {
+
+		std::size_t n = sizes[k];
+
+		checkMultiply<s16_12, Fi::FourMultipliers, s12_10, s12_10>(n);
+		checkMultiply<s16_12, Fi::ThreeMultipliers<>, s12_10, s12_10>(n);
+		checkMultiply<s8_6w, Fi::FourMultipliers, s8_7w, s8_7w>(n);
+		checkMultiply<s8_6w, Fi::ThreeMultipliers<>, s8_7w, s8_7w>(n);
+		checkMultiply<s16_14c, Fi::FourMultipliers, s15_14, s15_14>(n);
+		checkMultiply<s8_4, Fi::ThreeMultipliers<>, s15_14, s15_14>(n);
+		checkMultiply<s16_12, Fi::ThreeMultipliers<s13_10>, s12_10, s12_10>(n);
+		checkMultiply<s16_12, Fi::ThreeMultipliers<s12_10>, s12_10, s12_10>(n);
+		checkMultiply<s8_6w, Fi::ThreeMultipliers<s9_7w>, s8_7w, s8_7w>(n);
+		checkMultiply<s15_14, Fi::FourMultipliers, s15_14, s15_14>(n);
+		checkMultiply<s16_15, Fi::FourMultipliers, s16_15, s16_15>(n);
+		checkMultiply<s16_12, Fi::FourMultipliers, s12_10, s15_14>(n);
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE( multiply_throws )
+{
+
+	Fi::ComplexVector<s10_9t> x(9);
+	Fi::ComplexVector<s10_9t> y(9);
+	Fi::ComplexVector<s10_8t> out;
+
+	for (std::size_t i = 0; i < x.size(); ++i) {
+		x.set(i, Fi::Complex<s10_9t>(s10_9t(0.5), s10_9t(-0.25)));
+		y.set(i, Fi::Complex<s10_9t>(s10_9t(0.25), s10_9t(0.5)));
+	}
+
+	BOOST_CHECK_NO_THROW((Fi::multiply<s10_8t>(x, y, out)));
+	for (std::size_t i = 0; i < out.size(); ++i) {
+		BOOST_CHECK(out[i] == (Fi::multiply<s10_8t>(x[i], y[i])));
+	}
+
+	x.set(5, Fi::Complex<s10_9t>(s10_9t(-1.0), s10_9t(-1.0)));
+	y.set(5, Fi::Complex<s10_9t>(s10_9t(-1.0), s10_9t(0.0)));
+
+	BOOST_CHECK_NO_THROW((Fi::multiply<s10_8t>(x, y, out)));
+	BOOST_CHECK_NO_THROW(
+		(Fi::multiply<s10_8t, Fi::ThreeMultipliers<> >(x, y, out)));
+	BOOST_CHECK(out[5] == (Fi::multiply<s10_8t>(x[5], y[5])));
+
+	x.set(6, Fi::Complex<s10_9t>(s10_9t(-1.0), s10_9t(-1.0)));
+	y.set(6, Fi::Complex<s10_9t>(s10_9t(-1.0), s10_9t(-1.0)));
+	BOOST_CHECK_THROW((Fi::multiply<s10_8t>(x, y, out)), std::overflow_error);
+
+}
+
+BOOST_AUTO_TEST_CASE( elementwise_matches_scalar )
+{
+
+	const std::size_t sizes[] = {0, 1, 3, 4, 37, 256};
+
+	for (std::size_t k = 0; k < sizeof(sizes)/sizeof(sizes[0]); ++k) {
+
+		std::size_t n = sizes[k];
+
+		checkElementwise<s12_10>(n);
+		checkElementwise<s8_7w>(n);
+		checkElementwise<s16_15>(n);
+		checkElementwise<u8_8>(n);
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE( size_mismatch )
+{
+
+	Fi::ComplexVector<s12_10> x(5);
+	Fi::ComplexVector<s12_10> y(4);
+	Fi::ComplexVector<s12_10> out;
+	Fi::ComplexVector<s16_12> prod;
+
+	BOOST_CHECK_THROW(Fi::add(x, y, out), std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::subtract(y, x, out), std::invalid_argument);
+	BOOST_CHECK_THROW((Fi::multiply<s16_12>(x, y, prod)),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW(
+		(Fi::multiply<s16_12, Fi::ThreeMultipliers<> >(y, x, prod)),
+		std::invalid_argument);
+
+}
+
+BOOST_AUTO_TEST_CASE( arena_storage )
+{
+
+	Fi::Arena arena;
+	Fi::ArenaAllocator<s12_10> alloc(arena);
+
+	typedef Fi::ComplexVector<s12_10, Fi::ArenaAllocator<s12_10> > ArenaVec;
+	ArenaVec x(16, alloc);
+	ArenaVec y(16, alloc);
+	ArenaVec out(alloc);
+
+	fill(x);
+	fill(y);
+
+	Fi::add(x, y, out);
+
+	BOOST_CHECK_EQUAL(out.size(), 16u);
+	BOOST_CHECK(out[7] == x[7] + y[7]);
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
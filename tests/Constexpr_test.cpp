@@ -0,0 +1,254 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/Fixed.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Ceil.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+#include "fi/rounding/NearOdd.hpp"
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE constexpr
+#include <boost/test/unit_test.hpp>
+
+#if __cplusplus >= 201402L
+
+using namespace Fi::literals;
+
+typedef Fi::Fixed<16, 12, Fi::SIGNED, Fi::Saturate, Fi::Classic> coef;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Wrap, Fi::Fix> s8_4;
+typedef Fi::Fixed<8, 0, Fi::SIGNED, Fi::Saturate, Fi::Classic> s8_0;
+typedef Fi::Fixed<8, 3, Fi::UNSIGNED, Fi::Saturate, Fi::NearEven> u8_3;
+typedef Fi::Fixed<32, 16, Fi::SIGNED, Fi::Saturate, Fi::Floor> s32_16;
+
+template<typename T>
+constexpr T sumOfSquares(double x, double y) {
+	T a(x);
+	T b(y);
+	return a*a + b*b;
+}
+
+template<typename T>
+constexpr T polynomial(double x) {
+	//Horner's rule for 0.5 + x*(0.25 - x*0.125).
+	T xf(x);
+	T acc(-0.125);
+	acc *= xf;
+	acc += T(0.25);
+	acc *= xf;
+	acc += T(0.5);
+	return acc;
+}
+
+template<typename T, std::size_t N>
+struct Values {
+	T v[N];
+};
+
+template<typename T, std::size_t N>
+constexpr Values<T, N> values(double start, double step) {
+	Values<T, N> ret = {};
+	for (std::size_t i = 0; i < N; ++i) {
+		ret.v[i] = T(start + step*i);
+	}
+	return ret;
+}
+
+template<typename T>
+void checkArithmetic(const T& constant, double x, double y) {
+	T a(x);
+	T b(y);
+	BOOST_CHECK_EQUAL(constant.toBinary(), (a*a + b*b).toBinary());
+}
+
+BOOST_AUTO_TEST_CASE(construction_test) {
+
+	constexpr coef pi(3.14159);
+	static_assert(pi.toBinary() == 12868, "");
+	BOOST_CHECK_EQUAL(pi.toBinary(), coef(3.14159).toBinary());
+
+	constexpr s8_4 negative(-1.53);
+	static_assert(negative.toBinary(true) == -24, "");
+	BOOST_CHECK_EQUAL(negative.toBinary(), s8_4(-1.53).toBinary());
+
+	constexpr s8_4 raw = s8_4::fromBinary(0xF8);
+	static_assert(raw.toBinary(true) == -8, "");
+	static_assert(raw.toDouble() == -0.5, "");
+
+	static_assert(coef::MaxVal().toBinary() == 32767, "");
+	static_assert(coef::MinVal().toBinary(true) == -32768, "");
+	static_assert(coef().toBinary() == 0, "");
+
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic_test) {
+
+	constexpr coef c = sumOfSquares<coef>(1.3, -0.7);
+	checkArithmetic(c, 1.3, -0.7);
+
+	constexpr s8_0 i = sumOfSquares<s8_0>(3, 4);
+	static_assert(i.toBinary() == 25, "");
+	checkArithmetic(i, 3, 4);
+
+	constexpr u8_3 u = sumOfSquares<u8_3>(1.375, 2.625);
+	checkArithmetic(u, 1.375, 2.625);
+
+	constexpr s32_16 s = sumOfSquares<s32_16>(-12.3456, 100.001);
+	checkArithmetic(s, -12.3456, 100.001);
+
+	constexpr coef p = polynomial<coef>(0.8);
+	BOOST_CHECK_EQUAL(p.toBinary(), polynomial<coef>(0.8).toBinary());
+
+	constexpr coef q = coef(3.0) / coef(4.0);
+	static_assert(q.toDouble() == 0.75, "");
+
+	constexpr coef r = std::abs(coef(-1.5));
+	static_assert(r == coef(1.5), "");
+	static_assert(coef(-1.5) < coef(1.5), "");
+	static_assert(Fi::max(coef(-1.5), coef(1.25)) == coef(1.25), "");
+
+	constexpr s8_4 shifted = (s8_4(1.5) << 1) | s8_4(0.0625);
+	static_assert(shifted.toBinary() == 0x31, "");
+
+}
+
+BOOST_AUTO_TEST_CASE(rounding_test) {
+
+	typedef Fi::Fixed<8, 2, Fi::SIGNED, Fi::Saturate, Fi::Ceil> ceil;
+	typedef Fi::Fixed<8, 2, Fi::SIGNED, Fi::Saturate, Fi::Floor> floor;
+	typedef Fi::Fixed<8, 2, Fi::SIGNED, Fi::Saturate, Fi::Fix> fix;
+	typedef Fi::Fixed<8, 2, Fi::SIGNED, Fi::Saturate, Fi::Classic> classic;
+	typedef Fi::Fixed<8, 2, Fi::SIGNED, Fi::Saturate, Fi::NearEven> even;
+	typedef Fi::Fixed<8, 2, Fi::SIGNED, Fi::Saturate, Fi::NearOdd> odd;
+
+	static_assert(ceil(-0.6).toBinary(true) == -2, "");
+	static_assert(floor(-0.6).toBinary(true) == -3, "");
+	static_assert(fix(-0.6).toBinary(true) == -2, "");
+	static_assert(classic(-0.625).toBinary(true) == -3, "");
+	static_assert(even(0.625).toBinary() == 2, "");
+	static_assert(odd(0.625).toBinary() == 3, "");
+
+	//Products are rounded to 2 fractional bits: 0.75*0.75 = 0.5625.
+	static_assert((ceil(0.75)*ceil(0.75)).toBinary() == 3, "");
+	static_assert((floor(0.75)*floor(0.75)).toBinary() == 2, "");
+	static_assert((classic(0.75)*classic(0.75)).toBinary() == 2, "");
+	static_assert((even(0.75)*even(0.75)).toBinary() == 2, "");
+	static_assert((odd(0.75)*odd(0.75)).toBinary() == 2, "");
+
+	constexpr Values<even, 129> table = values<even, 129>(-4.0, 0.0625);
+	for (std::size_t i = 0; i < 129; ++i) {
+		BOOST_CHECK_EQUAL(table.v[i].toBinary(),
+		                  even(-4.0 + 0.0625*i).toBinary());
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(fraction_length_edges_test) {
+
+	//The half weight of the rounding modes used to be 1 << (F - 1) in an
+	//int. With F = 0 that shift is undefined, and products were off by
+	//one depending on the optimization level; with F = 32 it overflowed
+	//to a negative number, and ties were never rounded up.
+	typedef Fi::Fixed<8, 0, Fi::SIGNED, Fi::Wrap, Fi::Classic> classic0;
+	typedef Fi::Fixed<16, 0, Fi::SIGNED, Fi::Wrap, Fi::NearEven> even0;
+	typedef Fi::Fixed<8, 0, Fi::UNSIGNED, Fi::Wrap, Fi::NearOdd> odd0;
+	typedef Fi::Fixed<32, 32, Fi::UNSIGNED, Fi::Wrap, Fi::Classic> classic32;
+	typedef Fi::Fixed<32, 32, Fi::UNSIGNED, Fi::Wrap, Fi::NearEven> even32;
+	typedef Fi::Fixed<32, 32, Fi::UNSIGNED, Fi::Wrap, Fi::NearOdd> odd32;
+
+	//Without fractional bits, products are exact.
+	for (int a = -6; a <= 6; ++a) {
+		for (int b = -3; b <= 3; ++b) {
+			BOOST_CHECK_EQUAL((classic0(a)*classic0(b)).toBinary(true), a*b);
+			BOOST_CHECK_EQUAL((even0(a)*even0(b)).toBinary(true), a*b);
+		}
+	}
+	BOOST_CHECK_EQUAL((odd0(5.0)*odd0(3.0)).toBinary(), 15u);
+	static_assert((classic0(3.0)*classic0(-3.0)).toBinary(true) == -9, "");
+
+	//(1 - 2^-32)*0.5 is half an LSB below 0.5: was 0x7FFFFFFF.
+	const classic32 max = classic32::MaxVal();
+	const classic32 half = classic32::fromBinary(0x80000000u);
+	BOOST_CHECK_EQUAL((max*half).toBinary(), 0x80000000u);
+
+	//0.5*3 LSB is a tie between 1 and 2: was 1 for both.
+	BOOST_CHECK_EQUAL((even32::fromBinary(0x80000000u)*
+	                   even32::fromBinary(3)).toBinary(), 2u);
+	BOOST_CHECK_EQUAL((odd32::fromBinary(0x80000000u)*
+	                   odd32::fromBinary(3)).toBinary(), 1u);
+	//0.5*1 LSB is a tie between 0 and 1: was 0 for both.
+	BOOST_CHECK_EQUAL((even32::fromBinary(0x80000000u)*
+	                   even32::fromBinary(1)).toBinary(), 0u);
+	BOOST_CHECK_EQUAL((odd32::fromBinary(0x80000000u)*
+	                   odd32::fromBinary(1)).toBinary(), 1u);
+
+	static_assert(classic32::TR::F_HALF == 0x80000000u, "");
+	static_assert(classic0::TR::F_HALF == 1, "");
+
+}
+
+BOOST_AUTO_TEST_CASE(overflow_test) {
+
+	constexpr coef saturated(100.0);
+	static_assert(saturated == coef::MaxVal(), "");
+
+	constexpr coef sum = coef(7.5) + coef(7.5);
+	static_assert(sum == coef::MaxVal(), "");
+
+	constexpr s8_4 wrapped = s8_4(7.5) + s8_4(1.0);
+	static_assert(wrapped.toBinary(true) == -120, "");
+	BOOST_CHECK_EQUAL(wrapped.toBinary(), (s8_4(7.5) + s8_4(1.0)).toBinary());
+
+}
+
+BOOST_AUTO_TEST_CASE(literal_test) {
+
+	constexpr coef pi = 3.14159_fx;
+	constexpr coef twoPi = pi + pi;
+	static_assert(twoPi.toBinary() == 25736, "");
+
+	constexpr s8_0 three = 3_fx;
+	static_assert(three.toBinary() == 3, "");
+	static_assert((three*three).toBinary() == 9, "");
+
+	constexpr s8_4 half = 0.5_fx;
+	static_assert(half.toBinary() == 8, "");
+
+	constexpr u8_3 large = 1000.0_fx;
+	static_assert(large == u8_3::MaxVal(), "");
+
+	coef runTime = 3.14159_fx;
+	BOOST_CHECK(runTime == pi);
+
+}
+
+#else
+
+BOOST_AUTO_TEST_CASE(unsupported_test) {
+	BOOST_TEST_MESSAGE("constexpr support requires C++14");
+}
+
+#endif
@@ -0,0 +1,249 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/Cordic.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Throw.hpp"
+#include "fi/overflow/Wrap.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE cordic
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<16, 14, Fi::SIGNED, Fi::Saturate> s16_14;
+typedef Fi::Fixed<16, 13, Fi::SIGNED, Fi::Saturate> a16_13;
+typedef Fi::Fixed<24, 20, Fi::SIGNED, Fi::Saturate> s24_20;
+typedef Fi::Fixed<24, 20, Fi::SIGNED, Fi::Wrap> a24_20;
+typedef Fi::Fixed<29, 20, Fi::SIGNED, Fi::Saturate> s29_20;
+typedef Fi::Fixed<32, 26, Fi::SIGNED, Fi::Saturate> s32_26;
+typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Throw> t12_10;
+
+/**
+ *Reference written from the definition of the iterations, with the
+ *constants rounded from their floating-point values.
+ */
+template<typename FixedT, std::size_t N, typename AngleT>
+struct Reference {
+
+	static int64_t angle(std::size_t i) {
+		double a = std::atan(std::ldexp(1.0, -static_cast<int>(i)));
+		return static_cast<int64_t>(std::floor(
+			std::ldexp(a, AngleT::FRACTION_LENGTH) + 0.5));
+	}
+
+	static int64_t gain() {
+		double k = 1.0;
+		for (std::size_t i = 0; i < N; ++i) {
+			k /= std::sqrt(1.0 + std::ldexp(1.0, -2*static_cast<int>(i)));
+		}
+		return static_cast<int64_t>(std::floor(
+			std::ldexp(k, FixedT::FRACTION_LENGTH) + 0.5));
+	}
+
+	static void iterate(int64_t& x, int64_t& y, int64_t& z, bool vectoring) {
+		for (std::size_t i = 0; i < N; ++i) {
+			int64_t d = vectoring ? ((y < 0) ? 1 : -1) : ((z >= 0) ? 1 : -1);
+			int64_t xs = x >> i;
+			int64_t ys = y >> i;
+			x -= d*ys;
+			y += d*xs;
+			z -= d*angle(i);
+		}
+	}
+
+	static int64_t raw(double v, std::size_t f) {
+		return static_cast<int64_t>(std::floor(std::ldexp(v, f) + 0.5));
+	}
+
+};
+
+template<typename FixedT>
+FixedT random(double range) {
+	double v = range*(2.0*std::rand()/RAND_MAX - 1.0);
+	return FixedT(v);
+}
+
+template<typename FixedT, std::size_t N, typename AngleT>
+void checkModes() {
+
+	typedef Fi::Cordic<FixedT, N, AngleT> C;
+	typedef Reference<FixedT, N, AngleT> R;
+
+	for (std::size_t i = 0; i < N; ++i) {
+		BOOST_CHECK_EQUAL(C::angle(i).toBinary(true), R::angle(i));
+	}
+	BOOST_CHECK_EQUAL(C::compensation().toBinary(true), R::gain());
+
+	for (int t = 0; t < 200; ++t) {
+
+		FixedT x = random<FixedT>(0.5);
+		FixedT y = random<FixedT>(0.5);
+		AngleT z = random<AngleT>(1.7);
+
+		int64_t rx = x.toBinary(true);
+		int64_t ry = y.toBinary(true);
+		int64_t rz = z.toBinary(true);
+		R::iterate(rx, ry, rz, false);
+		C::rotation(x, y, z);
+		BOOST_CHECK_EQUAL(x.toBinary(true), rx);
+		BOOST_CHECK_EQUAL(y.toBinary(true), ry);
+		BOOST_CHECK_EQUAL(z.toBinary(true), rz);
+
+		x = FixedT(std::fabs(random<FixedT>(0.5).toDouble()));
+		y = random<FixedT>(0.5);
+		z = AngleT(0.0);
+		rx = x.toBinary(true);
+		ry = y.toBinary(true);
+		rz = 0;
+		R::iterate(rx, ry, rz, true);
+		C::vectoring(x, y, z);
+		BOOST_CHECK_EQUAL(x.toBinary(true), rx);
+		BOOST_CHECK_EQUAL(y.toBinary(true), ry);
+		BOOST_CHECK_EQUAL(z.toBinary(true), rz);
+
+	}
+
+}
+
+template<typename FixedT, std::size_t N, typename AngleT>
+void checkBatch(double range) {
+
+	typedef Fi::Cordic<FixedT, N, AngleT> C;
+
+	const std::size_t n = 103;
+	std::vector<AngleT> a(n);
+	std::vector<FixedT> x(n);
+	std::vector<FixedT> y(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		a[i] = random<AngleT>(3.14);
+		x[i] = random<FixedT>(range);
+		y[i] = random<FixedT>(range);
+	}
+	x[0] = FixedT(-range);
+	y[0] = FixedT(0.0);
+	a[1] = AngleT(3.14);
+	x[2] = FixedT(0.0);
+	y[2] = FixedT(0.0);
+
+	std::vector<FixedT> s(n);
+	std::vector<FixedT> c(n);
+	std::vector<AngleT> t(n);
+	std::vector<FixedT> m(n);
+	C::sincos(&a[0], &s[0], &c[0], n);
+	C::atan2(&y[0], &x[0], &t[0], n);
+	C::magnitude(&x[0], &y[0], &m[0], n);
+
+	for (std::size_t i = 0; i < n; ++i) {
+		FixedT si;
+		FixedT ci;
+		C::sincos(a[i], si, ci);
+		BOOST_CHECK_EQUAL(s[i].toBinary(true), si.toBinary(true));
+		BOOST_CHECK_EQUAL(c[i].toBinary(true), ci.toBinary(true));
+		BOOST_CHECK_EQUAL(t[i].toBinary(true),
+		                  C::atan2(y[i], x[i]).toBinary(true));
+		BOOST_CHECK_EQUAL(m[i].toBinary(true),
+		                  C::magnitude(x[i], y[i]).toBinary(true));
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(bit_exact_modes) {
+	std::srand(1);
+	checkModes<s16_14, 12, a16_13>();
+	checkModes<s24_20, 20, a24_20>();
+	checkModes<s16_14, 1, s16_14>();
+}
+
+BOOST_AUTO_TEST_CASE(accuracy) {
+
+	typedef Fi::Cordic<s24_20, 20, a24_20> C;
+	const double eps = 2e-5;
+
+	for (double a = -3.14; a <= 3.14; a += 0.01) {
+
+		s24_20 s;
+		s24_20 c;
+		C::sincos(a24_20(a), s, c);
+		BOOST_CHECK_SMALL(s.toDouble() - std::sin(a), eps);
+		BOOST_CHECK_SMALL(c.toDouble() - std::cos(a), eps);
+		BOOST_CHECK_SMALL(C::atan2(s, c).toDouble() - a, eps);
+		BOOST_CHECK_SMALL(C::magnitude(c, s).toDouble() - 1.0, eps);
+
+		const s24_20 x(2.0*std::fabs(a)*c.toDouble());
+		const s24_20 y(2.0*std::fabs(a)*s.toDouble());
+		BOOST_CHECK_SMALL(C::magnitude(x, y).toDouble() -
+		                  std::sqrt(x.toDouble()*x.toDouble() +
+		                            y.toDouble()*y.toDouble()), 4*eps);
+
+	}
+
+	BOOST_CHECK_EQUAL(C::atan2(s24_20(0.0), s24_20(-1.0)).toDouble(),
+	                  C::atan2(s24_20(0.0), s24_20(-0.5)).toDouble());
+	BOOST_CHECK_SMALL(C::atan2(s24_20(0.0), s24_20(-1.0)).toDouble() - M_PI,
+	                  eps);
+	BOOST_CHECK_EQUAL(C::atan2(s24_20(0.0), s24_20(0.0)).toBinary(), 0);
+
+	BOOST_CHECK_EQUAL(C::sqrt(s24_20(0.0)).toDouble(), 0.0);
+	for (double v = 1e-4; v < 7.0; v *= 1.37) {
+		BOOST_CHECK_SMALL(C::sqrt(s24_20(v)).toDouble() -
+		                  std::sqrt(s24_20(v).toDouble()), eps);
+	}
+	typedef Fi::Cordic<s32_26, 26> Wide;
+	BOOST_CHECK_SMALL(Wide::sqrt(s32_26(31.0)).toDouble() - std::sqrt(31.0),
+	                  1e-6);
+
+}
+
+BOOST_AUTO_TEST_CASE(batch) {
+	std::srand(2);
+	checkBatch<s16_14, 14, a16_13>(1.9);
+	checkBatch<s24_20, 20, a24_20>(7.9);
+	checkBatch<s29_20, 24, a24_20>(255.0);
+	checkBatch<s32_26, 26, s32_26>(31.0);
+}
+
+BOOST_AUTO_TEST_CASE(overflow) {
+
+	typedef Fi::Cordic<t12_10, 10> C;
+
+	BOOST_CHECK_THROW(C::magnitude(t12_10(1.9), t12_10(1.9)),
+	                  std::overflow_error);
+	BOOST_CHECK_THROW(C::sqrt(t12_10(-0.5)), std::domain_error);
+	BOOST_CHECK_THROW(C::angle(10), std::invalid_argument);
+
+	std::vector<t12_10> x(8, t12_10(1.9));
+	std::vector<t12_10> m(8);
+	BOOST_CHECK_THROW(C::magnitude(&x[0], &x[0], &m[0], 8),
+	                  std::overflow_error);
+
+	x[0] = t12_10(0.5);
+	C::magnitude(&x[0], &x[0], &m[0], 1);
+	BOOST_CHECK_SMALL(m[0].toDouble() - std::sqrt(0.5), 0.01);
+
+}
@@ -0,0 +1,264 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/DynFixed.hpp"
+
+#include <cstdlib>
+#include <sstream>
+#if __cplusplus >= 201103L
+#include <type_traits>
+#endif
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE dyn_fixed
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<4, 4, Fi::SIGNED, Fi::Wrap, Fi::Fix> s4_4;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Saturate, Fi::Classic> s8_4;
+typedef Fi::Fixed<8, 3, Fi::UNSIGNED, Fi::Wrap, Fi::Ceil> u8_3;
+typedef Fi::Fixed<6, 6, Fi::UNSIGNED, Fi::Saturate, Fi::Floor> u6_6;
+typedef Fi::Fixed<12, 6, Fi::SIGNED, Fi::Wrap, Fi::NearEven> s12_6;
+typedef Fi::Fixed<16, 8, Fi::UNSIGNED, Fi::Saturate, Fi::Classic> u16_8;
+typedef Fi::Fixed<20, 4, Fi::UNSIGNED, Fi::StickySaturate, Fi::NearOdd> u20_4;
+typedef Fi::Fixed<32, 24, Fi::UNSIGNED, Fi::Wrap, Fi::Fix> u32_24;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Floor> s16_15;
+typedef Fi::Fixed<24, 10, Fi::SIGNED, Fi::StickyWrap, Fi::NearOdd> s24_10;
+typedef Fi::Fixed<32, 16, Fi::SIGNED, Fi::StickySaturate, Fi::Ceil> s32_16;
+
+uint64_t random64() {
+	return (uint64_t(std::rand()) << 40) ^ (uint64_t(std::rand()) << 20) ^
+		uint64_t(std::rand());
+}
+
+int64_t randomBinary(const Fi::DynFormat& format) {
+	uint64_t span = format.maxVal() - format.minVal() + 1;
+	return format.minVal() + static_cast<int64_t>(random64() % span);
+}
+
+std::string randomString(const Fi::DynFormat& format) {
+
+	std::ostringstream os;
+
+	if ((format.signedness() == Fi::SIGNED) && (std::rand() % 2 == 0)) {
+		os << '-';
+	}
+
+	//Up to twice the range of the integer part.
+	std::size_t i = format.wordLength() - format.fractionLength() + 1;
+	os << (random64() % (uint64_t(1) << i)) << '.';
+
+	for (int n = std::rand() % 12; n >= 0; --n) {
+		os << std::rand() % 10;
+	}
+
+	return os.str();
+
+}
+
+template<typename FixedT>
+void checkEqual(const Fi::DynFixed& d, const FixedT& x) {
+	BOOST_CHECK_EQUAL(d.toBinary(true), static_cast<int64_t>(x.toBinary(true)));
+	BOOST_CHECK_EQUAL(d.toString(), x.toString());
+}
+
+/*
+ *Random operations on DynFixed and Fixed numbers of the same format must
+ *give the same results.
+ */
+template<typename FixedT>
+void compare() {
+
+	const Fi::DynFormat& format = Fi::DynFormat::of<FixedT>();
+
+	for (int i = 0; i < 2000; ++i) {
+
+		FixedT x = FixedT::fromBinary(randomBinary(format));
+		FixedT y = FixedT::fromBinary(randomBinary(format));
+		Fi::DynFixed a(x);
+		Fi::DynFixed b(y);
+		std::size_t pos = std::rand() % 4;
+
+		checkEqual(a, x);
+		checkEqual(a + b, x + y);
+		checkEqual(a - b, x - y);
+		checkEqual(a * b, x * y);
+		if (y != FixedT()) {
+			checkEqual(a / b, x / y);
+		}
+		checkEqual(-a, -x);
+		checkEqual(~a, ~x);
+		checkEqual(a | b, x | y);
+		checkEqual(a & b, x & y);
+		checkEqual(a ^ b, x ^ y);
+		checkEqual(a << pos, x << pos);
+		checkEqual(a >> pos, x >> pos);
+
+		BOOST_CHECK_EQUAL(a < b, x < y);
+		BOOST_CHECK_EQUAL(a == b, x == y);
+		BOOST_CHECK_EQUAL(a.toDouble(), x.toDouble());
+		BOOST_CHECK_EQUAL(a.toFloat(), x.toFloat());
+		BOOST_CHECK_EQUAL(a.integer(), x.integer());
+		BOOST_CHECK_EQUAL(a.fraction(), x.fraction());
+		BOOST_CHECK_EQUAL(a.toBinaryString(), x.toBinaryString());
+		BOOST_CHECK(a.toFixed<FixedT>() == x);
+
+		double f = (3.0*std::rand()/RAND_MAX - 1.5)*
+			(format.maxVal() - format.minVal())/
+			std::pow(2.0, static_cast<double>(format.fractionLength()));
+		checkEqual(Fi::DynFixed(format, f), FixedT(f));
+
+		std::string str = randomString(format);
+		checkEqual(Fi::DynFixed(format, str), FixedT(str));
+
+	}
+
+	checkEqual(Fi::DynFixed::MaxVal(format), FixedT::MaxVal());
+	checkEqual(Fi::DynFixed::MinVal(format), FixedT::MinVal());
+
+}
+
+BOOST_AUTO_TEST_CASE(compare_test) {
+
+	std::srand(1);
+
+	compare<s4_4>();
+	compare<s8_4>();
+	compare<u8_3>();
+	compare<u6_6>();
+	compare<s12_6>();
+	compare<u16_8>();
+	compare<u20_4>();
+	compare<u32_24>();
+	compare<s16_15>();
+	compare<s24_10>();
+	compare<s32_16>();
+
+}
+
+/*
+ *Conversion between formats must match Fixed::fromFixed().
+ */
+template<typename SrcT, typename DstT>
+void compareConversion() {
+
+	const Fi::DynFormat& format = Fi::DynFormat::of<SrcT>();
+
+	for (int i = 0; i < 500; ++i) {
+		SrcT x = SrcT::fromBinary(randomBinary(format));
+		checkEqual(Fi::DynFixed(x).convert(Fi::DynFormat::of<DstT>()),
+		           DstT::fromFixed(x));
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(conversion_test) {
+
+	std::srand(2);
+
+	compareConversion<s8_4, s12_6>();
+	compareConversion<s12_6, s16_15>();
+	compareConversion<s24_10, s32_16>();
+	compareConversion<s12_6, s8_4>();
+	compareConversion<s16_15, s24_10>();
+	compareConversion<u6_6, u8_3>();
+
+}
+
+BOOST_AUTO_TEST_CASE(format_test) {
+
+	BOOST_CHECK_THROW(Fi::DynFormat(0, 0, Fi::SIGNED, Fi::SATURATE_OVERFLOW,
+	                                Fi::CLASSIC_ROUNDING),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::DynFormat(33, 0, Fi::SIGNED, Fi::SATURATE_OVERFLOW,
+	                                Fi::CLASSIC_ROUNDING),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::DynFormat(8, 9, Fi::SIGNED, Fi::SATURATE_OVERFLOW,
+	                                Fi::CLASSIC_ROUNDING),
+	                  std::invalid_argument);
+
+	Fi::DynFormat format(8, 4, Fi::SIGNED, Fi::SATURATE_OVERFLOW,
+	                     Fi::CLASSIC_ROUNDING);
+	BOOST_CHECK(format == Fi::DynFormat::of<s8_4>());
+	BOOST_CHECK(format != Fi::DynFormat::of<s12_6>());
+	BOOST_CHECK_EQUAL(format.wordLength(), 8u);
+	BOOST_CHECK_EQUAL(format.fractionLength(), 4u);
+	BOOST_CHECK_EQUAL(format.maxVal(), 127);
+	BOOST_CHECK_EQUAL(format.minVal(), -128);
+
+	//Equal formats may be different objects.
+	Fi::DynFixed a(format, "2.5");
+	Fi::DynFixed b(s8_4(1.25));
+	BOOST_CHECK_EQUAL((a + b).toString(), "3.75");
+	BOOST_CHECK(b < a);
+
+	std::ostringstream os;
+	os << a*b;
+	BOOST_CHECK_EQUAL(os.str(), "3.125");
+
+	Fi::DynFixed c(Fi::DynFormat::of<s12_6>());
+	BOOST_CHECK_THROW(a + c, std::invalid_argument);
+
+#if __cplusplus >= 201103L
+	//Numbers cannot refer to a temporary format.
+	static_assert(!std::is_constructible<Fi::DynFixed, Fi::DynFormat>::value,
+	              "");
+	static_assert(!std::is_constructible<Fi::DynFixed, Fi::DynFormat,
+	              double>::value, "");
+	static_assert(!std::is_constructible<Fi::DynFixed, Fi::DynFormat,
+	              std::string>::value, "");
+	static_assert(std::is_constructible<Fi::DynFixed, Fi::DynFormat&,
+	              double>::value, "");
+#endif
+	BOOST_CHECK_THROW(a == c, std::invalid_argument);
+	BOOST_CHECK_THROW(a.toFixed<s12_6>(), std::invalid_argument);
+
+}
+
+BOOST_AUTO_TEST_CASE(overflow_test) {
+
+	typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Throw, Fi::Fix> fixed;
+	Fi::DynFormat format(8, 4, Fi::SIGNED, Fi::THROW_OVERFLOW,
+	                     Fi::FIX_ROUNDING);
+
+	Fi::DynFixed max = Fi::DynFixed::MaxVal(format);
+	Fi::DynFixed min = Fi::DynFixed::MinVal(format);
+	Fi::DynFixed step = Fi::DynFixed::fromBinary(format, 1);
+
+	BOOST_CHECK_THROW(max + step, Fi::PositiveOverflow);
+	BOOST_CHECK_THROW(min - step, Fi::NegativeOverflow);
+	BOOST_CHECK_THROW(Fi::DynFixed(format, 8.0), Fi::PositiveOverflow);
+	BOOST_CHECK_THROW(Fi::DynFixed(format, "-8.0625"), Fi::NegativeOverflow);
+	BOOST_CHECK_THROW(Fi::DynFixed(format, "1.2.3"), std::invalid_argument);
+	BOOST_CHECK_THROW(fixed("-8.0625"), Fi::NegativeOverflow);
+
+	checkEqual(Fi::DynFixed(format, "-8.0"), fixed("-8.0"));
+	checkEqual(Fi::DynFixed(format, 7.99), fixed(7.99));
+
+	Fi::clearOverflowFlags();
+	Fi::DynFormat sticky(8, 4, Fi::SIGNED, Fi::STICKY_SATURATE_OVERFLOW,
+	                     Fi::FIX_ROUNDING);
+	Fi::DynFixed x(sticky, 100.0);
+	BOOST_CHECK_EQUAL(x.toString(), "7.9375");
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::POSITIVE_OVERFLOW));
+	Fi::clearOverflowFlags();
+
+}
@@ -0,0 +1,241 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/Explore.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Throw.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE explore
+#include <boost/test/unit_test.hpp>
+
+struct Classic {
+	static const char* name() { return "classic"; }
+};
+
+struct Truncate {
+	static const char* name() { return "truncate"; }
+};
+
+//A rounding mode defined outside the library.
+template<typename T>
+struct NoRounding : Fi::Fix<T> {
+};
+
+//Quantizes its inputs.
+struct Quantize {
+
+	std::vector<double> in;
+
+	template<typename FixedT>
+	void run(std::vector<double>& out) const {
+		for (std::size_t i = 0; i < in.size(); ++i) {
+			out.push_back(FixedT(in[i]).toDouble());
+		}
+	}
+
+};
+
+//Moving average of four inputs.
+struct Average {
+
+	std::vector<double> in;
+
+	template<typename FixedT>
+	void run(std::vector<double>& out) const {
+		const FixedT quarter(0.25);
+		for (std::size_t i = 3; i < in.size(); ++i) {
+			FixedT acc;
+			for (std::size_t j = 0; j < 4; ++j) {
+				acc += quarter*FixedT(in[i - j]);
+			}
+			out.push_back(acc.toDouble());
+		}
+	}
+
+};
+
+struct Short {
+	template<typename FixedT>
+	void run(std::vector<double>& out) const {
+		out.push_back(FixedT().toDouble());
+	}
+};
+
+//Throws an exception that does not derive from std::exception.
+struct Fails {
+	template<typename FixedT>
+	void run(std::vector<double>&) const {
+		throw FixedT::WORD_LENGTH;
+	}
+};
+
+std::vector<double> inputs(std::size_t n) {
+	std::vector<double> x(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		x[i] = 1.9*std::rand()/RAND_MAX - 0.95;
+	}
+	return x;
+}
+
+typedef Fi::FormatGrid<4, 12, 2, 10, Fi::SIGNED,
+                       Fi::Saturate, Fi::Classic, Classic> classic;
+typedef Fi::FormatGrid<4, 12, 2, 10, Fi::SIGNED,
+                       Fi::Saturate, Fi::Fix, Truncate> truncated;
+
+BOOST_AUTO_TEST_CASE(grid_test) {
+
+	Quantize q;
+	q.in = inputs(200);
+
+	const std::vector<Fi::Exploration> r = Fi::explore<classic>(q, q.in, 3);
+
+	//Each word length from 4 to 12 has fraction lengths from 2 to the
+	//smaller of 10 and the word length.
+	std::size_t n = 0;
+	for (std::size_t w = 4; w <= 12; ++w) {
+		for (std::size_t f = 2; f <= std::min<std::size_t>(w, 10); ++f) {
+			BOOST_REQUIRE(n < r.size());
+			BOOST_CHECK_EQUAL(r[n].label, "classic");
+			BOOST_CHECK(r[n].signedness == Fi::SIGNED);
+			BOOST_CHECK_EQUAL(r[n].wordLength, w);
+			BOOST_CHECK_EQUAL(r[n].fractionLength, f);
+			BOOST_CHECK_EQUAL(r[n].overflow, "saturate");
+			BOOST_CHECK_EQUAL(r[n].rounding, "classic");
+
+			//Inputs in (-1, 1) do not overflow with an integer bit, and
+			//most do without a sign bit.
+			if (w > f + 1) {
+				BOOST_CHECK(r[n].maxError <= std::ldexp(1.0, -(int)f - 1));
+			}
+			else if (w == f) {
+				BOOST_CHECK(r[n].maxError > 0.4);
+			}
+			++n;
+		}
+	}
+	BOOST_CHECK_EQUAL(r.size(), n);
+	BOOST_CHECK_EQUAL(r[0].format(), "s4.2");
+
+}
+
+BOOST_AUTO_TEST_CASE(thread_test) {
+
+	Average a;
+	a.in = inputs(500);
+
+	std::vector<double> reference;
+	for (std::size_t i = 3; i < a.in.size(); ++i) {
+		reference.push_back(
+			0.25*(a.in[i] + a.in[i - 1] + a.in[i - 2] + a.in[i - 3]));
+	}
+
+	typedef Fi::FormatGrids<classic, truncated> grids;
+
+	const std::vector<Fi::Exploration> r1 =
+		Fi::explore<grids>(a, reference, 1);
+	const std::vector<Fi::Exploration> r4 =
+		Fi::explore<grids>(a, reference, 4);
+	const std::vector<Fi::Exploration> r =
+		Fi::explore<grids>(a, reference);
+
+	BOOST_REQUIRE_EQUAL(r1.size(), r4.size());
+	BOOST_REQUIRE_EQUAL(r1.size(), r.size());
+	for (std::size_t i = 0; i < r1.size(); ++i) {
+		BOOST_CHECK_EQUAL(r1[i].format(), r4[i].format());
+		BOOST_CHECK_EQUAL(r1[i].label, r4[i].label);
+		BOOST_CHECK_EQUAL(r1[i].rmsError, r4[i].rmsError);
+		BOOST_CHECK_EQUAL(r1[i].maxError, r4[i].maxError);
+		BOOST_CHECK_EQUAL(r1[i].rmsError, r[i].rmsError);
+	}
+	BOOST_CHECK_EQUAL(r1.front().label, "classic");
+	BOOST_CHECK_EQUAL(r1.back().label, "truncate");
+	BOOST_CHECK_EQUAL(r1.back().rounding, "fix");
+
+	//No result of the front is dominated.
+	const std::vector<Fi::Exploration> p = Fi::paretoFront(r1);
+	BOOST_REQUIRE(!p.empty());
+	for (std::size_t i = 0; i < p.size(); ++i) {
+		if (i > 0) {
+			BOOST_CHECK(p[i].wordLength > p[i - 1].wordLength);
+			BOOST_CHECK(p[i].rmsError < p[i - 1].rmsError);
+		}
+		for (std::size_t j = 0; j < r1.size(); ++j) {
+			BOOST_CHECK(r1[j].wordLength > p[i].wordLength ||
+			            r1[j].rmsError >= p[i].rmsError);
+		}
+	}
+
+	//Beyond one integer bit, the most accurate result has the largest
+	//fraction length.
+	BOOST_CHECK_EQUAL(p.back().wordLength, 11u);
+	BOOST_CHECK_EQUAL(p.back().fractionLength, 10u);
+	BOOST_CHECK_EQUAL(p.back().label, "classic");
+
+	std::ostringstream os;
+	Fi::reportExploration(os, p);
+	BOOST_CHECK(os.str().find(p.back().format()) != std::string::npos);
+	BOOST_CHECK(os.str().find("saturate") != std::string::npos);
+
+}
+
+BOOST_AUTO_TEST_CASE(error_test) {
+
+	Quantize q;
+	q.in = inputs(50);
+
+	//Formats that overflow throw, and have an infinite error.
+	typedef Fi::FormatGrid<6, 6, 4, 6, Fi::SIGNED,
+	                       Fi::Throw, Fi::Classic> throwing;
+	const std::vector<Fi::Exploration> r = Fi::explore<throwing>(q, q.in);
+	BOOST_REQUIRE_EQUAL(r.size(), 3u);
+	BOOST_CHECK_EQUAL(r[0].label, "");
+	BOOST_CHECK_EQUAL(r[0].overflow, "throw");
+	BOOST_CHECK(r[0].rmsError < 1);
+	BOOST_CHECK(r[1].rmsError < 1);
+	BOOST_CHECK(r[2].rmsError == HUGE_VAL);
+	BOOST_CHECK(r[2].maxError == HUGE_VAL);
+	BOOST_REQUIRE_EQUAL(Fi::paretoFront(r).size(), 1u);
+	BOOST_CHECK_EQUAL(Fi::paretoFront(r)[0].fractionLength, 5u);
+
+	BOOST_CHECK_THROW(Fi::explore<classic>(Short(), q.in),
+	                  std::invalid_argument);
+
+	const std::vector<Fi::Exploration> f = Fi::explore<throwing>(Fails(), q.in);
+	BOOST_REQUIRE_EQUAL(f.size(), 3u);
+	for (std::size_t i = 0; i < f.size(); ++i) {
+		BOOST_CHECK(f[i].rmsError == HUGE_VAL);
+	}
+
+	//Handlers that are not part of the library have no name.
+	typedef Fi::FormatGrid<6, 6, 4, 4, Fi::SIGNED,
+	                       Fi::Throw, NoRounding> custom;
+	BOOST_CHECK_EQUAL(Fi::explore<custom>(q, q.in)[0].rounding, "");
+
+}
@@ -0,0 +1,477 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+#include "fi/FFT.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Throw.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+#include "Narrow.hpp"
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE fft
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<12, 11, Fi::SIGNED, Fi::Saturate, Fi::Classic> s12_11;
+typedef Fi::Fixed<13, 12, Fi::SIGNED, Fi::Saturate, Fi::Classic> c13_12;
+typedef Fi::Fixed<14, 13, Fi::SIGNED, Fi::Wrap, Fi::NearEven> w14_13;
+typedef Fi::Fixed<15, 14, Fi::SIGNED, Fi::Saturate, Fi::NearEven> c15_14;
+typedef Fi::Fixed<16, 12, Fi::SIGNED, Fi::Saturate, Fi::Floor> s16_12;
+typedef Fi::Fixed<16, 13, Fi::SIGNED, Fi::Saturate, Fi::Classic> c16_13;
+typedef Fi::Fixed<12, 11, Fi::SIGNED, Fi::Throw, Fi::Classic> t12_11;
+
+/**
+ *Model of the quantization documented by Fi::FFT: each output of a
+ *butterfly is computed exactly from the raw values in 64 bits and
+ *converted once to the data type. The engine must match it bit for bit,
+ *including the vector butterflies and the overflow handler; accuracy is
+ *checked independently against a DFT by checkAccuracy().
+ */
+template<typename FixedT, typename CoefT, std::size_t N, std::size_t RADIX,
+         Fi::FFTDecimation D>
+struct Reference {
+
+	static const std::size_t FX = FixedT::FRACTION_LENGTH;
+	static const std::size_t FC = CoefT::FRACTION_LENGTH;
+	static const std::size_t F = FX + FC;
+
+	typedef Fi::FFT<FixedT, N, CoefT, RADIX, D> Engine;
+
+	//Raw complex value with FX or F fractional bits.
+	struct C {
+		int64_t re;
+		int64_t im;
+	};
+
+	static C make(int64_t re, int64_t im) {
+		C c = {re, im};
+		return c;
+	}
+
+	static C add(const C& x, const C& y) {
+		return make(x.re + y.re, x.im + y.im);
+	}
+
+	static C sub(const C& x, const C& y) {
+		return make(x.re - y.re, x.im - y.im);
+	}
+
+	static C raw(const Fi::Complex<FixedT>& x) {
+		return make(x.real().toBinary(true), x.imag().toBinary(true));
+	}
+
+	///From FX to F fractional bits.
+	static C widen(const C& x) {
+		return make(x.re*(int64_t(1) << FC), x.im*(int64_t(1) << FC));
+	}
+
+	///Product of \c x with FX fractional bits by twiddle factor \c i,
+	///with F fractional bits.
+	static C twiddle(const C& x, std::size_t i, bool inverse) {
+		Fi::Complex<CoefT> w = Engine::twiddle(i);
+		const int64_t wr = w.real().toBinary(true);
+		const int64_t wi = inverse ? -int64_t(w.imag().toBinary(true)) :
+			int64_t(w.imag().toBinary(true));
+		return make(x.re*wr - x.im*wi, x.re*wi + x.im*wr);
+	}
+
+	static C minusJ(const C& x, bool inverse) {
+		return inverse ? make(-x.im, x.re) : make(x.im, -x.re);
+	}
+
+	static Fi::Complex<FixedT> quantize(const C& x, unsigned s) {
+		switch (s) {
+		case 0:
+			return Fi::Complex<FixedT>(narrow<FixedT, F>(x.re),
+			                           narrow<FixedT, F>(x.im));
+		case 1:
+			return Fi::Complex<FixedT>(narrow<FixedT, F + 1>(x.re),
+			                           narrow<FixedT, F + 1>(x.im));
+		case 2:
+			return Fi::Complex<FixedT>(narrow<FixedT, F + 2>(x.re),
+			                           narrow<FixedT, F + 2>(x.im));
+		default:
+			return Fi::Complex<FixedT>(narrow<FixedT, F + 3>(x.re),
+			                           narrow<FixedT, F + 3>(x.im));
+		}
+	}
+
+	static void radix4(C* y, bool inverse) {
+		C a = add(y[0], y[2]);
+		C b = sub(y[0], y[2]);
+		C c = add(y[1], y[3]);
+		C d = minusJ(sub(y[1], y[3]), inverse);
+		y[0] = add(a, c);
+		y[1] = add(b, d);
+		y[2] = sub(a, c);
+		y[3] = sub(b, d);
+	}
+
+	static void butterfly(C* y, bool inverse) {
+		if (RADIX == 2) {
+			C a = y[0];
+			y[0] = add(a, y[1]);
+			y[1] = sub(a, y[1]);
+		}
+		else {
+			radix4(y, inverse);
+		}
+	}
+
+	static void permute(std::vector<Fi::Complex<FixedT> >& x) {
+		std::vector<Fi::Complex<FixedT> > y(x);
+		for (std::size_t i = 0; i < N; ++i) {
+			std::size_t r = 0;
+			for (std::size_t n = i, m = 1; m < N; m *= RADIX, n /= RADIX) {
+				r = r*RADIX + n % RADIX;
+			}
+			y[r] = x[i];
+		}
+		x = y;
+	}
+
+	static unsigned blockShift(const std::vector<Fi::Complex<FixedT> >& x) {
+		double largest = 0.0;
+		for (std::size_t i = 0; i < N; ++i) {
+			largest = std::max(largest, std::fabs(x[i].real().toDouble()));
+			largest = std::max(largest, std::fabs(x[i].imag().toDouble()));
+		}
+		largest *= std::pow(2.0, static_cast<int>(FixedT::FRACTION_LENGTH));
+		int bits = 0;
+		while (std::pow(2.0, bits) <= largest) {
+			++bits;
+		}
+		int s = bits + static_cast<int>(Engine::MAX_SHIFT) -
+			static_cast<int>(FixedT::WORD_LENGTH) + 1;
+		return std::max(0, std::min(s, static_cast<int>(Engine::MAX_SHIFT)));
+	}
+
+	static int transform(std::vector<Fi::Complex<FixedT> >& x, bool inverse,
+	                     const Engine& engine) {
+
+		int exponent = 0;
+
+		if (D == Fi::DECIMATION_IN_TIME) {
+			permute(x);
+		}
+
+		for (std::size_t st = 0; st < Engine::STAGES; ++st) {
+
+			unsigned s = 0;
+			if (engine.scaling() == Fi::SHIFT_SCALING) {
+				s = engine.shift(st);
+			}
+			else if (engine.scaling() == Fi::BLOCK_FLOATING_POINT) {
+				s = blockShift(x);
+			}
+			exponent += s;
+
+			std::size_t q = 1;
+			for (std::size_t i = 0; i < st; ++i) {
+				q *= RADIX;
+			}
+			if (D == Fi::DECIMATION_IN_FREQUENCY) {
+				q = N/(RADIX*q);
+			}
+			std::size_t stride = N/(RADIX*q);
+
+			for (std::size_t g = 0; g < N; g += RADIX*q) {
+				for (std::size_t k = 0; k < q; ++k) {
+
+					C y[4];
+
+					for (std::size_t m = 0; m < RADIX; ++m) {
+						y[m] = raw(x[g + k + m*q]);
+						if (D == Fi::DECIMATION_IN_TIME) {
+							y[m] = (m > 0) ?
+								twiddle(y[m], m*k*stride, inverse) :
+								widen(y[m]);
+						}
+					}
+
+					butterfly(y, inverse);
+
+					for (std::size_t m = 0; m < RADIX; ++m) {
+						if (D == Fi::DECIMATION_IN_FREQUENCY) {
+							y[m] = (m > 0) ?
+								twiddle(y[m], m*k*stride, inverse) :
+								widen(y[m]);
+						}
+						x[g + k + m*q] = quantize(y[m], s);
+					}
+
+				}
+			}
+
+		}
+
+		if (D == Fi::DECIMATION_IN_FREQUENCY) {
+			permute(x);
+		}
+
+		return exponent;
+
+	}
+
+};
+
+template<typename FixedT>
+std::vector<Fi::Complex<FixedT> > randomInput(std::size_t n, int range) {
+
+	std::vector<Fi::Complex<FixedT> > x(n);
+
+	for (std::size_t i = 0; i < n; ++i) {
+		x[i] = Fi::Complex<FixedT>(
+			FixedT::fromBinary(std::rand() % (2*range) - range),
+			FixedT::fromBinary(std::rand() % (2*range) - range));
+	}
+
+	return x;
+
+}
+
+template<typename FixedT, typename CoefT, std::size_t N, std::size_t RADIX,
+         Fi::FFTDecimation D>
+void checkBitExact(Fi::FFTScaling scaling, int range) {
+
+	typedef Reference<FixedT, CoefT, N, RADIX, D> Ref;
+	typedef typename Ref::Engine Engine;
+
+	Engine fft(scaling);
+
+	for (int inverse = 0; inverse < 2; ++inverse) {
+
+		std::vector<Fi::Complex<FixedT> > expected =
+			randomInput<FixedT>(N, range);
+
+		Fi::ComplexVector<FixedT> x(N);
+		for (std::size_t i = 0; i < N; ++i) {
+			x.set(i, expected[i]);
+		}
+
+		int exponent = Ref::transform(expected, inverse != 0, fft);
+
+		if (inverse) {
+			fft.inverse(x);
+		}
+		else {
+			fft.forward(x);
+		}
+
+		BOOST_CHECK_EQUAL(fft.exponent(), exponent);
+
+		std::size_t mismatches = 0;
+		for (std::size_t i = 0; i < N; ++i) {
+			if (x[i] != expected[i]) {
+				++mismatches;
+			}
+		}
+		BOOST_CHECK_EQUAL(mismatches, 0u);
+
+	}
+
+}
+
+/**
+ *Compares a transform with the DFT of its input computed in double
+ *precision. Each component of a butterfly output is off by less than one
+ *LSB of FixedT and each component of a twiddle factor by less than one
+ *LSB of CoefT; a later stage multiplies an error by at most RADIX. With E
+ *the total shift, M the largest input magnitude and the errors referred
+ *to the exact DFT, every output is therefore within
+ *	sqrt(2)*2^(E-FX)*(N-1)/(RADIX-1) + sqrt(2)*2^-FC*STAGES*N*M
+ *plus 1% for second order terms, provided nothing overflows.
+ */
+template<typename FixedT, typename CoefT, std::size_t N, std::size_t RADIX,
+         Fi::FFTDecimation D>
+void checkAccuracy(Fi::FFTScaling scaling, int range) {
+
+	typedef Fi::FFT<FixedT, N, CoefT, RADIX, D> Engine;
+
+	const double pi = 4.0*std::atan(1.0);
+	const double lsbX = std::pow(2.0,
+		-static_cast<int>(FixedT::FRACTION_LENGTH));
+	const double lsbC = std::pow(2.0,
+		-static_cast<int>(CoefT::FRACTION_LENGTH));
+
+	Engine fft(scaling);
+
+	for (int inverse = 0; inverse < 2; ++inverse) {
+
+		std::vector<Fi::Complex<FixedT> > in = randomInput<FixedT>(N, range);
+
+		Fi::ComplexVector<FixedT> x(N);
+		double largest = 0.0;
+		for (std::size_t i = 0; i < N; ++i) {
+			x.set(i, in[i]);
+			largest = std::max(largest, std::abs(std::complex<double>(
+				in[i].real().toDouble(), in[i].imag().toDouble())));
+		}
+
+		if (inverse) {
+			fft.inverse(x);
+		}
+		else {
+			fft.forward(x);
+		}
+
+		const double scale = std::pow(2.0, fft.exponent());
+		const double bound = 1.01*std::sqrt(2.0)*(
+			scale*lsbX*static_cast<double>(N - 1)/(RADIX - 1) +
+			lsbC*static_cast<double>(Engine::STAGES*N)*largest);
+		const double sign = inverse ? 1.0 : -1.0;
+
+		double worst = 0.0;
+		for (std::size_t k = 0; k < N; ++k) {
+
+			std::complex<double> sum;
+			for (std::size_t n = 0; n < N; ++n) {
+				sum += std::complex<double>(in[n].real().toDouble(),
+				                            in[n].imag().toDouble())*
+					std::polar(1.0, sign*2.0*pi*
+					           static_cast<double>(k*n % N)/N);
+			}
+
+			std::complex<double> out(x[k].real().toDouble()*scale,
+			                         x[k].imag().toDouble()*scale);
+
+			worst = std::max(worst, std::abs(out - sum));
+
+		}
+
+		BOOST_CHECK_LE(worst, bound);
+
+	}
+
+}
+
+template<typename FixedT, typename CoefT, std::size_t N, std::size_t RADIX>
+void checkAllModes(int range) {
+
+	const Fi::FFTScaling modes[] = {
+		Fi::NO_SCALING, Fi::SHIFT_SCALING, Fi::BLOCK_FLOATING_POINT
+	};
+
+	for (std::size_t i = 0; i < 3; ++i) {
+		checkBitExact<FixedT, CoefT, N, RADIX,
+		              Fi::DECIMATION_IN_TIME>(modes[i], range);
+		checkBitExact<FixedT, CoefT, N, RADIX,
+		              Fi::DECIMATION_IN_FREQUENCY>(modes[i], range);
+	}
+
+	//Inputs of magnitude below half the full scale do not overflow with
+	//SHIFT_SCALING, nor below 1/(2N) of it without scaling.
+	const int accurate[] = {
+		std::max(1, range/static_cast<int>(2*N)), range/2, range
+	};
+
+	for (std::size_t i = 0; i < 3; ++i) {
+		checkAccuracy<FixedT, CoefT, N, RADIX,
+		              Fi::DECIMATION_IN_TIME>(modes[i], accurate[i]);
+		checkAccuracy<FixedT, CoefT, N, RADIX,
+		              Fi::DECIMATION_IN_FREQUENCY>(modes[i], accurate[i]);
+	}
+
+}
+
+BOOST_AUTO_TEST_SUITE( fft )
+
+BOOST_AUTO_TEST_CASE( vector_formats )
+{
+
+	for (int i = 0; i < 4; ++i) {
+
+		checkAllModes<s12_11, c13_12, 64, 2>(2048);
+		checkAllModes<s12_11, c13_12, 64, 4>(2048);
+		checkAllModes<s12_11, c13_12, 16, 4>(64);
+		checkAllModes<w14_13, c15_14, 256, 4>(8192);
+		checkAllModes<w14_13, c15_14, 8, 2>(8192);
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE( scalar_formats )
+{
+
+	checkAllModes<s16_12, c16_13, 64, 2>(32768);
+	checkAllModes<s16_12, c16_13, 64, 4>(32768);
+	checkAllModes<s16_12, c16_13, 32, 2>(256);
+
+}
+
+BOOST_AUTO_TEST_CASE( shift_scaling_divides_by_n )
+{
+
+	Fi::FFT<s12_11, 16, c13_12, 2> fft(Fi::SHIFT_SCALING);
+	Fi::ComplexVector<s12_11> x(16);
+
+	for (std::size_t i = 0; i < 16; ++i) {
+		x.set(i, Fi::Complex<s12_11>(s12_11(0.5), s12_11(-0.25)));
+	}
+
+	fft.forward(x);
+
+	BOOST_CHECK_EQUAL(fft.exponent(), 4);
+	BOOST_CHECK(x[0] == Fi::Complex<s12_11>(s12_11(0.5), s12_11(-0.25)));
+	for (std::size_t i = 1; i < 16; ++i) {
+		BOOST_CHECK(x[i] == Fi::Complex<s12_11>());
+	}
+
+	fft.setShift(0, 0);
+	BOOST_CHECK_EQUAL(fft.shift(0), 0u);
+	BOOST_CHECK_THROW(fft.setShift(4, 1), std::invalid_argument);
+	BOOST_CHECK_THROW(fft.setShift(0, 3), std::invalid_argument);
+
+}
+
+BOOST_AUTO_TEST_CASE( overflow )
+{
+
+	Fi::ComplexVector<t12_11> x(64);
+	for (std::size_t i = 0; i < 64; ++i) {
+		x.set(i, Fi::Complex<t12_11>(t12_11(0.75), t12_11(0.5)));
+	}
+	Fi::ComplexVector<t12_11> y(x);
+
+	Fi::FFT<t12_11, 64, c13_12, 4> unscaled;
+	BOOST_CHECK_THROW(unscaled.forward(x), std::overflow_error);
+
+	Fi::FFT<t12_11, 64, c13_12, 4> bfp(Fi::BLOCK_FLOATING_POINT);
+	BOOST_CHECK_NO_THROW(bfp.forward(y));
+
+	Fi::ComplexVector<t12_11> z(32);
+	BOOST_CHECK_THROW(bfp.forward(z), std::invalid_argument);
+
+}
+
+BOOST_AUTO_TEST_SUITE_END()
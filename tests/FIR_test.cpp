@@ -0,0 +1,254 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/FIR.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Throw.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+#include "Narrow.hpp"
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE fir
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<12, 11, Fi::SIGNED, Fi::Saturate, Fi::Classic> s12_11;
+typedef Fi::Fixed<14, 13, Fi::SIGNED, Fi::Saturate, Fi::Classic> c14_13;
+typedef Fi::Fixed<16, 14, Fi::SIGNED, Fi::Saturate, Fi::Classic> c16_14;
+typedef Fi::Fixed<32, 24, Fi::SIGNED, Fi::Wrap> a32_24;
+typedef Fi::Fixed<16, 13, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s16_13;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s16_15;
+typedef Fi::Fixed<32, 30, Fi::SIGNED, Fi::Wrap> a32_30;
+typedef Fi::Fixed<24, 18, Fi::SIGNED, Fi::Saturate, Fi::Floor> f24_18;
+typedef Fi::Fixed<26, 24, Fi::SIGNED, Fi::Saturate, Fi::Classic> s26_24;
+typedef Fi::Fixed<26, 24, Fi::SIGNED, Fi::Throw, Fi::Classic> t26_24;
+typedef Fi::Fixed<20, 12, Fi::SIGNED, Fi::Saturate, Fi::Classic> s20_12;
+typedef Fi::Fixed<12, 11, Fi::SIGNED, Fi::Saturate, Fi::NearEven> c12_11;
+typedef Fi::Fixed<32, 23, Fi::SIGNED, Fi::Saturate, Fi::Classic> a32_23;
+typedef Fi::Fixed<32, 24, Fi::UNSIGNED, Fi::Saturate, Fi::Classic> u32_24;
+
+/**
+ *Reference filter written with Fi::Fixed operators: zero-insertion,
+ *direct-form filtering and downsampling.
+ */
+template<typename InT, typename CoefT, typename AccT, typename OutT>
+std::vector<OutT> reference(const std::vector<CoefT>& h,
+                            const std::vector<InT>& x,
+                            std::size_t L, std::size_t M) {
+
+	static const std::size_t PRODUCT_F =
+		InT::FRACTION_LENGTH + CoefT::FRACTION_LENGTH;
+
+	std::vector<OutT> y;
+
+	for (std::size_t t = 0; t < x.size()*L; t += M) {
+
+		AccT acc;
+
+		for (std::size_t k = h.size(); k-- > 0; ) {
+			if (k <= t && (t - k) % L == 0) {
+				int64_t p = static_cast<int64_t>(x[(t - k)/L].toBinary(true))*
+					h[k].toBinary(true);
+				acc += narrow<AccT, PRODUCT_F>(p);
+			}
+		}
+
+		y.push_back(narrow<OutT>(acc));
+
+	}
+
+	return y;
+
+}
+
+template<typename FixedT>
+std::vector<FixedT> randomVector(std::size_t n, int range) {
+
+	std::vector<FixedT> x(n);
+
+	for (std::size_t i = 0; i < n; ++i) {
+		x[i] = FixedT::fromBinary(std::rand() % (2*range) - range);
+	}
+
+	return x;
+
+}
+
+/**
+ *Filter random data in random block sizes and compare with the
+ *reference.
+ */
+template<typename InT, typename CoefT, typename AccT, typename OutT>
+void checkBitExact(std::size_t taps, std::size_t L, std::size_t M,
+                   int inRange, int coefRange) {
+
+	std::vector<CoefT> h = randomVector<CoefT>(taps, coefRange);
+	std::vector<InT> x = randomVector<InT>(300, inRange);
+
+	Fi::FIR<InT, CoefT, AccT, OutT> fir(h, L, M);
+
+	std::vector<OutT> y;
+	std::vector<OutT> block;
+
+	for (std::size_t i = 0; i < x.size(); ) {
+		std::size_t n = std::min<std::size_t>(std::rand() % 40, x.size() - i);
+		std::vector<InT> in(x.begin() + i, x.begin() + i + n);
+		fir.process(in, block);
+		BOOST_CHECK(block.size() <= fir.maxOutputs(n));
+		y.insert(y.end(), block.begin(), block.end());
+		i += n;
+	}
+
+	std::vector<OutT> expected = reference<InT, CoefT, AccT, OutT>(h, x, L, M);
+
+	BOOST_REQUIRE_EQUAL(y.size(), expected.size());
+
+	std::size_t mismatches = 0;
+	for (std::size_t i = 0; i < y.size(); ++i) {
+		if (!(y[i] == expected[i])) {
+			++mismatches;
+		}
+	}
+
+	BOOST_CHECK_MESSAGE(mismatches == 0, "taps " << taps << " L " << L <<
+	                    " M " << M << ": " << mismatches << " mismatches");
+
+}
+
+template<typename InT, typename CoefT, typename AccT, typename OutT>
+void checkRates(int inRange, int coefRange) {
+
+	const std::size_t taps[] = {1, 7, 16, 33, 64};
+	const std::size_t rates[][2] = {{1, 1}, {1, 3}, {4, 1}, {3, 2}, {2, 5}};
+
+	for (std::size_t t = 0; t < sizeof(taps)/sizeof(taps[0]); ++t) {
+		for (std::size_t r = 0; r < sizeof(rates)/sizeof(rates[0]); ++r) {
+			checkBitExact<InT, CoefT, AccT, OutT>(taps[t], rates[r][0],
+			                                      rates[r][1], inRange,
+			                                      coefRange);
+		}
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(bit_exact_guarded_accumulator) {
+	std::srand(1);
+	checkRates<s12_11, c14_13, a32_24, s12_11>(2048, 8192);
+	checkRates<s12_11, c14_13, a32_24, s16_13>(2048, 8192);
+	checkRates<s16_15, s16_15, a32_30, s16_15>(32768, 512);
+	checkRates<s20_12, c12_11, a32_23, s20_12>(1 << 19, 2048);
+}
+
+BOOST_AUTO_TEST_CASE(bit_exact_overflowing_accumulator) {
+	std::srand(2);
+	checkRates<s16_15, s16_15, a32_30, s16_15>(32768, 32768);
+	checkRates<s12_11, c14_13, s26_24, s12_11>(2048, 8192);
+	checkRates<s12_11, c14_13, u32_24, s12_11>(2048, 8192);
+}
+
+BOOST_AUTO_TEST_CASE(overflow_free) {
+
+	std::vector<s16_15> h(3, s16_15(-0.5));
+	BOOST_CHECK((Fi::FIR<s16_15, s16_15, a32_30>(h).overflowFree()));
+
+	h.push_back(s16_15(-0.5));
+	BOOST_CHECK(!(Fi::FIR<s16_15, s16_15, a32_30>(h).overflowFree()));
+	BOOST_CHECK((Fi::FIR<s16_15, s16_15, a32_30>(h, 2).overflowFree()));
+
+	//Products are rounded by an accumulator with fewer fractional bits.
+	std::vector<c14_13> g(4, c14_13(0.0));
+	BOOST_CHECK(!(Fi::FIR<s12_11, c14_13, f24_18>(g).overflowFree()));
+
+	//Sums of signed products can be negative, which an unsigned
+	//accumulator cannot hold.
+	std::vector<c14_13> n(1, c14_13(-0.5));
+	Fi::FIR<s12_11, c14_13, u32_24, s12_11> u(n);
+	BOOST_CHECK(!u.overflowFree());
+	std::vector<s12_11> x(1, s12_11(0.5));
+	std::vector<s12_11> y;
+	u.process(x, y);
+	BOOST_REQUIRE_EQUAL(y.size(), 1u);
+	BOOST_CHECK(y[0] >= s12_11(0.0));
+
+}
+
+BOOST_AUTO_TEST_CASE(bit_exact_rounding_accumulator) {
+	std::srand(3);
+	checkRates<s12_11, c14_13, f24_18, s12_11>(2048, 8192);
+}
+
+BOOST_AUTO_TEST_CASE(impulse_response) {
+
+	std::vector<c14_13> h = randomVector<c14_13>(21, 8192);
+	Fi::FIR<s12_11, c14_13, a32_24, c16_14> fir(h);
+
+	std::vector<s12_11> x(30);
+	x[0] = s12_11(0.5);
+
+	std::vector<c16_14> y;
+	fir.process(x, y);
+
+	BOOST_REQUIRE_EQUAL(y.size(), x.size());
+	for (std::size_t i = 0; i < h.size(); ++i) {
+		BOOST_CHECK_EQUAL(y[i].toBinary(true), h[i].toBinary(true));
+	}
+	for (std::size_t i = h.size(); i < y.size(); ++i) {
+		BOOST_CHECK_EQUAL(y[i].toBinary(true), 0);
+	}
+
+	//After a reset, the filter forgets the impulse.
+	std::vector<s12_11> zeros(10);
+	fir.reset();
+	fir.process(zeros, y);
+	for (std::size_t i = 0; i < y.size(); ++i) {
+		BOOST_CHECK_EQUAL(y[i].toBinary(true), 0);
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(overflow) {
+
+	std::vector<c14_13> h(8, c14_13(0.9));
+	std::vector<s12_11> x(16, s12_11(-1.0));
+	std::vector<s12_11> y;
+
+	Fi::FIR<s12_11, c14_13, t26_24, s12_11> fir(h);
+	BOOST_CHECK(!fir.overflowFree());
+	BOOST_CHECK_THROW(fir.process(x, y), std::overflow_error);
+
+	std::vector<c14_13> none;
+	BOOST_CHECK_THROW((Fi::FIR<s12_11, c14_13, a32_24>(none)),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW((Fi::FIR<s12_11, c14_13, a32_24>(h, 0, 1)),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW((Fi::FIR<s12_11, c14_13, a32_24>(h, 1, 0)),
+	                  std::invalid_argument);
+
+}
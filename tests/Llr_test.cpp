@@ -0,0 +1,190 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/Llr.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE llr
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<6, 1, Fi::SIGNED, Fi::Saturate, Fi::Floor> s6_1;
+typedef Fi::Fixed<8, 2, Fi::SIGNED, Fi::Saturate, Fi::Classic> s8_2;
+typedef Fi::Fixed<12, 4, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s12_4;
+typedef Fi::Fixed<16, 3, Fi::SIGNED, Fi::Saturate, Fi::Fix> s16_3;
+typedef Fi::Fixed<20, 6, Fi::SIGNED, Fi::Saturate, Fi::Classic> s20_6;
+
+/**
+ *Random LLRs, a quarter of them at the limits of the type.
+ */
+template<typename T>
+std::vector<T> randomLlrs(std::size_t n) {
+	const int64_t range = int64_t(1) << T::WORD_LENGTH;
+	std::vector<T> x(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		int64_t r = std::rand() % range - range/2;
+		switch (std::rand() % 8) {
+		case 0: r = -range/2; break;
+		case 1: r = range/2 - 1; break;
+		default: break;
+		}
+		x[i] = T::fromBinary(static_cast<typename T::valtype>(r));
+	}
+	return x;
+}
+
+template<typename T>
+T magnitude(const T& x) {
+	return (x < T()) ? -x : x;
+}
+
+template<typename T>
+T correction(const T& x) {
+	T m = magnitude(x);
+	m >>= 2;
+	const T c = T(0.625) - m;
+	return (c < T()) ? T() : c;
+}
+
+/**
+ *Check-node update using the operators, with \c VARIANT 0 for min-sum,
+ *1 for offset and 2 for normalized min-sum.
+ */
+template<typename T, int VARIANT>
+std::vector<T> reference(const std::vector<T>& in, std::size_t degree,
+                         std::size_t n, const T& p) {
+	std::vector<T> out(in.size());
+	for (std::size_t k = 0; k < n; ++k) {
+		for (std::size_t i = 0; i < degree; ++i) {
+			bool negative = false;
+			T m = magnitude(T::fromBinary(T::TR::MAX_VAL));
+			for (std::size_t j = 0; j < degree; ++j) {
+				if (j != i) {
+					const T x = in[j*n + k];
+					negative ^= (x < T());
+					m = std::min(m, magnitude(x));
+				}
+			}
+			if (VARIANT == 1) {
+				m = (p < m) ? m - p : T();
+			}
+			else if (VARIANT == 2) {
+				m *= p;
+			}
+			out[i*n + k] = negative ? -m : m;
+		}
+	}
+	return out;
+}
+
+template<typename T>
+void checkNodes() {
+	const double offsets[] = {0.0, 0.5, 1.0, 3.0};
+	const double scales[] = {0.75, 0.5, 0.875, 1.0, 1.25};
+
+	for (std::size_t degree = 2; degree < 9; ++degree) {
+		const std::size_t n = 3 + 7*degree;
+		const std::vector<T> in = randomLlrs<T>(degree*n);
+		std::vector<T> out(in.size());
+
+		Fi::llr::minSum(&in[0], &out[0], degree, n);
+		BOOST_CHECK(out == (reference<T, 0>(in, degree, n, T())));
+
+		for (std::size_t i = 0; i < 4; ++i) {
+			const T p(offsets[i]);
+			Fi::llr::offsetMinSum(&in[0], &out[0], degree, n, p);
+			BOOST_CHECK(out == (reference<T, 1>(in, degree, n, p)));
+		}
+
+		for (std::size_t i = 0; i < 5; ++i) {
+			const T p(scales[i]);
+			Fi::llr::normalizedMinSum(&in[0], &out[0], degree, n, p);
+			BOOST_CHECK(out == (reference<T, 2>(in, degree, n, p)));
+		}
+
+		//In place.
+		out = in;
+		Fi::llr::minSum(&out[0], &out[0], degree, n);
+		BOOST_CHECK(out == (reference<T, 0>(in, degree, n, T())));
+	}
+}
+
+template<typename T>
+void checkBoxplus() {
+	const std::size_t n = 1001;
+	const std::vector<T> a = randomLlrs<T>(n);
+	const std::vector<T> b = randomLlrs<T>(n);
+	std::vector<T> out(n);
+	Fi::llr::boxplus(&a[0], &b[0], &out[0], n);
+
+	for (std::size_t i = 0; i < n; ++i) {
+		const T m = std::min(magnitude(a[i]), magnitude(b[i]));
+		T r = ((a[i] < T()) != (b[i] < T())) ? -m : m;
+		r = r + correction(a[i] + b[i]) - correction(a[i] - b[i]);
+		BOOST_CHECK(out[i] == r);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(min_sum) {
+	checkNodes<s6_1>();
+	checkNodes<s8_2>();
+	checkNodes<s12_4>();
+	checkNodes<s16_3>();
+	checkNodes<s20_6>();
+}
+
+BOOST_AUTO_TEST_CASE(boxplus) {
+	checkBoxplus<s6_1>();
+	checkBoxplus<s8_2>();
+	checkBoxplus<s12_4>();
+	checkBoxplus<s16_3>();
+	checkBoxplus<s20_6>();
+
+	//2*atanh(tanh(1/2)*tanh(-1/2)) = -0.434 approximated by
+	//-1 + 0.625 - 0.125.
+	const s16_3 a(1.0);
+	const s16_3 b(-1.0);
+	s16_3 r;
+	Fi::llr::boxplus(&a, &b, &r, 1);
+	BOOST_CHECK(r == s16_3(-0.5));
+}
+
+BOOST_AUTO_TEST_CASE(arguments) {
+	std::vector<s8_2> x(8);
+	BOOST_CHECK_THROW(Fi::llr::minSum(&x[0], &x[0], 1, 8),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::llr::offsetMinSum(&x[0], &x[0], 2, 4, s8_2(-0.5)),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::llr::normalizedMinSum(&x[0], &x[0], 2, 4,
+	                                            s8_2(-0.5)),
+	                  std::invalid_argument);
+	BOOST_CHECK_NO_THROW(Fi::llr::minSum(&x[0], &x[0], 2, 0));
+}
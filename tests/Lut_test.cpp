@@ -0,0 +1,153 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/Lut.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Floor.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE lut
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<16, 8, Fi::UNSIGNED, Fi::Saturate, Fi::Classic> u16_8;
+typedef Fi::Fixed<16, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_10;
+typedef Fi::Fixed<24, 16, Fi::SIGNED, Fi::Saturate, Fi::Classic> s24_16;
+typedef Fi::Fixed<24, 16, Fi::SIGNED, Fi::Saturate, Fi::Floor> f24_16;
+
+const double LSB = 1.0/(1 << 16);
+
+double ulps(double a, double b) {
+	return std::fabs(a - b)/LSB;
+}
+
+/**
+ *Largest error over all positive inputs of \c u16_8, in LSBs of
+ *\c s24_16, for results below 128.
+ */
+template<int FUNCTION, std::size_t TB, Fi::lut::Interpolation I>
+double maxError() {
+	double e = 0.0;
+	for (int r = 1; r < (1 << 16); r += 3) {
+		const u16_8 x = u16_8::fromBinary(r);
+		const double d = x.toDouble();
+		double exact;
+		double v;
+		switch (FUNCTION) {
+		case 0:
+			exact = 1.0/d;
+			v = Fi::lut::reciprocal<u16_8, s24_16, TB, I>(x).toDouble();
+			break;
+		case 1:
+			exact = 1.0/std::sqrt(d);
+			v = Fi::lut::rsqrt<u16_8, s24_16, TB, I>(x).toDouble();
+			break;
+		default:
+			exact = std::log(d)/std::log(2.0);
+			v = Fi::lut::log2<u16_8, s24_16, TB, I>(x).toDouble();
+			break;
+		}
+		if (exact < 127.0) {
+			e = std::max(e, ulps(v, exact));
+		}
+	}
+	return e;
+}
+
+BOOST_AUTO_TEST_CASE(accuracy) {
+
+	using namespace Fi::lut;
+
+	BOOST_CHECK_LT((maxError<0, 8, LINEAR>()), 2.0);
+	BOOST_CHECK_LT((maxError<1, 8, LINEAR>()), 2.0);
+	BOOST_CHECK_LT((maxError<2, 8, LINEAR>()), 2.0);
+
+	BOOST_CHECK_LT((maxError<0, 5, QUADRATIC>()), 2.0);
+	BOOST_CHECK_LT((maxError<1, 5, QUADRATIC>()), 2.0);
+	BOOST_CHECK_LT((maxError<2, 5, QUADRATIC>()), 2.0);
+
+	BOOST_CHECK_LT((maxError<0, 5, QUADRATIC>()),
+	               (maxError<0, 5, LINEAR>()));
+	BOOST_CHECK_LT((maxError<0, 5, LINEAR>()),
+	               (maxError<0, 5, NEAREST>()));
+
+	for (double x = -10.0; x < 7.0; x += 0.0625) {
+		const double v = exp2<s16_10, s24_16, 6, QUADRATIC>(s16_10(x)).toDouble();
+		BOOST_CHECK_LT(ulps(v, std::pow(2.0, x)), 2.0);
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(exact_points) {
+
+	using namespace Fi::lut;
+
+	for (int k = -8; k < 5; ++k) {
+		const double p = std::ldexp(1.0, k);
+		BOOST_CHECK_EQUAL((reciprocal<s16_10, s24_16, 4>(s16_10(p)).toDouble()),
+		                  s24_16(1.0/p).toDouble());
+		BOOST_CHECK_EQUAL((log2<s16_10, s24_16, 4>(s16_10(p)).toDouble()), k);
+		BOOST_CHECK_EQUAL((exp2<s16_10, s24_16, 4>(s16_10(k)).toDouble()),
+		                  s24_16(p).toDouble());
+	}
+	BOOST_CHECK_EQUAL((rsqrt<s16_10, s24_16, 4>(s16_10(0.25)).toDouble()), 2.0);
+	BOOST_CHECK_EQUAL((rsqrt<s16_10, s24_16, 4>(s16_10(16.0)).toDouble()), 0.25);
+
+	BOOST_CHECK_EQUAL((reciprocal<s16_10, s24_16, 6>(s16_10(-2.5)).toDouble()),
+	                  -(reciprocal<s16_10, s24_16, 6>(s16_10(2.5)).toDouble()));
+
+}
+
+BOOST_AUTO_TEST_CASE(rounding) {
+
+	using namespace Fi::lut;
+
+	//The scaled result is rounded once by the output type.
+	const s16_10 x(30.0);
+	const double r = 1.0/30.0;
+	BOOST_CHECK_EQUAL((reciprocal<s16_10, f24_16, 8>(x).toDouble()),
+	                  std::floor(r/LSB)*LSB);
+	BOOST_CHECK_EQUAL((reciprocal<s16_10, s24_16, 8>(x).toDouble()),
+	                  std::floor(r/LSB + 0.5)*LSB);
+
+}
+
+BOOST_AUTO_TEST_CASE(domain) {
+
+	using namespace Fi::lut;
+
+	BOOST_CHECK_THROW((reciprocal<s16_10, s24_16, 4>(s16_10(0.0))),
+	                  std::domain_error);
+	BOOST_CHECK_THROW((rsqrt<s16_10, s24_16, 4>(s16_10(-1.0))),
+	                  std::domain_error);
+	BOOST_CHECK_THROW((log2<s16_10, s24_16, 4>(s16_10(0.0))),
+	                  std::domain_error);
+
+	//Saturated by the output type
+	BOOST_CHECK_EQUAL((reciprocal<s16_10, s24_16, 4>(
+		s16_10::fromBinary(1)).toDouble()), s24_16::fromBinary(0x7FFFFF).toDouble());
+
+}
@@ -0,0 +1,278 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/Matrix.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Throw.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE matrix
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> s12_10;
+typedef Fi::Fixed<16, 14, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_14;
+typedef Fi::Fixed<16, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_10;
+typedef Fi::Fixed<8, 8, Fi::UNSIGNED, Fi::Saturate, Fi::Floor> u8_8;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s16_15;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Wrap, Fi::Classic> s8_4w;
+typedef Fi::Fixed<24, 20, Fi::SIGNED, Fi::Saturate, Fi::Floor> s24_20;
+typedef Fi::Fixed<32, 31, Fi::SIGNED, Fi::Saturate, Fi::Floor> s32_31;
+typedef Fi::Fixed<32, 32, Fi::SIGNED, Fi::Saturate, Fi::Floor> s32_32;
+
+///Random raw value of all W bits
+template<typename T>
+T randomFixed() {
+	const int64_t W = T::WORD_LENGTH;
+	int64_t r = (int64_t(std::rand()) << 16 ^ std::rand()) & ((int64_t(1) << W) - 1);
+	if (T::SIGNEDNESS == Fi::SIGNED && r >> (W - 1)) {
+		r -= int64_t(1) << W;
+	}
+	return T::fromBinary(static_cast<typename T::valtype>(r));
+}
+
+template<typename T>
+Fi::Matrix<T> randomMatrix(std::size_t rows, std::size_t cols) {
+
+	Fi::Matrix<T> x(rows, cols);
+
+	for (std::size_t i = 0; i < rows; ++i) {
+		for (std::size_t j = 0; j < cols; ++j) {
+			x(i, j) = randomFixed<T>();
+		}
+	}
+
+	return x;
+
+}
+
+///Exact sum of products rounded once by the double constructor of ProdT
+template<typename ProdT, typename T1, typename T2>
+void check(const Fi::Matrix<T1>& x, const Fi::Matrix<T2>& y) {
+
+	Fi::Matrix<ProdT> p = Fi::multiply<ProdT>(x, y);
+
+	BOOST_REQUIRE_EQUAL(p.rows(), x.rows());
+	BOOST_REQUIRE_EQUAL(p.cols(), y.cols());
+
+	for (std::size_t i = 0; i < x.rows(); ++i) {
+		for (std::size_t j = 0; j < y.cols(); ++j) {
+
+			double sum = 0.0;
+
+			for (std::size_t k = 0; k < x.cols(); ++k) {
+				sum += x(i, k).toDouble()*y(k, j).toDouble();
+			}
+
+			BOOST_CHECK_EQUAL(p(i, j), ProdT(sum));
+
+		}
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(storage) {
+
+	Fi::Matrix<s12_10> x(5, 3);
+
+	BOOST_CHECK_EQUAL(x.rows(), 5u);
+	BOOST_CHECK_EQUAL(x.cols(), 3u);
+	BOOST_CHECK_EQUAL(x.stride(), 16u);
+
+	for (std::size_t i = 0; i < x.rows(); ++i) {
+		BOOST_CHECK_EQUAL(reinterpret_cast<std::size_t>(x.row(i)) % 64, 0u);
+		for (std::size_t j = 0; j < x.cols(); ++j) {
+			BOOST_CHECK_EQUAL(x(i, j), s12_10());
+			x(i, j) = s12_10::fromBinary(static_cast<int>(i*x.cols() + j));
+		}
+	}
+
+	Fi::Matrix<s12_10> y(x), z;
+	z = x;
+
+	for (std::size_t i = 0; i < x.rows(); ++i) {
+		BOOST_CHECK_EQUAL(reinterpret_cast<std::size_t>(y.row(i)) % 64, 0u);
+		BOOST_CHECK_EQUAL(reinterpret_cast<std::size_t>(z.row(i)) % 64, 0u);
+		for (std::size_t j = 0; j < x.cols(); ++j) {
+			BOOST_CHECK_EQUAL(y(i, j), x(i, j));
+			BOOST_CHECK_EQUAL(z(i, j), x(i, j));
+		}
+	}
+
+	z.resize(2, 20);
+	BOOST_CHECK_EQUAL(z.stride(), 32u);
+	BOOST_CHECK_EQUAL(z(1, 19), s12_10());
+
+	Fi::Matrix<s32_31> w(2, 17);
+	BOOST_CHECK_EQUAL(w.stride(), 24u);
+
+}
+
+BOOST_AUTO_TEST_CASE(product) {
+
+	std::srand(1);
+
+	//16-bit multiply-add.
+	check<s16_10>(randomMatrix<s12_10>(37, 29), randomMatrix<s16_14>(29, 70));
+	check<s16_14>(randomMatrix<u8_8>(3, 100), randomMatrix<s12_10>(100, 5));
+	check<s8_4w>(randomMatrix<s12_10>(20, 9), randomMatrix<s12_10>(9, 20));
+
+	//Sums that may not fit 32 bits.
+	check<s16_15>(randomMatrix<s16_15>(17, 40), randomMatrix<s16_15>(40, 19));
+
+	//Wide types.
+	check<s16_10>(randomMatrix<s24_20>(6, 33), randomMatrix<s16_14>(33, 7));
+
+	//Empty inner dimension.
+	check<s16_10>(Fi::Matrix<s12_10>(3, 0), Fi::Matrix<s16_14>(0, 4));
+
+	//[1 2; 3 4]*[0.5 -0.25; 0.125 0.75]
+	Fi::Matrix<s12_10> x(2, 2), y(2, 2);
+	x(0, 0) = s12_10(1.0);
+	x(0, 1) = s12_10(-0.5);
+	x(1, 0) = s12_10(0.25);
+	x(1, 1) = s12_10(1.5);
+	y(0, 0) = s12_10(0.5);
+	y(0, 1) = s12_10(-0.25);
+	y(1, 0) = s12_10(0.125);
+	y(1, 1) = s12_10(0.75);
+
+	Fi::Matrix<s16_10> p;
+	Fi::multiply(x, y, p);
+
+	BOOST_CHECK_EQUAL(p(0, 0), s16_10(0.4375));
+	BOOST_CHECK_EQUAL(p(0, 1), s16_10(-0.625));
+	BOOST_CHECK_EQUAL(p(1, 0), s16_10(0.3125));
+	BOOST_CHECK_EQUAL(p(1, 1), s16_10(1.0625));
+
+}
+
+BOOST_AUTO_TEST_CASE(vector) {
+
+	std::srand(2);
+
+	Fi::Matrix<s12_10> x = randomMatrix<s12_10>(13, 21);
+	std::vector<s16_14> v(21);
+	Fi::Matrix<s16_14> column(21, 1);
+
+	for (std::size_t k = 0; k < v.size(); ++k) {
+		v[k] = randomFixed<s16_14>();
+		column(k, 0) = v[k];
+	}
+
+	std::vector<s16_10> y;
+	Fi::multiply(x, v, y);
+	Fi::Matrix<s16_10> p = Fi::multiply<s16_10>(x, column);
+
+	BOOST_REQUIRE_EQUAL(y.size(), 13u);
+
+	for (std::size_t i = 0; i < y.size(); ++i) {
+		BOOST_CHECK_EQUAL(y[i], p(i, 0));
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(transpose) {
+
+	std::srand(3);
+
+	Fi::Matrix<s16_14> x = randomMatrix<s16_14>(45, 70);
+	Fi::Matrix<s16_14> t = Fi::transpose(x);
+
+	BOOST_REQUIRE_EQUAL(t.rows(), 70u);
+	BOOST_REQUIRE_EQUAL(t.cols(), 45u);
+
+	for (std::size_t i = 0; i < x.rows(); ++i) {
+		for (std::size_t j = 0; j < x.cols(); ++j) {
+			BOOST_CHECK_EQUAL(t(j, i), x(i, j));
+		}
+	}
+
+	//Gram matrix.
+	check<s16_10>(Fi::transpose(x), x);
+
+}
+
+BOOST_AUTO_TEST_CASE(arguments) {
+
+	Fi::Matrix<s12_10> x(2, 3), y(2, 3), p;
+	std::vector<s12_10> v(2), w;
+
+	BOOST_CHECK_THROW(Fi::multiply(x, y, p), std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::multiply(x, v, w), std::invalid_argument);
+
+	Fi::Matrix<s32_31> a(1, 4), b(4, 1);
+	Fi::Matrix<s32_32> c;
+
+	for (std::size_t k = 0; k < 4; ++k) {
+		a(0, k) = s32_31::MinVal();
+		b(k, 0) = s32_31::MinVal();
+	}
+
+	BOOST_CHECK_THROW(Fi::multiply(a, b, c), std::overflow_error);
+
+	a(0, 0) = s32_31();
+	a(0, 1) = s32_31();
+	a(0, 2) = s32_31();
+	BOOST_CHECK_NO_THROW(Fi::multiply(a, b, c));
+
+}
+
+BOOST_AUTO_TEST_CASE(throwing_handler) {
+
+	typedef Fi::Fixed<16, 14, Fi::SIGNED, Fi::Throw, Fi::Classic> t16_14;
+
+	//Rows in several tiles overflow, the first negatively.
+	Fi::Matrix<s12_10> a(128, 4), b(4, 1);
+	Fi::Matrix<t16_14> c;
+
+	for (std::size_t k = 0; k < 4; ++k) {
+		b(k, 0) = s12_10(1.0);
+		for (std::size_t i = 0; i < 128; ++i) {
+			a(i, k) = s12_10(0.25);
+		}
+		a(40, k) = s12_10(-1.0);
+		a(100, k) = s12_10(1.0);
+	}
+
+	BOOST_CHECK_THROW(Fi::multiply(a, b, c), Fi::NegativeOverflow);
+
+	for (std::size_t k = 0; k < 4; ++k) {
+		a(40, k) = s12_10();
+	}
+	BOOST_CHECK_THROW(Fi::multiply(a, b, c), Fi::PositiveOverflow);
+
+	for (std::size_t k = 0; k < 4; ++k) {
+		a(100, k) = s12_10();
+	}
+	BOOST_CHECK_NO_THROW(Fi::multiply(a, b, c));
+	BOOST_CHECK_EQUAL(c(0, 0).toDouble(), 1.0);
+
+}
@@ -0,0 +1,210 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/NCO.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE nco
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<32, 32, Fi::UNSIGNED, Fi::Wrap> u32_32;
+typedef Fi::Fixed<32, 32, Fi::SIGNED, Fi::Wrap> s32_32;
+typedef Fi::Fixed<20, 20, Fi::SIGNED, Fi::Wrap> s20_20;
+typedef Fi::Fixed<10, 10, Fi::UNSIGNED, Fi::Wrap> u10_10;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_15;
+typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> s12_10;
+
+const double PI = 3.14159265358979323846;
+
+/**
+ *Phases of the first \c n samples without dithering, as unsigned
+ *binary values.
+ */
+template<typename PhaseT>
+std::vector<uint64_t> phases(const PhaseT& increment, std::size_t n) {
+	const uint64_t mask = (uint64_t(1) << PhaseT::WORD_LENGTH) - 1;
+	const uint64_t inc = static_cast<uint64_t>(increment.toBinary(true));
+	std::vector<uint64_t> p(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		p[i] = (inc*i) & mask;
+	}
+	return p;
+}
+
+template<typename PhaseT, typename OutT, std::size_t TB>
+void checkTruncation(double increment) {
+	typedef Fi::NCO<PhaseT, OutT, TB> Osc;
+	const std::size_t N = 1003;
+	const std::size_t W = PhaseT::WORD_LENGTH;
+
+	Osc nco((PhaseT(increment)));
+	std::vector<OutT> s(N), c(N);
+	nco.sincos(&s[0], &c[0], N);
+
+	const std::vector<uint64_t> p = phases(PhaseT(increment), N + 1);
+	for (std::size_t i = 0; i < N; ++i) {
+		const std::size_t index = static_cast<std::size_t>(p[i] >> (W - TB));
+		BOOST_CHECK(s[i] == nco.table(index));
+		BOOST_CHECK(c[i] == nco.table((index + Osc::TABLE_SIZE/4) %
+		                              Osc::TABLE_SIZE));
+	}
+	const uint64_t last = static_cast<uint64_t>(nco.phase().toBinary(true)) &
+		((uint64_t(1) << W) - 1);
+	BOOST_CHECK_EQUAL(last, p[N]);
+}
+
+BOOST_AUTO_TEST_CASE(table) {
+	typedef Fi::NCO<u32_32, s16_15, 10> Osc;
+	Osc nco;
+	for (std::size_t i = 0; i < Osc::TABLE_SIZE; ++i) {
+		BOOST_CHECK(nco.table(i) ==
+		            s16_15(std::sin(2*PI*static_cast<double>(i)/
+		                            Osc::TABLE_SIZE)));
+	}
+	BOOST_CHECK(nco.table(Osc::TABLE_SIZE/4) == s16_15(1.0));
+	BOOST_CHECK_THROW(nco.table(Osc::TABLE_SIZE), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(truncation) {
+	checkTruncation<u32_32, s16_15, 10>(0.013);
+	checkTruncation<u32_32, s16_15, 16>(0.2371);
+	checkTruncation<s20_20, s12_10, 8>(0.37);
+	checkTruncation<s20_20, s12_10, 8>(-0.11);
+	checkTruncation<u10_10, s12_10, 10>(0.123);
+	checkTruncation<u10_10, s16_15, 2>(0.25);
+}
+
+BOOST_AUTO_TEST_CASE(blocks) {
+	const std::size_t N = 997;
+	const bool dither[] = {false, true};
+	for (std::size_t d = 0; d < 2; ++d) {
+		Fi::NCO<u32_32, s16_15, 12> whole(u32_32(0.0123), dither[d], 7);
+		Fi::NCO<u32_32, s16_15, 12> split(u32_32(0.0123), dither[d], 7);
+
+		std::vector<s16_15> s(N), c(N), t(N), u(N);
+		whole.sincos(&s[0], &c[0], N);
+
+		std::size_t i = 0;
+		std::size_t size = 1;
+		while (i < N) {
+			const std::size_t n = std::min(size, N - i);
+			if (size % 3 == 0) {
+				split.sin(&t[i], n);
+			}
+			else {
+				split.sincos(&t[i], &u[i], n);
+			}
+			i += n;
+			size = size % 11 + 1;
+		}
+		for (i = 0; i < N; ++i) {
+			BOOST_CHECK(s[i] == t[i]);
+		}
+		BOOST_CHECK(whole.phase() == split.phase());
+
+		whole.reset();
+		std::vector<s16_15> v(N);
+		whole.cos(&v[0], N);
+		BOOST_CHECK(v == c);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(dither) {
+	typedef Fi::NCO<u32_32, s16_15, 8> Osc;
+	const std::size_t N = 4096;
+	const double inc = 0.0371;
+
+	Osc plain(u32_32(inc), false);
+	Osc dithered(u32_32(inc), true, 12345);
+	BOOST_CHECK(!plain.dither());
+	BOOST_CHECK(dithered.dither());
+
+	std::vector<s16_15> s(N), d(N);
+	plain.sin(&s[0], N);
+	dithered.sin(&d[0], N);
+
+	//Dithering moves each sample to the next table entry at most.
+	const std::vector<uint64_t> p = phases(u32_32(inc), N);
+	std::size_t moved = 0;
+	for (std::size_t i = 0; i < N; ++i) {
+		const std::size_t index = static_cast<std::size_t>(p[i] >> 24);
+		if (d[i] != s[i]) {
+			++moved;
+			BOOST_CHECK(d[i] == dithered.table((index + 1) % 256));
+		}
+	}
+	BOOST_CHECK(moved > N/10);
+
+	//The sequence depends on the seed.
+	Osc other(u32_32(inc), true, 54321);
+	std::vector<s16_15> o(N);
+	other.sin(&o[0], N);
+	BOOST_CHECK(o != d);
+}
+
+BOOST_AUTO_TEST_CASE(phase) {
+	Fi::NCO<u32_32, s16_15, 10> nco(u32_32(0.25));
+	BOOST_CHECK(nco.increment() == u32_32(0.25));
+
+	nco.setPhase(u32_32(0.5));
+	std::vector<s16_15> s(5);
+	nco.sin(&s[0], s.size());
+	BOOST_CHECK(s[0] == s16_15(0.0));
+	BOOST_CHECK(s[1] == s16_15(-1.0));
+	BOOST_CHECK(s[2] == s16_15(0.0));
+	BOOST_CHECK(s[3] == s16_15(1.0));
+	BOOST_CHECK(nco.phase() == u32_32(0.75));
+
+	nco.setIncrement(u32_32(0.125));
+	nco.sin(&s[0], 2);
+	BOOST_CHECK(nco.phase() == u32_32(0.0));
+
+	Fi::NCO<s20_20, s16_15, 10> negative(s20_20(-0.25));
+	BOOST_CHECK(negative.increment() == s20_20(-0.25));
+	negative.sin(&s[0], 3);
+	BOOST_CHECK(s[1] == s16_15(-1.0));
+	BOOST_CHECK(negative.phase() == s20_20(0.25));
+}
+
+BOOST_AUTO_TEST_CASE(wrap) {
+	//Native modular phase matches accumulation with Fi::Wrap.
+	const s32_32 inc(0.3183);
+	Fi::NCO<s32_32, s16_15, 12> nco(inc);
+	s32_32 phase;
+	std::vector<s16_15> s(7);
+	for (std::size_t i = 0; i < 100; ++i) {
+		nco.sin(&s[0], s.size());
+		for (std::size_t j = 0; j < s.size(); ++j) {
+			phase += inc;
+		}
+		BOOST_CHECK(nco.phase() == phase);
+	}
+}
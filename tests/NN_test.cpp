@@ -0,0 +1,262 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/NN.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+#include "Narrow.hpp"
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE nn
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<8, 4, Fi::UNSIGNED, Fi::Saturate, Fi::NearEven> u8_4;
+typedef Fi::Fixed<8, 7, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s8_7;
+typedef Fi::Fixed<8, 5, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s8_5;
+typedef Fi::Fixed<16, 8, Fi::SIGNED, Fi::Saturate, Fi::NearEven> b16_8;
+typedef Fi::Fixed<32, 11, Fi::SIGNED, Fi::Saturate, Fi::NearEven> a32_11;
+typedef Fi::Fixed<12, 6, Fi::SIGNED, Fi::Saturate, Fi::Floor> a12_6;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s16_15;
+typedef Fi::Fixed<32, 30, Fi::SIGNED, Fi::Wrap> a32_30;
+typedef Fi::Fixed<24, 10, Fi::SIGNED, Fi::Saturate, Fi::Floor> s24_10;
+typedef Fi::Fixed<32, 17, Fi::SIGNED, Fi::Saturate, Fi::Floor> a32_17;
+
+/**
+ *Reference dot product written with Fi::Fixed operators.
+ */
+template<typename AccT, typename OutT, typename InT, typename WT,
+         typename BiasT>
+OutT reference(const InT* x, const WT* w, std::size_t stride,
+               const BiasT& bias, std::size_t n) {
+
+	static const std::size_t PRODUCT_F =
+		InT::FRACTION_LENGTH + WT::FRACTION_LENGTH;
+
+	AccT acc = narrow<AccT>(bias);
+
+	for (std::size_t k = 0; k < n; ++k) {
+		int64_t p = static_cast<int64_t>(x[k].toBinary(true))*
+			w[k*stride].toBinary(true);
+		acc += narrow<AccT, PRODUCT_F>(p);
+	}
+
+	return narrow<OutT>(acc);
+
+}
+
+template<typename FixedT>
+std::vector<FixedT> randomVector(std::size_t n, int low, int high) {
+
+	std::vector<FixedT> x(n);
+
+	for (std::size_t i = 0; i < n; ++i) {
+		x[i] = FixedT::fromBinary(low + std::rand() % (high - low + 1));
+	}
+
+	return x;
+
+}
+
+/**
+ *Compare a dense layer of random data with the reference.
+ */
+template<typename AccT, typename InT, typename WT, typename BiasT,
+         typename OutT>
+void checkDense(std::size_t batch, std::size_t inputs, std::size_t outputs,
+                int wLow, int wHigh) {
+
+	const int inLow = (InT::SIGNEDNESS == Fi::SIGNED)
+		? -(1 << (InT::WORD_LENGTH - 1)) : 0;
+	const int inHigh = (InT::SIGNEDNESS == Fi::SIGNED)
+		? (1 << (InT::WORD_LENGTH - 1)) - 1 : (1 << InT::WORD_LENGTH) - 1;
+
+	std::vector<InT> x = randomVector<InT>(batch*inputs, inLow, inHigh);
+	std::vector<WT> w = randomVector<WT>(outputs*inputs, wLow, wHigh);
+	std::vector<BiasT> b = randomVector<BiasT>(outputs, -300, 300);
+	std::vector<OutT> y(batch*outputs);
+
+	Fi::nn::dense<AccT>(&x[0], &w[0], &b[0], &y[0], batch, inputs, outputs);
+
+	for (std::size_t i = 0; i < batch; ++i) {
+		for (std::size_t j = 0; j < outputs; ++j) {
+			OutT r = reference<AccT, OutT>(&x[i*inputs], &w[j*inputs], 1,
+			                               b[j], inputs);
+			BOOST_CHECK_EQUAL(y[i*outputs + j], r);
+		}
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(dense) {
+
+	std::srand(1);
+
+	//Wide accumulator: integer sums.
+	for (std::size_t inputs = 1; inputs < 70; inputs += 3) {
+		for (std::size_t outputs = 1; outputs <= 9; ++outputs) {
+			checkDense<a32_11, u8_4, s8_7, b16_8, s8_5>(
+				3, inputs, outputs, -128, 127);
+		}
+	}
+
+	//Narrow accumulator: products round and sums saturate.
+	for (std::size_t inputs = 1; inputs < 40; inputs += 5) {
+		checkDense<a12_6, u8_4, s8_7, b16_8, s8_5>(4, inputs, 6, -128, 127);
+	}
+
+	//16-bit inputs and weights: integer sums only for small weights.
+	checkDense<a32_30, s16_15, s16_15, s16_15, s16_15>(
+		2, 37, 5, -1000, 1000);
+	checkDense<a32_30, s16_15, s16_15, s16_15, s16_15>(
+		2, 37, 5, -32768, 32767);
+
+	//Types wider than 16 bits.
+	checkDense<a32_17, s24_10, s8_7, s16_15, s24_10>(2, 11, 3, -128, 127);
+
+	//No inputs: the outputs are the biases.
+	const u8_4 x[1] = {u8_4(1.0)};
+	const s8_7 w[1] = {s8_7(0.5)};
+	const b16_8 b[3] = {b16_8(1.5), b16_8(-0.25), b16_8(9.0)};
+	s8_5 y[6];
+	Fi::nn::dense<a32_11>(x, w, b, y, 2, 0, 3);
+	for (std::size_t i = 0; i < 6; ++i) {
+		BOOST_CHECK_EQUAL(y[i], (reference<a32_11, s8_5>(x, w, 1, b[i%3], 0)));
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(gemm) {
+
+	std::srand(2);
+
+	const std::size_t M = 5, N = 7, K = 19;
+
+	std::vector<u8_4> a = randomVector<u8_4>(M*K, 0, 255);
+	std::vector<s8_7> b = randomVector<s8_7>(K*N, -128, 127);
+	std::vector<s8_5> c(M*N);
+
+	Fi::nn::gemm<a32_11>(&a[0], &b[0], &c[0], M, N, K);
+
+	for (std::size_t i = 0; i < M; ++i) {
+		for (std::size_t j = 0; j < N; ++j) {
+			s8_5 r = reference<a32_11, s8_5>(&a[i*K], &b[j], N, b16_8(), K);
+			BOOST_CHECK_EQUAL(c[i*N + j], r);
+		}
+	}
+
+	//[1 2; 3 4]*[0.5 -0.25; 0.125 1]
+	u8_4 x[] = {u8_4(1.0), u8_4(2.0), u8_4(3.0), u8_4(4.0)};
+	s8_7 y[] = {s8_7(0.5), s8_7(-0.25), s8_7(0.125), s8_7(0.75)};
+	s8_5 z[4];
+
+	Fi::nn::gemm<a32_11>(x, y, z, 2, 2, 2);
+
+	BOOST_CHECK_EQUAL(z[0], s8_5(0.75));
+	BOOST_CHECK_EQUAL(z[1], s8_5(1.25));
+	BOOST_CHECK_EQUAL(z[2], s8_5(2.0));
+	BOOST_CHECK_EQUAL(z[3], s8_5(2.25));
+
+}
+
+/**
+ *Compare a convolution of random data with the reference.
+ */
+template<typename AccT>
+void checkConv(const Fi::nn::Conv2D& shape) {
+
+	const std::size_t C = shape.channels;
+	const std::size_t size = shape.filterSize();
+
+	std::vector<u8_4> in = randomVector<u8_4>(
+		shape.height*shape.width*C, 0, 255);
+	std::vector<s8_7> w = randomVector<s8_7>(shape.filters*size, -128, 127);
+	std::vector<b16_8> b = randomVector<b16_8>(shape.filters, -300, 300);
+	std::vector<s8_5> out(
+		shape.outputHeight()*shape.outputWidth()*shape.filters);
+
+	Fi::nn::conv2d<AccT>(shape, &in[0], &w[0], &b[0], &out[0]);
+
+	const u8_4 zero;
+	std::vector<u8_4> patch(size);
+
+	for (std::size_t y = 0; y < shape.outputHeight(); ++y) {
+		for (std::size_t x = 0; x < shape.outputWidth(); ++x) {
+
+			for (std::size_t r = 0; r < shape.kernelHeight; ++r) {
+				for (std::size_t s = 0; s < shape.kernelWidth; ++s) {
+					for (std::size_t c = 0; c < C; ++c) {
+						int py = int(y*shape.stride + r) - int(shape.padding);
+						int px = int(x*shape.stride + s) - int(shape.padding);
+						bool inside = py >= 0 && px >= 0 &&
+							py < int(shape.height) && px < int(shape.width);
+						patch[(r*shape.kernelWidth + s)*C + c] = inside
+							? in[(py*shape.width + px)*C + c] : zero;
+					}
+				}
+			}
+
+			for (std::size_t j = 0; j < shape.filters; ++j) {
+				s8_5 ref = reference<AccT, s8_5>(&patch[0], &w[j*size], 1,
+				                                 b[j], size);
+				BOOST_CHECK_EQUAL(
+					out[(y*shape.outputWidth() + x)*shape.filters + j], ref);
+			}
+
+		}
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(convolution) {
+
+	std::srand(3);
+
+	checkConv<a32_11>(Fi::nn::Conv2D(6, 7, 3, 5, 3, 3));
+	checkConv<a32_11>(Fi::nn::Conv2D(9, 8, 2, 4, 3, 2, 2, 1));
+	checkConv<a32_11>(Fi::nn::Conv2D(5, 5, 1, 1, 5, 5, 1, 2));
+	checkConv<a12_6>(Fi::nn::Conv2D(6, 6, 4, 3, 3, 3, 1, 1));
+
+	Fi::nn::Conv2D shape(9, 8, 2, 4, 3, 2, 2, 1);
+	BOOST_CHECK_EQUAL(shape.outputHeight(), 5u);
+	BOOST_CHECK_EQUAL(shape.outputWidth(), 5u);
+	BOOST_CHECK_EQUAL(shape.filterSize(), 12u);
+
+}
+
+BOOST_AUTO_TEST_CASE(arguments) {
+
+	BOOST_CHECK_THROW(Fi::nn::Conv2D(0, 4, 1, 1, 3, 3), std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::nn::Conv2D(4, 4, 1, 0, 3, 3), std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::nn::Conv2D(4, 4, 1, 1, 3, 3, 0),
+	                  std::invalid_argument);
+	BOOST_CHECK_THROW(Fi::nn::Conv2D(4, 4, 1, 1, 5, 3), std::invalid_argument);
+	BOOST_CHECK_NO_THROW(Fi::nn::Conv2D(4, 4, 1, 1, 5, 3, 1, 1));
+
+}
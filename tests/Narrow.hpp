@@ -0,0 +1,91 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#ifndef FI_TESTS_NARROW_HPP
+#define FI_TESTS_NARROW_HPP
+
+#include "fi/Fixed.hpp"
+
+#include <cstddef>
+#include <stdint.h>
+
+/**
+ *Conversion of a raw value with \c F fractional bits, e.g. an exact
+ *product, to a Fi::Fixed type, all on 64 bits.
+
+ *Fi::Fixed::fromFixed() and the double and string constructors only see
+ *twice the fractional bits of the destination, which loses the bits
+ *that decide ties. Here, the bits below the destination are rounded
+ *away at once by its rounding mode, then its overflow handler is
+ *applied, as for the product of two numbers of the destination type.
+ */
+template<typename DstT, std::size_t F>
+struct Narrow;
+
+template<std::size_t W, std::size_t F_DST, Fi::Signedness S,
+         template <typename> class OF,
+         template <typename> class R,
+         std::size_t F>
+struct Narrow<Fi::Fixed<W, F_DST, S, OF, R>, F> {
+
+	typedef Fi::Fixed<W, F_DST, S, OF, R> DstT;
+
+	static const std::size_t DOWN = (F > F_DST) ? F - F_DST : 0;
+	static const std::size_t UP = (F < F_DST) ? F_DST - F : 0;
+
+	typedef char ShiftCheck[(DOWN < 63) ? 1 : -1];
+
+	///Removes \c DOWN bits from a 64-bit signed value.
+	typedef Fi::Traits<63, 64, DOWN, Fi::SIGNED> RoundTR;
+	///The range of the destination on 64 bits.
+	typedef Fi::Traits<W, 64, F_DST, S> TR;
+
+	static DstT apply(int64_t raw) {
+
+		int64_t n = raw*(int64_t(1) << UP);
+		if (DOWN > 0) {
+			n = R<RoundTR>::round(n).first;
+		}
+
+		typename TR::valtype v = static_cast<typename TR::valtype>(n);
+		v = Fi::OverflowDetector<TR, OF>::fromFixedPoint(v);
+		return DstT::fromBinary(static_cast<typename DstT::valtype>(v));
+
+	}
+
+};
+
+///Convert a raw value with \c F fractional bits to \c DstT.
+template<typename DstT, std::size_t F>
+DstT narrow(int64_t raw) {
+	return Narrow<DstT, F>::apply(raw);
+}
+
+///Convert a Fi::Fixed number to \c DstT, as narrow(int64_t).
+template<typename DstT, typename SrcT>
+DstT narrow(const SrcT& v) {
+	return narrow<DstT, SrcT::FRACTION_LENGTH>(
+		static_cast<int64_t>(v.toBinary(true)));
+}
+
+#endif
@@ -0,0 +1,186 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/Newton.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <stdint.h>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE newton
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<16, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_10;
+typedef Fi::Fixed<16, 12, Fi::SIGNED, Fi::Saturate, Fi::Floor> f16_12;
+typedef Fi::Fixed<12, 6, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s12_6;
+typedef Fi::Fixed<20, 8, Fi::SIGNED, Fi::Wrap, Fi::Fix> w20_8;
+typedef Fi::Fixed<30, 20, Fi::SIGNED, Fi::Saturate, Fi::Classic> s30_20;
+
+/**
+ *Reciprocal written with the operators of the iteration format and a
+ *seed table rounded from double.
+ */
+template<typename T, std::size_t N>
+T reference(const T& x) {
+
+	typedef typename Fi::NewtonFormat<T>::type U;
+	const int F = static_cast<int>(U::FRACTION_LENGTH);
+
+	const int64_t r = x.toBinary(true);
+	const int64_t u = (r < 0) ? -r : r;
+	int p = 0;
+	while ((u >> (p + 1)) != 0) {
+		++p;
+	}
+
+	const U m = U::fromBinary((p <= F) ? (u << (F - p)) : (u >> (p - F)));
+	const int index = static_cast<int>(((u << 4) >> p) & 15);
+	U y = U::fromBinary(static_cast<int64_t>(std::floor(
+		std::ldexp(1.0/(1.0 + (index + 0.5)/16.0), F) + 0.5)));
+	for (std::size_t i = 0; i < N; ++i) {
+		y = y*(U(2.0) - m*y);
+	}
+
+	const double v = std::ldexp(static_cast<double>(y.toBinary(true)),
+	                            static_cast<int>(T::FRACTION_LENGTH) - p - F);
+	return T((r < 0) ? -v : v);
+
+}
+
+template<typename T, std::size_t N>
+void checkReference() {
+	for (int64_t r = 1; r < 4000; r += 3) {
+		const T x = T::fromBinary(r);
+		BOOST_CHECK_EQUAL((Fi::newtonReciprocal<T, N>(x).toBinary(true)),
+		                  (reference<T, N>(x).toBinary(true)));
+	}
+}
+
+template<typename T, std::size_t N>
+void checkBatch(double low, double high) {
+
+	const std::size_t n = 131;
+	std::vector<T> x(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		x[i] = T(low + (high - low)*std::rand()/RAND_MAX);
+		if (x[i].toDouble() == 0.0) {
+			x[i] = T(high);
+		}
+	}
+
+	std::vector<T> out(n);
+	Fi::newtonReciprocal<T, N>(&x[0], &out[0], n);
+	for (std::size_t i = 0; i < n; ++i) {
+		BOOST_CHECK_EQUAL(out[i].toBinary(true),
+		                  (Fi::newtonReciprocal<T, N>(x[i]).toBinary(true)));
+	}
+
+	for (std::size_t i = 0; i < n; ++i) {
+		if (x[i].toDouble() < 0.0) {
+			x[i] = -x[i];
+		}
+	}
+	Fi::newtonRsqrt<T, N>(&x[0], &out[0], n);
+	for (std::size_t i = 0; i < n; ++i) {
+		BOOST_CHECK_EQUAL(out[i].toBinary(true),
+		                  (Fi::newtonRsqrt<T, N>(x[i]).toBinary(true)));
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(bit_exact_iterations) {
+	checkReference<s16_10, 0>();
+	checkReference<s16_10, 2>();
+	checkReference<f16_12, 1>();
+	checkReference<f16_12, 3>();
+	checkReference<w20_8, 2>();
+}
+
+BOOST_AUTO_TEST_CASE(convergence) {
+
+	const double lsb = 1.0/(1 << 10);
+
+	for (double v = 0.0625; v < 30.0; v *= 1.13) {
+
+		const s16_10 x(v);
+		const double d = x.toDouble();
+
+		const double e0 = std::fabs(
+			Fi::newtonReciprocal<s16_10, 0>(x).toDouble() - 1.0/d);
+		const double e1 = std::fabs(
+			Fi::newtonReciprocal<s16_10, 1>(x).toDouble() - 1.0/d);
+		const double e2 = std::fabs(
+			Fi::newtonReciprocal<s16_10, 2>(x).toDouble() - 1.0/d);
+		BOOST_CHECK_LE(e1, std::max(e0, lsb));
+		BOOST_CHECK_LE(e2, lsb);
+
+		BOOST_CHECK_LE(std::fabs(Fi::newtonRsqrt<s16_10, 2>(x).toDouble() -
+		                         1.0/std::sqrt(d)), lsb);
+
+	}
+
+	BOOST_CHECK_EQUAL((Fi::newtonReciprocal<s16_10, 2>(s16_10(-4.0))
+	                   .toDouble()), -0.25);
+	BOOST_CHECK_EQUAL((Fi::newtonRsqrt<s16_10, 2>(s16_10(16.0))
+	                   .toDouble()), 0.25);
+	BOOST_CHECK_CLOSE((Fi::newtonRsqrt<s30_20, 3>(s30_20(2.0)).toDouble()),
+	                  1.0/std::sqrt(2.0), 1e-4);
+
+}
+
+BOOST_AUTO_TEST_CASE(batch) {
+	std::srand(3);
+	checkBatch<s16_10, 2>(-31.0, 31.0);
+	checkBatch<f16_12, 3>(0.001, 7.9);
+	checkBatch<s12_6, 1>(-31.0, 31.0);
+	checkBatch<w20_8, 2>(-2000.0, 2000.0);
+	checkBatch<s30_20, 3>(-500.0, 500.0);
+}
+
+BOOST_AUTO_TEST_CASE(domain) {
+
+	BOOST_CHECK_THROW((Fi::newtonReciprocal<s16_10, 2>(s16_10(0.0))),
+	                  std::domain_error);
+	BOOST_CHECK_THROW((Fi::newtonRsqrt<s16_10, 2>(s16_10(-1.0))),
+	                  std::domain_error);
+
+	std::vector<s16_10> x(5, s16_10(1.0));
+	std::vector<s16_10> out(5);
+	x[3] = s16_10(0.0);
+	BOOST_CHECK_THROW((Fi::newtonReciprocal<s16_10, 2>(&x[0], &out[0], 5)),
+	                  std::domain_error);
+
+	//Saturated by the type
+	BOOST_CHECK_EQUAL((Fi::newtonReciprocal<s16_10, 2>(
+		s16_10::fromBinary(1)).toBinary(true)), 0x7FFF);
+
+}
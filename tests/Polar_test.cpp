@@ -0,0 +1,189 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/Polar.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Floor.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE polar
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<6, 1, Fi::SIGNED, Fi::Saturate, Fi::Floor> s6_1;
+typedef Fi::Fixed<16, 4, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_4;
+typedef Fi::Fixed<24, 8, Fi::SIGNED, Fi::Saturate, Fi::Classic> s24_8;
+
+template<typename T>
+std::vector<T> randomLlrs(std::size_t n) {
+	const int64_t range = int64_t(1) << T::WORD_LENGTH;
+	std::vector<T> x(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		int64_t r = std::rand() % range - range/2;
+		if (std::rand() % 8 == 0) {
+			r = (std::rand() % 2) ? -range/2 : range/2 - 1;
+		}
+		x[i] = T::fromBinary(static_cast<typename T::valtype>(r));
+	}
+	return x;
+}
+
+std::vector<uint8_t> randomBits(std::size_t n) {
+	std::vector<uint8_t> u(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		u[i] = static_cast<uint8_t>(std::rand() % 2);
+	}
+	return u;
+}
+
+template<typename T>
+T magnitude(const T& x) {
+	return (x < T()) ? -x : x;
+}
+
+template<typename T>
+void checkOperations() {
+	const std::size_t n = 61;
+	const std::vector<T> a = randomLlrs<T>(n);
+	const std::vector<T> b = randomLlrs<T>(n);
+	const std::vector<uint8_t> u = randomBits(n);
+	std::vector<T> x(n), y(n), z(n);
+
+	Fi::polar::f(&a[0], &b[0], &x[0], n);
+	Fi::polar::g(&a[0], &b[0], &u[0], &y[0], n);
+	Fi::polar::f<16>(&a[0], &b[0], &z[0]);
+
+	for (std::size_t i = 0; i < n; ++i) {
+		const T m = std::min(magnitude(a[i]), magnitude(b[i]));
+		BOOST_CHECK(x[i] == (((a[i] < T()) != (b[i] < T())) ? -m : m));
+		BOOST_CHECK(y[i] == (u[i] ? b[i] - a[i] : b[i] + a[i]));
+	}
+	BOOST_CHECK(std::equal(z.begin(), z.begin() + 16, x.begin()));
+
+	Fi::polar::g<4>(&a[0], &b[0], &u[0], &z[0]);
+	BOOST_CHECK(std::equal(z.begin(), z.begin() + 4, y.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(operations) {
+	checkOperations<s6_1>();
+	checkOperations<s16_4>();
+	checkOperations<s24_8>();
+}
+
+BOOST_AUTO_TEST_CASE(combine) {
+	for (std::size_t n = 1; n < 70; n += 3) {
+		const std::vector<uint8_t> u = randomBits(n);
+		const std::vector<uint8_t> v = randomBits(n);
+		std::vector<uint8_t> out(2*n);
+		Fi::polar::combine(&u[0], &v[0], &out[0], n);
+		for (std::size_t i = 0; i < n; ++i) {
+			BOOST_CHECK_EQUAL(out[i], u[i] ^ v[i]);
+			BOOST_CHECK_EQUAL(out[n + i], v[i]);
+		}
+
+		//In place.
+		std::vector<uint8_t> w(u);
+		w.insert(w.end(), v.begin(), v.end());
+		Fi::polar::combine(&w[0], &w[n], &w[0], n);
+		BOOST_CHECK(w == out);
+	}
+
+	const uint8_t u[] = {1, 0};
+	const uint8_t v[] = {1, 1};
+	uint8_t out[4];
+	Fi::polar::combine<2>(u, v, out);
+	BOOST_CHECK_EQUAL(out[0], 0);
+	BOOST_CHECK_EQUAL(out[1], 1);
+	BOOST_CHECK_EQUAL(out[2], 1);
+	BOOST_CHECK_EQUAL(out[3], 1);
+}
+
+/**
+ *Successive-cancellation decoding of a node of size \c n. Writes the
+ *decided bits to \c bits and the partial sums to \c beta.
+ */
+void decode(const s6_1* alpha, const bool* frozen, std::size_t n,
+            uint8_t* bits, uint8_t* beta) {
+	if (n == 1) {
+		Fi::polar::decide(alpha, beta, 1);
+		if (*frozen) {
+			*beta = 0;
+		}
+		*bits = *beta;
+		return;
+	}
+	const std::size_t h = n/2;
+	std::vector<s6_1> child(h);
+	Fi::polar::f(alpha, alpha + h, &child[0], h);
+	decode(&child[0], frozen, h, bits, beta);
+	Fi::polar::g(alpha, alpha + h, beta, &child[0], h);
+	decode(&child[0], frozen + h, h, bits + h, beta + h);
+	Fi::polar::combine(beta, beta + h, beta, h);
+}
+
+BOOST_AUTO_TEST_CASE(successive_cancellation) {
+	//Rate 1/2 code of length 64 with the usual reliability order
+	//approximated by the weight of the index.
+	const std::size_t N = 64;
+	bool frozen[N];
+	for (std::size_t i = 0; i < N; ++i) {
+		std::size_t w = 0;
+		for (std::size_t j = i; j != 0; j >>= 1) {
+			w += j & 1;
+		}
+		frozen[i] = (w < 3) || (w == 3 && i < 40);
+	}
+
+	for (std::size_t trial = 0; trial < 20; ++trial) {
+		std::vector<uint8_t> u = randomBits(N);
+		for (std::size_t i = 0; i < N; ++i) {
+			if (frozen[i]) {
+				u[i] = 0;
+			}
+		}
+
+		//x = u F^n, computed with the same butterflies as combine.
+		std::vector<uint8_t> x(u);
+		for (std::size_t h = 1; h < N; h *= 2) {
+			for (std::size_t k = 0; k < N; k += 2*h) {
+				Fi::polar::combine(&x[k], &x[k + h], &x[k], h);
+			}
+		}
+
+		//Noisy BPSK: bit 0 is a positive LLR.
+		std::vector<s6_1> alpha(N);
+		for (std::size_t i = 0; i < N; ++i) {
+			const double noise = 2.0*(std::rand()/(RAND_MAX + 1.0)) - 1.0;
+			alpha[i] = s6_1((x[i] ? -4.0 : 4.0) + noise);
+		}
+
+		std::vector<uint8_t> bits(N), beta(N);
+		decode(&alpha[0], frozen, N, &bits[0], &beta[0]);
+		BOOST_CHECK(bits == u);
+		BOOST_CHECK(beta == x);
+	}
+}
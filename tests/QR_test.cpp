@@ -0,0 +1,313 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/QR.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Floor.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE qr
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<12, 9, Fi::SIGNED, Fi::Saturate, Fi::Classic> s12_9;
+typedef Fi::Fixed<18, 13, Fi::SIGNED, Fi::Saturate, Fi::Classic> c18_13;
+typedef Fi::Fixed<12, 8, Fi::SIGNED, Fi::Saturate, Fi::Floor> c12_8;
+typedef Fi::Fixed<16, 10, Fi::SIGNED, Fi::Saturate, Fi::Classic> c16_10;
+typedef Fi::Fixed<22, 18, Fi::SIGNED, Fi::Saturate, Fi::Classic> c22_18;
+typedef Fi::Fixed<20, 14, Fi::SIGNED, Fi::Wrap, Fi::Floor> w20_14;
+typedef Fi::Fixed<32, 26, Fi::SIGNED, Fi::Saturate, Fi::Classic> c32_26;
+
+template<typename T>
+Fi::Matrix<T> randomMatrix(std::size_t rows, std::size_t cols,
+                           double scale, double diagonal = 0.0) {
+
+	Fi::Matrix<T> a(rows, cols);
+
+	for (std::size_t i = 0; i < rows; ++i) {
+		for (std::size_t j = 0; j < cols; ++j) {
+			double v = scale*(2.0*std::rand()/(RAND_MAX + 1.0) - 1.0);
+			a(i, j) = T(v + ((i == j) ? diagonal : 0.0));
+		}
+	}
+
+	return a;
+
+}
+
+/**
+ *R of the QR decomposition with a positive diagonal, by modified
+ *Gram-Schmidt in double precision.
+ */
+template<typename T>
+std::vector<double> referenceR(const Fi::Matrix<T>& a) {
+
+	const std::size_t m = a.rows();
+	const std::size_t n = a.cols();
+
+	std::vector<double> q(m*n), r(n*n, 0.0);
+
+	for (std::size_t i = 0; i < m; ++i) {
+		for (std::size_t j = 0; j < n; ++j) {
+			q[i*n + j] = a(i, j).toDouble();
+		}
+	}
+
+	for (std::size_t j = 0; j < n; ++j) {
+
+		double norm = 0.0;
+		for (std::size_t i = 0; i < m; ++i) {
+			norm += q[i*n + j]*q[i*n + j];
+		}
+		norm = std::sqrt(norm);
+		r[j*n + j] = norm;
+
+		for (std::size_t i = 0; i < m; ++i) {
+			q[i*n + j] /= norm;
+		}
+
+		for (std::size_t k = j + 1; k < n; ++k) {
+			double dot = 0.0;
+			for (std::size_t i = 0; i < m; ++i) {
+				dot += q[i*n + j]*q[i*n + k];
+			}
+			r[j*n + k] = dot;
+			for (std::size_t i = 0; i < m; ++i) {
+				q[i*n + k] -= dot*q[i*n + j];
+			}
+		}
+
+	}
+
+	return r;
+
+}
+
+BOOST_AUTO_TEST_CASE(decomposition) {
+
+	std::srand(1);
+
+	const std::size_t rows[] = {4, 8, 6, 12};
+	const std::size_t cols[] = {4, 8, 4, 3};
+
+	for (std::size_t t = 0; t < 4; ++t) {
+		for (int trial = 0; trial < 20; ++trial) {
+
+			Fi::Matrix<s12_9> a =
+				randomMatrix<s12_9>(rows[t], cols[t], 1.0, 1.5);
+			Fi::Matrix<c18_13> r;
+
+			Fi::QR<c18_13, 16>::decompose(a, r);
+			std::vector<double> ref = referenceR(a);
+
+			BOOST_REQUIRE_EQUAL(r.rows(), cols[t]);
+			BOOST_REQUIRE_EQUAL(r.cols(), cols[t]);
+
+			for (std::size_t i = 0; i < cols[t]; ++i) {
+				BOOST_CHECK(r(i, i) >= c18_13());
+				for (std::size_t j = 0; j < cols[t]; ++j) {
+					if (j < i) {
+						BOOST_CHECK_EQUAL(r(i, j), c18_13());
+					}
+					else {
+						BOOST_CHECK_SMALL(r(i, j).toDouble() - ref[i*cols[t] + j],
+						                  0.01);
+					}
+				}
+			}
+
+		}
+	}
+
+	//Givens rotation of (3, 4) onto (5, 0)
+	Fi::Matrix<s12_9> a(2, 1);
+	a(0, 0) = s12_9(0.75);
+	a(1, 0) = s12_9(1.0);
+	Fi::Matrix<c18_13> r;
+	Fi::QR<c18_13, 16>::decompose(a, r);
+	BOOST_CHECK_SMALL(r(0, 0).toDouble() - 1.25, 0.001);
+
+}
+
+BOOST_AUTO_TEST_CASE(cell_types) {
+
+	std::srand(4);
+
+	for (int trial = 0; trial < 20; ++trial) {
+
+		Fi::Matrix<s12_9> a = randomMatrix<s12_9>(8, 4, 1.0, 1.5);
+		std::vector<double> ref = referenceR(a);
+
+		//Coarse boundary cells: the diagonal has their 10 fractional bits.
+		Fi::Matrix<c18_13> r;
+		Fi::QR<c16_10, 10, c18_13>::decompose(a, r);
+
+		//Fine boundary cells
+		Fi::Matrix<c18_13> fine;
+		Fi::QR<c22_18, 16, c18_13>::decompose(a, fine);
+
+		for (std::size_t i = 0; i < 4; ++i) {
+			BOOST_CHECK_EQUAL(r(i, i).toBinary() % 8, 0u);
+			for (std::size_t j = i; j < 4; ++j) {
+				BOOST_CHECK_SMALL(r(i, j).toDouble() - ref[i*4 + j], 0.02);
+				BOOST_CHECK_SMALL(fine(i, j).toDouble() - ref[i*4 + j], 0.01);
+			}
+		}
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(solve) {
+
+	std::srand(2);
+
+	const std::size_t n = 6;
+
+	for (int trial = 0; trial < 20; ++trial) {
+
+		Fi::Matrix<s12_9> a = randomMatrix<s12_9>(8, n, 0.5, 2.0);
+		Fi::Matrix<s12_9> x = randomMatrix<s12_9>(n, 1, 1.0);
+
+		//b = a*x in double, then quantized
+		Fi::Matrix<s12_9> b(8, 1);
+		for (std::size_t i = 0; i < 8; ++i) {
+			double s = 0.0;
+			for (std::size_t k = 0; k < n; ++k) {
+				s += a(i, k).toDouble()*x(k, 0).toDouble();
+			}
+			b(i, 0) = s12_9(s/4);
+		}
+
+		Fi::Matrix<c18_13> r, qtb;
+		Fi::QR<c18_13, 16>::decompose(a, b, r, qtb);
+
+		BOOST_REQUIRE_EQUAL(qtb.rows(), n);
+		BOOST_REQUIRE_EQUAL(qtb.cols(), 1u);
+
+		//Back substitution of R*y = Q^T b
+		std::vector<double> y(n);
+		for (std::size_t i = n; i-- > 0; ) {
+			double s = qtb(i, 0).toDouble();
+			for (std::size_t k = i + 1; k < n; ++k) {
+				s -= r(i, k).toDouble()*y[k];
+			}
+			y[i] = s/r(i, i).toDouble();
+		}
+
+		for (std::size_t k = 0; k < n; ++k) {
+			BOOST_CHECK_SMALL(4*y[k] - x(k, 0).toDouble(), 0.05);
+		}
+
+	}
+
+}
+
+/**
+ *Batch decomposition of augmented matrices, compared with decompose().
+ */
+template<typename InT, typename BoundaryT, typename CellT, std::size_t I,
+         std::size_t M, std::size_t N, std::size_t C>
+void checkBatch(std::size_t count, double scale) {
+
+	typedef Fi::QR<BoundaryT, I, CellT> QR;
+
+	std::vector<InT> in(count*M*C);
+	std::vector<CellT> out(count*N*C);
+
+	for (std::size_t e = 0; e < in.size(); ++e) {
+		in[e] = InT(scale*(2.0*std::rand()/(RAND_MAX + 1.0) - 1.0));
+	}
+
+	QR::template batch<M, N, C>(&in[0], &out[0], count);
+
+	for (std::size_t g = 0; g < count; ++g) {
+
+		Fi::Matrix<InT> a(M, N), b(M, C - N);
+		for (std::size_t i = 0; i < M; ++i) {
+			for (std::size_t j = 0; j < C; ++j) {
+				const InT v = in[g*M*C + i*C + j];
+				if (j < N) {
+					a(i, j) = v;
+				}
+				else {
+					b(i, j - N) = v;
+				}
+			}
+		}
+
+		Fi::Matrix<CellT> r, qtb;
+		QR::decompose(a, b, r, qtb);
+
+		for (std::size_t i = 0; i < N; ++i) {
+			for (std::size_t j = 0; j < C; ++j) {
+				const CellT v = (j < N) ? r(i, j) : qtb(i, j - N);
+				BOOST_CHECK_EQUAL(out[g*N*C + i*C + j], v);
+			}
+		}
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(batch) {
+
+	std::srand(3);
+
+	checkBatch<s12_9, c18_13, c18_13, 16, 4, 4, 5>(11, 1.0);
+	checkBatch<s12_9, c18_13, c18_13, 14, 8, 8, 9>(9, 1.0);
+	checkBatch<s12_9, c18_13, c18_13, 12, 6, 4, 4>(5, 1.0);
+
+	//Saturating and wrapping cells
+	checkBatch<s12_9, c12_8, c12_8, 12, 8, 8, 10>(7, 3.9);
+	checkBatch<s12_9, w20_14, w20_14, 16, 8, 8, 8>(7, 3.9);
+
+	//Cells too wide for the vector code, or of two types
+	checkBatch<s12_9, c32_26, c32_26, 24, 4, 4, 5>(6, 1.0);
+	checkBatch<s12_9, c16_10, c18_13, 10, 8, 8, 9>(6, 1.0);
+	checkBatch<s12_9, c22_18, c12_8, 12, 6, 4, 5>(6, 3.9);
+
+	//Square overload
+	std::vector<s12_9> in(5*16, s12_9(0.5));
+	std::vector<c18_13> out(5*16);
+	Fi::QR<c18_13, 16>::batch<4, 4>(&in[0], &out[0], 5);
+	BOOST_CHECK_SMALL(out[4*16].toDouble() - 1.0, 0.001);
+	BOOST_CHECK_SMALL(out[4*16 + 1].toDouble() - 1.0, 0.001);
+	BOOST_CHECK_SMALL(out[4*16 + 5].toDouble(), 0.005);
+
+}
+
+BOOST_AUTO_TEST_CASE(arguments) {
+
+	Fi::Matrix<s12_9> a(4, 4), b(3, 1);
+	Fi::Matrix<c18_13> r, qtb;
+
+	BOOST_CHECK_THROW((Fi::QR<c18_13, 16>::decompose(a, b, r, qtb)),
+	                  std::invalid_argument);
+
+}
@@ -0,0 +1,98 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/Fixed.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Throw.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/NearEven.hpp"
+#include "fi/private/Requantize.hpp"
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE requantize
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<16, 8, Fi::SIGNED, Fi::Saturate, Fi::Classic> s16_8;
+typedef Fi::Fixed<16, 8, Fi::SIGNED, Fi::Throw, Fi::Classic> t16_8;
+typedef Fi::Fixed<16, 8, Fi::UNSIGNED, Fi::Saturate, Fi::Classic> u16_8;
+typedef Fi::Fixed<32, 0, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s32_0;
+
+BOOST_AUTO_TEST_CASE(round_bits) {
+
+	//2.5 and 3.5 with 40 fractional bits.
+	const int64_t half = int64_t(1) << 39;
+	BOOST_CHECK_EQUAL((Fi::RoundBits<Fi::NearEven, 40>::apply(5*half)), 2);
+	BOOST_CHECK_EQUAL((Fi::RoundBits<Fi::NearEven, 40>::apply(7*half)), 4);
+	BOOST_CHECK_EQUAL((Fi::RoundBits<Fi::Classic, 40>::apply(5*half)), 3);
+	BOOST_CHECK_EQUAL((Fi::RoundBits<Fi::Classic, 62>::apply(
+		int64_t(3) << 60)), 1);
+
+}
+
+BOOST_AUTO_TEST_CASE(scaled) {
+
+	//1.5 with 20 fractional bits.
+	const int64_t x = int64_t(3) << 19;
+	BOOST_CHECK_EQUAL((Fi::requantizeScaled<s16_8, 20>(x, 0).toBinary()),
+	                  384);
+	BOOST_CHECK_EQUAL((Fi::requantizeScaled<s16_8, 20>(x, 3).toBinary()),
+	                  3072);
+	BOOST_CHECK_EQUAL((Fi::requantizeScaled<s16_8, 20>(-x, -2).
+	                   toBinary(true)), -96);
+
+	//Exact beyond 32 bits when the intermediate has enough fraction bits.
+	BOOST_CHECK_EQUAL((Fi::requantizeScaled<s16_8, 60>(1, 40).toBinary()), 0);
+	BOOST_CHECK_EQUAL((Fi::requantizeScaled<s16_8, 60>(1, 52).toBinary()), 1);
+
+}
+
+BOOST_AUTO_TEST_CASE(scaled_overflow) {
+
+	//n*2^k does not fit in 64 bits.
+	const int64_t big = int64_t(1) << 40;
+	BOOST_CHECK((Fi::requantizeScaled<s16_8, 20>(big, 30)) ==
+	            s16_8::MaxVal());
+	BOOST_CHECK((Fi::requantizeScaled<s16_8, 20>(-big, 30)) ==
+	            s16_8::MinVal());
+	BOOST_CHECK((Fi::requantizeScaled<u16_8, 20>(-big, 30)) ==
+	            u16_8::MinVal());
+	BOOST_CHECK((Fi::requantizeScaled<s32_0, 62>(big, 1000)) ==
+	            s32_0::MaxVal());
+	BOOST_CHECK((Fi::requantizeScaled<s32_0, 62>(-1, 64)) ==
+	            s32_0::MinVal());
+	BOOST_CHECK_THROW((Fi::requantizeScaled<t16_8, 20>(big, 30)),
+	                  Fi::PositiveOverflow);
+	BOOST_CHECK_THROW((Fi::requantizeScaled<t16_8, 20>(-big, 30)),
+	                  Fi::NegativeOverflow);
+
+	//Largest magnitudes that still fit: 2^62 - 1 and -2^62 with 62
+	//fractional bits, just below 1 and exactly -1.
+	const int64_t max = (int64_t(1) << 61) - 1;
+	BOOST_CHECK_EQUAL((Fi::requantizeScaled<s32_0, 62>(max, 1).toBinary()),
+	                  1);
+	BOOST_CHECK_EQUAL((Fi::requantizeScaled<s32_0, 62>(-max - 1, 1).
+	                   toBinary(true)), -1);
+	BOOST_CHECK_EQUAL((Fi::requantizeScaled<s32_0, 62>(0, 1000).toBinary()),
+	                  0);
+
+}
@@ -0,0 +1,230 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/Statistics.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Floor.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+#if __cplusplus >= 201103L
+#include <thread>
+#include <vector>
+#endif
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE statistics
+#include <boost/test/unit_test.hpp>
+
+struct Gain {
+	static const char* name() { return "gain"; }
+};
+
+struct Error {
+	static const char* name() { return "error"; }
+};
+
+typedef Fi::Fixed<8, 4, Fi::SIGNED,
+                  FI_OVERFLOW_STATISTICS(Gain, Fi::Saturate),
+                  FI_ROUNDING_STATISTICS(Gain, Fi::Classic)> gain;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Saturate, Fi::Classic> s8_4;
+
+typedef Fi::Fixed<12, 6, Fi::SIGNED,
+                  FI_OVERFLOW_STATISTICS(Error, Fi::Wrap),
+                  FI_ROUNDING_STATISTICS(Error, Fi::Floor)> error12;
+typedef Fi::Fixed<16, 10, Fi::SIGNED,
+                  FI_OVERFLOW_STATISTICS(Error, Fi::Wrap),
+                  FI_ROUNDING_STATISTICS(Error, Fi::Floor)> error16;
+typedef Fi::Fixed<12, 6, Fi::SIGNED, Fi::Wrap, Fi::Floor> w12_6;
+
+typedef Fi::Fixed<8, 3, Fi::UNSIGNED,
+                  Fi::OverflowStatistics<void, Fi::Saturate>::Handler,
+                  Fi::RoundingStatistics<void, Fi::Classic>::Handler> u8_3;
+
+BOOST_AUTO_TEST_CASE(overflow_test) {
+
+	Fi::resetStatistics();
+
+	gain a(7.0);
+	gain b = a + a;
+	gain c = -a - a - a;
+	a += gain(0.5);
+
+	BOOST_CHECK_EQUAL(b.toBinary(true), s8_4::MaxVal().toBinary(true));
+	BOOST_CHECK_EQUAL(c.toBinary(true), s8_4::MinVal().toBinary(true));
+
+	Fi::Statistics s = Fi::statistics()["gain"];
+	BOOST_CHECK_EQUAL(s.positiveOverflows, 1u);
+	BOOST_CHECK_EQUAL(s.negativeOverflows, 2u);
+	//After saturation at -8, subtracting 7 exceeds the range by 7.
+	BOOST_CHECK_EQUAL(s.maxExcess, 7.0*16);
+	//Conversions of 7.0 and 0.5.
+	BOOST_CHECK_EQUAL(s.roundings, 2u);
+
+	Fi::resetStatistics();
+	s = Fi::statistics()["gain"];
+	BOOST_CHECK_EQUAL(s.positiveOverflows, 0u);
+	BOOST_CHECK_EQUAL(s.negativeOverflows, 0u);
+
+	//Results are those of the handlers.
+	for (int i = 0; i < 500; ++i) {
+		const int x = std::rand() % 256 - 128;
+		const int y = std::rand() % 256 - 128;
+		gain p = gain::fromBinary(x)*gain::fromBinary(y);
+		s8_4 q = s8_4::fromBinary(x)*s8_4::fromBinary(y);
+		BOOST_CHECK_EQUAL(p.toBinary(true), q.toBinary(true));
+		error12 r = error12::fromBinary(16*x) + error12::fromBinary(16*y);
+		w12_6 t = w12_6::fromBinary(16*x) + w12_6::fromBinary(16*y);
+		BOOST_CHECK_EQUAL(r.toBinary(true), t.toBinary(true));
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(rounding_test) {
+
+	Fi::resetStatistics();
+
+	double sum = 0;
+	double squares = 0;
+	double largest = 0;
+
+	for (int i = 0; i < 1000; ++i) {
+		const int x = std::rand() % 4096 - 2048;
+		const int y = std::rand() % 4096 - 2048;
+		error12 a = error12::fromBinary(x);
+		error12 b = error12::fromBinary(y);
+		a *= b;
+		//Exact product in units of the result.
+		const double exact = std::ldexp(static_cast<double>(x)*y, -6);
+		const double e = std::floor(exact) - exact;
+		sum += e;
+		squares += e*e;
+		largest = std::max(largest, std::fabs(e));
+	}
+
+	//Conversions from double and string are recorded too.
+	error16 c(0.3);
+	error16 d("0.3");
+	const double e16 = std::floor(0.3*1024) - 0.3*1024;
+
+	Fi::Statistics s = Fi::statistics()["error"];
+	BOOST_CHECK_EQUAL(s.roundings, 1002u);
+	BOOST_CHECK_CLOSE(s.errorSum, sum + 2*e16, 1e-6);
+	BOOST_CHECK_CLOSE(s.squaredErrorSum, squares + 2*e16*e16, 1e-6);
+	BOOST_CHECK_EQUAL(s.maxError, std::max(largest, std::fabs(e16)));
+	BOOST_CHECK_CLOSE(s.meanError(), (sum + 2*e16)/1002, 1e-6);
+	BOOST_CHECK_CLOSE(s.rmsError(),
+	                  std::sqrt((squares + 2*e16*e16)/1002), 1e-6);
+
+	//Floor is biased by half a bit.
+	BOOST_CHECK_SMALL(s.meanError() + 0.5, 0.1);
+
+}
+
+BOOST_AUTO_TEST_CASE(format_test) {
+
+	Fi::resetStatistics();
+
+	u8_3 a(20.0);
+	u8_3 b = a*a;
+	u8_3 c = a - b;
+	(void)c;
+
+	Fi::Statistics s = Fi::statistics()["u8.3"];
+	BOOST_CHECK_EQUAL(s.positiveOverflows, 1u);
+	BOOST_CHECK_EQUAL(s.negativeOverflows, 1u);
+	BOOST_CHECK_EQUAL(s.roundings, 2u);
+
+	std::ostringstream os;
+	Fi::reportStatistics(os);
+	BOOST_CHECK(os.str().find("u8.3") != std::string::npos);
+	BOOST_CHECK(os.str().find("gain") != std::string::npos);
+
+}
+
+/**
+ *A format instrumented under a tag given as a template parameter.
+ */
+template<typename Tag>
+struct Tagged {
+	typedef Fi::Fixed<8, 4, Fi::SIGNED,
+	                  FI_OVERFLOW_STATISTICS_TPL(Tag, Fi::Saturate),
+	                  FI_ROUNDING_STATISTICS_TPL(Tag, Fi::Classic)> type;
+};
+
+BOOST_AUTO_TEST_CASE(template_test) {
+
+	Fi::resetStatistics();
+
+	typedef Tagged<Error>::type tagged;
+	tagged a(7.0);
+	tagged b = a*a;
+	BOOST_CHECK(b == tagged::MaxVal());
+
+	Fi::Statistics s = Fi::statistics()["error"];
+	BOOST_CHECK_EQUAL(s.positiveOverflows, 1u);
+
+}
+
+#if __cplusplus >= 201103L || defined(FI_STATISTICS_PTHREAD)
+
+void* overflowTwice(void*) {
+	gain a(7.0);
+	a = a + a;
+	a = a + a;
+	return 0;
+}
+
+BOOST_AUTO_TEST_CASE(thread_test) {
+
+	Fi::resetStatistics();
+
+#if __cplusplus >= 201103L
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 4; ++i) {
+		threads.push_back(std::thread(overflowTwice, static_cast<void*>(0)));
+	}
+	for (int i = 0; i < 4; ++i) {
+		threads[i].join();
+	}
+#else
+	pthread_t threads[4];
+	for (int i = 0; i < 4; ++i) {
+		pthread_create(&threads[i], 0, overflowTwice, 0);
+	}
+	for (int i = 0; i < 4; ++i) {
+		pthread_join(threads[i], 0);
+	}
+#endif
+
+	gain a(7.0);
+	a = a + a;
+
+	BOOST_CHECK_EQUAL(Fi::statistics()["gain"].positiveOverflows, 9u);
+
+}
+
+#endif
@@ -0,0 +1,183 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/Complex.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Sticky.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+
+#include <cstdlib>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE sticky
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::StickySaturate, Fi::Classic> ss8_4;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Saturate, Fi::Classic> s8_4;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::StickyWrap, Fi::Classic> sw8_4;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Wrap, Fi::Classic> w8_4;
+typedef Fi::Fixed<14, 6, Fi::SIGNED, Fi::StickySaturate, Fi::Classic> ss14_6;
+typedef Fi::Fixed<14, 6, Fi::SIGNED, Fi::Saturate, Fi::Classic> s14_6;
+typedef Fi::Fixed<24, 10, Fi::SIGNED, Fi::StickyWrap, Fi::Classic> sw24_10;
+typedef Fi::Fixed<24, 10, Fi::SIGNED, Fi::Wrap, Fi::Classic> w24_10;
+typedef Fi::Fixed<8, 4, Fi::UNSIGNED, Fi::StickySaturate, Fi::Classic> us8_4;
+
+BOOST_AUTO_TEST_CASE(flags_test) {
+
+	Fi::clearOverflowFlags();
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), 0u);
+
+	ss8_4 a(5.0);
+	ss8_4 b = a + a;
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::POSITIVE_OVERFLOW));
+	BOOST_CHECK(b == ss8_4::MaxVal());
+
+	//Flags stay set.
+	b = a - a;
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::POSITIVE_OVERFLOW));
+
+	b = -a - a;
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::ALL_OVERFLOW));
+	BOOST_CHECK(b == ss8_4::MinVal());
+
+	Fi::clearOverflowFlags(Fi::POSITIVE_OVERFLOW);
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::NEGATIVE_OVERFLOW));
+	Fi::clearOverflowFlags();
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), 0u);
+
+	//Conversions.
+	ss8_4 c(100.0);
+	BOOST_CHECK(c == ss8_4::MaxVal());
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::POSITIVE_OVERFLOW));
+	Fi::clearOverflowFlags();
+
+	us8_4 d(-1.0);
+	BOOST_CHECK(d == us8_4::MinVal());
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::NEGATIVE_OVERFLOW));
+	Fi::clearOverflowFlags();
+
+	ss8_4 e("-9.5");
+	BOOST_CHECK(e == ss8_4::MinVal());
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::NEGATIVE_OVERFLOW));
+	Fi::clearOverflowFlags();
+
+	ss8_4 f = ss8_4(3.0)*ss8_4(-4.0);
+	BOOST_CHECK(f == ss8_4::MinVal());
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::NEGATIVE_OVERFLOW));
+	Fi::clearOverflowFlags();
+
+	//No overflow.
+	f = ss8_4(3.0)*ss8_4(-2.0) + ss8_4(1.5);
+	BOOST_CHECK_EQUAL(Fi::overflowFlags(), 0u);
+
+}
+
+template<typename StickyT, typename T>
+void sameResults() {
+
+	Fi::clearOverflowFlags();
+
+	unsigned expected = 0;
+
+	for (int i = 0; i < 1000; ++i) {
+
+		const typename T::valtype ra = std::rand() - RAND_MAX/2;
+		const typename T::valtype rb = std::rand() - RAND_MAX/2;
+		const T a = T::fromBinary(ra);
+		const T b = T::fromBinary(rb);
+		const StickyT sa = StickyT::fromBinary(ra);
+		const StickyT sb = StickyT::fromBinary(rb);
+
+		const double sum = a.toDouble() + b.toDouble();
+		if (sum > T::MaxVal().toDouble()) {
+			expected |= Fi::POSITIVE_OVERFLOW;
+		}
+		if (sum < T::MinVal().toDouble()) {
+			expected |= Fi::NEGATIVE_OVERFLOW;
+		}
+
+		BOOST_CHECK_EQUAL((sa + sb).toBinary(true), (a + b).toBinary(true));
+		BOOST_CHECK_EQUAL((sa*sb).toBinary(true), (a*b).toBinary(true));
+
+	}
+
+	//Products overflow as well.
+	BOOST_CHECK_EQUAL(Fi::overflowFlags() & expected, expected);
+
+}
+
+BOOST_AUTO_TEST_CASE(results_test) {
+	sameResults<ss8_4, s8_4>();
+	sameResults<sw8_4, w8_4>();
+	sameResults<ss14_6, s14_6>();
+	sameResults<sw24_10, w24_10>();
+}
+
+template<typename StickyT, typename T>
+void vectors() {
+
+	//Large enough for the vector kernels, with overflow in one element.
+	for (std::size_t k = 0; k < 37; ++k) {
+
+		Fi::ComplexVector<StickyT> x(37);
+		Fi::ComplexVector<StickyT> y(37);
+		Fi::ComplexVector<T> xr(37);
+		Fi::ComplexVector<T> yr(37);
+
+		for (std::size_t i = 0; i < 37; ++i) {
+			const double v = (i == k) ? 0.9 : 0.1;
+			const double scale = T::MaxVal().toDouble();
+			x.set(i, Fi::Complex<StickyT>(StickyT(v*scale), StickyT(-0.1*scale)));
+			y.set(i, Fi::Complex<StickyT>(StickyT(v*scale), StickyT(0.2*scale)));
+			xr.set(i, Fi::Complex<T>(T(v*scale), T(-0.1*scale)));
+			yr.set(i, Fi::Complex<T>(T(v*scale), T(0.2*scale)));
+		}
+
+		Fi::clearOverflowFlags();
+		Fi::ComplexVector<StickyT> out;
+		Fi::ComplexVector<T> ref;
+
+		Fi::add(x, y, out);
+		Fi::add(xr, yr, ref);
+		BOOST_CHECK_EQUAL(Fi::overflowFlags(), unsigned(Fi::POSITIVE_OVERFLOW));
+
+		for (std::size_t i = 0; i < 37; ++i) {
+			BOOST_CHECK_EQUAL(out[i].real().toBinary(true),
+			                  ref[i].real().toBinary(true));
+			BOOST_CHECK_EQUAL(out[i].imag().toBinary(true),
+			                  ref[i].imag().toBinary(true));
+		}
+
+		Fi::clearOverflowFlags();
+		Fi::subtract(y, x, out);
+		BOOST_CHECK_EQUAL(Fi::overflowFlags(), 0u);
+
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(vector_test) {
+	vectors<ss8_4, s8_4>();
+	vectors<sw8_4, w8_4>();
+	vectors<ss14_6, s14_6>();
+}
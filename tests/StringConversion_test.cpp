@@ -57,6 +57,13 @@ BOOST_AUTO_TEST_CASE( from_string )
 	BOOST_CHECK_EQUAL( (unsigned char)((fromString<TR888S>("-0.5")).first) , 0x80 );
 	BOOST_CHECK_EQUAL( (unsigned char)((fromString<TR888S>("7.9375")).first) , 0xF0 );
 
+	//More than 32 fractional bits, as used by the string constructor of
+	//types with more than 16 fractional bits.
+	typedef Fi::Traits<52, 64, 48, Fi::SIGNED> TR5248S;
+
+	BOOST_CHECK_EQUAL( (fromString<TR5248S>("-0.5")).first, -(int64_t(1) << 47) );
+	BOOST_CHECK_EQUAL( (fromString<TR5248S>("0.75")).first, int64_t(3) << 46 );
+
 }
 
 BOOST_AUTO_TEST_SUITE_END()
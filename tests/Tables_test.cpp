@@ -0,0 +1,179 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/Tables.hpp"
+#include "fi/FFT.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/overflow/Wrap.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+#include "fi/rounding/Floor.hpp"
+#include "fi/rounding/NearEven.hpp"
+
+#include <cmath>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE tables
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Saturate, Fi::Classic> q15;
+typedef Fi::Fixed<16, 15, Fi::SIGNED, Fi::Wrap, Fi::Floor> q15_floor;
+typedef Fi::Fixed<12, 10, Fi::SIGNED, Fi::Saturate, Fi::NearEven> s12_10;
+typedef Fi::Fixed<16, 14, Fi::UNSIGNED, Fi::Saturate, Fi::Fix> u16_14;
+
+const double TWO_PI = 8.0*std::atan(1.0);
+
+constexpr double ramp(std::size_t i) {
+	return i/8.0 - 1.0;
+}
+
+struct Square {
+	double scale;
+	constexpr double operator()(std::size_t i) const {
+		return scale*i*i;
+	}
+};
+
+BOOST_AUTO_TEST_CASE(generate_test) {
+
+	constexpr std::array<s12_10, 17> r =
+		Fi::table::generate<s12_10, 17>(ramp);
+	static_assert(r[0].toBinary(true) == -1024, "");
+	static_assert(r[16].toBinary() == 1024, "");
+	for (std::size_t i = 0; i < r.size(); ++i) {
+		BOOST_CHECK_EQUAL(r[i].toBinary(), s12_10(ramp(i)).toBinary());
+	}
+
+	//Saturated by the overflow handler of the type.
+	constexpr std::array<s12_10, 8> s =
+		Fi::table::generate<s12_10, 8>(Square{0.1});
+	static_assert(s[7] == s12_10::MaxVal(), "");
+	for (std::size_t i = 0; i < s.size(); ++i) {
+		BOOST_CHECK_EQUAL(s[i].toBinary(), s12_10(0.1*i*i).toBinary());
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(sin_cos_test) {
+
+	//std::sin and std::cos of the rounded angle are less accurate.
+	for (std::size_t n = 1; n < 200; ++n) {
+		for (std::size_t i = 0; i < n; ++i) {
+			const double a = TWO_PI*i/n;
+			BOOST_CHECK_SMALL(Fi::table::sinCycle(i, n) - std::sin(a), 4e-15);
+			BOOST_CHECK_SMALL(Fi::table::cosCycle(i, n) - std::cos(a), 4e-15);
+		}
+	}
+
+	static_assert(Fi::table::sinCycle(1, 4) == 1.0, "");
+	static_assert(Fi::table::cosCycle(2, 4) == -1.0, "");
+	static_assert(Fi::table::sinCycle(3, 4) == -1.0, "");
+	static_assert(Fi::table::cosCycle(5, 4) == 0.0, "");
+
+}
+
+BOOST_AUTO_TEST_CASE(sine_cosine_test) {
+
+	constexpr std::array<q15, 1024> s = Fi::table::sine<q15, 1024>();
+	constexpr std::array<q15, 1024> c = Fi::table::cosine<q15, 1024>();
+	static_assert(s[0].toBinary() == 0, "");
+	static_assert(s[256] == q15::MaxVal(), "");
+	static_assert(s[768].toBinary(true) == -32768, "");
+	static_assert(c[512].toBinary(true) == -32768, "");
+
+	for (std::size_t i = 0; i < s.size(); ++i) {
+		const double a = TWO_PI*i/1024;
+		BOOST_CHECK_EQUAL(s[i].toBinary(), q15(std::sin(a)).toBinary());
+		BOOST_CHECK_EQUAL(c[i].toBinary(), q15(std::cos(a)).toBinary());
+	}
+
+	//Wrap and Floor: 1.0 wraps to -1.0, and sin(7*pi/6) is exactly -0.5
+	//while std::sin(7*pi/6) is below -0.5.
+	constexpr std::array<q15_floor, 360> w = Fi::table::sine<q15_floor, 360>();
+	static_assert(w[90].toBinary(true) == -32768, "");
+	static_assert(w[210].toBinary(true) == -16384, "");
+	for (std::size_t i = 0; i < w.size(); ++i) {
+		const double v = Fi::table::sinCycle(i, 360);
+		BOOST_CHECK_EQUAL(w[i].toBinary(), q15_floor(v).toBinary());
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(twiddles_test) {
+
+	typedef Fi::FFT<q15, 64, q15, 4> fft;
+
+	constexpr std::array<q15, 128> w = Fi::table::twiddles<q15, 64>();
+	for (std::size_t i = 0; i < 64; ++i) {
+		const Fi::Complex<q15> t = fft::twiddle(i);
+		BOOST_CHECK_EQUAL(w[2*i].toBinary(), t.real().toBinary());
+		BOOST_CHECK_EQUAL(w[2*i + 1].toBinary(), t.imag().toBinary());
+	}
+
+}
+
+BOOST_AUTO_TEST_CASE(window_test) {
+
+	const std::size_t N = 255;
+	constexpr std::array<q15, N> hann = Fi::table::hann<q15, N>();
+	constexpr std::array<q15, N> hamming = Fi::table::hamming<q15, N>();
+	constexpr std::array<q15, N> blackman = Fi::table::blackman<q15, N>();
+
+	static_assert(hann[0].toBinary() == 0, "");
+	static_assert(hann[127] == q15::MaxVal(), "");
+	static_assert(hann[N - 1].toBinary() == 0, "");
+
+	for (std::size_t i = 0; i < N; ++i) {
+		const double c = std::cos(TWO_PI*i/(N - 1));
+		const double c2 = std::cos(2*TWO_PI*i/(N - 1));
+		BOOST_CHECK_EQUAL(hann[i].toBinary(), q15(0.5 - 0.5*c).toBinary());
+		BOOST_CHECK_EQUAL(hamming[i].toBinary(),
+		                  q15(0.54 - 0.46*c).toBinary());
+		BOOST_CHECK_EQUAL(blackman[i].toBinary(),
+		                  q15(0.42 - 0.5*c + 0.08*c2).toBinary());
+		BOOST_CHECK(hann[i] == hann[N - 1 - i]);
+	}
+
+	constexpr std::array<q15, 1> one = Fi::table::hann<q15, 1>();
+	static_assert(one[0] == q15::MaxVal(), "");
+
+}
+
+BOOST_AUTO_TEST_CASE(reciprocal_seeds_test) {
+
+	constexpr std::array<u16_14, 16> seeds =
+		Fi::table::reciprocalSeeds<u16_14, 4>();
+	for (std::size_t i = 0; i < seeds.size(); ++i) {
+		const double m = 1.0 + (i + 0.5)/16;
+		BOOST_CHECK_EQUAL(seeds[i].toBinary(), u16_14(1.0/m).toBinary());
+	}
+	static_assert(seeds[0].toBinary() == 15887, "");
+
+	constexpr std::array<q15, 1024> fine =
+		Fi::table::reciprocalSeeds<q15, 10>();
+	for (std::size_t i = 0; i < fine.size(); ++i) {
+		const double m = 1.0 + (i + 0.5)/1024;
+		BOOST_CHECK_EQUAL(fine[i].toBinary(), q15(1.0/m).toBinary());
+	}
+
+}
@@ -0,0 +1,207 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+#include "fi/Tracked.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE tracked
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<24, 12, Fi::SIGNED, Fi::Saturate, Fi::Classic> wide;
+typedef Fi::Fixed<24, 12, Fi::SIGNED, Fi::Saturate, Fi::Fix> truncated;
+
+struct Input {
+	static const char* name() { return "input"; }
+};
+
+struct Acc {
+	static const char* name() { return "acc"; }
+};
+
+struct Coef {
+	static const char* name() { return "coef"; }
+};
+
+BOOST_AUTO_TEST_CASE(range_test) {
+
+	Fi::resetRanges();
+
+	typedef Fi::Tracked<wide, Input> input;
+	typedef Fi::Tracked<wide, Acc> acc;
+
+	acc a;
+	for (int i = -20; i <= 30; ++i) {
+		input x(wide::fromBinary(i*256));
+		a += x;
+		//Copies do not record.
+		input y = x;
+		y = x;
+	}
+
+	Fi::ValueRange r = Fi::ranges()["input"];
+	BOOST_CHECK_EQUAL(r.samples, 51u);
+	BOOST_CHECK_EQUAL(r.minimum, -20.0/16);
+	BOOST_CHECK_EQUAL(r.maximum, 30.0/16);
+	//Multiples of 1/16.
+	BOOST_CHECK_EQUAL(r.precision, 4);
+	BOOST_CHECK(r.signedness() == Fi::SIGNED);
+	BOOST_CHECK_EQUAL(r.integerLength(), 2);
+	BOOST_CHECK_EQUAL(r.fractionLength(), 4);
+	BOOST_CHECK_EQUAL(r.wordLength(), 6);
+	BOOST_CHECK_EQUAL(r.rmsError(), 0.0);
+
+	r = Fi::ranges()["acc"];
+	BOOST_CHECK_EQUAL(r.samples, 51u);
+	BOOST_CHECK_EQUAL(r.minimum, -210.0/16);
+	BOOST_CHECK_EQUAL(r.maximum, 255.0/16);
+	BOOST_CHECK_EQUAL(r.integerLength(), 5);
+
+	//Zero is not recorded by default construction.
+	BOOST_CHECK_EQUAL(a.value().toBinary(true), 255*256);
+
+	Fi::resetRanges();
+	BOOST_CHECK_EQUAL(Fi::ranges()["acc"].samples, 0u);
+
+}
+
+BOOST_AUTO_TEST_CASE(length_test) {
+
+	Fi::ValueRange r;
+
+	//Unsigned values up to, but not including, a power of two.
+	r.minimum = 0;
+	r.maximum = 7.75;
+	r.precision = 2;
+	r.samples = 1;
+	BOOST_CHECK(r.signedness() == Fi::UNSIGNED);
+	BOOST_CHECK_EQUAL(r.integerLength(), 3);
+	r.maximum = 8;
+	BOOST_CHECK_EQUAL(r.integerLength(), 4);
+
+	//-8 fits in a signed number with 4 integer bits, 8 does not.
+	r.minimum = -8;
+	r.maximum = 7.75;
+	BOOST_CHECK_EQUAL(r.integerLength(), 4);
+	r.minimum = -8.25;
+	BOOST_CHECK_EQUAL(r.integerLength(), 5);
+
+	//Integers that are multiples of 4 need no fractional bits.
+	r.precision = -2;
+	BOOST_CHECK_EQUAL(r.fractionLength(), 0);
+
+	//Bits below the error carry noise.
+	r.precision = 12;
+	r.squaredErrorSum = std::ldexp(1.0, -12);
+	BOOST_CHECK_EQUAL(r.rmsError(), std::ldexp(1.0, -6));
+	BOOST_CHECK_EQUAL(r.fractionLength(), 8);
+	BOOST_CHECK_EQUAL(r.fractionLength(0), 6);
+	BOOST_CHECK_EQUAL(r.fractionLength(10), 12);
+
+	//Merging an empty range changes nothing.
+	Fi::ValueRange s = r;
+	s.merge(Fi::ValueRange());
+	BOOST_CHECK_EQUAL(s.samples, r.samples);
+	BOOST_CHECK_EQUAL(s.minimum, r.minimum);
+	BOOST_CHECK_EQUAL(s.maximum, r.maximum);
+
+	Fi::ValueRange t;
+	t.merge(r);
+	BOOST_CHECK_EQUAL(t.minimum, r.minimum);
+	BOOST_CHECK_EQUAL(t.precision, r.precision);
+
+}
+
+BOOST_AUTO_TEST_CASE(shadow_test) {
+
+	Fi::resetRanges();
+
+	typedef Fi::Tracked<truncated, Coef, true> coef;
+	typedef Fi::Tracked<truncated, Acc, true> acc;
+
+	const coef c(0.3);
+	BOOST_CHECK_EQUAL(c.shadow(), 0.3);
+
+	acc a;
+	double sum = 0;
+	double exact = 0;
+	double squares = 0;
+	double largest = 0;
+	for (int i = 0; i < 200; ++i) {
+		const Fi::Tracked<truncated, void, true> x(
+			std::rand()/static_cast<double>(RAND_MAX));
+		a += c*x;
+		exact += 0.3*x.shadow();
+		const double e = a.value().toDouble() - exact;
+		sum += e;
+		squares += e*e;
+		largest = std::max(largest, std::fabs(e));
+		BOOST_CHECK_CLOSE(a.shadow(), exact, 1e-9);
+	}
+
+	Fi::ValueRange r = Fi::ranges()["acc"];
+	BOOST_CHECK_EQUAL(r.samples, 200u);
+	BOOST_CHECK_CLOSE(r.errorSum, sum, 1e-6);
+	BOOST_CHECK_CLOSE(r.squaredErrorSum, squares, 1e-6);
+	BOOST_CHECK_CLOSE(r.maxError, largest, 1e-6);
+	//Truncation biases the sum downwards.
+	BOOST_CHECK(r.meanError() < 0);
+	BOOST_CHECK(r.fractionLength() < 12);
+
+	r = Fi::ranges()["coef"];
+	BOOST_CHECK_EQUAL(r.samples, 1u);
+	BOOST_CHECK_CLOSE(r.errorSum, c.value().toDouble() - 0.3, 1e-9);
+
+	//Values are those of the fixed-point operators.
+	const truncated p = truncated(0.3)*truncated(0.7);
+	const Fi::Tracked<truncated, void, true> q =
+		c*Fi::Tracked<truncated, Coef, true>(0.7);
+	BOOST_CHECK(q.value() == p);
+	BOOST_CHECK((-q).value() == -p);
+	BOOST_CHECK(q < c);
+	BOOST_CHECK(c >= q);
+	BOOST_CHECK(q != c);
+
+}
+
+BOOST_AUTO_TEST_CASE(report_test) {
+
+	Fi::resetRanges();
+
+	Fi::Tracked<wide, Input> x(-1.5);
+	Fi::Tracked<wide, Input> y(3.25);
+	(void)x;
+	(void)y;
+
+	std::ostringstream os;
+	Fi::reportRanges(os);
+	BOOST_CHECK(os.str().find("input") != std::string::npos);
+	//Three integer bits and two fractional bits.
+	BOOST_CHECK(os.str().find("s5.2") != std::string::npos);
+
+}
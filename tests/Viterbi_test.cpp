@@ -0,0 +1,198 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+#include "fi/Viterbi.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_DYN_LINK true
+#define BOOST_TEST_MODULE viterbi
+#include <boost/test/unit_test.hpp>
+
+typedef Fi::Fixed<6, 2, Fi::SIGNED, Fi::Saturate, Fi::Classic> s6_2;
+typedef Fi::Fixed<11, 2, Fi::SIGNED, Fi::Wrap> w11_2;
+typedef Fi::Fixed<16, 2, Fi::SIGNED, Fi::Wrap> w16_2;
+typedef Fi::Fixed<20, 2, Fi::SIGNED, Fi::Wrap> w20_2;
+typedef Fi::Fixed<8, 4, Fi::SIGNED, Fi::Wrap> w8_4;
+
+typedef Fi::Trellis<7, 0171, 0133> K7;
+typedef Fi::Trellis<3, 07, 05> K3;
+typedef Fi::Trellis<5, 025, 033, 037> K5;
+
+std::vector<uint8_t> randomBits(std::size_t n, std::size_t tail) {
+	std::vector<uint8_t> u(n + tail, 0);
+	for (std::size_t i = 0; i < n; ++i) {
+		u[i] = static_cast<uint8_t>(std::rand() % 2);
+	}
+	return u;
+}
+
+/**
+ *BPSK symbols of the code bits with uniform noise of amplitude
+ *\c noise.
+ */
+std::vector<s6_2> channel(const std::vector<uint8_t>& c, double noise) {
+	std::vector<s6_2> y(c.size());
+	for (std::size_t i = 0; i < c.size(); ++i) {
+		const double n = noise*(2.0*std::rand()/(RAND_MAX + 1.0) - 1.0);
+		y[i] = s6_2((c[i] ? -4.0 : 4.0) + n);
+	}
+	return y;
+}
+
+/**
+ *Path metrics computed with the operators of \c PathT.
+ */
+template<typename TrellisT, typename PathT>
+struct Reference {
+
+	std::vector<PathT> metrics;
+
+	Reference() : metrics(TrellisT::STATES,
+	                      PathT::fromBinary(TrellisT::RATE << 6)) {
+		metrics[0] = PathT();
+	}
+
+	void update(const s6_2* y) {
+		const std::size_t S = TrellisT::STATES;
+		std::vector<PathT> next(S);
+		for (std::size_t t = 0; t < S; ++t) {
+			PathT m[2];
+			for (std::size_t h = 0; h < 2; ++h) {
+				const std::size_t p = (t >> 1) + h*S/2;
+				const unsigned c = TrellisT::output(p, t & 1);
+				m[h] = metrics[p];
+				for (std::size_t r = 0; r < TrellisT::RATE; ++r) {
+					const PathT v = PathT::fromBinary(y[r].toBinary(true));
+					m[h] += ((c >> r) & 1) ? v : -v;
+				}
+			}
+			next[t] = Fi::modularLess(m[1], m[0]) ? m[1] : m[0];
+		}
+		metrics = next;
+	}
+
+};
+
+template<typename TrellisT, typename PathT>
+void checkMetrics(std::size_t n, double noise) {
+	const std::size_t R = TrellisT::RATE;
+	const std::vector<uint8_t> u = randomBits(n, 0);
+	std::vector<uint8_t> c(n*R);
+	TrellisT::encode(&u[0], n, &c[0]);
+	const std::vector<s6_2> y = channel(c, noise);
+
+	Fi::Viterbi<TrellisT, s6_2, PathT> decoder;
+	Reference<TrellisT, PathT> reference;
+	for (std::size_t i = 0; i < n; i += 7) {
+		const std::size_t steps = std::min<std::size_t>(7, n - i);
+		decoder.update(&y[i*R], steps);
+		for (std::size_t k = 0; k < steps; ++k) {
+			reference.update(&y[(i + k)*R]);
+		}
+		for (std::size_t s = 0; s < TrellisT::STATES; ++s) {
+			BOOST_REQUIRE(decoder.metric(s) == reference.metrics[s]);
+		}
+	}
+	BOOST_CHECK_EQUAL(decoder.steps(), n);
+}
+
+template<typename TrellisT, typename PathT>
+void checkDecoding(std::size_t n, double noise) {
+	const std::size_t R = TrellisT::RATE;
+	const std::size_t tail = TrellisT::CONSTRAINT_LENGTH - 1;
+	const std::vector<uint8_t> u = randomBits(n, tail);
+	std::vector<uint8_t> c(u.size()*R);
+	TrellisT::encode(&u[0], u.size(), &c[0]);
+	const std::vector<s6_2> y = channel(c, noise);
+
+	Fi::Viterbi<TrellisT, s6_2, PathT> decoder;
+	decoder.update(&y[0], u.size());
+	std::vector<uint8_t> bits(u.size());
+	decoder.traceback(0, &bits[0]);
+	BOOST_CHECK(bits == u);
+	BOOST_CHECK_EQUAL(decoder.best(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(modular_less) {
+	BOOST_CHECK(Fi::modularLess(w8_4(1.0), w8_4(2.0)));
+	BOOST_CHECK(!Fi::modularLess(w8_4(2.0), w8_4(1.0)));
+	BOOST_CHECK(!Fi::modularLess(w8_4(1.0), w8_4(1.0)));
+
+	//7.5 + 1 wraps to -7.5 but is still greater.
+	w8_4 a(7.5);
+	w8_4 b(a);
+	b += w8_4(1.0);
+	BOOST_CHECK(b < a);
+	BOOST_CHECK(Fi::modularLess(a, b));
+	BOOST_CHECK(!Fi::modularLess(b, a));
+}
+
+BOOST_AUTO_TEST_CASE(trellis) {
+	BOOST_CHECK(K7::STATES == 64);
+	BOOST_CHECK(K5::RATE == 3);
+
+	//The response to a single one is the generators.
+	std::vector<uint8_t> u(7, 0);
+	u[0] = 1;
+	std::vector<uint8_t> c(14);
+	K7::encode(&u[0], u.size(), &c[0]);
+	for (std::size_t i = 0; i < 7; ++i) {
+		BOOST_CHECK_EQUAL(c[2*i], (0171 >> i) & 1);
+		BOOST_CHECK_EQUAL(c[2*i + 1], (0133 >> i) & 1);
+	}
+	BOOST_CHECK_EQUAL(K3::next(3, 0), 2u);
+	BOOST_CHECK_EQUAL(K3::output(0, 1), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(metrics) {
+	checkMetrics<K7, w11_2>(500, 6.0);
+	checkMetrics<K7, w16_2>(500, 6.0);
+	checkMetrics<K7, w20_2>(500, 6.0);
+	checkMetrics<K3, w11_2>(300, 6.0);
+	checkMetrics<K5, w16_2>(300, 6.0);
+}
+
+BOOST_AUTO_TEST_CASE(decoding) {
+	//The metrics wrap around many times.
+	checkDecoding<K7, w11_2>(20000, 0.0);
+	checkDecoding<K7, w11_2>(5000, 5.0);
+	checkDecoding<K7, w20_2>(5000, 5.0);
+	checkDecoding<K3, w11_2>(2000, 3.0);
+	checkDecoding<K5, w16_2>(2000, 5.0);
+}
+
+BOOST_AUTO_TEST_CASE(arguments) {
+	BOOST_CHECK_THROW((Fi::Viterbi<K3, s6_2, w11_2>(4)), std::invalid_argument);
+	Fi::Viterbi<K3, s6_2, w11_2> decoder(3);
+	BOOST_CHECK(decoder.metric(3) == w11_2());
+	uint8_t bits[1];
+	BOOST_CHECK_THROW(decoder.traceback(4, bits), std::invalid_argument);
+	BOOST_CHECK_THROW(decoder.metric(4), std::out_of_range);
+}
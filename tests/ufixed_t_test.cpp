@@ -109,6 +109,22 @@ BOOST_AUTO_TEST_CASE( saturate_sub )
 
 }
 
+BOOST_AUTO_TEST_CASE( saturate_sub_wide )
+{
+
+	//Wider than 8 bits, the difference is held in an unsigned type of 32
+	//bits or more and was detected as a positive overflow.
+	typedef Fi::Fixed<16, 8, Fi::UNSIGNED, Fi::Saturate> fi16s;
+	typedef Fi::Fixed<32, 16, Fi::UNSIGNED, Fi::Saturate> fi32s;
+
+	CHECK_EQ(fi16s("1.0") - fi16s("2.0"), "0.0");
+	CHECK_EQ(fi16s("0.0") - fi16s("255.99609375"), "0.0");
+	CHECK_EQ(fi16s("3.5") - fi16s("1.25"), "2.25");
+	CHECK_EQ(fi32s("1.0") - fi32s("2.0"), "0.0");
+	CHECK_EQ(-fi32s("2.0"), "0.0");
+
+}
+
 BOOST_AUTO_TEST_CASE( saturate_mul )
 {
 	//Directed
@@ -525,6 +541,16 @@ BOOST_AUTO_TEST_CASE( overflowexception_sub )
 
 }
 
+BOOST_AUTO_TEST_CASE( overflowexception_sub_wide )
+{
+
+	typedef Fi::Fixed<16, 8, Fi::UNSIGNED, Fi::Throw> fi16of;
+
+	BOOST_CHECK_THROW(fi16of("1.0") - fi16of("2.0"), Fi::NegativeOverflow);
+	CHECK_EQ(fi16of("3.5") - fi16of("1.25"), "2.25");
+
+}
+
 BOOST_AUTO_TEST_CASE( overflowexception_mul )
 {
 	//Directed
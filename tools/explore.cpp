@@ -0,0 +1,123 @@
+/*
+
+ *Copyright © 2026 Gabi Sarkis.
+
+ *This file is part of the C++ Fixed-Point Library (LibFi).
+
+ *LibFi is free software: you can redistribute it and/or modify
+ *it under the terms of the GNU General Public License as published by
+ *the Free Software Foundation, either version 3 of the License, or
+ *(at your option) any later version.
+
+ *LibFi is distributed in the hope that it will be useful,
+ *but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *GNU General Public License for more details.
+
+ *You should have received a copy of the GNU General Public License
+ *along with LibFi.  If not, see <http://www.gnu.org/licenses/>.
+
+ */
+
+
+
+/*
+ *Word-length exploration of a low-pass FIR filter: runs the filter with
+ *every format of a grid in parallel and prints the Pareto front of word
+ *length versus root mean square error against the double-precision
+ *filter. Usage: explore [threads]
+ */
+
+#include "fi/Explore.hpp"
+#include "fi/overflow/Saturate.hpp"
+#include "fi/rounding/Classic.hpp"
+#include "fi/rounding/Fix.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+const std::size_t TAPS = 15;
+const std::size_t SAMPLES = 4096;
+
+typedef Fi::FormatGrid<8, 20, 4, 18, Fi::SIGNED,
+                       Fi::Saturate, Fi::Classic> classic;
+typedef Fi::FormatGrid<8, 20, 4, 18, Fi::SIGNED,
+                       Fi::Saturate, Fi::Fix> truncated;
+
+struct Filter {
+
+	std::vector<double> taps;
+	std::vector<double> in;
+
+	Filter() : taps(TAPS), in(SAMPLES) {
+
+		//Hamming-windowed sinc with a cutoff of a quarter of the band.
+		const double pi = 3.14159265358979323846;
+		const double c = (TAPS - 1)/2.0;
+		for (std::size_t i = 0; i < TAPS; ++i) {
+			const double t = i - c;
+			const double s = (t == 0) ? 0.25 : std::sin(0.25*pi*t)/(pi*t);
+			taps[i] = s*(0.54 - 0.46*std::cos(2*pi*i/(TAPS - 1)));
+		}
+
+		for (std::size_t i = 0; i < SAMPLES; ++i) {
+			in[i] = 1.8*std::rand()/RAND_MAX - 0.9;
+		}
+
+	}
+
+	template<typename T>
+	static double toDouble(const T& x) {
+		return x.toDouble();
+	}
+
+	static double toDouble(double x) {
+		return x;
+	}
+
+	template<typename T>
+	void filter(std::vector<double>& out) const {
+		std::vector<T> h;
+		std::vector<T> x;
+		for (std::size_t i = 0; i < TAPS; ++i) {
+			h.push_back(T(taps[i]));
+		}
+		for (std::size_t i = 0; i < SAMPLES; ++i) {
+			x.push_back(T(in[i]));
+		}
+		for (std::size_t i = TAPS - 1; i < SAMPLES; ++i) {
+			T acc(0.0);
+			for (std::size_t j = 0; j < TAPS; ++j) {
+				acc += h[j]*x[i - j];
+			}
+			out.push_back(toDouble(acc));
+		}
+	}
+
+	template<typename FixedT>
+	void run(std::vector<double>& out) const {
+		filter<FixedT>(out);
+	}
+
+};
+
+int main(int argc, char* argv[]) {
+
+	const std::size_t threads = (argc > 1) ? std::atoi(argv[1]) : 0;
+
+	Filter f;
+	std::vector<double> reference;
+	f.filter<double>(reference);
+
+	const std::vector<Fi::Exploration> r =
+		Fi::explore< Fi::FormatGrids<classic, truncated> >(f, reference,
+		                                                   threads);
+
+	std::cout << r.size() << " formats, Pareto front:\n";
+	Fi::reportExploration(std::cout, Fi::paretoFront(r));
+
+	return 0;
+
+}
@@ -19,102 +19,106 @@
 
  */
 
-#include <boost/preprocessor/list/for_each_product.hpp>
-#include <boost/preprocessor/tuple/to_seq.hpp>
-#include <boost/preprocessor/seq/cat.hpp>
-#include <boost/preprocessor/cat.hpp>
-#include <boost/preprocessor/stringize.hpp>
-#include <boost/algorithm/string.hpp>
-#include <iostream>
+#include "fi/DynFixed.hpp"
+
+#include <algorithm>
+#include <cctype>
 #include <cstdlib>
+#include <exception>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+
+using namespace Fi;
 
-#include "fi/Fixed.hpp"
-#define OVERFLOW_TYPES  (Wrap, (Saturate, (Throw, (Undefined, BOOST_PP_NIL))))
-#include "fi/overflow/Wrap.hpp"
-#include "fi/overflow/Saturate.hpp"
-#include "fi/overflow/Throw.hpp"
-#include "fi/overflow/Undefined.hpp"
-
-#define ROUNDING_TYPES  (Ceil, (Classic, (Fix, (Floor, BOOST_PP_NIL))))
-#include "fi/rounding/Ceil.hpp"
-#include "fi/rounding/Classic.hpp"
-#include "fi/rounding/Fix.hpp"
-#include "fi/rounding/Floor.hpp"
-
-#define SIGNEDNESS_TYPES  (UNSIGNED, (SIGNED, BOOST_PP_NIL))
-#define W 5
-#define F_VALS (1, (2, (3, (4, BOOST_PP_NIL))))
-
-
-#define MACRO1(r, p) { \
-	typedef Fixed<W, BOOST_PP_TUPLE_ELEM(4,0,p), BOOST_PP_TUPLE_ELEM(4,1,p), \
-	BOOST_PP_TUPLE_ELEM(4,2,p), BOOST_PP_TUPLE_ELEM(4,3,p)> fi_t; \
-	fi_t var; \
-	std::string v_f          = BOOST_PP_STRINGIZE(BOOST_PP_TUPLE_ELEM(4,0,p)); \
-	boost::to_lower(v_f); \
-	std::string v_signedness = BOOST_PP_STRINGIZE(BOOST_PP_TUPLE_ELEM(4,1,p)); \
-	boost::to_lower(v_signedness); \
-	std::string v_overflow   = BOOST_PP_STRINGIZE(BOOST_PP_TUPLE_ELEM(4,2,p)); \
-	boost::to_lower(v_overflow); \
-	std::string v_rounding   = BOOST_PP_STRINGIZE(BOOST_PP_TUPLE_ELEM(4,3,p)); \
-	boost::to_lower(v_rounding); \
-	if ( \
-	     (p_f          == v_f) \
-	     && \
-	     (p_signedness == v_signedness) \
-	     && \
-	     (p_overflow   == v_overflow) \
-	     && \
-	     (p_rounding   == v_rounding) \
-	   ) \
-	{ \
-		var = fi_t(p_val); \
-		std::cout << var << std::endl; \
-		return 0; \
-	} \
+const char* const SIGNEDNESS_NAMES[] = {"signed", "unsigned"};
+const Signedness SIGNEDNESS_TYPES[] = {SIGNED, UNSIGNED};
+
+const char* const OVERFLOW_NAMES[] = {"saturate", "wrap", "throw",
+                                      "undefined", "stickysaturate",
+                                      "stickywrap"};
+const OverflowMode OVERFLOW_TYPES[] = {SATURATE_OVERFLOW, WRAP_OVERFLOW,
+                                       THROW_OVERFLOW, UNDEFINED_OVERFLOW,
+                                       STICKY_SATURATE_OVERFLOW,
+                                       STICKY_WRAP_OVERFLOW};
+
+const char* const ROUNDING_NAMES[] = {"ceil", "classic", "fix", "floor",
+                                      "neareven", "nearodd"};
+const RoundingMode ROUNDING_TYPES[] = {CEIL_ROUNDING, CLASSIC_ROUNDING,
+                                       FIX_ROUNDING, FLOOR_ROUNDING,
+                                       NEAR_EVEN_ROUNDING, NEAR_ODD_ROUNDING};
+
+template<std::size_t N>
+std::string names(const char* const (&list)[N]) {
+	std::string ret = "(";
+	for (std::size_t i = 0; i < N; ++i) {
+		ret += (i == 0) ? "" : ", ";
+		ret += list[i];
+	}
+	return ret + ")";
 }
 
-using namespace Fi;
+//Index of a name in a list, ignoring case.
+template<std::size_t N>
+bool find(const char* const (&list)[N], std::string name, std::size_t& index) {
+	std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+	index = std::find(list, list + N, name) - list;
+	return index < N;
+}
 
 void usage(char *argv0) {
-	std::cout << "LibFi test program with W=" << W << std::endl << std::endl
-	          << "Usage: " << std::string(argv0) << " <f> <signedness> <overflow> <rounding> <value>"
+	std::cout << "LibFi test program" << std::endl << std::endl
+	          << "Usage: " << std::string(argv0)
+	          << " <w> <f> <signedness> <overflow> <rounding> <value>"
 	          << std::endl
 	          << "  Where:" << std::endl
-	          << "    f          : number of fractional bits (1-" << W << ")" << std::endl
-	          << "    signedness : overflow behavior "
-	          << BOOST_PP_STRINGIZE(BOOST_PP_LIST_TO_TUPLE(SIGNEDNESS_TYPES)) << std::endl
-	          << "    overflow   : overflow behavior "
-	          << BOOST_PP_STRINGIZE(BOOST_PP_LIST_TO_TUPLE(OVERFLOW_TYPES)) << std::endl
-	          << "    rounding   : rounding behavior "
-	          << BOOST_PP_STRINGIZE(BOOST_PP_LIST_TO_TUPLE(ROUNDING_TYPES)) << std::endl
+	          << "    w          : word length (1-" << DynFormat::MAX_WORD_LENGTH
+	          << ")" << std::endl
+	          << "    f          : number of fractional bits (0-w)" << std::endl
+	          << "    signedness : signedness " << names(SIGNEDNESS_NAMES)
+	          << std::endl
+	          << "    overflow   : overflow behavior " << names(OVERFLOW_NAMES)
+	          << std::endl
+	          << "    rounding   : rounding behavior " << names(ROUNDING_NAMES)
+	          << std::endl
 	          << "    value      : value to be converted to fixed point"
 	          << std::endl;
 	exit(1);
 }
 
 int main(int argc, char* argv[]) {
-	if (argc < 6) {
+	if (argc < 7) {
 		usage(argv[0]);
 	}
 
 	//command-line parameters
-	std::string p_f          = argv[1];
-	std::string p_signedness = argv[2];
-	std::string p_overflow   = argv[3];
-	std::string p_rounding   = argv[4];
-	std::string p_val        = argv[5];
-
-	boost::to_lower(p_f);
-	boost::to_lower(p_signedness);
-	boost::to_lower(p_overflow);
-	boost::to_lower(p_rounding);
-
-	BOOST_PP_LIST_FOR_EACH_PRODUCT(MACRO1, 4, (F_VALS,SIGNEDNESS_TYPES,OVERFLOW_TYPES,ROUNDING_TYPES))
+	std::size_t p_w          = std::strtoul(argv[1], 0, 10);
+	std::size_t p_f          = std::strtoul(argv[2], 0, 10);
+	std::size_t p_signedness = 0;
+	std::size_t p_overflow   = 0;
+	std::size_t p_rounding   = 0;
+	std::string p_val        = argv[6];
+
+	if (!find(SIGNEDNESS_NAMES, argv[3], p_signedness) ||
+	    !find(OVERFLOW_NAMES, argv[4], p_overflow) ||
+	    !find(ROUNDING_NAMES, argv[5], p_rounding)) {
+		std::cout << "ERROR: Invalid parameter combination" << std::endl;
+		usage(argv[0]);
+	}
 
-	std::cout << "ERROR: Invalid parameter combination" << std::endl;
-	usage(argv[0]);
+	try {
+		DynFormat format(p_w, p_f, SIGNEDNESS_TYPES[p_signedness],
+		                 OVERFLOW_TYPES[p_overflow], ROUNDING_TYPES[p_rounding]);
+		std::cout << DynFixed(format, p_val) << std::endl;
+	}
+	catch (const std::invalid_argument& e) {
+		std::cout << "ERROR: " << e.what() << std::endl;
+		usage(argv[0]);
+	}
+	catch (const std::exception& e) {
+		std::cout << "ERROR: " << e.what() << std::endl;
+		return 1;
+	}
 
 	return 0;
 }
-